@@ -0,0 +1,115 @@
+/**
+ * @file ArenaFrame.cpp
+ * @brief Implémentation de l'arène de tick
+ */
+
+#include "ArenaFrame.h"
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Constructeur
+ */
+ArenaFrame::ArenaFrame()
+    : mPosition(0),
+      mUtilises(0),
+      mPic(0)
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+ArenaFrame::~ArenaFrame()
+{
+    for (unsigned char* bloc : mBlocs)
+        delete[] bloc;
+}
+
+/**
+ * @brief Double la taille du dernier bloc, ou plus si la demande l'exige
+ */
+void ArenaFrame::AjouterBloc(size_t octets)
+{
+    size_t taille = mTailles.empty() ? TAILLE_INITIALE : 2 * mTailles.back();
+    taille = std::max(taille, octets);
+    mBlocs.push_back(new unsigned char[taille]);
+    mTailles.push_back(taille);
+    mPosition = 0;
+}
+
+/**
+ * @brief Incrément de pointeur aligné ; nouveau bloc si le courant est plein
+ */
+void* ArenaFrame::Allouer(size_t octets, size_t alignement)
+{
+    if (!mBlocs.empty())
+    {
+        uintptr_t base = reinterpret_cast<uintptr_t>(mBlocs.back());
+        uintptr_t debut = (base + mPosition + alignement - 1) & ~(static_cast<uintptr_t>(alignement) - 1);
+        size_t fin = static_cast<size_t>(debut - base) + octets;
+        if (fin <= mTailles.back())
+        {
+            mUtilises += fin - mPosition;
+            mPic = std::max(mPic, mUtilises);
+            mPosition = fin;
+            return reinterpret_cast<void*>(debut);
+        }
+    }
+
+    /* new[] aligne pour tout type fondamental ; la marge couvre un alignement plus fort */
+    AjouterBloc(octets + alignement);
+    return Allouer(octets, alignement);
+}
+
+/**
+ * @brief Recule le pointeur si l'allocation rendue est la dernière du bloc courant
+ */
+void ArenaFrame::Rendre(void* p, size_t octets)
+{
+    if (mBlocs.empty())
+        return;
+    unsigned char* octetsRendus = static_cast<unsigned char*>(p);
+    if (octetsRendus + octets == mBlocs.back() + mPosition)
+    {
+        mPosition -= octets;
+        mUtilises -= octets;
+    }
+}
+
+/**
+ * @brief Tout redevient libre ; plusieurs blocs deviennent un seul bloc de leur taille totale
+ */
+void ArenaFrame::Reinitialiser()
+{
+    if (mBlocs.size() > 1)
+    {
+        size_t total = GetCapacite();
+        for (unsigned char* bloc : mBlocs)
+            delete[] bloc;
+        mBlocs.clear();
+        mTailles.clear();
+        AjouterBloc(total);
+    }
+    mPosition = 0;
+    mUtilises = 0;
+}
+
+/**
+ * @brief Somme des tailles des blocs
+ */
+size_t ArenaFrame::GetCapacite() const
+{
+    size_t total = 0;
+    for (size_t taille : mTailles)
+        total += taille;
+    return total;
+}
+
+/**
+ * @brief Plus forte occupation depuis la création
+ */
+size_t ArenaFrame::GetPic() const
+{
+    return mPic;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file ArenaFrame.h
+ * @brief Arène de tick : allocation par incrément de pointeur, tout libéré d'un coup
+ */
+
+#ifndef ARENA_FRAME_H
+#define ARENA_FRAME_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ArenaFrame
+ * @brief Mémoire des données temporaires d'un tick, rendue en bloc au tick suivant
+ *
+ * Allouer avance un pointeur dans le bloc courant ; rien n'est libéré avant
+ * Reinitialiser, qui rend tout d'un coup. Quand le bloc est plein, un bloc
+ * deux fois plus grand est ajouté ; à la réinitialisation suivante, les blocs
+ * sont fondus en un seul de la taille totale. Une fois le pic de la
+ * simulation atteint, un tick n'alloue plus rien au système et ne fragmente
+ * pas le tas.
+ * Non synchronisée : une arène par thread (ici, les phases séquentielles du tick).
+ */
+class ArenaFrame
+{
+private:
+    std::vector<unsigned char*> mBlocs;     /**< Blocs possédés ; le dernier est le courant */
+    std::vector<size_t> mTailles;           /**< Taille de chaque bloc */
+    size_t mPosition;                       /**< Premier octet libre du bloc courant */
+    size_t mUtilises;                       /**< Octets rendus depuis Reinitialiser (alignement compris) */
+    size_t mPic;                            /**< Plus grand mUtilises observé */
+
+    static constexpr size_t TAILLE_INITIALE = 64 * 1024;   /**< Premier bloc (octets) */
+
+    /**
+     * @brief Ajoute un bloc d'au moins octets octets et en fait le bloc courant
+     * @param octets Taille minimale
+     */
+    void AjouterBloc(size_t octets);
+
+public:
+    /**
+     * @brief Constructeur (aucun bloc avant la première allocation)
+     */
+    ArenaFrame();
+
+    /**
+     * @brief Destructeur libérant les blocs
+     */
+    ~ArenaFrame();
+
+    ArenaFrame(const ArenaFrame&) = delete;
+    ArenaFrame& operator=(const ArenaFrame&) = delete;
+
+    /**
+     * @brief Réserve de la mémoire jusqu'à la prochaine réinitialisation
+     * @param octets Taille demandée
+     * @param alignement Alignement voulu (puissance de deux)
+     * @return Mémoire non initialisée
+     */
+    void* Allouer(size_t octets, size_t alignement);
+
+    /**
+     * @brief Rend une allocation ; seule la dernière est réellement reprise
+     * @param p Mémoire rendue par Allouer
+     * @param octets Taille demandée à l'allocation
+     */
+    void Rendre(void* p, size_t octets);
+
+    /**
+     * @brief Oublie toutes les allocations (début de tick) et fond les blocs en un seul
+     */
+    void Reinitialiser();
+
+    /**
+     * @brief Mémoire possédée
+     * @return Octets de tous les blocs
+     */
+    size_t GetCapacite() const;
+
+    /**
+     * @brief Plus forte occupation depuis la création
+     * @return Octets
+     */
+    size_t GetPic() const;
+};
+
+/**
+ * @class AllocateurFrame
+ * @brief Allocateur standard puisant dans une arène de tick
+ * @tparam T Type alloué
+ *
+ * Un conteneur qui l'utilise doit disparaître (ou être vidé par clear puis
+ * shrink_to_fit) avant la réinitialisation de l'arène.
+ */
+template<typename T>
+class AllocateurFrame
+{
+private:
+    ArenaFrame* mArena;     /**< Arène utilisée (non possédée) */
+
+    template<typename U> friend class AllocateurFrame;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Constructeur
+     * @param arena Arène dans laquelle puiser
+     */
+    explicit AllocateurFrame(ArenaFrame& arena) : mArena(&arena) {}
+
+    /**
+     * @brief Conversion depuis l'allocateur d'un autre type (même arène)
+     */
+    template<typename U>
+    AllocateurFrame(const AllocateurFrame<U>& autre) : mArena(autre.mArena) {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(mArena->Allouer(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        mArena->Rendre(p, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const AllocateurFrame<U>& autre) const { return mArena == autre.mArena; }
+
+    template<typename U>
+    bool operator!=(const AllocateurFrame<U>& autre) const { return mArena != autre.mArena; }
+};
+
+/**
+ * @brief Vecteur temporaire d'un tick
+ */
+template<typename T>
+using VecteurFrame = std::vector<T, AllocateurFrame<T>>;
+
+#endif /* ARENA_FRAME_H */
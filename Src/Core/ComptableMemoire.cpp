@@ -0,0 +1,287 @@
+/**
+ * @file ComptableMemoire.cpp
+ * @brief Opérateurs new/delete globaux comptés et relevés par sous-système
+ */
+
+#include "ComptableMemoire.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+std::atomic<bool> ComptableMemoire::sActif(false);
+
+static constexpr uint32_t NON_SUIVI = 0xFFFFFFFFu;     /**< Bloc alloué avant l'activation */
+
+/**
+ * @struct EnTeteBloc
+ * @brief Placé juste devant chaque bloc ; garde l'alignement de malloc pour le bloc qui suit
+ */
+struct alignas(std::max_align_t) EnTeteBloc
+{
+    size_t taille;          /**< Octets demandés */
+    uint32_t sousSysteme;   /**< Sous-système imputé (NON_SUIVI : pas compté) */
+    uint32_t decalage;      /**< Octets entre le bloc de malloc et l'en-tête (formes alignées) */
+};
+
+/**
+ * @struct CompteurAtomique
+ * @brief Compteur d'un sous-système, incrémenté par tous les threads
+ */
+struct CompteurAtomique
+{
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> octets;
+    std::atomic<int64_t> vivants;
+    std::atomic<int64_t> pic;
+};
+
+/* Initialisés à zéro avant tout constructeur statique : new peut servir avant main */
+static CompteurAtomique sCompteurs[NB_SOUS_SYSTEMES];
+static thread_local SousSysteme tSousSysteme = MEMOIRE_AUTRE;
+
+/**
+ * @brief Alloue le bloc et son en-tête, en appelant le gestionnaire new_handler tant qu'il y en a un
+ * @param taille Octets demandés
+ * @param alignement Alignement du bloc (puissance de 2)
+ * @return Bloc utilisateur, nullptr si la mémoire manque
+ */
+static void* AllouerCompte(size_t taille, size_t alignement = alignof(EnTeteBloc))
+{
+    /* Au-delà de l'alignement de malloc, une marge permet de décaler le bloc */
+    size_t marge = (alignement > alignof(EnTeteBloc)) ? alignement : 0;
+
+    void* brut;
+    while (!(brut = malloc(sizeof(EnTeteBloc) + marge + taille)))
+    {
+        std::new_handler gestionnaire = std::get_new_handler();
+        if (!gestionnaire)
+            return nullptr;
+        gestionnaire();
+    }
+
+    uintptr_t debut = reinterpret_cast<uintptr_t>(brut) + sizeof(EnTeteBloc);
+    uintptr_t aligne = (debut + alignement - 1) & ~static_cast<uintptr_t>(alignement - 1);
+    EnTeteBloc* entete = reinterpret_cast<EnTeteBloc*>(aligne) - 1;
+    entete->taille = taille;
+    entete->sousSysteme = NON_SUIVI;
+    entete->decalage = static_cast<uint32_t>(aligne - debut);
+
+    if (ComptableMemoire::EstActif())
+    {
+        CompteurAtomique& compteur = sCompteurs[tSousSysteme];
+        entete->sousSysteme = tSousSysteme;
+        compteur.allocations.fetch_add(1, std::memory_order_relaxed);
+        compteur.octets.fetch_add(taille, std::memory_order_relaxed);
+        int64_t vivants = compteur.vivants.fetch_add(static_cast<int64_t>(taille), std::memory_order_relaxed)
+                          + static_cast<int64_t>(taille);
+        int64_t pic = compteur.pic.load(std::memory_order_relaxed);
+        while (vivants > pic && !compteur.pic.compare_exchange_weak(pic, vivants, std::memory_order_relaxed))
+        {
+        }
+    }
+    return entete + 1;
+}
+
+/**
+ * @brief Décompte le bloc dans le sous-système qui l'a alloué, puis le libère
+ * @param bloc Bloc utilisateur (nullptr accepté)
+ */
+static void LibererCompte(void* bloc)
+{
+    if (!bloc)
+        return;
+
+    /* Décompté même après la fin du comptage : vivants reste juste */
+    EnTeteBloc* entete = static_cast<EnTeteBloc*>(bloc) - 1;
+    if (entete->sousSysteme != NON_SUIVI)
+        sCompteurs[entete->sousSysteme].vivants.fetch_sub(static_cast<int64_t>(entete->taille),
+                                                          std::memory_order_relaxed);
+    free(reinterpret_cast<char*>(entete) - entete->decalage);
+}
+
+/**
+ * @brief Active le comptage pour tous les threads
+ */
+void ComptableMemoire::Activer()
+{
+    sActif = true;
+}
+
+/**
+ * @brief Sous-système courant du thread
+ */
+SousSysteme ComptableMemoire::GetSousSysteme()
+{
+    return tSousSysteme;
+}
+
+/**
+ * @brief Change le sous-système du thread et rend l'ancien
+ */
+SousSysteme ComptableMemoire::Entrer(SousSysteme sousSysteme)
+{
+    SousSysteme precedent = tSousSysteme;
+    tSousSysteme = sousSysteme;
+    return precedent;
+}
+
+/**
+ * @brief Copie les compteurs atomiques
+ */
+void ComptableMemoire::Relever(ReleveMemoire& releve)
+{
+    for (int i = 0; i < NB_SOUS_SYSTEMES; i++)
+    {
+        releve.compteurs[i].allocations = sCompteurs[i].allocations.load(std::memory_order_relaxed);
+        releve.compteurs[i].octets = sCompteurs[i].octets.load(std::memory_order_relaxed);
+        releve.compteurs[i].vivants = sCompteurs[i].vivants.load(std::memory_order_relaxed);
+        releve.compteurs[i].pic = sCompteurs[i].pic.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Nom affiché dans les bilans
+ */
+const char* ComptableMemoire::GetNom(SousSysteme sousSysteme)
+{
+    switch (sousSysteme)
+    {
+        case MEMOIRE_POPULATION: return "Population";
+        case MEMOIRE_PLANTES:    return "Plantes";
+        case MEMOIRE_INTERFACE:  return "Interface";
+        case MEMOIRE_RENDU:      return "Rendu";
+        case MEMOIRE_RESSOURCES: return "Ressources";
+        default:                 return "Autre";
+    }
+}
+
+/**
+ * @brief Somme des compteurs de tous les sous-systèmes
+ */
+CompteurMemoire ReleveMemoire::Total() const
+{
+    CompteurMemoire total = {0, 0, 0, 0};
+    for (int i = 0; i < NB_SOUS_SYSTEMES; i++)
+    {
+        total.allocations += compteurs[i].allocations;
+        total.octets += compteurs[i].octets;
+        total.vivants += compteurs[i].vivants;
+        total.pic += compteurs[i].pic;
+    }
+    return total;
+}
+
+/* Opérateurs globaux : toutes les formes, alignées comprises, passent par le compte */
+
+void* operator new(size_t taille)
+{
+    void* bloc = AllouerCompte(taille);
+    if (!bloc)
+        throw std::bad_alloc();
+    return bloc;
+}
+
+void* operator new[](size_t taille)
+{
+    void* bloc = AllouerCompte(taille);
+    if (!bloc)
+        throw std::bad_alloc();
+    return bloc;
+}
+
+void* operator new(size_t taille, const std::nothrow_t&) noexcept
+{
+    return AllouerCompte(taille);
+}
+
+void* operator new[](size_t taille, const std::nothrow_t&) noexcept
+{
+    return AllouerCompte(taille);
+}
+
+void operator delete(void* bloc) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete(void* bloc, size_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc, size_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete(void* bloc, const std::nothrow_t&) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc, const std::nothrow_t&) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void* operator new(size_t taille, std::align_val_t alignement)
+{
+    void* bloc = AllouerCompte(taille, static_cast<size_t>(alignement));
+    if (!bloc)
+        throw std::bad_alloc();
+    return bloc;
+}
+
+void* operator new[](size_t taille, std::align_val_t alignement)
+{
+    void* bloc = AllouerCompte(taille, static_cast<size_t>(alignement));
+    if (!bloc)
+        throw std::bad_alloc();
+    return bloc;
+}
+
+void* operator new(size_t taille, std::align_val_t alignement, const std::nothrow_t&) noexcept
+{
+    return AllouerCompte(taille, static_cast<size_t>(alignement));
+}
+
+void* operator new[](size_t taille, std::align_val_t alignement, const std::nothrow_t&) noexcept
+{
+    return AllouerCompte(taille, static_cast<size_t>(alignement));
+}
+
+void operator delete(void* bloc, std::align_val_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc, std::align_val_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete(void* bloc, size_t, std::align_val_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc, size_t, std::align_val_t) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete(void* bloc, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    LibererCompte(bloc);
+}
+
+void operator delete[](void* bloc, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    LibererCompte(bloc);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file ComptableMemoire.h
+ * @brief Comptage des allocations et de la mémoire tenue par sous-système
+ */
+
+#ifndef COMPTABLE_MEMOIRE_H
+#define COMPTABLE_MEMOIRE_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @enum SousSysteme
+ * @brief Sous-système auquel une allocation est imputée
+ */
+enum SousSysteme
+{
+    MEMOIRE_AUTRE = 0,      /**< Hors de toute zone */
+    MEMOIRE_POPULATION,     /**< Animaux, grilles, tuiles, roue */
+    MEMOIRE_PLANTES,        /**< Plantes et leur suivi */
+    MEMOIRE_INTERFACE,      /**< Menus, historiques des courbes */
+    MEMOIRE_RENDU,          /**< Caméra, carte de densité, enregistrement */
+    MEMOIRE_RESSOURCES,     /**< Textures et fichiers chargés */
+    NB_SOUS_SYSTEMES
+};
+
+/**
+ * @struct CompteurMemoire
+ * @brief Allocations d'un sous-système depuis l'activation
+ */
+struct CompteurMemoire
+{
+    uint64_t allocations;   /**< Nombre de new */
+    uint64_t octets;        /**< Octets demandés par ces new */
+    int64_t vivants;        /**< Octets alloués et pas encore libérés */
+    int64_t pic;            /**< Maximum atteint par vivants */
+};
+
+/**
+ * @struct ReleveMemoire
+ * @brief Instantané des compteurs de tous les sous-systèmes
+ */
+struct ReleveMemoire
+{
+    CompteurMemoire compteurs[NB_SOUS_SYSTEMES];    /**< Un compteur par sous-système */
+
+    /**
+     * @brief Additionne les sous-systèmes
+     * @return Compteur total (pic : somme des pics)
+     */
+    CompteurMemoire Total() const;
+};
+
+/**
+ * @class ComptableMemoire
+ * @brief Compte les new/delete du programme, imputés au sous-système du thread appelant
+ *
+ * Les opérateurs new et delete globaux sont remplacés : chaque bloc porte un
+ * en-tête (taille, sous-système) qui permet de décompter la libération,
+ * même d'un autre thread ou d'une autre zone. Avant Activer, ou sans
+ * activation, seul un booléen est lu à chaque new. Les allocations de SDL et
+ * d'ImGui passent par malloc et ne sont pas vues.
+ *
+ * Le sous-système courant est propre à chaque thread ; les threads du pool
+ * prennent celui du thread qui a lancé le lot.
+ */
+class ComptableMemoire
+{
+private:
+    static std::atomic<bool> sActif;    /**< Comptage en cours */
+
+public:
+    /**
+     * @brief Commence à compter : seuls les blocs alloués ensuite sont suivis
+     */
+    static void Activer();
+
+    /**
+     * @brief Indique si le comptage est en cours
+     * @return true après Activer
+     */
+    static bool EstActif() { return sActif.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Sous-système courant du thread appelant
+     * @return Sous-système des prochains new
+     */
+    static SousSysteme GetSousSysteme();
+
+    /**
+     * @brief Change le sous-système courant du thread appelant
+     * @param sousSysteme Sous-système des prochains new
+     * @return Sous-système précédent
+     */
+    static SousSysteme Entrer(SousSysteme sousSysteme);
+
+    /**
+     * @brief Lit les compteurs de tous les sous-systèmes
+     * @param releve Instantané rempli (chaque compteur est lu sans verrou)
+     */
+    static void Relever(ReleveMemoire& releve);
+
+    /**
+     * @brief Nom affichable d'un sous-système
+     * @param sousSysteme Sous-système
+     * @return Nom court
+     */
+    static const char* GetNom(SousSysteme sousSysteme);
+};
+
+/**
+ * @class ZoneMemoire
+ * @brief Impute les new de sa portée à un sous-système, puis rétablit le précédent
+ */
+class ZoneMemoire
+{
+private:
+    SousSysteme mPrecedent;     /**< Sous-système rétabli à la sortie */
+
+public:
+    /**
+     * @brief Entre dans la zone
+     * @param sousSysteme Sous-système des new de la portée
+     */
+    explicit ZoneMemoire(SousSysteme sousSysteme) : mPrecedent(ComptableMemoire::Entrer(sousSysteme)) {}
+
+    /**
+     * @brief Rétablit le sous-système précédent
+     */
+    ~ZoneMemoire() { ComptableMemoire::Entrer(mPrecedent); }
+
+    ZoneMemoire(const ZoneMemoire&) = delete;
+    ZoneMemoire& operator=(const ZoneMemoire&) = delete;
+};
+
+#endif /* COMPTABLE_MEMOIRE_H */
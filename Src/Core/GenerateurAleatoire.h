@@ -0,0 +1,95 @@
+/**
+ * @file GenerateurAleatoire.h
+ * @brief Générateur pseudo-aléatoire léger, un flux indépendant par tranche de travail
+ */
+
+#ifndef GENERATEUR_ALEATOIRE_H
+#define GENERATEUR_ALEATOIRE_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class GenerateurAleatoire
+ * @brief xorshift64* dont l'état initial est mélangé par splitmix64
+ *
+ * Contrairement à rand(), chaque générateur a son propre état : plusieurs
+ * threads tirent en même temps sans se gêner. Deux flux d'une même graine
+ * (numéros différents) sont décorrélés, et le résultat d'une tranche ne
+ * dépend que de (graine, flux), pas du thread qui l'exécute.
+ */
+class GenerateurAleatoire
+{
+private:
+    uint64_t mEtat;     /**< État courant (jamais nul) */
+
+public:
+    /**
+     * @brief Initialise le flux numéro flux de la graine
+     * @param graine Graine commune aux flux
+     * @param flux Numéro du flux (de la tranche)
+     */
+    GenerateurAleatoire(uint64_t graine, uint64_t flux = 0)
+    {
+        uint64_t z = graine + (flux + 1) * 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        mEtat = z ? z : 0x2545F4914F6CDD1Dull;
+    }
+
+    /**
+     * @brief Tire 32 bits
+     * @return Entier uniforme sur 32 bits
+     */
+    uint32_t Suivant()
+    {
+        mEtat ^= mEtat >> 12;
+        mEtat ^= mEtat << 25;
+        mEtat ^= mEtat >> 27;
+        return static_cast<uint32_t>((mEtat * 0x2545F4914F6CDD1Dull) >> 32);
+    }
+
+    /**
+     * @brief Tire un réel dans [0, 1[
+     * @return Réel uniforme
+     */
+    float Reel()
+    {
+        return (Suivant() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * @brief Tire un réel dans [min, max[
+     * @param min Borne basse
+     * @param max Borne haute (exclue)
+     * @return Réel uniforme
+     */
+    float Entre(float min, float max)
+    {
+        return min + (max - min) * Reel();
+    }
+
+    /**
+     * @brief Tire un entier dans [0, n[
+     * @param n Nombre de valeurs (> 0)
+     * @return Entier uniforme
+     */
+    int Entier(int n)
+    {
+        return static_cast<int>((static_cast<uint64_t>(Suivant()) * static_cast<uint32_t>(n)) >> 32);
+    }
+
+    /**
+     * @brief Tire selon la loi normale centrée réduite (Box-Muller)
+     * @return Réel gaussien
+     */
+    float Normale()
+    {
+        float u = 1.0f - Reel();    /* ]0, 1] : le logarithme reste fini */
+        float v = Reel();
+        return std::sqrt(-2.0f * std::log(u)) * std::cos(6.28318531f * v);
+    }
+};
+
+#endif /* GENERATEUR_ALEATOIRE_H */
@@ -1,432 +1,707 @@
-/*
- * @file Main.cpp
- * @brief Point d'entrée du programme de simulation écosystème
- */
-
-#include "../UI/GUI.h"
-#include "../Graphics/Renderer.h"
-#include "../Population/Ecosysteme.h"
-#include "../Population/Proie.h"
-#include "../Population/Predateur.h"
-#include "../Population/Plante.h"
-#include "../Population/Animal.h"
-#include <iostream>
-#include <cstdlib>
-#include <ctime>
-
-int main(int argc, char* argv[])
-{
-    srand(static_cast<unsigned int>(time(nullptr)));
-    
-    std::cout << "=== Démarrage Simulation Écosystème ===" << std::endl;
-    
-    /* Initialiser le renderer */
-    Renderer renderer;
-    
-    if (!renderer.Initialiser())
-    {
-        std::cerr << "❌ Échec initialisation SDL" << std::endl;
-        return -1;
-    }
-    
-    std::cout << "✅ SDL initialisé" << std::endl;
-
-    /* Initialiser GUI */
-    GUI gui;
-    gui.Initialize(renderer.ObtenirFenetre(), renderer.ObtenirRenderer());
-
-    std::cout << "✅ GUI initialisée" << std::endl;
-
-    /* Menu de configuration initial */
-    ConfigEcosysteme config = gui.AfficherMenuConfiguration(WINDOW_WIDTH, WINDOW_HEIGHT);
-
-    if (!config.pret)
-    {
-        gui.Destroy();
-        renderer.Nettoyer();
-        return 0;
-    }
-
-    /* Créer l'écosystème avec la config */
-    Ecosysteme* eco = new Ecosysteme(config.nbProies, config.nbPredateurs, 
-                                      config.nbPlantes, WINDOW_WIDTH, WINDOW_HEIGHT);
-    eco->SetDelaiPlantes(config.delaiPlantes);
-
-    /* DÉCLARER TOUTES LES TEXTURES AVANT LE SWITCH */
-    SDL_Texture* textureFond = nullptr;
-    SDL_Texture* textureFondJour = nullptr;
-    SDL_Texture* textureFondNuit = nullptr;
-    SDL_Texture* texturePlante = nullptr;
-    
-    /* Textures Loup */
-    SDL_Texture* textureLoup1 = nullptr;
-    SDL_Texture* textureLoup1_left = nullptr;
-    SDL_Texture* textureLoup2 = nullptr;
-    SDL_Texture* textureLoup2_left = nullptr;
-    SDL_Texture* textureLoup3 = nullptr;
-    SDL_Texture* textureLoup3_left = nullptr;
-    
-    /* Textures Lapin */
-    SDL_Texture* textureLapin1 = nullptr;
-    SDL_Texture* textureLapin1_left = nullptr;
-    SDL_Texture* textureLapin2 = nullptr;
-    SDL_Texture* textureLapin2_left = nullptr;
-    SDL_Texture* textureLapin3 = nullptr;
-    SDL_Texture* textureLapin3_left = nullptr;
-
-    /* Textures Requin */
-    SDL_Texture* textureRequin = nullptr;
-    SDL_Texture* textureRequin_left = nullptr;
-
-    /* Textures Poisson */
-    SDL_Texture* texturePoisson = nullptr;
-    SDL_Texture* texturePoisson_left = nullptr;
-    
-    /* Variables pour l'animation */
-    int frameAnimLoup = 0;      // 0, 1, 2 pour Frame1, Frame2, Frame3
-    int frameAnimLapin = 0;     // 0, 1, 2 pour Frame1, Frame2, Frame3
-    int compteurFrames = 0;     // Pour ralentir l'animation
-    
-    /* Variables pour le cycle jour/nuit */
-    float tempsEcouleJourNuit = 0.0f;
-    const float DUREE_DEMI_CYCLE = 30.0f;  // 30 secondes par phase
-    bool estJour = true;
-    
-    /* Charger les textures selon le type d'écosystème */
-    switch (config.typeEcosysteme)
-    {
-    case 0:  // 🌲 Forêt
-        std::cout << "🌲 Chargement textures Forêt..." << std::endl;
-        
-        /* Fond jour et nuit */
-        textureFondJour = renderer.ChargerTexture("Assets/Img/Background/Foret_Jour.jpeg");
-        textureFondNuit = renderer.ChargerTexture("Assets/Img/Background/Foret_Nuit.jpeg");
-        textureFond = textureFondJour;  // Commencer par le jour
-        
-        texturePlante = renderer.ChargerTexture("Assets/Img/Plantes/REMOVE/Herbe.png");
-        
-        /* Loup Frame 1 */
-        textureLoup1 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame1.png");
-        textureLoup1_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame1_Left.png");
-        
-        /* Loup Frame 2 */
-        textureLoup2 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame2.png");
-        textureLoup2_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame2_Left.png");
-        
-        /* Loup Frame 3 */
-        textureLoup3 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame3.png");
-        textureLoup3_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame3_Left.png");
-                
-        /* Lapin Frame 1 */
-        textureLapin1 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame1.png");
-        textureLapin1_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame1_Left.png");
-        
-        /* Lapin Frame 2 */
-        textureLapin2 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame2.png");
-        textureLapin2_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame2_Left.png");
-
-        /* Lapin Frame 3 */
-        textureLapin3 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame3.png");
-        textureLapin3_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame3_Left.png");
-        
-        /* Vérification */
-        if (!textureFondJour || !textureFondNuit || !texturePlante || 
-            !textureLoup1 || !textureLoup1_left || 
-            !textureLoup2 || !textureLoup2_left ||
-            !textureLoup3 || !textureLoup3_left ||
-            !textureLapin1 || !textureLapin1_left ||
-            !textureLapin2 || !textureLapin2_left ||
-            !textureLapin3 || !textureLapin3_left)
-        {
-            std::cerr << "❌ Erreur chargement textures Forêt" << std::endl;
-            gui.Destroy();
-            renderer.Nettoyer();
-            return -1;
-        }
-        
-        std::cout << "✅ Textures Forêt chargées (Loup: 3 frames, Lapin: 3 frames, Jour+Nuit)" << std::endl;
-        break;
-        
-    case 1:  // 🌊 Océan
-        std::cout << "🌊 Chargement textures Maritime..." << std::endl;
-        
-        /* Fond jour et nuit */
-        textureFondJour = renderer.ChargerTexture("Assets/Img/Background/Maritime_Jour.jpeg");
-        textureFondNuit = renderer.ChargerTexture("Assets/Img/Background/Maritime_Nuit.jpeg");
-        textureFond = textureFondJour;  // Commencer par le jour
-        
-        texturePlante = renderer.ChargerTexture("Assets/Img/Plantes/REMOVE/Algue.png");
-        
-        /* Requin */
-        textureRequin = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Requin.png");
-        textureRequin_left = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Requin_left.png");
-
-        /* Poisson */
-        texturePoisson = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Poisson.png");
-        texturePoisson_left = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Poisson_left.png");
-        
-        /* Vérification */
-        if (!textureFondJour || !textureFondNuit || !texturePlante ||
-            !textureRequin || !textureRequin_left ||
-            !texturePoisson || !texturePoisson_left)
-        {
-            std::cerr << "❌ Erreur chargement textures Maritime" << std::endl;
-            gui.Destroy();
-            renderer.Nettoyer();
-            return -1;
-        }
-        
-        std::cout << "✅ Textures Maritime chargées (Jour+Nuit)" << std::endl;
-        break;
-        
-    case 2:  // ✈️ Air
-        std::cout << "✈️ Chargement textures Aérienne..." << std::endl;
-        // À compléter plus tard
-        break;
-        
-    default:
-        std::cerr << "❌ Type d'écosystème invalide" << std::endl;
-        gui.Destroy();
-        renderer.Nettoyer();
-        return -1;
-    }
-
-    std::cout << "✅ Écosystème créé : Type=" << config.typeEcosysteme 
-              << ", Proies=" << config.nbProies 
-              << ", Prédateurs=" << config.nbPredateurs << std::endl;
-
-    /* Paramètres du panneau de controle */
-    int nb_proies = config.nbProies;
-    int nb_preds = config.nbPredateurs;
-    int nb_plantes = config.nbPlantes;
-    int nb_plantes_conso = config.nbPlantesConso;
-    float DelaiPlantes = config.delaiPlantes;
-    bool enPause = false;
-    bool relancer = false;
-    
-    /* Variables de la boucle de jeu */
-    bool enCours = true;
-    SDL_Event event;
-    Uint64 dernierTemps = SDL_GetTicks();
-    int frameCount = 0;
-    
-    std::cout << "\n🎮 Simulation lancée ! Fermez la fenêtre pour quitter.\n" << std::endl;
-    
-    /* Boucle principale */
-    while (enCours)
-    {
-        /* Gérer les événements */
-        while (SDL_PollEvent(&event))
-        {
-            ImGui_ImplSDL3_ProcessEvent(&event);
-            if (event.type == SDL_EVENT_QUIT)
-            {
-                enCours = false;
-            }
-        }
-        
-        /* Calculer deltaTime */
-        Uint64 tempsActuel = SDL_GetTicks();
-        float deltaTime = enPause ? 0.0 : (tempsActuel - dernierTemps) / 1000.0f;
-        dernierTemps = tempsActuel;
-        
-        /* Nouveau Frame GUI */
-        gui.DebutFrame();
-        
-        /* Mettre à jour la simulation */
-        eco->Update(deltaTime);
-        
-        /* CYCLE JOUR/NUIT */
-        if (!enPause)
-        {
-            tempsEcouleJourNuit += deltaTime;
-            
-            // Vérifier si on doit basculer
-            if (tempsEcouleJourNuit >= DUREE_DEMI_CYCLE)
-            {
-                tempsEcouleJourNuit = 0.0f;
-                estJour = !estJour;
-                
-                // Basculer le fond
-                if (estJour)
-                {
-                    textureFond = textureFondJour;
-                    std::cout << "🌞 Lever du jour !" << std::endl;
-                }
-                else
-                {
-                    textureFond = textureFondNuit;
-                    std::cout << "🌙 Tombée de la nuit !" << std::endl;
-                }
-            }
-        }
-        
-        /* ANIMATION - Changer de frame toutes les 10 frames SDL */
-        compteurFrames++;
-        if (compteurFrames >= 10)
-        {
-            compteurFrames = 0;
-            
-            /* Loup : cycle 0 → 1 → 2 → 0 */
-            frameAnimLoup = (frameAnimLoup + 1) % 3;
-            
-            /* Lapin : cycle 0 → 1 → 2 → 0 */
-            frameAnimLapin = (frameAnimLapin + 1) % 3;
-        }
-        
-        /* Interface GUI */
-        gui.AfficherPanneauControle(nb_proies, nb_preds, nb_plantes, nb_plantes_conso,
-                             DelaiPlantes, enPause, enCours, relancer, WINDOW_WIDTH);
-
-        gui.AfficherStatistiques(eco->GetNombreProies(), eco->GetNombrePredateurs(),
-                                  eco->GetNombrePlantes(), eco->GetTotalPlantesConsommees());
-
-        if (relancer)
-        {
-            delete eco;
-            eco = new Ecosysteme(nb_proies, nb_preds, nb_plantes, WINDOW_WIDTH, WINDOW_HEIGHT);
-            eco->SetDelaiPlantes(DelaiPlantes);
-            std::cout << "Ecosysteme relancé !" << std::endl;
-            relancer = false;
-            
-            // Réinitialiser le cycle jour/nuit
-            tempsEcouleJourNuit = 0.0f;
-            estJour = true;
-            textureFond = textureFondJour;
-        }
-        
-        /* Dessiner */
-        renderer.EffacerEcran();
-        
-        /* 1. Fond (celui qui est actif) */
-        renderer.DessinerTexture(textureFond, 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
-        
-        /* 2. Plantes */
-        for (auto* plante : eco->GetPlantes())
-        {
-            if (plante->EstDisponible())
-            {
-                renderer.DessinerTexture(texturePlante, 
-                                        static_cast<int>(plante->GetX()), 
-                                        static_cast<int>(plante->GetY()), 
-                                        35, 35);
-            }
-        }
-        
-        /* 3. Proies avec animation */
-        for (auto* proie : eco->GetProies())
-        {
-            SDL_Texture* textureActuelle = nullptr;
-            
-            /* Déterminer la direction selon la vitesse */
-            bool versGauche = (proie->GetDirection() < 0);
-            
-            switch (config.typeEcosysteme)
-            {
-                case 0:  // Forêt
-                    /* Choisir la frame selon l'animation ET la direction */
-                    if (frameAnimLapin == 0)
-                        textureActuelle = versGauche ? textureLapin1_left : textureLapin1;
-                    else if (frameAnimLapin == 1)
-                        textureActuelle = versGauche ? textureLapin2_left : textureLapin2;
-                    else
-                        textureActuelle = versGauche ? textureLapin3_left : textureLapin3;
-                    break;
-                    
-                case 1:  // Maritime
-                    textureActuelle = versGauche ? texturePoisson_left : texturePoisson;
-                    break;
-                    
-                case 2:  // Aérien
-                    // Prochainement
-                    break;
-            }
-            
-            renderer.DessinerTexture(textureActuelle,
-                                    static_cast<int>(proie->GetX()),
-                                    static_cast<int>(proie->GetY()),
-                                    35, 35);
-        }
-        
-        /* 4. Prédateurs avec animation */
-        for (auto* pred : eco->GetPredateurs())
-        {
-            SDL_Texture* textureActuelle = nullptr;
-            
-            /* Déterminer la direction selon la vitesse */
-            bool versGauche = (pred->GetDirection() < 0);
-
-            switch (config.typeEcosysteme)
-            {
-                case 0:  // Forêt
-                    /* Choisir la frame selon l'animation ET la direction */
-                    if (frameAnimLoup == 0)
-                        textureActuelle = versGauche ? textureLoup1_left : textureLoup1;
-                    else if (frameAnimLoup == 1)
-                        textureActuelle = versGauche ? textureLoup2_left : textureLoup2;
-                    else
-                        textureActuelle = versGauche ? textureLoup3_left : textureLoup3;
-                    break;
-                    
-                case 1:  // Maritime
-                    textureActuelle = versGauche ? textureRequin_left : textureRequin;
-                    break;
-                    
-                case 2:  // Aérien
-                    // Prochainement
-                    break;
-            }
-            
-            renderer.DessinerTexture(textureActuelle,
-                                    static_cast<int>(pred->GetX()),
-                                    static_cast<int>(pred->GetY()),
-                                    60, 60);
-        }
-
-        /* Rendre GUI */
-        gui.FinFrame(renderer.ObtenirRenderer());
-        
-        /* Afficher à l'écran */
-        renderer.Afficher();
-
-        /* Statistiques console */
-        frameCount++;
-        
-        /* Limiter à ~60 FPS */
-        SDL_Delay(16);
-    }
-    
-    /* Nettoyage */
-    delete eco;
-    
-    SDL_DestroyTexture(textureFondJour);
-    SDL_DestroyTexture(textureFondNuit);
-    SDL_DestroyTexture(texturePlante);
-    SDL_DestroyTexture(textureLoup1);
-    SDL_DestroyTexture(textureLoup1_left);
-    SDL_DestroyTexture(textureLoup2);
-    SDL_DestroyTexture(textureLoup2_left);
-    SDL_DestroyTexture(textureLoup3);
-    SDL_DestroyTexture(textureLoup3_left);
-    SDL_DestroyTexture(textureLapin1);
-    SDL_DestroyTexture(textureLapin1_left);
-    SDL_DestroyTexture(textureLapin2);
-    SDL_DestroyTexture(textureLapin2_left);
-    SDL_DestroyTexture(textureLapin3);
-    SDL_DestroyTexture(textureLapin3_left);
-    SDL_DestroyTexture(texturePoisson);
-    SDL_DestroyTexture(texturePoisson_left);
-    SDL_DestroyTexture(textureRequin);
-    SDL_DestroyTexture(textureRequin_left);
-
-    Uint64 tempsFinal = SDL_GetTicks();
-    std::cout << "La simulation a duré : " << (tempsFinal - dernierTemps) / 1000.0f << " secondes" << std::endl;
-    std::cout << "Nombre de Frames : " << frameCount << std::endl;
-
-    gui.Destroy();
-    renderer.Nettoyer();
-    
-    std::cout << "\n✅ Programme terminé proprement" << std::endl;
-    
-    return 0;
-}
+/*
+ * @file Main.cpp
+ * @brief Point d'entrée du programme de simulation écosystème
+ */
+
+#include "ComptableMemoire.h"
+#include "OptionsLancement.h"
+#include "PoolThreads.h"
+#include "RoueTemporisation.h"
+#include "SimulationSansAffichage.h"
+#include "ThreadSimulation.h"
+#include "Traceur.h"
+#include "../UI/GUI.h"
+#include "../Graphics/Renderer.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/CarteDensite.h"
+#include "../Graphics/Enregistreur.h"
+#include "../Population/ChampVegetation.h"
+#include "../Population/Ecosysteme.h"
+#include "../Population/InstantaneRendu.h"
+#include "../Population/PolitiqueEspece.h"
+#include "../Population/RegistreEspeces.h"
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    OptionsLancement options;
+    if (!LireOptions(argc, argv, options))
+        return 1;
+
+    /* Toute option de simulation lance le mode console, sans SDL */
+    if (options.sansAffichage)
+        return ExecuterSansAffichage(options);
+
+    /* Chaque relance repeuple avec la graine suivante */
+    const unsigned int graine = static_cast<unsigned int>(time(nullptr));
+    unsigned int nbRelances = 0;
+    srand(graine);
+    
+    std::cout << "=== Démarrage Simulation Écosystème ===" << std::endl;
+    
+    /* Initialiser le renderer */
+    Renderer renderer;
+    
+    if (!renderer.Initialiser())
+    {
+        std::cerr << "❌ Échec initialisation SDL" << std::endl;
+        return -1;
+    }
+    
+    std::cout << "✅ SDL initialisé" << std::endl;
+
+    /* Initialiser GUI */
+    GUI gui;
+    gui.Initialize(renderer.ObtenirFenetre(), renderer.ObtenirRenderer());
+
+    std::cout << "✅ GUI initialisée" << std::endl;
+
+    /* Menu de configuration initial */
+    ConfigEcosysteme config = gui.AfficherMenuConfiguration(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+    if (!config.pret)
+    {
+        gui.Destroy();
+        renderer.Nettoyer();
+        return 0;
+    }
+
+    /* Seuls les blocs alloués à partir d'ici sont comptés */
+    if (config.memoire)
+        ComptableMemoire::Activer();
+
+    /* Un seul système de tâches pour la simulation, la carte de densité et l'encodage */
+    PoolThreads taches(std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+
+    /* En aérien, les animaux viennent tous du fichier d'espèces : pas de
+       proies ni de prédateurs classiques. */
+    bool especesFichier = (config.typeEcosysteme == 2);
+    RepartitionInitiale repartition(static_cast<TypeRepartition>(config.repartition),
+                                    static_cast<unsigned int>(rand()));
+
+    /* Caméra : vue d'ensemble du monde au démarrage */
+    Camera camera;
+    int largeurVue = WINDOW_WIDTH;
+    int hauteurVue = WINDOW_HEIGHT;
+    renderer.ObtenirTailleSortie(largeurVue, hauteurVue);
+    camera.DefinirMonde(config.largeurMonde, config.hauteurMonde);
+    camera.DefinirTailleVue(largeurVue, hauteurVue);
+    camera.Recentrer();
+
+    /* Indices des entités visibles dans l'instantané, réutilisés d'une frame à l'autre */
+    std::vector<uint32_t> proiesVisibles;
+    std::vector<uint32_t> predateursVisibles;
+    std::vector<uint32_t> plantesVisibles;
+
+    /* DÉCLARER TOUTES LES TEXTURES AVANT LE SWITCH */
+    SDL_Texture* textureFond = nullptr;
+    SDL_Texture* textureFondJour = nullptr;
+    SDL_Texture* textureFondNuit = nullptr;
+    SDL_Texture* texturePlante = nullptr;
+    
+    /* Textures Loup */
+    SDL_Texture* textureLoup1 = nullptr;
+    SDL_Texture* textureLoup1_left = nullptr;
+    SDL_Texture* textureLoup2 = nullptr;
+    SDL_Texture* textureLoup2_left = nullptr;
+    SDL_Texture* textureLoup3 = nullptr;
+    SDL_Texture* textureLoup3_left = nullptr;
+    
+    /* Textures Lapin */
+    SDL_Texture* textureLapin1 = nullptr;
+    SDL_Texture* textureLapin1_left = nullptr;
+    SDL_Texture* textureLapin2 = nullptr;
+    SDL_Texture* textureLapin2_left = nullptr;
+    SDL_Texture* textureLapin3 = nullptr;
+    SDL_Texture* textureLapin3_left = nullptr;
+
+    /* Textures Requin */
+    SDL_Texture* textureRequin = nullptr;
+    SDL_Texture* textureRequin_left = nullptr;
+
+    /* Textures Poisson */
+    SDL_Texture* texturePoisson = nullptr;
+    SDL_Texture* texturePoisson_left = nullptr;
+    
+    /* Variables pour l'animation */
+    int frameAnimLoup = 0;      // 0, 1, 2 pour Frame1, Frame2, Frame3
+    int frameAnimLapin = 0;     // 0, 1, 2 pour Frame1, Frame2, Frame3
+    int compteurFrames = 0;     // Pour ralentir l'animation
+    
+    /* Espèces décrites par fichier (écosystème aérien) */
+    RegistreEspeces registreEspeces;
+    std::vector<uint32_t> indicesVisibles;
+
+    /* Variables pour le cycle jour/nuit (échéance sur la roue de l'affichage) */
+    const float DUREE_DEMI_CYCLE = 30.0f;  // 30 secondes par phase
+    bool estJour = true;
+    RoueTemporisation roueAffichage;
+    Minuterie minuterieJourNuit;
+    std::vector<Minuterie*> echeancesAffichage;
+    roueAffichage.Armer(minuterieJourNuit, DUREE_DEMI_CYCLE, 0, nullptr);
+    
+    /* Charger les textures selon le type d'écosystème */
+    {
+        /* Rétabli par la zone, y compris sur les retours en erreur */
+        ZoneMemoire zone(MEMOIRE_RESSOURCES);
+        switch (config.typeEcosysteme)
+        {
+        case 0:  // 🌲 Forêt
+            std::cout << "🌲 Chargement textures Forêt..." << std::endl;
+        
+            /* Fond jour et nuit */
+            textureFondJour = renderer.ChargerTexture("Assets/Img/Background/Foret_Jour.jpeg");
+            textureFondNuit = renderer.ChargerTexture("Assets/Img/Background/Foret_Nuit.jpeg");
+            textureFond = textureFondJour;  // Commencer par le jour
+        
+            texturePlante = renderer.ChargerTexture("Assets/Img/Plantes/REMOVE/Herbe.png");
+        
+            /* Loup Frame 1 */
+            textureLoup1 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame1.png");
+            textureLoup1_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame1_Left.png");
+        
+            /* Loup Frame 2 */
+            textureLoup2 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame2.png");
+            textureLoup2_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame2_Left.png");
+        
+            /* Loup Frame 3 */
+            textureLoup3 = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame3.png");
+            textureLoup3_left = renderer.ChargerTexture("Assets/Img/Loup_moves/REMOVE/Frame3_Left.png");
+                
+            /* Lapin Frame 1 */
+            textureLapin1 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame1.png");
+            textureLapin1_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame1_Left.png");
+        
+            /* Lapin Frame 2 */
+            textureLapin2 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame2.png");
+            textureLapin2_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame2_Left.png");
+
+            /* Lapin Frame 3 */
+            textureLapin3 = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame3.png");
+            textureLapin3_left = renderer.ChargerTexture("Assets/Img/Lapin_moves/REMOVE/Frame3_Left.png");
+        
+            /* Vérification */
+            if (!textureFondJour || !textureFondNuit || !texturePlante || 
+                !textureLoup1 || !textureLoup1_left || 
+                !textureLoup2 || !textureLoup2_left ||
+                !textureLoup3 || !textureLoup3_left ||
+                !textureLapin1 || !textureLapin1_left ||
+                !textureLapin2 || !textureLapin2_left ||
+                !textureLapin3 || !textureLapin3_left)
+            {
+                std::cerr << "❌ Erreur chargement textures Forêt" << std::endl;
+                gui.Destroy();
+                renderer.Nettoyer();
+                return -1;
+            }
+        
+            std::cout << "✅ Textures Forêt chargées (Loup: 3 frames, Lapin: 3 frames, Jour+Nuit)" << std::endl;
+            break;
+        
+        case 1:  // 🌊 Océan
+            std::cout << "🌊 Chargement textures Maritime..." << std::endl;
+        
+            /* Fond jour et nuit */
+            textureFondJour = renderer.ChargerTexture("Assets/Img/Background/Maritime_Jour.jpeg");
+            textureFondNuit = renderer.ChargerTexture("Assets/Img/Background/Maritime_Nuit.jpeg");
+            textureFond = textureFondJour;  // Commencer par le jour
+        
+            texturePlante = renderer.ChargerTexture("Assets/Img/Plantes/REMOVE/Algue.png");
+        
+            /* Requin */
+            textureRequin = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Requin.png");
+            textureRequin_left = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Requin_left.png");
+
+            /* Poisson */
+            texturePoisson = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Poisson.png");
+            texturePoisson_left = renderer.ChargerTexture("Assets/Img/Animaux/REMOVE/Poisson_left.png");
+        
+            /* Vérification */
+            if (!textureFondJour || !textureFondNuit || !texturePlante ||
+                !textureRequin || !textureRequin_left ||
+                !texturePoisson || !texturePoisson_left)
+            {
+                std::cerr << "❌ Erreur chargement textures Maritime" << std::endl;
+                gui.Destroy();
+                renderer.Nettoyer();
+                return -1;
+            }
+        
+            std::cout << "✅ Textures Maritime chargées (Jour+Nuit)" << std::endl;
+            break;
+        
+        case 2:  // ✈️ Air
+            std::cout << "✈️ Chargement des espèces aériennes..." << std::endl;
+
+            /* Pas de textures : espèces, réseau trophique et couleurs viennent du fichier */
+            if (!registreEspeces.Charger("Assets/Config/Aerien.cfg"))
+            {
+                gui.Destroy();
+                renderer.Nettoyer();
+                return -1;
+            }
+            break;
+        
+        default:
+            std::cerr << "❌ Type d'écosystème invalide" << std::endl;
+            gui.Destroy();
+            renderer.Nettoyer();
+            return -1;
+        }
+    }
+
+    /* Création d'un écosystème réglé par la config : au démarrage, puis à
+       chaque relance, sur le thread de simulation */
+    auto fabrique = [&](const ParametresRelance& parametres)
+    {
+        Ecosysteme* eco = new Ecosysteme(parametres.nbProies, parametres.nbPredateurs,
+                                         parametres.nbPlantes, config.largeurMonde, config.hauteurMonde,
+                                         repartition, &taches);
+        eco->SetDelaiPlantes(parametres.delaiPlantes);
+        eco->ActiverParallelisme(config.nbThreads);
+        if (config.sommeil && !eco->ActiverSommeil(true))
+            std::cout << "⚠️ Sommeil des animaux ignoré : la mise à jour par tuiles réveille tout le monde" << std::endl;
+        eco->ActiverSuivi(config.suivi);
+        if (config.collisions && !eco->ActiverCollisions(true))
+            std::cout << "⚠️ Collisions ignorées : les animaux endormis filent sur une trajectoire fixée" << std::endl;
+        if (config.voisins && !eco->ActiverListesVoisins(true))
+            std::cout << "⚠️ Listes de voisins ignorées : tuiles ou sommeil déjà actifs" << std::endl;
+        if (config.champVegetation && !especesFichier)
+            eco->ActiverChampVegetation(true);
+        if (config.flux && !eco->ActiverCarteNourriture(true))
+            std::cout << "⚠️ Carte de la nourriture ignorée : sommeil ou végétation continue déjà actifs" << std::endl;
+        if (config.triSpatial && !eco->ActiverTriSpatial(true))
+            std::cout << "⚠️ Tri spatial ignoré : les dormeurs gardent les adresses des animaux" << std::endl;
+        if (especesFichier)
+            eco->ChargerEspeces(registreEspeces, config.compact);
+        eco->DefinirBudget(static_cast<size_t>(config.budgetAnimaux),
+                           static_cast<size_t>(config.budgetMemoire) * 1024 * 1024,
+                           static_cast<PolitiqueBudget>(config.politiqueBudget));
+        return eco;
+    };
+
+    /* La simulation avance sur son thread ; l'affichage dessine ses instantanés */
+    ThreadSimulation simulation(fabrique, config.champMoyen);
+    /* Les espèces du fichier remplacent proies et prédateurs, à la création comme à la relance */
+    int proiesCreees = especesFichier ? 0 : config.nbProies;
+    int predateursCrees = especesFichier ? 0 : config.nbPredateurs;
+    simulation.Demarrer({proiesCreees, predateursCrees, config.nbPlantes, config.delaiPlantes, graine});
+
+    std::cout << "✅ Écosystème créé : Type=" << config.typeEcosysteme 
+              << ", Proies=" << config.nbProies 
+              << ", Prédateurs=" << config.nbPredateurs << std::endl;
+
+    /* Paramètres du panneau de controle */
+    int nb_proies = config.nbProies;
+    int nb_preds = config.nbPredateurs;
+    int nb_plantes = config.nbPlantes;
+    int nb_plantes_conso = config.nbPlantesConso;
+    float DelaiPlantes = config.delaiPlantes;
+    int seuilSprites = 20000;
+    bool enPause = false;
+    bool pauseEnvoyee = false;
+    bool relancer = false;
+
+    /* Niveau de détail réduit pour les vues très peuplées */
+    ComptableMemoire::Entrer(MEMOIRE_RENDU);
+    CarteDensite carteDensite;
+    carteDensite.Initialiser(renderer.ObtenirRenderer(), 320, 160, &taches);
+
+    /* Végétation continue, dessinée sous les sprites */
+    CarteDensite carteVegetation;
+    if (config.champVegetation)
+        carteVegetation.Initialiser(renderer.ObtenirRenderer(), 320, 160, &taches);
+
+    /* Enregistrement hors écran, encodé par le système de tâches */
+    Enregistreur enregistreur;
+    if (config.enregistrer)
+    {
+        ConfigEnregistrement configVideo;
+        configVideo.dossier = "Enregistrements";
+        configVideo.formatY4M = (config.formatVideo == 1);
+        configVideo.largeur = config.largeurVideo;
+        configVideo.hauteur = config.hauteurVideo;
+        configVideo.avecInterface = config.videoAvecInterface;
+        configVideo.imagesParSeconde = 60;
+        configVideo.nbEncodeurs = std::max(1, taches.GetNombreThreads() - 1);
+        configVideo.capaciteFile = 8;
+        if (!enregistreur.Demarrer(renderer.ObtenirRenderer(), configVideo, taches))
+            std::cerr << "⚠️ Enregistrement désactivé" << std::endl;
+    }
+    ComptableMemoire::Entrer(MEMOIRE_AUTRE);
+    
+    /* Trace des phases, exportée à la fermeture */
+    if (config.tracer)
+    {
+        Traceur::NommerThread("Principal");
+        Traceur::Demarrer();
+    }
+
+    /* Variables de la boucle de jeu */
+    bool enCours = true;
+    SDL_Event event;
+    Uint64 dernierTemps = SDL_GetTicks();
+    int frameCount = 0;
+    ReleveMemoire releveMemoire;
+    ComptableMemoire::Relever(releveMemoire);
+
+    
+    std::cout << "\n🎮 Simulation lancée ! Fermez la fenêtre pour quitter.\n" << std::endl;
+    
+    /* Boucle principale */
+    while (enCours)
+    {
+        Traceur::Debut("Frame");
+
+        /* Gérer les événements */
+        Traceur::Debut("Evenements");
+        while (SDL_PollEvent(&event))
+        {
+            ImGui_ImplSDL3_ProcessEvent(&event);
+            if (event.type == SDL_EVENT_QUIT)
+            {
+                enCours = false;
+            }
+
+            /* La caméra ne reçoit que ce que l'interface ne capture pas */
+            ImGuiIO& io = ImGui::GetIO();
+            bool evenementSouris = (event.type == SDL_EVENT_MOUSE_WHEEL
+                                    || event.type == SDL_EVENT_MOUSE_BUTTON_DOWN);
+            bool evenementClavier = (event.type == SDL_EVENT_KEY_DOWN);
+            if (!(evenementSouris && io.WantCaptureMouse) && !(evenementClavier && io.WantCaptureKeyboard))
+            {
+                camera.TraiterEvenement(event);
+            }
+        }
+        Traceur::Fin();
+        
+        /* Calculer deltaTime */
+        Uint64 tempsActuel = SDL_GetTicks();
+        float tempsReel = (tempsActuel - dernierTemps) / 1000.0f;
+        float deltaTime = enPause ? 0.0 : tempsReel;
+        dernierTemps = tempsActuel;
+
+        /* La caméra reste pilotable pendant la pause */
+        renderer.ObtenirTailleSortie(largeurVue, hauteurVue);
+        camera.DefinirTailleVue(largeurVue, hauteurVue);
+        if (!ImGui::GetIO().WantCaptureKeyboard)
+        {
+            camera.MettreAJour(tempsReel);
+        }
+        
+        /* Nouveau Frame GUI */
+        gui.DebutFrame();
+        
+        /* Dernier état publié par la simulation, inchangé jusqu'à la frame suivante */
+        const InstantaneRendu& instantane = simulation.Consulter();
+        
+        /* CYCLE JOUR/NUIT */
+        if (!enPause)
+        {
+            roueAffichage.Avancer(deltaTime, echeancesAffichage);
+            
+            // Basculer quand la phase est échue
+            if (!echeancesAffichage.empty())
+            {
+                roueAffichage.Armer(minuterieJourNuit, DUREE_DEMI_CYCLE, 0, nullptr);
+                estJour = !estJour;
+                
+                // Basculer le fond
+                if (estJour)
+                {
+                    textureFond = textureFondJour;
+                    std::cout << "🌞 Lever du jour !" << std::endl;
+                }
+                else
+                {
+                    textureFond = textureFondNuit;
+                    std::cout << "🌙 Tombée de la nuit !" << std::endl;
+                }
+            }
+        }
+        
+        /* ANIMATION - Changer de frame toutes les 10 frames SDL */
+        compteurFrames++;
+        if (compteurFrames >= 10)
+        {
+            compteurFrames = 0;
+            
+            /* Loup : cycle 0 → 1 → 2 → 0 */
+            frameAnimLoup = (frameAnimLoup + 1) % 3;
+            
+            /* Lapin : cycle 0 → 1 → 2 → 0 */
+            frameAnimLapin = (frameAnimLapin + 1) % 3;
+        }
+        
+        /* Interface GUI */
+        Traceur::Debut("Interface");
+        ComptableMemoire::Entrer(MEMOIRE_INTERFACE);
+        gui.AfficherPanneauControle(nb_proies, nb_preds, nb_plantes, nb_plantes_conso,
+                             DelaiPlantes, seuilSprites, enPause, enCours, relancer,
+                             largeurVue);
+
+        /* Les espèces du registre s'ajoutent aux courbes selon leur régime */
+        int nbProiesCourbe, nbPredateursCourbe;
+        instantane.GetEffectifsCourbes(nbProiesCourbe, nbPredateursCourbe);
+        gui.AfficherStatistiques(nbProiesCourbe, nbPredateursCourbe,
+                                  instantane.GetNombrePlantes(), instantane.GetTotalPlantesConsommees(),
+                                  instantane.GetChampMoyen());
+
+        /* Allocations de la frame précédente, depuis le relevé d'il y a une frame */
+        if (config.memoire)
+        {
+            ReleveMemoire precedent = releveMemoire;
+            ComptableMemoire::Relever(releveMemoire);
+            gui.AfficherMemoire(releveMemoire, precedent);
+        }
+
+        float utilisationBudget;
+        uint64_t naissancesRefusees;
+        bool freinage;
+        if (instantane.GetBudget(utilisationBudget, naissancesRefusees, freinage))
+            gui.AfficherBudget(utilisationBudget, naissancesRefusees, freinage);
+        ComptableMemoire::Entrer(MEMOIRE_AUTRE);
+        Traceur::Fin();
+
+        /* Le panneau pilote la simulation par commandes, appliquées avant son prochain tick */
+        if (enPause != pauseEnvoyee)
+        {
+            simulation.Envoyer({enPause ? COMMANDE_PAUSE : COMMANDE_REPRISE, {}});
+            pauseEnvoyee = enPause;
+        }
+
+        if (relancer)
+        {
+            simulation.Envoyer({COMMANDE_RELANCER, {especesFichier ? 0 : nb_proies, especesFichier ? 0 : nb_preds,
+                                                    nb_plantes, DelaiPlantes, graine + ++nbRelances}});
+            relancer = false;
+            
+            // Réinitialiser le cycle jour/nuit
+            roueAffichage.Armer(minuterieJourNuit, DUREE_DEMI_CYCLE, 0, nullptr);
+            estJour = true;
+            textureFond = textureFondJour;
+        }
+        
+        /* Dessiner (dans la cible d'enregistrement si elle est active) */
+        Traceur::Debut("Rendu");
+        ComptableMemoire::Entrer(MEMOIRE_RENDU);
+        enregistreur.DebutFrame(largeurVue, hauteurVue);
+        renderer.EffacerEcran();
+        
+        /* 1. Fond (celui qui est actif) */
+        if (textureFond)
+            renderer.DessinerTexture(textureFond, 0, 0, largeurVue, hauteurVue);
+        else
+            renderer.DessinerRectangle(0, 0, largeurVue, hauteurVue, 135, 190, 235);  /* Ciel */
+
+        float vueX0, vueY0, vueX1, vueY1;
+        camera.ZoneVisible(vueX0, vueY0, vueX1, vueY1);
+        float zoom = camera.GetZoom();
+
+        /* Vue trop peuplée ou trop éloignée : carte de densité au lieu des sprites.
+           Le comptage se fait par cellule de grille, sans parcourir les animaux. */
+        int nbVisibles = instantane.CompterAnimauxZone(vueX0, vueY0, vueX1, vueY1);
+
+        if (carteDensite.ChoisirNiveau(nbVisibles, seuilSprites, zoom))
+        {
+            carteDensite.Construire(instantane, vueX0, vueY0, vueX1, vueY1);
+            carteDensite.Dessiner(renderer.ObtenirRenderer(), largeurVue, hauteurVue);
+        }
+        else
+        {
+            /* Ne récupérer que les entités de la zone visible. Les sprites partent
+               du coin haut-gauche : on élargit la zone de la taille du plus grand. */
+            const float marge = PolitiqueEspece<Predateur>::TAILLE_SPRITE;
+            instantane.RequeteZone(vueX0 - marge, vueY0 - marge, vueX1, vueY1,
+                                   proiesVisibles, predateursVisibles, plantesVisibles);
+
+            int tailleProie = std::max(1, static_cast<int>(PolitiqueEspece<Proie>::TAILLE_SPRITE * zoom));
+            int taillePredateur = std::max(1, static_cast<int>(PolitiqueEspece<Predateur>::TAILLE_SPRITE * zoom));
+
+            if (const ChampVegetation* champ = instantane.GetChampVegetation())
+            {
+                carteVegetation.ConstruireVegetation(*champ, vueX0, vueY0, vueX1, vueY1);
+                carteVegetation.Dessiner(renderer.ObtenirRenderer(), largeurVue, hauteurVue);
+            }
+        
+            /* 2. Plantes (seules les disponibles sont dans l'instantané) */
+            for (uint32_t i : plantesVisibles)
+            {
+                float x, y;
+                instantane.GetPlante(i, x, y);
+                if (!texturePlante)
+                {
+                    renderer.DessinerRectangle(static_cast<int>(camera.MondeVersEcranX(x)),
+                                               static_cast<int>(camera.MondeVersEcranY(y)),
+                                               std::max(1, tailleProie / 2), std::max(1, tailleProie / 2),
+                                               60, 160, 60);
+                }
+                else
+                {
+                    renderer.DessinerTexture(texturePlante, 
+                                            static_cast<int>(camera.MondeVersEcranX(x)), 
+                                            static_cast<int>(camera.MondeVersEcranY(y)), 
+                                            tailleProie, tailleProie);
+                }
+            }
+        
+            /* 3. Proies avec animation */
+            for (uint32_t i : proiesVisibles)
+            {
+                SDL_Texture* textureActuelle = nullptr;
+            
+                /* Direction et position figées à la capture */
+                float x, y;
+                bool versGauche = instantane.GetProie(i, x, y);
+            
+                switch (config.typeEcosysteme)
+                {
+                    case 0:  // Forêt
+                        /* Choisir la frame selon l'animation ET la direction */
+                        if (frameAnimLapin == 0)
+                            textureActuelle = versGauche ? textureLapin1_left : textureLapin1;
+                        else if (frameAnimLapin == 1)
+                            textureActuelle = versGauche ? textureLapin2_left : textureLapin2;
+                        else
+                            textureActuelle = versGauche ? textureLapin3_left : textureLapin3;
+                        break;
+                    
+                    case 1:  // Maritime
+                        textureActuelle = versGauche ? texturePoisson_left : texturePoisson;
+                        break;
+                    
+                    case 2:  // Aérien
+                        // Prochainement
+                        break;
+                }
+            
+                renderer.DessinerTexture(textureActuelle,
+                                        static_cast<int>(camera.MondeVersEcranX(x)),
+                                        static_cast<int>(camera.MondeVersEcranY(y)),
+                                        tailleProie, tailleProie);
+            }
+        
+            /* 4. Prédateurs avec animation */
+            for (uint32_t i : predateursVisibles)
+            {
+                SDL_Texture* textureActuelle = nullptr;
+            
+                /* Direction et position figées à la capture */
+                float x, y;
+                bool versGauche = instantane.GetPredateur(i, x, y);
+
+                switch (config.typeEcosysteme)
+                {
+                    case 0:  // Forêt
+                        /* Choisir la frame selon l'animation ET la direction */
+                        if (frameAnimLoup == 0)
+                            textureActuelle = versGauche ? textureLoup1_left : textureLoup1;
+                        else if (frameAnimLoup == 1)
+                            textureActuelle = versGauche ? textureLoup2_left : textureLoup2;
+                        else
+                            textureActuelle = versGauche ? textureLoup3_left : textureLoup3;
+                        break;
+                    
+                    case 1:  // Maritime
+                        textureActuelle = versGauche ? textureRequin_left : textureRequin;
+                        break;
+                    
+                    case 2:  // Aérien
+                        // Prochainement
+                        break;
+                }
+            
+                renderer.DessinerTexture(textureActuelle,
+                                        static_cast<int>(camera.MondeVersEcranX(x)),
+                                        static_cast<int>(camera.MondeVersEcranY(y)),
+                                        taillePredateur, taillePredateur);
+            }
+
+            /* 5. Espèces du registre : carrés de leur couleur, sans texture */
+            if (const RegistreEspeces* registre = instantane.GetRegistre())
+            {
+                for (int e = 0; e < registre->GetNombreEspeces(); e++)
+                {
+                    const ParametresEspece& parametres = registre->GetEspece(e);
+                    const EspeceInstantane& espece = instantane.GetEspece(e);
+                    int taille = std::max(1, static_cast<int>(parametres.taille * zoom));
+
+                    indicesVisibles.clear();
+                    espece.grille.RequeteRectangle(vueX0 - parametres.taille, vueY0 - parametres.taille,
+                                                   vueX1, vueY1, indicesVisibles);
+                    for (uint32_t i : indicesVisibles)
+                    {
+                        renderer.DessinerRectangle(static_cast<int>(camera.MondeVersEcranX(espece.xs[i])),
+                                                   static_cast<int>(camera.MondeVersEcranY(espece.ys[i])),
+                                                   taille, taille, parametres.couleur[0],
+                                                   parametres.couleur[1], parametres.couleur[2]);
+                    }
+                }
+            }
+        }
+
+        /* Rendre GUI, avant ou après la capture selon l'enregistrement */
+        if (!enregistreur.AvecInterface())
+            enregistreur.FinFrame();
+        gui.FinFrame(renderer.ObtenirRenderer());
+        if (enregistreur.AvecInterface())
+            enregistreur.FinFrame();
+        ComptableMemoire::Entrer(MEMOIRE_AUTRE);
+        Traceur::Fin();
+        
+        /* Afficher à l'écran */
+        Traceur::Debut("Presentation");
+        renderer.Afficher();
+        Traceur::Fin();
+        Traceur::Fin();     /* Frame */
+
+        /* Statistiques console */
+        frameCount++;
+        
+        /* Limiter à ~60 FPS */
+        SDL_Delay(16);
+    }
+    
+    /* Nettoyage : plus aucun thread ne trace une fois la simulation arrêtée */
+    simulation.Arreter();
+    enregistreur.Arreter();
+    if (config.tracer)
+        Traceur::Exporter("trace_simulation.json");
+    carteDensite.Nettoyer();
+    carteVegetation.Nettoyer();
+    
+    SDL_DestroyTexture(textureFondJour);
+    SDL_DestroyTexture(textureFondNuit);
+    SDL_DestroyTexture(texturePlante);
+    SDL_DestroyTexture(textureLoup1);
+    SDL_DestroyTexture(textureLoup1_left);
+    SDL_DestroyTexture(textureLoup2);
+    SDL_DestroyTexture(textureLoup2_left);
+    SDL_DestroyTexture(textureLoup3);
+    SDL_DestroyTexture(textureLoup3_left);
+    SDL_DestroyTexture(textureLapin1);
+    SDL_DestroyTexture(textureLapin1_left);
+    SDL_DestroyTexture(textureLapin2);
+    SDL_DestroyTexture(textureLapin2_left);
+    SDL_DestroyTexture(textureLapin3);
+    SDL_DestroyTexture(textureLapin3_left);
+    SDL_DestroyTexture(texturePoisson);
+    SDL_DestroyTexture(texturePoisson_left);
+    SDL_DestroyTexture(textureRequin);
+    SDL_DestroyTexture(textureRequin_left);
+
+    Uint64 tempsFinal = SDL_GetTicks();
+    std::cout << "La simulation a duré : " << (tempsFinal - dernierTemps) / 1000.0f << " secondes" << std::endl;
+    std::cout << "Nombre de Frames : " << frameCount << std::endl;
+
+    gui.Destroy();
+    renderer.Nettoyer();
+    
+    std::cout << "\n✅ Programme terminé proprement" << std::endl;
+    
+    return 0;
+}
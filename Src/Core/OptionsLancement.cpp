@@ -0,0 +1,295 @@
+/**
+ * @file OptionsLancement.cpp
+ * @brief Lecture des options de la ligne de commande
+ */
+
+#include "OptionsLancement.h"
+#include "../Population/BudgetPopulation.h"
+#include "../Population/RepartitionInitiale.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Affiche les options reconnues
+ */
+static void AfficherUsage(const char* programme)
+{
+    std::cout << "Usage : " << programme << " [options]\n"
+              << "  (sans option)            interface graphique\n"
+              << "  --sans-affichage         simulation en console\n"
+              << "  --processus N            monde partagé en N bandes, un processus chacune (Linux)\n"
+              << "  --transport memoire|socket  échanges entre bandes (défaut : memoire)\n"
+              << "  --threads N              monde mis à jour par tuiles sur N threads (défaut : 1, un seul processus)\n"
+              << "  --sommeil                endort les animaux isolés (un seul processus)\n"
+              << "  --suivi                  garde les cibles entre deux détections (un seul processus)\n"
+              << "  --collisions             écarte les sprites qui se chevauchent (un seul processus)\n"
+              << "  --voisins                listes de voisins refaites seulement quand les animaux ont bougé\n"
+              << "  --flux                   plante la plus proche lue dans une carte tenue à jour (un seul processus)\n"
+              << "  --tri-spatial            range proies et prédateurs dans l'ordre de Morton (un seul processus)\n"
+              << "  --budget-animaux N       naissances freinées à l'approche de N animaux (un seul processus)\n"
+              << "  --budget-memoire Mo      naissances freinées à l'approche de Mo mégaoctets d'entités (un seul processus)\n"
+              << "  --politique-budget probabilite|capacite|refus  freinage des naissances (défaut : probabilite)\n"
+              << "  --ticks N                durée en ticks de 1/60 s (défaut : 3600)\n"
+              << "  --monde LxH              taille du monde (défaut : 8000x8000)\n"
+              << "  --proies N               proies initiales (défaut : 4000)\n"
+              << "  --predateurs N           prédateurs initiaux (défaut : 400)\n"
+              << "  --plantes N              plantes initiales (défaut : 2000)\n"
+              << "  --graine N               graine aléatoire (défaut : horloge)\n"
+              << "  --repartition uniforme|agregats|bandes  disposition initiale (défaut : uniforme)\n"
+              << "  --masque IMAGE           disposition initiale suivant la luminosité d'une image\n"
+              << "  --vegetation plantes|champ  plantes individuelles ou champ de biomasse (défaut : plantes)\n"
+              << "  --champ-moyen            prévision des équations de population, comparée aux agents\n"
+              << "  --especes FICHIER        ajoute les espèces d'un fichier (un seul processus)\n"
+              << "  --compact                états quantifiés, espèces de --especes uniquement (14 octets/animal)\n"
+              << "  --enregistrer DOSSIER    enregistre une image tous les 2 ticks (un seul processus)\n"
+              << "  --format png|y4m         images PNG numérotées ou flux Y4M (défaut : png)\n"
+              << "  --resolution LxH         taille des images enregistrées (défaut : 1280x640)\n"
+              << "  --trace FICHIER          phases de chaque tick au format Chrome (chrome://tracing, Perfetto)\n"
+              << "  --memoire                allocations et mémoire vive par sous-système\n"
+              << "  --sans-allocation N      échec si un tick alloue après les N premiers (implique --memoire)\n";
+}
+
+/**
+ * @brief Lit un entier au moins égal à minimum (strictement positif par défaut)
+ */
+static bool LireEntier(const char* texte, int& valeur, int minimum = 1)
+{
+    char* fin = nullptr;
+    long lu = strtol(texte, &fin, 10);
+    if (fin == texte || *fin != '\0' || lu < minimum)
+        return false;
+    valeur = static_cast<int>(lu);
+    return true;
+}
+
+/**
+ * @brief Lit des dimensions de la forme LxH
+ */
+static bool LireDimensions(const char* texte, int& largeur, int& hauteur)
+{
+    const char* x = strchr(texte, 'x');
+    if (!x)
+        return false;
+    std::string texteLargeur(texte, x - texte);
+    return LireEntier(texteLargeur.c_str(), largeur) && LireEntier(x + 1, hauteur);
+}
+
+/**
+ * @brief Parcourt les arguments ; toute option sauf l'aide implique la console
+ */
+bool LireOptions(int argc, char* argv[], OptionsLancement& options)
+{
+    options.sansAffichage = false;
+    options.nbProcessus = 1;
+    options.transportSocket = false;
+    options.nbThreads = 1;
+    options.sommeil = false;
+    options.suivi = false;
+    options.collisions = false;
+    options.voisins = false;
+    options.flux = false;
+    options.triSpatial = false;
+    options.budgetAnimaux = 0;
+    options.budgetMemoire = 0;
+    options.politiqueBudget = BUDGET_PROBABILITE;
+    options.fichierEspeces.clear();
+    options.compact = false;
+    options.nbTicks = 3600;
+    options.largeurMonde = 8000.0f;
+    options.hauteurMonde = 8000.0f;
+    options.nbProies = 4000;
+    options.nbPredateurs = 400;
+    options.nbPlantes = 2000;
+    options.graine = 0;
+    options.repartition = REPARTITION_UNIFORME;
+    options.fichierMasque.clear();
+    options.champVegetation = false;
+    options.champMoyen = false;
+    options.dossierVideo.clear();
+    options.videoY4M = false;
+    options.largeurVideo = 1280;
+    options.hauteurVideo = 640;
+    options.fichierTrace.clear();
+    options.memoire = false;
+    options.chauffeAllocations = -1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* option = argv[i];
+        const char* valeur = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        bool ok = true;
+
+        if (strcmp(option, "--sans-affichage") == 0)
+        {
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--sommeil") == 0)
+        {
+            options.sommeil = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--suivi") == 0)
+        {
+            options.suivi = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--collisions") == 0)
+        {
+            options.collisions = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--voisins") == 0)
+        {
+            options.voisins = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--flux") == 0)
+        {
+            options.flux = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--tri-spatial") == 0)
+        {
+            options.triSpatial = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--memoire") == 0)
+        {
+            options.memoire = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--champ-moyen") == 0)
+        {
+            options.champMoyen = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--compact") == 0)
+        {
+            options.compact = true;
+            options.sansAffichage = true;
+            continue;
+        }
+        if (strcmp(option, "--aide") == 0 || strcmp(option, "--help") == 0)
+        {
+            AfficherUsage(argv[0]);
+            return false;
+        }
+        if (!valeur)
+        {
+            std::cerr << "❌ Valeur manquante pour " << option << std::endl;
+            AfficherUsage(argv[0]);
+            return false;
+        }
+
+        if (strcmp(option, "--processus") == 0)
+            ok = LireEntier(valeur, options.nbProcessus);
+        else if (strcmp(option, "--threads") == 0)
+            ok = LireEntier(valeur, options.nbThreads);
+        else if (strcmp(option, "--transport") == 0)
+        {
+            ok = (strcmp(valeur, "memoire") == 0 || strcmp(valeur, "socket") == 0);
+            options.transportSocket = (strcmp(valeur, "socket") == 0);
+        }
+        else if (strcmp(option, "--budget-animaux") == 0)
+            ok = LireEntier(valeur, options.budgetAnimaux);
+        else if (strcmp(option, "--budget-memoire") == 0)
+            ok = LireEntier(valeur, options.budgetMemoire);
+        else if (strcmp(option, "--politique-budget") == 0)
+        {
+            if (strcmp(valeur, "probabilite") == 0)
+                options.politiqueBudget = BUDGET_PROBABILITE;
+            else if (strcmp(valeur, "capacite") == 0)
+                options.politiqueBudget = BUDGET_CAPACITE;
+            else if (strcmp(valeur, "refus") == 0)
+                options.politiqueBudget = BUDGET_REFUS;
+            else
+                ok = false;
+        }
+        else if (strcmp(option, "--ticks") == 0)
+            ok = LireEntier(valeur, options.nbTicks);
+        else if (strcmp(option, "--monde") == 0)
+        {
+            int largeur = 0;
+            int hauteur = 0;
+            ok = LireDimensions(valeur, largeur, hauteur);
+            options.largeurMonde = static_cast<float>(largeur);
+            options.hauteurMonde = static_cast<float>(hauteur);
+        }
+        else if (strcmp(option, "--proies") == 0)
+            ok = LireEntier(valeur, options.nbProies, 0);
+        else if (strcmp(option, "--predateurs") == 0)
+            ok = LireEntier(valeur, options.nbPredateurs, 0);
+        else if (strcmp(option, "--plantes") == 0)
+            ok = LireEntier(valeur, options.nbPlantes);
+        else if (strcmp(option, "--graine") == 0)
+        {
+            int graine = 0;
+            ok = LireEntier(valeur, graine);
+            options.graine = static_cast<unsigned int>(graine);
+        }
+        else if (strcmp(option, "--repartition") == 0)
+        {
+            if (strcmp(valeur, "uniforme") == 0)
+                options.repartition = REPARTITION_UNIFORME;
+            else if (strcmp(valeur, "agregats") == 0)
+                options.repartition = REPARTITION_AGREGATS;
+            else if (strcmp(valeur, "bandes") == 0)
+                options.repartition = REPARTITION_BANDES;
+            else
+                ok = false;
+        }
+        else if (strcmp(option, "--masque") == 0)
+            options.fichierMasque = valeur;
+        else if (strcmp(option, "--vegetation") == 0)
+        {
+            ok = (strcmp(valeur, "plantes") == 0 || strcmp(valeur, "champ") == 0);
+            options.champVegetation = (strcmp(valeur, "champ") == 0);
+        }
+        else if (strcmp(option, "--especes") == 0)
+            options.fichierEspeces = valeur;
+        else if (strcmp(option, "--enregistrer") == 0)
+            options.dossierVideo = valeur;
+        else if (strcmp(option, "--format") == 0)
+        {
+            ok = (strcmp(valeur, "png") == 0 || strcmp(valeur, "y4m") == 0);
+            options.videoY4M = (strcmp(valeur, "y4m") == 0);
+        }
+        else if (strcmp(option, "--resolution") == 0)
+            ok = LireDimensions(valeur, options.largeurVideo, options.hauteurVideo);
+        else if (strcmp(option, "--trace") == 0)
+            options.fichierTrace = valeur;
+        else if (strcmp(option, "--sans-allocation") == 0)
+        {
+            ok = LireEntier(valeur, options.chauffeAllocations, 0);
+            options.memoire = true;
+        }
+        else
+        {
+            std::cerr << "❌ Option inconnue : " << option << std::endl;
+            AfficherUsage(argv[0]);
+            return false;
+        }
+
+        if (!ok)
+        {
+            std::cerr << "❌ Valeur invalide pour " << option << " : " << valeur << std::endl;
+            AfficherUsage(argv[0]);
+            return false;
+        }
+
+        options.sansAffichage = true;
+        i++;
+    }
+    return true;
+}
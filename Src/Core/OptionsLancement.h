@@ -0,0 +1,61 @@
+/**
+ * @file OptionsLancement.h
+ * @brief Options de la ligne de commande
+ */
+
+#ifndef OPTIONS_LANCEMENT_H
+#define OPTIONS_LANCEMENT_H
+
+#include <string>
+
+/**
+ * @struct OptionsLancement
+ * @brief Mode de lancement et paramètres de la simulation sans fenêtre
+ */
+struct OptionsLancement
+{
+    bool sansAffichage;     /**< Simulation en console, sans SDL */
+    int nbProcessus;        /**< Bandes distribuées sur plusieurs processus (1 : un seul) */
+    bool transportSocket;   /**< Échanges entre processus par sockets au lieu de mémoire partagée */
+    int nbThreads;          /**< Threads de la mise à jour par tuiles (1 : séquentielle) */
+    bool sommeil;           /**< Animaux isolés endormis jusqu'au prochain événement */
+    bool suivi;             /**< Cibles gardées entre deux détections complètes */
+    bool collisions;        /**< Animaux de même espèce écartés quand leurs sprites se chevauchent */
+    bool voisins;           /**< Cibles cherchées dans des listes de voisins gardées entre les ticks */
+    bool flux;              /**< Plante la plus proche lue dans la carte de la nourriture */
+    bool triSpatial;        /**< Proies et prédateurs rangés périodiquement dans l'ordre de Morton */
+    int budgetAnimaux;      /**< Plafond d'animaux, toutes espèces (0 : aucun) */
+    int budgetMemoire;      /**< Plafond de mémoire des entités en Mo (0 : aucun) */
+    int politiqueBudget;    /**< Freinage des naissances à l'approche du plafond (PolitiqueBudget) */
+    std::string fichierEspeces; /**< Espèces supplémentaires (vide : aucune) */
+    bool compact;           /**< Espèces du fichier stockées sous forme quantifiée */
+    int nbTicks;            /**< Durée de la simulation sans affichage */
+    float largeurMonde;     /**< Largeur du monde */
+    float hauteurMonde;     /**< Hauteur du monde */
+    int nbProies;           /**< Proies initiales */
+    int nbPredateurs;       /**< Prédateurs initiaux */
+    int nbPlantes;          /**< Plantes initiales */
+    unsigned int graine;    /**< Graine aléatoire (0 : horloge) */
+    int repartition;        /**< Disposition des populations initiales (TypeRepartition) */
+    std::string fichierMasque;  /**< Image de densité des populations initiales (vide : aucune) */
+    bool champVegetation;   /**< Végétation en champ de biomasse au lieu de plantes individuelles */
+    bool champMoyen;        /**< Prévision du modèle en champ moyen, comparée aux agents */
+    std::string dossierVideo;   /**< Dossier d'enregistrement des images (vide : pas d'enregistrement) */
+    bool videoY4M;          /**< Flux Y4M au lieu de PNG numérotés */
+    int largeurVideo;       /**< Largeur des images enregistrées */
+    int hauteurVideo;       /**< Hauteur des images enregistrées */
+    std::string fichierTrace;   /**< Trace des phases au format Chrome (vide : pas de trace) */
+    bool memoire;           /**< Allocations et mémoire comptées par sous-système */
+    int chauffeAllocations; /**< Ticks après lesquels toute allocation fait échouer la simulation (-1 : aucun contrôle) */
+};
+
+/**
+ * @brief Lit les options de la ligne de commande
+ * @param argc Nombre d'arguments
+ * @param argv Arguments
+ * @param options Options remplies (valeurs par défaut pour les absentes)
+ * @return false si une option est inconnue ou mal formée (l'usage est affiché)
+ */
+bool LireOptions(int argc, char* argv[], OptionsLancement& options);
+
+#endif /* OPTIONS_LANCEMENT_H */
@@ -0,0 +1,477 @@
+/**
+ * @file PoolThreads.cpp
+ * @brief Implémentation du système de tâches à vol de travail
+ */
+
+#include "PoolThreads.h"
+#include "Traceur.h"
+#include <algorithm>
+#include <string>
+
+/**
+ * @struct PoolThreads::Tache
+ * @brief Tâche isolée et ses liens de dépendance
+ */
+struct PoolThreads::Tache
+{
+    std::function<void()> travail;      /**< Fonction à exécuter */
+    SousSysteme sousSysteme;            /**< Sous-système de celui qui a lancé */
+    std::atomic<int> attentes;          /**< Prérequis non terminés (+1 pendant Lancer) */
+    std::atomic<int> references;        /**< Poignée de l'appelant + exécution */
+    std::atomic<bool> terminee;         /**< Travail fait */
+    std::mutex mutex;                   /**< Protège terminee face aux ajouts de suivantes */
+    std::vector<Tache*> suivantes;      /**< Tâches qui attendent celle-ci */
+};
+
+/**
+ * @struct PoolThreads::Boucle
+ * @brief Boucle parallèle en cours, sur la pile de qui l'attend
+ */
+struct PoolThreads::Boucle
+{
+    const std::function<void(int, int)>* corps;     /**< Corps appelé sur chaque morceau */
+    int grain;                                      /**< Taille minimale d'un morceau coupé */
+    SousSysteme sousSysteme;                        /**< Sous-système de celui qui a lancé */
+    std::atomic<int> restants;                      /**< Indices pas encore traités */
+};
+
+/* Système et file du thread courant : seuls les travailleurs en ont une à eux */
+static thread_local const PoolThreads* tPool = nullptr;
+static thread_local int tIndice = 0;
+static thread_local unsigned tVictime = 0;
+
+/**
+ * @brief Ajoute à la fin de l'anneau, agrandi (jamais rétréci) s'il est plein
+ * @param anneau Éléments
+ * @param tete Position du plus ancien
+ * @param nombre Éléments en file
+ * @param element Élément ajouté
+ */
+template <typename T>
+static void Empiler(std::vector<T>& anneau, size_t& tete, size_t& nombre, const T& element)
+{
+    if (nombre == anneau.size())
+    {
+        std::vector<T> agrandi(std::max<size_t>(16, 2 * anneau.size()));
+        for (size_t i = 0; i < nombre; i++)
+            agrandi[i] = anneau[(tete + i) % anneau.size()];
+        anneau.swap(agrandi);
+        tete = 0;
+    }
+    anneau[(tete + nombre) % anneau.size()] = element;
+    nombre++;
+}
+
+/**
+ * @brief Crée nbThreads - 1 threads (l'appelant est le dernier)
+ */
+PoolThreads::PoolThreads(int nbThreads)
+    : mNbMorceaux(0)
+    , mNbTaches(0)
+    , mNbEndormis(0)
+    , mArret(false)
+{
+    nbThreads = std::max(1, nbThreads);
+    mFileTaches.tete = 0;
+    mFileTaches.nombre = 0;
+    for (int i = 0; i < nbThreads; i++)
+    {
+        FileTravail* file = new FileTravail;
+        file->tete = 0;
+        file->nombre = 0;
+        file->anneau.resize(64);
+        mFiles.push_back(file);
+    }
+    for (int i = 1; i < nbThreads; i++)
+        mThreads.emplace_back(&PoolThreads::Travailler, this, i);
+}
+
+/**
+ * @brief Arrête et rejoint les threads, puis libère files et tâches recyclées
+ */
+PoolThreads::~PoolThreads()
+{
+    {
+        std::lock_guard<std::mutex> verrou(mMutexSommeil);
+        mArret = true;
+    }
+    mReveil.notify_all();
+
+    for (auto& thread : mThreads)
+        thread.join();
+
+    for (FileTravail* file : mFiles)
+        delete file;
+    for (Tache* tache : mTachesLibres)
+        delete tache;
+}
+
+/**
+ * @brief Boucle d'un thread : aide jusqu'à l'arrêt, en dormant faute de travail
+ */
+void PoolThreads::Travailler(int numero)
+{
+    tPool = this;
+    tIndice = numero;
+    tVictime = static_cast<unsigned>(numero);
+    Traceur::NommerThread("Travailleur " + std::to_string(numero));
+
+    AiderJusqua([this] { return mArret.load(); }, true);
+}
+
+/**
+ * @brief File du thread courant
+ */
+int PoolThreads::IndiceCourant() const
+{
+    return tPool == this ? tIndice : 0;
+}
+
+/**
+ * @brief Pose le morceau dans sa file ; un dormeur suffit à le prendre
+ */
+void PoolThreads::Pousser(const ElementTravail& element)
+{
+    FileTravail& file = *mFiles[IndiceCourant()];
+    {
+        std::lock_guard<std::mutex> verrou(file.mutex);
+        Empiler(file.anneau, file.tete, file.nombre, element);
+    }
+    mNbMorceaux.fetch_add(1);
+
+    /* mNbMorceaux écrit avant de lire mNbEndormis : un thread qui s'endort verra l'un ou l'autre */
+    if (mNbEndormis.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> verrou(mMutexSommeil);
+        }
+        mReveil.notify_one();
+    }
+}
+
+/**
+ * @brief Sa file par la fin (morceau le plus récent, encore chaud en cache), puis vol par le début
+ */
+bool PoolThreads::Prendre(ElementTravail& element, bool tachesAussi)
+{
+    int moi = IndiceCourant();
+    int nbFiles = static_cast<int>(mFiles.size());
+
+    if (mNbMorceaux.load() > 0)
+    {
+        FileTravail& propre = *mFiles[moi];
+        {
+            std::lock_guard<std::mutex> verrou(propre.mutex);
+            if (propre.nombre > 0)
+            {
+                propre.nombre--;
+                element = propre.anneau[(propre.tete + propre.nombre) % propre.anneau.size()];
+                mNbMorceaux.fetch_sub(1);
+                return true;
+            }
+        }
+
+        /* Victime suivante à chaque vol : les voleurs ne se ruent pas tous sur la même file */
+        int depart = static_cast<int>(tVictime++ % static_cast<unsigned>(nbFiles));
+        for (int k = 0; k < nbFiles; k++)
+        {
+            int victime = (depart + k) % nbFiles;
+            if (victime == moi)
+                continue;
+
+            FileTravail& file = *mFiles[victime];
+            std::lock_guard<std::mutex> verrou(file.mutex);
+            if (file.nombre > 0)
+            {
+                element = file.anneau[file.tete];
+                file.tete = (file.tete + 1) % file.anneau.size();
+                file.nombre--;
+                mNbMorceaux.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+
+    if (tachesAussi && mNbTaches.load() > 0)
+    {
+        std::lock_guard<std::mutex> verrou(mFileTaches.mutex);
+        if (mFileTaches.nombre > 0)
+        {
+            element = mFileTaches.anneau[mFileTaches.tete];
+            mFileTaches.tete = (mFileTaches.tete + 1) % mFileTaches.anneau.size();
+            mFileTaches.nombre--;
+            mNbTaches.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Prend et exécute un élément
+ */
+bool PoolThreads::ExecuterUn(bool tachesAussi)
+{
+    ElementTravail element;
+    if (!Prendre(element, tachesAussi))
+        return false;
+    ExecuterElement(element);
+    return true;
+}
+
+/**
+ * @brief Morceau de boucle : coupé en deux tant qu'il dépasse le grain, la moitié droite offerte aux voleurs
+ */
+void PoolThreads::ExecuterElement(const ElementTravail& element)
+{
+    if (element.tache)
+    {
+        ExecuterTache(element.tache);
+        return;
+    }
+
+    Boucle* boucle = element.boucle;
+    int debut = element.debut;
+    int fin = element.fin;
+    ZoneMemoire zone(boucle->sousSysteme);
+
+    while (fin - debut > boucle->grain)
+    {
+        int milieu = debut + (fin - debut) / 2;
+        ElementTravail droite = {nullptr, boucle, milieu, fin};
+        Pousser(droite);
+        fin = milieu;
+    }
+    (*boucle->corps)(debut, fin);
+
+    /* Après le dernier morceau, la boucle peut déjà avoir quitté la pile de qui l'attendait */
+    if (boucle->restants.fetch_sub(fin - debut) == fin - debut)
+        SignalerFin();
+}
+
+/**
+ * @brief Exécute la tâche, la marque terminée, puis prépare ses suivantes dont c'était le dernier prérequis
+ */
+void PoolThreads::ExecuterTache(Tache* tache)
+{
+    {
+        ZoneMemoire zone(tache->sousSysteme);
+        tache->travail();
+        tache->travail = nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> verrou(tache->mutex);
+        tache->terminee = true;
+    }
+
+    /* Plus aucun ajout possible : terminee est vu par Lancer sous le même verrou */
+    for (Tache* suivante : tache->suivantes)
+        if (suivante->attentes.fetch_sub(1) == 1)
+            Preparer(suivante);
+    tache->suivantes.clear();
+
+    SignalerFin();
+    Relacher(tache);
+}
+
+/**
+ * @brief En file commune ; sans thread de travail, personne d'autre ne l'exécuterait à temps
+ */
+void PoolThreads::Preparer(Tache* tache)
+{
+    if (mThreads.empty())
+    {
+        ExecuterTache(tache);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> verrou(mFileTaches.mutex);
+        ElementTravail element = {tache, nullptr, 0, 0};
+        Empiler(mFileTaches.anneau, mFileTaches.tete, mFileTaches.nombre, element);
+    }
+    mNbTaches.fetch_add(1);
+
+    /* Tous réveillés : un dormeur qui attend la fin d'une boucle ne prendrait pas la tâche */
+    if (mNbEndormis.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> verrou(mMutexSommeil);
+        }
+        mReveil.notify_all();
+    }
+}
+
+/**
+ * @brief La dernière référence rend la tâche à la réserve de Lancer
+ */
+void PoolThreads::Relacher(Tache* tache)
+{
+    if (tache->references.fetch_sub(1) == 1)
+    {
+        std::lock_guard<std::mutex> verrou(mMutexRecyclage);
+        mTachesLibres.push_back(tache);
+    }
+}
+
+/**
+ * @brief Travaille tant qu'il y a de quoi, quelques tours à vide, puis s'endort jusqu'au prochain signal
+ */
+void PoolThreads::AiderJusqua(const std::function<bool()>& condition, bool tachesAussi)
+{
+    int essais = 0;
+    while (!condition())
+    {
+        if (ExecuterUn(tachesAussi))
+        {
+            essais = 0;
+            continue;
+        }
+        if (++essais < ESSAIS_AVANT_SOMMEIL)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> verrou(mMutexSommeil);
+        mNbEndormis.fetch_add(1);
+        mReveil.wait(verrou, [&]
+        {
+            return condition() || mNbMorceaux.load() > 0 || (tachesAussi && mNbTaches.load() > 0);
+        });
+        mNbEndormis.fetch_sub(1);
+        essais = 0;
+    }
+}
+
+/**
+ * @brief Réveille tout le monde si quelqu'un dort : chacun revérifie ce qu'il attend
+ */
+void PoolThreads::SignalerFin()
+{
+    if (mNbEndormis.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> verrou(mMutexSommeil);
+        }
+        mReveil.notify_all();
+    }
+}
+
+/**
+ * @brief Le premier morceau est exécuté (et coupé) par l'appelant, qui aide ensuite jusqu'à la fin
+ */
+void PoolThreads::Pour(int debut, int fin, int grain, const std::function<void(int, int)>& corps)
+{
+    if (fin <= debut)
+        return;
+
+    grain = std::max(1, grain);
+    if (mThreads.empty() || fin - debut <= grain)
+    {
+        corps(debut, fin);
+        return;
+    }
+
+    Boucle boucle;
+    boucle.corps = &corps;
+    boucle.grain = grain;
+    boucle.sousSysteme = ComptableMemoire::GetSousSysteme();
+    boucle.restants.store(fin - debut);
+
+    ElementTravail entier = {nullptr, &boucle, debut, fin};
+    ExecuterElement(entier);
+    AiderJusqua([&boucle] { return boucle.restants.load() == 0; }, false);
+}
+
+/**
+ * @brief Chaque indice est un morceau de taille 1
+ */
+void PoolThreads::Executer(int nbTaches, const std::function<void(int)>& tache)
+{
+    Pour(0, nbTaches, 1, [&tache](int debut, int fin)
+    {
+        for (int i = debut; i < fin; i++)
+            tache(i);
+    });
+}
+
+/**
+ * @brief Réutilise une tâche recyclée ; inscrite chez chaque prérequis encore en cours
+ */
+PoolThreads::Tache* PoolThreads::Lancer(std::function<void()> travail, std::initializer_list<Tache*> prerequis)
+{
+    Tache* tache = nullptr;
+    {
+        std::lock_guard<std::mutex> verrou(mMutexRecyclage);
+        if (!mTachesLibres.empty())
+        {
+            tache = mTachesLibres.back();
+            mTachesLibres.pop_back();
+        }
+    }
+    if (!tache)
+        tache = new Tache;
+
+    tache->travail = std::move(travail);
+    tache->sousSysteme = ComptableMemoire::GetSousSysteme();
+    tache->terminee = false;
+    tache->references.store(2);
+    tache->attentes.store(1);
+
+    for (Tache* avant : prerequis)
+    {
+        if (!avant)
+            continue;
+        std::lock_guard<std::mutex> verrou(avant->mutex);
+        if (!avant->terminee)
+        {
+            tache->attentes.fetch_add(1);
+            avant->suivantes.push_back(tache);
+        }
+    }
+
+    if (tache->attentes.fetch_sub(1) == 1)
+        Preparer(tache);
+    return tache;
+}
+
+/**
+ * @brief Aide à tout (tâches comprises) jusqu'à la fin de la tâche
+ */
+void PoolThreads::Attendre(Tache* tache)
+{
+    if (!tache)
+        return;
+    AiderJusqua([tache] { return tache->terminee.load(); }, true);
+    Relacher(tache);
+}
+
+/**
+ * @brief Rend la poignée ; l'exécution garde sa propre référence
+ */
+void PoolThreads::Liberer(Tache* tache)
+{
+    if (tache)
+        Relacher(tache);
+}
+
+/**
+ * @brief Brouillon de la file du thread, agrandi au besoin
+ */
+void* PoolThreads::Brouillon(size_t octets)
+{
+    std::vector<unsigned char>& brouillon = mFiles[IndiceCourant()]->brouillon;
+    if (brouillon.size() < octets)
+        brouillon.resize(octets);
+    return brouillon.data();
+}
+
+/**
+ * @brief Récupère le nombre de threads, appelant compris
+ */
+int PoolThreads::GetNombreThreads() const
+{
+    return static_cast<int>(mThreads.size()) + 1;
+}
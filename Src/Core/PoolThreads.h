@@ -0,0 +1,227 @@
+/**
+ * @file PoolThreads.h
+ * @brief Système de tâches à vol de travail partagé par la simulation, le rendu et les entrées-sorties
+ */
+
+#ifndef POOL_THREADS_H
+#define POOL_THREADS_H
+
+#include "ComptableMemoire.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class PoolThreads
+ * @brief Threads persistants, une file de travail chacun, vol entre files
+ *
+ * Un seul système de tâches est créé par l'application et prêté à tous ceux
+ * qui parallélisent : l'écosystème (tuiles, peuplement, végétation), la
+ * préparation du rendu et l'encodage des vidéos. Deux formes de travail :
+ *  - Pour : boucle parallèle fork/join ; l'intervalle est coupé en deux à la
+ *    demande, la moitié droite est posée dans la file du thread et la gauche
+ *    gardée, jusqu'au grain. Un thread oisif vole le plus gros morceau, au
+ *    début de la file d'un autre ; le propriétaire dépile par la fin ;
+ *  - Lancer : tâche isolée, mise dans une file commune une fois ses
+ *    prérequis terminés ; les threads la prennent quand ils n'ont plus de
+ *    morceau de boucle.
+ *
+ * Qui attend exécute du travail en attendant, puis s'endort. La fin d'une
+ * boucle n'aide qu'aux morceaux de boucle : une longue tâche isolée (encodage
+ * d'une image) ne retarde pas le tick qui attend ses tuiles. Un thread sans
+ * travail s'endort aussi : rien ne tourne à vide.
+ * Chaque thread a un brouillon, mémoire réutilisée d'une tâche à l'autre.
+ * Le sous-système mémoire de celui qui lance est imputé aux allocations du
+ * travail, quel que soit le thread qui l'exécute.
+ */
+class PoolThreads
+{
+public:
+    struct Tache;
+
+private:
+    struct Boucle;
+
+    /**
+     * @struct ElementTravail
+     * @brief Entrée d'une file : une tâche prête, ou un morceau de boucle
+     */
+    struct ElementTravail
+    {
+        Tache* tache;       /**< Tâche prête (nullptr pour un morceau de boucle) */
+        Boucle* boucle;     /**< Boucle du morceau */
+        int debut;          /**< Premier indice du morceau */
+        int fin;            /**< Indice après le dernier */
+    };
+
+    /**
+     * @struct FileTravail
+     * @brief File d'un thread (anneau qui ne rétrécit jamais) et son brouillon
+     */
+    struct FileTravail
+    {
+        std::mutex mutex;                       /**< Protège l'anneau */
+        std::vector<ElementTravail> anneau;     /**< Éléments, de tete à tete + nombre */
+        size_t tete;                            /**< Position du plus ancien élément */
+        size_t nombre;                          /**< Éléments en file */
+        std::vector<unsigned char> brouillon;   /**< Mémoire de travail du thread */
+    };
+
+    std::vector<std::thread> mThreads;          /**< Threads de travail */
+    std::vector<FileTravail*> mFiles;           /**< Morceaux de boucle ; file 0 : threads extérieurs, i : travailleur i */
+    FileTravail mFileTaches;                    /**< Tâches prêtes, dans l'ordre où elles le sont devenues */
+    std::atomic<int> mNbMorceaux;               /**< Morceaux de boucle en file, toutes files confondues */
+    std::atomic<int> mNbTaches;                 /**< Tâches prêtes en file */
+    std::atomic<int> mNbEndormis;               /**< Threads endormis (travailleurs ou en attente) */
+    std::mutex mMutexSommeil;                   /**< Accompagne mReveil */
+    std::condition_variable mReveil;            /**< Signale du travail ou une fin attendue */
+    std::mutex mMutexRecyclage;                 /**< Protège mTachesLibres */
+    std::vector<Tache*> mTachesLibres;          /**< Tâches terminées, réutilisées par Lancer */
+    std::atomic<bool> mArret;                   /**< Demande d'arrêt des threads */
+
+    static constexpr int ESSAIS_AVANT_SOMMEIL = 64;     /**< Tours sans travail avant de s'endormir */
+
+    /**
+     * @brief Boucle d'un thread de travail
+     * @param numero Rang du thread (1 à nbThreads - 1), pour la trace et sa file
+     */
+    void Travailler(int numero);
+
+    /**
+     * @brief File du thread courant (0 pour un thread extérieur au système)
+     * @return Indice dans mFiles
+     */
+    int IndiceCourant() const;
+
+    /**
+     * @brief Pose un morceau de boucle à la fin de la file du thread courant et réveille un dormeur
+     * @param element Morceau à poser
+     */
+    void Pousser(const ElementTravail& element);
+
+    /**
+     * @brief Prend un élément : fin de sa propre file, sinon début d'une autre, sinon une tâche prête
+     * @param element Élément pris
+     * @param tachesAussi false : morceaux de boucle seulement
+     * @return false s'il n'y avait rien à prendre
+     */
+    bool Prendre(ElementTravail& element, bool tachesAussi);
+
+    /**
+     * @brief Prend et exécute un élément
+     * @param tachesAussi false : morceaux de boucle seulement
+     * @return false s'il n'y avait rien à faire
+     */
+    bool ExecuterUn(bool tachesAussi);
+
+    /**
+     * @brief Exécute un élément pris dans une file
+     * @param element Élément
+     */
+    void ExecuterElement(const ElementTravail& element);
+
+    /**
+     * @brief Exécute une tâche prête, puis rend prêtes celles qui n'attendaient qu'elle
+     * @param tache Tâche
+     */
+    void ExecuterTache(Tache* tache);
+
+    /**
+     * @brief Rend une tâche prête : mise en file, ou exécutée sur-le-champ sans thread de travail
+     * @param tache Tâche dont tous les prérequis sont terminés
+     */
+    void Preparer(Tache* tache);
+
+    /**
+     * @brief Abandonne une référence à une tâche ; la dernière la recycle
+     * @param tache Tâche
+     */
+    void Relacher(Tache* tache);
+
+    /**
+     * @brief Aide jusqu'à ce que la condition soit vraie, en dormant quand il n'y a rien à faire
+     * @param condition Fin attendue
+     * @param tachesAussi false : n'aide qu'aux morceaux de boucle
+     */
+    void AiderJusqua(const std::function<bool()>& condition, bool tachesAussi);
+
+    /**
+     * @brief Réveille les dormeurs, dont ceux qui attendent une fin
+     */
+    void SignalerFin();
+
+public:
+    /**
+     * @brief Crée les threads de travail
+     * @param nbThreads Nombre total de threads, appelant compris
+     */
+    explicit PoolThreads(int nbThreads);
+
+    /**
+     * @brief Arrête et rejoint les threads (le travail en file doit être terminé)
+     */
+    ~PoolThreads();
+
+    PoolThreads(const PoolThreads&) = delete;
+    PoolThreads& operator=(const PoolThreads&) = delete;
+
+    /**
+     * @brief Boucle parallèle : corps(d, f) sur des morceaux couvrant [debut, fin[, puis attend
+     * @param debut Premier indice
+     * @param fin Indice après le dernier
+     * @param grain Taille au-dessous de laquelle un morceau n'est plus coupé
+     * @param corps Fonction appelée sur chaque morceau [d, f[
+     */
+    void Pour(int debut, int fin, int grain, const std::function<void(int, int)>& corps);
+
+    /**
+     * @brief Exécute tache(0) ... tache(nbTaches - 1) et attend leur fin (Pour de grain 1)
+     * @param nbTaches Nombre de tâches
+     * @param tache Fonction appelée avec l'indice de la tâche
+     */
+    void Executer(int nbTaches, const std::function<void(int)>& tache);
+
+    /**
+     * @brief Lance une tâche, exécutée quand ses prérequis sont terminés
+     * @param travail Fonction à exécuter
+     * @param prerequis Tâches à terminer avant (nullptr ignoré)
+     * @return Poignée à rendre par Attendre ou Liberer
+     */
+    Tache* Lancer(std::function<void()> travail, std::initializer_list<Tache*> prerequis = {});
+
+    /**
+     * @brief Attend la fin d'une tâche en aidant, puis rend la poignée
+     * @param tache Poignée rendue par Lancer (nullptr accepté)
+     */
+    void Attendre(Tache* tache);
+
+    /**
+     * @brief Rend la poignée sans attendre : la tâche s'exécutera quand même
+     * @param tache Poignée rendue par Lancer (nullptr accepté)
+     */
+    void Liberer(Tache* tache);
+
+    /**
+     * @brief Brouillon du thread courant, valable jusqu'à la fin du travail en cours
+     * @param octets Taille voulue
+     * @return Mémoire d'au moins octets octets, agrandie si besoin et jamais rendue
+     *
+     * Attendre ou Pour depuis le travail en cours peut y exécuter un autre
+     * travail du même thread, qui réutilise le brouillon. Les threads
+     * extérieurs au système partagent un brouillon : un seul à la fois.
+     */
+    void* Brouillon(size_t octets);
+
+    /**
+     * @brief Récupère le nombre de threads, appelant compris
+     * @return Nombre de threads
+     */
+    int GetNombreThreads() const;
+};
+
+#endif /* POOL_THREADS_H */
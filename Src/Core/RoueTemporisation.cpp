@@ -0,0 +1,259 @@
+/**
+ * @file RoueTemporisation.cpp
+ * @brief Implémentation de la roue de temporisation hiérarchique
+ */
+
+#include "RoueTemporisation.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Minuterie désarmée
+ */
+Minuterie::Minuterie()
+    : precedente(nullptr)
+    , suivante(nullptr)
+    , roue(nullptr)
+    , indiceCase(-1)
+    , instantArmement(0.0)
+    , echeance(0)
+    , type(0)
+    , cible(nullptr)
+{
+}
+
+/**
+ * @brief Quitte la roue si elle y est encore
+ */
+Minuterie::~Minuterie()
+{
+    if (roue)
+        roue->Desarmer(*this);
+}
+
+/**
+ * @brief Indique si la minuterie attend une échéance
+ */
+bool Minuterie::EstArmee() const
+{
+    return roue != nullptr;
+}
+
+/**
+ * @brief Roue vide au tick 0
+ */
+RoueTemporisation::RoueTemporisation(float resolution)
+    : mTick(0)
+    , mReste(0.0)
+    , mResolution(resolution)
+    , mNbArmees(0)
+{
+    std::fill(mCases, mCases + NB_CASES, nullptr);
+}
+
+/**
+ * @brief Détache les minuteries restantes (leur destructeur ne touchera plus la roue)
+ */
+RoueTemporisation::~RoueTemporisation()
+{
+    for (int i = 0; i < NB_CASES; i++)
+    {
+        for (Minuterie* m = mCases[i]; m; m = m->suivante)
+            m->roue = nullptr;
+    }
+}
+
+/**
+ * @brief Minuteries détachées comme à la destruction, temps remis à zéro
+ */
+void RoueTemporisation::Reinitialiser()
+{
+    for (int i = 0; i < NB_CASES; i++)
+    {
+        for (Minuterie* m = mCases[i]; m; m = m->suivante)
+            m->roue = nullptr;
+    }
+    std::fill(mCases, mCases + NB_CASES, nullptr);
+    mTick = 0;
+    mReste = 0.0;
+    mNbArmees = 0;
+}
+
+/**
+ * @brief Niveau choisi par la distance à l'échéance, case par les bits de l'échéance
+ */
+void RoueTemporisation::Ranger(Minuterie& minuterie)
+{
+    uint64_t echeance = std::max(minuterie.echeance, mTick);
+    uint64_t distance = echeance - mTick;
+    int indice;
+
+    if (distance < CASES_NIVEAU0)
+        indice = static_cast<int>(echeance & (CASES_NIVEAU0 - 1));
+    else
+    {
+        /* Au-delà de la portée : rangée au plus loin, reclassée au passage */
+        if (distance >= PORTEE_MAX)
+            echeance = mTick + PORTEE_MAX - 1;
+
+        int niveau = 1;
+        while (niveau < NB_NIVEAUX_SUPERIEURS
+               && distance >= (1ull << (BITS_NIVEAU0 + niveau * BITS_NIVEAU)))
+            niveau++;
+
+        int decalage = BITS_NIVEAU0 + (niveau - 1) * BITS_NIVEAU;
+        indice = CASES_NIVEAU0 + (niveau - 1) * CASES_NIVEAU
+               + static_cast<int>((echeance >> decalage) & (CASES_NIVEAU - 1));
+    }
+
+    minuterie.indiceCase = indice;
+    minuterie.precedente = nullptr;
+    minuterie.suivante = mCases[indice];
+    if (mCases[indice])
+        mCases[indice]->precedente = &minuterie;
+    mCases[indice] = &minuterie;
+}
+
+/**
+ * @brief Arrondit le délai au tick qui le dépasse, en comptant le temps déjà accumulé
+ */
+void RoueTemporisation::Armer(Minuterie& minuterie, float delai, int type, void* cible)
+{
+    Desarmer(minuterie);
+
+    double ticks = std::ceil((std::max(0.0f, delai) + mReste) / mResolution - 1e-6);
+    uint64_t attente = static_cast<uint64_t>(std::max(1.0, ticks));
+
+    minuterie.roue = this;
+    minuterie.instantArmement = GetTemps();
+    minuterie.echeance = mTick + attente - 1;
+    minuterie.type = type;
+    minuterie.cible = cible;
+    Ranger(minuterie);
+    mNbArmees++;
+}
+
+/**
+ * @brief Décroche la minuterie de sa case
+ */
+void RoueTemporisation::Desarmer(Minuterie& minuterie)
+{
+    if (minuterie.roue != this)
+        return;
+
+    if (minuterie.precedente)
+        minuterie.precedente->suivante = minuterie.suivante;
+    else
+        mCases[minuterie.indiceCase] = minuterie.suivante;
+    if (minuterie.suivante)
+        minuterie.suivante->precedente = minuterie.precedente;
+
+    minuterie.precedente = nullptr;
+    minuterie.suivante = nullptr;
+    minuterie.roue = nullptr;
+    minuterie.indiceCase = -1;
+    mNbArmees--;
+}
+
+/**
+ * @brief Vide une case haute en rerangeant chaque minuterie selon sa vraie échéance
+ */
+void RoueTemporisation::Redistribuer(int niveau, int indice)
+{
+    int caseHaute = CASES_NIVEAU0 + (niveau - 1) * CASES_NIVEAU + indice;
+    Minuterie* liste = mCases[caseHaute];
+    mCases[caseHaute] = nullptr;
+
+    while (liste)
+    {
+        Minuterie* suivante = liste->suivante;
+        Ranger(*liste);
+        liste = suivante;
+    }
+}
+
+/**
+ * @brief Un tour complet d'un niveau fait descendre la case suivante du niveau au-dessus
+ */
+void RoueTemporisation::Tic(std::vector<Minuterie*>& echues)
+{
+    int indice = static_cast<int>(mTick & (CASES_NIVEAU0 - 1));
+
+    if (indice == 0)
+    {
+        for (int niveau = 1; niveau <= NB_NIVEAUX_SUPERIEURS; niveau++)
+        {
+            int decalage = BITS_NIVEAU0 + (niveau - 1) * BITS_NIVEAU;
+            int indiceHaut = static_cast<int>((mTick >> decalage) & (CASES_NIVEAU - 1));
+            Redistribuer(niveau, indiceHaut);
+            if (indiceHaut != 0)
+                break;
+        }
+    }
+
+    /* Toutes les minuteries de la case échoient à ce tick */
+    Minuterie* liste = mCases[indice];
+    mCases[indice] = nullptr;
+    while (liste)
+    {
+        Minuterie* suivante = liste->suivante;
+        liste->precedente = nullptr;
+        liste->suivante = nullptr;
+        liste->roue = nullptr;
+        liste->indiceCase = -1;
+        mNbArmees--;
+        echues.push_back(liste);
+        liste = suivante;
+    }
+
+    mTick++;
+}
+
+/**
+ * @brief Convertit le temps écoulé en ticks entiers et les traite un par un
+ */
+void RoueTemporisation::Avancer(float deltaTime, std::vector<Minuterie*>& echues)
+{
+    echues.clear();
+    mReste += deltaTime;
+
+    /* La tolérance absorbe l'arrondi d'un deltaTime égal à la résolution */
+    while (mReste + 1e-7 >= mResolution)
+    {
+        mReste -= mResolution;
+        Tic(echues);
+    }
+    mReste = std::max(0.0, mReste);
+}
+
+/**
+ * @brief Temps écoulé depuis la création de la roue
+ */
+double RoueTemporisation::GetTemps() const
+{
+    return mTick * static_cast<double>(mResolution) + mReste;
+}
+
+/**
+ * @brief Temps écoulé depuis l'armement
+ */
+float RoueTemporisation::SecondesDepuisArmement(const Minuterie& minuterie) const
+{
+    return static_cast<float>(GetTemps() - minuterie.instantArmement);
+}
+
+/**
+ * @brief Temps restant avant le tick d'échéance
+ */
+float RoueTemporisation::SecondesRestantes(const Minuterie& minuterie) const
+{
+    return static_cast<float>((minuterie.echeance + 1 - mTick) * static_cast<double>(mResolution) - mReste);
+}
+
+/**
+ * @brief Compte les minuteries en attente
+ */
+int RoueTemporisation::GetNombreArmees() const
+{
+    return mNbArmees;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file RoueTemporisation.h
+ * @brief Roue de temporisation hiérarchique : minuteries à coût proportionnel aux échéances
+ */
+
+#ifndef ROUE_TEMPORISATION_H
+#define ROUE_TEMPORISATION_H
+
+#include <cstdint>
+#include <vector>
+
+class RoueTemporisation;
+
+/**
+ * @struct Minuterie
+ * @brief Échéance insérée dans une roue (nœud de liste chaînée, sans allocation)
+ *
+ * Une minuterie se désarme toute seule à sa destruction : l'objet qui la
+ * contient peut être détruit sans prévenir la roue.
+ */
+struct Minuterie
+{
+    Minuterie* precedente;          /**< Voisine dans la case (nullptr en tête) */
+    Minuterie* suivante;            /**< Voisine dans la case */
+    RoueTemporisation* roue;        /**< Roue qui la contient (nullptr : désarmée) */
+    int indiceCase;                 /**< Case occupée dans la roue */
+    double instantArmement;         /**< Temps de la roue à l'armement (secondes) */
+    uint64_t echeance;              /**< Tick d'expiration */
+    int type;                       /**< Nature de l'échéance (libre pour l'appelant) */
+    void* cible;                    /**< Objet concerné (libre pour l'appelant) */
+
+    Minuterie();
+    ~Minuterie();
+    Minuterie(const Minuterie&) = delete;
+    Minuterie& operator=(const Minuterie&) = delete;
+
+    /**
+     * @brief Indique si la minuterie attend une échéance
+     * @return true si armée
+     */
+    bool EstArmee() const;
+};
+
+/**
+ * @class RoueTemporisation
+ * @brief Minuteries rangées par échéance dans des cases de granularité croissante
+ *
+ * Niveau 0 : 256 cases d'un tick. Niveaux 1 à 3 : 64 cases couvrant chacune
+ * toute la roue du niveau inférieur. Quand le niveau 0 fait un tour, la case
+ * courante du niveau 1 est redistribuée plus bas (et ainsi de suite). Armer,
+ * désarmer et faire avancer d'un tick coûtent O(1) ; seules les minuteries
+ * échues (et, une fois par tour, une case redistribuée) sont touchées.
+ */
+class RoueTemporisation
+{
+private:
+    static constexpr int BITS_NIVEAU0 = 8;                      /**< 256 cases au niveau 0 */
+    static constexpr int BITS_NIVEAU = 6;                       /**< 64 cases aux niveaux supérieurs */
+    static constexpr int NB_NIVEAUX_SUPERIEURS = 3;             /**< Niveaux 1 à 3 */
+    static constexpr int CASES_NIVEAU0 = 1 << BITS_NIVEAU0;
+    static constexpr int CASES_NIVEAU = 1 << BITS_NIVEAU;
+    static constexpr int NB_CASES = CASES_NIVEAU0 + NB_NIVEAUX_SUPERIEURS * CASES_NIVEAU;
+    static constexpr uint64_t PORTEE_MAX = 1ull << (BITS_NIVEAU0 + NB_NIVEAUX_SUPERIEURS * BITS_NIVEAU);  /**< Ticks couverts */
+
+    Minuterie* mCases[NB_CASES];    /**< Têtes des listes de chaque case */
+    uint64_t mTick;                 /**< Prochain tick à traiter */
+    double mReste;                  /**< Temps accumulé pas encore converti en ticks */
+    float mResolution;              /**< Durée d'un tick (secondes) */
+    int mNbArmees;                  /**< Minuteries en attente */
+
+    /**
+     * @brief Range une minuterie dans la case de son échéance
+     * @param minuterie Minuterie détachée
+     */
+    void Ranger(Minuterie& minuterie);
+
+    /**
+     * @brief Redistribue une case d'un niveau supérieur vers les niveaux inférieurs
+     * @param niveau Niveau (1 à 3)
+     * @param indice Case à vider
+     */
+    void Redistribuer(int niveau, int indice);
+
+    /**
+     * @brief Traite un tick : redistributions éventuelles puis échéances du tick
+     * @param echues Minuteries échues (ajoutées)
+     */
+    void Tic(std::vector<Minuterie*>& echues);
+
+public:
+    /**
+     * @brief Constructeur
+     * @param resolution Durée d'un tick (secondes)
+     */
+    explicit RoueTemporisation(float resolution = 1.0f / 60.0f);
+
+    /**
+     * @brief Destructeur : les minuteries encore armées sont simplement détachées
+     */
+    ~RoueTemporisation();
+
+    RoueTemporisation(const RoueTemporisation&) = delete;
+    RoueTemporisation& operator=(const RoueTemporisation&) = delete;
+
+    /**
+     * @brief Vide la roue et remet son temps à zéro, comme à la construction
+     *
+     * Les minuteries encore armées sont détachées sans être touchées.
+     */
+    void Reinitialiser();
+
+    /**
+     * @brief Arme (ou réarme) une minuterie
+     * @param minuterie Minuterie à armer
+     * @param delai Délai avant l'échéance (secondes, arrondi au tick supérieur)
+     * @param type Nature de l'échéance, rendue telle quelle
+     * @param cible Objet concerné, rendu tel quel
+     */
+    void Armer(Minuterie& minuterie, float delai, int type, void* cible);
+
+    /**
+     * @brief Retire une minuterie de la roue (sans effet si désarmée)
+     * @param minuterie Minuterie à désarmer
+     */
+    void Desarmer(Minuterie& minuterie);
+
+    /**
+     * @brief Fait avancer le temps et récupère les minuteries échues
+     * @param deltaTime Temps écoulé (secondes)
+     * @param echues Vidé puis rempli des minuteries échues, désarmées, dans l'ordre des échéances
+     */
+    void Avancer(float deltaTime, std::vector<Minuterie*>& echues);
+
+    /**
+     * @brief Temps écoulé depuis la création de la roue
+     * @return Secondes
+     */
+    double GetTemps() const;
+
+    /**
+     * @brief Temps écoulé depuis l'armement d'une minuterie armée
+     * @param minuterie Minuterie armée dans cette roue
+     * @return Secondes depuis Armer
+     */
+    float SecondesDepuisArmement(const Minuterie& minuterie) const;
+
+    /**
+     * @brief Temps restant avant l'échéance d'une minuterie armée
+     * @param minuterie Minuterie armée dans cette roue
+     * @return Secondes avant l'échéance
+     */
+    float SecondesRestantes(const Minuterie& minuterie) const;
+
+    /**
+     * @brief Compte les minuteries en attente
+     * @return Nombre de minuteries armées
+     */
+    int GetNombreArmees() const;
+};
+
+#endif /* ROUE_TEMPORISATION_H */
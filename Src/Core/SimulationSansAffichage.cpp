@@ -0,0 +1,400 @@
+/**
+ * @file SimulationSansAffichage.cpp
+ * @brief Implémentation de la simulation en console
+ */
+
+#include "SimulationSansAffichage.h"
+#include "ComptableMemoire.h"
+#include "PoolThreads.h"
+#include "Traceur.h"
+#include "../Distribue/SimulationDistribuee.h"
+#include "../Graphics/CarteDensite.h"
+#include "../Graphics/Enregistreur.h"
+#include "../Population/Ecosysteme.h"
+#include "../Population/ListesVoisins.h"
+#include "../Population/CarteNourriture.h"
+#include "../Population/ModeleChampMoyen.h"
+#include "../Population/PopulationGenerique.h"
+#include "../Population/RegistreEspeces.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+static constexpr float PAS_TEMPS = 1.0f / 60.0f;       /**< Tick fixe (secondes simulées) */
+static constexpr int INTERVALLE_RAPPORT = 600;         /**< Ticks entre deux lignes de statistiques */
+static constexpr float DELAI_PLANTES = 5.0f;           /**< Délai de repousse par défaut */
+static constexpr int TICKS_PAR_IMAGE = 2;              /**< Une image enregistrée pour deux ticks (30 images/s) */
+static constexpr double HEURES_PREVISION = 1000.0;     /**< Horizon de la prévision du champ moyen */
+
+/**
+ * @brief Affiche allocations, mémoire vive et pic de chaque sous-système
+ * @param releve Compteurs relevés en fin de simulation
+ */
+static void AfficherBilanMemoire(const ReleveMemoire& releve)
+{
+    std::cout << "🧮 Mémoire par sous-système (allocations, octets alloués, vivants, pic) :" << std::endl;
+    for (int i = 0; i < NB_SOUS_SYSTEMES; i++)
+    {
+        const CompteurMemoire& compteur = releve.compteurs[i];
+        if (compteur.allocations == 0)
+            continue;
+        std::cout << "   " << std::left << std::setw(11) << ComptableMemoire::GetNom(static_cast<SousSysteme>(i))
+                  << std::right << std::setw(10) << compteur.allocations
+                  << std::setw(12) << compteur.octets / 1024 << " Ko"
+                  << std::setw(10) << compteur.vivants / 1024 << " Ko"
+                  << std::setw(10) << compteur.pic / 1024 << " Ko" << std::endl;
+    }
+}
+
+/**
+ * @brief Prévoit les populations sur HEURES_PREVISION à partir de l'état initial et chronomètre le calcul
+ * @param modele Modèle initialisé (copié : il reste au temps zéro)
+ */
+static void AfficherPrevisionChampMoyen(const ModeleChampMoyen& modele)
+{
+    ModeleChampMoyen prevision = modele;
+    auto debut = std::chrono::steady_clock::now();
+    prevision.Avancer(HEURES_PREVISION * 3600.0);
+    double microsecondes = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - debut).count();
+
+    long acceptes, rejetes;
+    prevision.GetPas(acceptes, rejetes);
+    const EtatChampMoyen& etat = prevision.GetEtat();
+    std::cout << "🔮 Champ moyen : " << HEURES_PREVISION << " h prévues en " << microsecondes << " µs ("
+              << acceptes << " pas, " << rejetes << " refusés) : " << etat.proies << " proies, "
+              << etat.predateurs << " prédateurs, " << etat.plantes << " plantes" << std::endl;
+}
+
+/**
+ * @brief Un seul processus ou plusieurs bandes selon les options
+ */
+int ExecuterSansAffichage(const OptionsLancement& options)
+{
+    unsigned int graine = options.graine ? options.graine : static_cast<unsigned int>(time(nullptr));
+
+    std::cout << "=== Simulation sans affichage : monde " << options.largeurMonde << "x"
+              << options.hauteurMonde << ", " << options.nbTicks << " ticks ===" << std::endl;
+
+    /* Les processus des bandes naissent d'un fork : compter dans le parent ne dirait rien */
+    bool memoire = options.memoire && options.nbProcessus <= 1;
+    if (memoire)
+        ComptableMemoire::Activer();
+
+    /* Les centres d'agrégats suivent la graine : les bandes voient les mêmes */
+    RepartitionInitiale repartition(static_cast<TypeRepartition>(options.repartition), graine);
+    if (!options.fichierMasque.empty() && !repartition.ChargerMasque(options.fichierMasque))
+        return 1;
+
+    if (options.nbProcessus > 1)
+    {
+        if (options.nbThreads > 1)
+            std::cout << "⚠️ --threads ignoré : chaque bande est mise à jour par son processus" << std::endl;
+        if (options.sommeil)
+            std::cout << "⚠️ --sommeil ignoré : les bandes voisines ne préviennent pas les dormeurs" << std::endl;
+        if (options.suivi)
+            std::cout << "⚠️ --suivi ignoré : les fantômes des bandes voisines changent à chaque tick" << std::endl;
+        if (options.collisions)
+            std::cout << "⚠️ --collisions ignoré : un écart pousserait un animal hors de sa bande" << std::endl;
+        if (options.voisins)
+            std::cout << "⚠️ --voisins ignoré : les fantômes des bandes voisines changent à chaque tick" << std::endl;
+        if (options.flux)
+            std::cout << "⚠️ --flux ignoré : les bandes cherchent leurs plantes elles-mêmes" << std::endl;
+        if (options.triSpatial)
+            std::cout << "⚠️ --tri-spatial ignoré : chaque bande garde l'ordre de ses échanges" << std::endl;
+        if (options.budgetAnimaux > 0 || options.budgetMemoire > 0)
+            std::cout << "⚠️ --budget ignoré : chaque bande ne connaît que ses propres naissances" << std::endl;
+        if (!options.fichierEspeces.empty())
+            std::cout << "⚠️ --especes ignoré : les espèces du fichier ne migrent pas entre bandes" << std::endl;
+        if (!options.dossierVideo.empty())
+            std::cout << "⚠️ --enregistrer ignoré : chaque processus ne voit que sa bande" << std::endl;
+        if (options.memoire)
+            std::cout << "⚠️ --memoire ignoré : les bandes s'exécutent dans d'autres processus" << std::endl;
+        if (options.champVegetation)
+            std::cout << "⚠️ --vegetation champ ignoré : le champ ne franchit pas les frontières de bandes" << std::endl;
+        if (options.champMoyen)
+            std::cout << "⚠️ --champ-moyen ignoré : les bandes ne remontent pas leurs effectifs à chaque rapport" << std::endl;
+
+        ConfigDistribuee config;
+        config.nbProcessus = options.nbProcessus;
+        config.transportSocket = options.transportSocket;
+        config.nbTicks = options.nbTicks;
+        config.pasTemps = PAS_TEMPS;
+        config.largeurMonde = options.largeurMonde;
+        config.hauteurMonde = options.hauteurMonde;
+        config.nbProies = options.nbProies;
+        config.nbPredateurs = options.nbPredateurs;
+        config.nbPlantes = options.nbPlantes;
+        config.delaiPlantes = DELAI_PLANTES;
+        config.graine = graine;
+        config.repartition = repartition;
+        config.intervalleRapport = INTERVALLE_RAPPORT;
+        config.fichierTrace = options.fichierTrace;
+
+        SimulationDistribuee simulation(config);
+        return simulation.Executer();
+    }
+
+    if (!options.fichierTrace.empty())
+    {
+        Traceur::NommerThread("Principal");
+        Traceur::Demarrer();
+    }
+
+    /* Peuplement, végétation continue et encodage ; les animaux aussi avec --threads */
+    PoolThreads taches(std::max({1, options.nbThreads, static_cast<int>(std::thread::hardware_concurrency())}));
+
+    srand(graine);
+    RegistreEspeces registre;   /* Doit survivre à l'écosystème */
+    auto debutCreation = std::chrono::steady_clock::now();
+    Ecosysteme eco(options.nbProies, options.nbPredateurs, options.nbPlantes,
+                   options.largeurMonde, options.hauteurMonde, repartition, &taches);
+    double msCreation = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - debutCreation).count();
+    std::cout << "🌍 Monde peuplé en " << msCreation << " ms" << std::endl;
+    eco.SetDelaiPlantes(DELAI_PLANTES);
+
+    /* Avant les autres modes, comme dans l'interface : les tuiles refusent sommeil et listes de voisins */
+    bool tuiles = options.nbThreads > 1 && eco.ActiverParallelisme(options.nbThreads);
+    if (options.nbThreads > 1 && !tuiles)
+        std::cout << "⚠️ --threads ignoré : monde trop petit pour deux tuiles" << std::endl;
+    if (options.champVegetation && options.sommeil)
+        std::cout << "⚠️ --sommeil ignoré : les dormeurs attendent des plantes individuelles" << std::endl;
+    else if (tuiles && options.sommeil)
+        std::cout << "⚠️ --sommeil ignoré : la mise à jour par tuiles réveille tout le monde" << std::endl;
+    else
+        eco.ActiverSommeil(options.sommeil);
+    eco.ActiverSuivi(options.suivi);
+    if (options.collisions && !eco.ActiverCollisions(true))
+        std::cout << "⚠️ --collisions ignoré : les dormeurs filent sur une trajectoire fixée" << std::endl;
+    if (options.voisins && !eco.ActiverListesVoisins(true))
+        std::cout << "⚠️ --voisins ignoré : tuiles ou sommeil déjà actifs" << std::endl;
+    if (options.champVegetation && !options.fichierEspeces.empty())
+        std::cout << "⚠️ --vegetation champ ignoré : les espèces du fichier mangent des plantes individuelles" << std::endl;
+    else if (options.champVegetation)
+        eco.ActiverChampVegetation(true);
+    if (options.flux && !eco.ActiverCarteNourriture(true))
+        std::cout << "⚠️ --flux ignoré : sommeil ou végétation continue déjà actifs" << std::endl;
+    bool triSpatial = options.triSpatial && eco.ActiverTriSpatial(true);
+    if (options.triSpatial && !triSpatial)
+        std::cout << "⚠️ --tri-spatial ignoré : les dormeurs gardent les adresses des animaux" << std::endl;
+
+    if (!options.fichierEspeces.empty())
+    {
+        ZoneMemoire zone(MEMOIRE_RESSOURCES);
+        if (!registre.Charger(options.fichierEspeces))
+            return 1;
+        eco.ChargerEspeces(registre, options.compact);
+        std::cout << "🐦 " << registre.GetNombreEspeces() << " espèces chargées, "
+                  << eco.GetEspeces()->GetOctetsParIndividu() << " octets par individu" << std::endl;
+    }
+    else if (options.compact)
+        std::cout << "⚠️ --compact sans --especes : Proie et Predateur gardent leur représentation" << std::endl;
+
+    /* Après le chargement des espèces : le premier relevé les compte */
+    eco.DefinirBudget(static_cast<size_t>(options.budgetAnimaux),
+                      static_cast<size_t>(options.budgetMemoire) * 1024 * 1024,
+                      static_cast<PolitiqueBudget>(options.politiqueBudget));
+    bool freinage = false;
+
+    /* Les espèces du fichier comptent avec les proies ou les prédateurs selon leur régime */
+    auto compterParRegime = [&eco](int& proies, int& predateurs)
+    {
+        proies = eco.GetNombreProies();
+        predateurs = eco.GetNombrePredateurs();
+        if (const PopulationGenerique* especes = eco.GetEspeces())
+        {
+            int herbivores, carnivores;
+            especes->CompterParRegime(herbivores, carnivores);
+            proies += herbivores;
+            predateurs += carnivores;
+        }
+    };
+
+    ModeleChampMoyen champMoyen(options.largeurMonde, options.hauteurMonde,
+                                static_cast<float>(eco.GetMaxPlantes()), eco.GetRepoussePlantes());
+    if (options.champMoyen)
+    {
+        int proies, predateurs;
+        compterParRegime(proies, predateurs);
+        champMoyen.Initialiser(proies, predateurs, eco.GetNombrePlantes());
+        AfficherPrevisionChampMoyen(champMoyen);
+    }
+
+    /* Enregistrement sans fenêtre : carte de densité rendue par le renderer logiciel */
+    SDL_Surface* surfaceVideo = nullptr;
+    SDL_Renderer* rendererVideo = nullptr;
+    CarteDensite carteVideo;
+    Enregistreur enregistreur;
+    if (!options.dossierVideo.empty())
+    {
+        ZoneMemoire zone(MEMOIRE_RENDU);
+        surfaceVideo = SDL_CreateSurface(options.largeurVideo, options.hauteurVideo, SDL_PIXELFORMAT_RGBA32);
+        rendererVideo = surfaceVideo ? SDL_CreateSoftwareRenderer(surfaceVideo) : nullptr;
+        if (!rendererVideo)
+            std::cerr << "❌ Renderer logiciel indisponible : " << SDL_GetError() << std::endl;
+
+        ConfigEnregistrement configVideo;
+        configVideo.dossier = options.dossierVideo;
+        configVideo.formatY4M = options.videoY4M;
+        configVideo.largeur = options.largeurVideo;
+        configVideo.hauteur = options.hauteurVideo;
+        configVideo.avecInterface = false;
+        configVideo.imagesParSeconde = 60 / TICKS_PAR_IMAGE;
+        configVideo.nbEncodeurs = std::max(1, taches.GetNombreThreads() - 1);
+        configVideo.capaciteFile = 8;
+        if (!rendererVideo || !carteVideo.Initialiser(rendererVideo, 320, 160, &taches)
+            || !enregistreur.Demarrer(rendererVideo, configVideo, taches))
+            std::cerr << "⚠️ Enregistrement désactivé" << std::endl;
+    }
+
+    /* Allocations de chaque tick : écart entre deux relevés */
+    ReleveMemoire releve;
+    ComptableMemoire::Relever(releve);
+    uint64_t allocationsIntervalle = 0;
+    uint64_t octetsIntervalle = 0;
+    int premierTickFautif = -1;
+    uint64_t allocationsFautives = 0;
+    SousSysteme sousSystemeFautif = MEMOIRE_AUTRE;
+
+    auto debut = std::chrono::steady_clock::now();
+
+    for (int tick = 0; tick < options.nbTicks; tick++)
+    {
+        eco.Update(PAS_TEMPS);
+
+        const BudgetPopulation* budget = eco.GetBudget();
+        if (budget && budget->EstEnFreinage() != freinage)
+        {
+            freinage = budget->EstEnFreinage();
+            std::cout << (freinage ? "⚠️ " : "✅ ") << "Tick " << (tick + 1) << " : budget à "
+                      << static_cast<int>(budget->GetUtilisation() * 100.0f) << " %, naissances "
+                      << (freinage ? "freinées" : "rétablies") << " (" << BudgetPopulation::GetNom(budget->GetPolitique())
+                      << ")" << std::endl;
+        }
+
+        if (enregistreur.EstActif() && tick % TICKS_PAR_IMAGE == 0)
+        {
+            ZoneMemoire zone(MEMOIRE_RENDU);
+            Traceur::Debut("Enregistrement");
+            enregistreur.DebutFrame(options.largeurVideo, options.hauteurVideo);
+            SDL_SetRenderDrawColor(rendererVideo, 20, 25, 30, 255);
+            SDL_RenderClear(rendererVideo);
+            carteVideo.Construire(eco, 0.0f, 0.0f, options.largeurMonde, options.hauteurMonde);
+            carteVideo.Dessiner(rendererVideo, options.largeurVideo, options.hauteurVideo);
+            enregistreur.FinFrame();
+            Traceur::Fin();
+        }
+
+        if (memoire)
+        {
+            ReleveMemoire precedent = releve;
+            ComptableMemoire::Relever(releve);
+            for (int i = 0; i < NB_SOUS_SYSTEMES; i++)
+            {
+                uint64_t allocations = releve.compteurs[i].allocations - precedent.compteurs[i].allocations;
+                allocationsIntervalle += allocations;
+                octetsIntervalle += releve.compteurs[i].octets - precedent.compteurs[i].octets;
+
+                /* Régime établi : le premier tick qui alloue est retenu */
+                if (allocations > 0 && options.chauffeAllocations >= 0 && tick >= options.chauffeAllocations
+                    && premierTickFautif < 0)
+                {
+                    premierTickFautif = tick;
+                    allocationsFautives = allocations;
+                    sousSystemeFautif = static_cast<SousSysteme>(i);
+                }
+            }
+        }
+
+        if ((tick + 1) % INTERVALLE_RAPPORT == 0)
+        {
+            std::cout << "Tick " << (tick + 1) << " : " << eco.GetNombreProies() << " proies, "
+                      << eco.GetNombrePredateurs() << " prédateurs, "
+                      << eco.GetNombrePlantes() << " plantes";
+            if (const PopulationGenerique* especes = eco.GetEspeces())
+            {
+                int herbivores, carnivores;
+                especes->CompterParRegime(herbivores, carnivores);
+                std::cout << ", espèces du fichier : " << herbivores << " herbivores, " << carnivores << " carnivores";
+            }
+            if (options.sommeil)
+                std::cout << " (" << eco.GetNombreEndormis() << " animaux endormis)";
+            if (options.collisions)
+                std::cout << " (" << eco.GetEvenementsCollision().size() << " collisions ce tick)";
+            if (const ListesVoisins* voisins = eco.GetListesVoisins())
+                std::cout << " (" << voisins->GetReconstructions() << " constructions des listes, "
+                          << voisins->GetVoisinsMoyens() << " voisins par animal)";
+            if (const CarteNourriture* carte = eco.GetCarteNourriture())
+                std::cout << " (" << carte->GetNombreCellules() << " cellules avec une plante à portée)";
+            if (triSpatial)
+                std::cout << " (" << eco.GetNombreTris() << " tris du stockage, mesure tous les "
+                          << eco.GetIntervalleTri() << " ticks)";
+            if (budget)
+                std::cout << " (budget : " << static_cast<int>(budget->GetUtilisation() * 100.0f) << " % utilisé, "
+                          << budget->GetNaissancesRefusees() << " naissances refusées)";
+            std::cout << std::endl;
+
+            if (options.champMoyen)
+            {
+                int proies, predateurs;
+                compterParRegime(proies, predateurs);
+                champMoyen.Avancer(INTERVALLE_RAPPORT * PAS_TEMPS);
+                champMoyen.Comparer(proies, predateurs, eco.GetNombrePlantes());
+                const EtatChampMoyen& prevu = champMoyen.GetEtat();
+                std::cout << "   champ moyen : " << static_cast<int>(prevu.proies) << " proies, "
+                          << static_cast<int>(prevu.predateurs) << " prédateurs, "
+                          << static_cast<int>(prevu.plantes) << " plantes" << std::endl;
+            }
+
+            if (memoire)
+            {
+                CompteurMemoire total = releve.Total();
+                std::cout << "   mémoire : " << static_cast<double>(allocationsIntervalle) / INTERVALLE_RAPPORT
+                          << " allocations/tick (" << octetsIntervalle / INTERVALLE_RAPPORT << " octets), "
+                          << total.vivants / 1024 << " Ko vivants" << std::endl;
+                allocationsIntervalle = 0;
+                octetsIntervalle = 0;
+            }
+        }
+    }
+
+    double secondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+    std::cout << "⏱  " << options.nbTicks << " ticks en " << secondes << " s ("
+              << (secondes > 0.0 ? options.nbTicks / secondes : 0.0) << " ticks/s)" << std::endl;
+    std::cout << "✅ Fin : " << eco.GetNombreProies() << " proies, " << eco.GetNombrePredateurs()
+              << " prédateurs, " << eco.GetNombrePlantes() << " plantes" << std::endl;
+    if (options.champMoyen)
+    {
+        EtatChampMoyen ecart = champMoyen.GetEcart();
+        std::cout << "🔮 Écart moyen des agents au champ moyen : proies " << std::fixed << std::setprecision(0)
+                  << 100.0 * ecart.proies << " %, prédateurs " << 100.0 * ecart.predateurs
+                  << " %, plantes " << 100.0 * ecart.plantes << " %" << std::defaultfloat << std::endl;
+    }
+
+    enregistreur.Arreter();
+    if (!options.fichierTrace.empty())
+        Traceur::Exporter(options.fichierTrace);
+    carteVideo.Nettoyer();
+    if (rendererVideo)
+        SDL_DestroyRenderer(rendererVideo);
+    if (surfaceVideo)
+        SDL_DestroySurface(surfaceVideo);
+
+    if (memoire)
+    {
+        ComptableMemoire::Relever(releve);
+        AfficherBilanMemoire(releve);
+    }
+    if (premierTickFautif >= 0)
+    {
+        std::cerr << "❌ Allocation en régime établi : " << allocationsFautives << " au tick "
+                  << premierTickFautif << " (" << ComptableMemoire::GetNom(sousSystemeFautif) << ")" << std::endl;
+        return 2;
+    }
+    if (memoire && options.chauffeAllocations >= 0)
+        std::cout << "✅ Aucune allocation après le tick " << options.chauffeAllocations << std::endl;
+    return 0;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file SimulationSansAffichage.h
+ * @brief Exécution de la simulation en console, sans fenêtre
+ */
+
+#ifndef SIMULATION_SANS_AFFICHAGE_H
+#define SIMULATION_SANS_AFFICHAGE_H
+
+#include "OptionsLancement.h"
+
+/**
+ * @brief Simule nbTicks pas fixes de 1/60 s et affiche les populations
+ * @param options Options de la ligne de commande
+ * @return Code de sortie du programme
+ *
+ * Avec plus d'un processus, le monde est découpé en bandes (SimulationDistribuee).
+ */
+int ExecuterSansAffichage(const OptionsLancement& options);
+
+#endif /* SIMULATION_SANS_AFFICHAGE_H */
@@ -0,0 +1,228 @@
+/**
+ * @file ThreadSimulation.cpp
+ * @brief Implémentation du thread de simulation
+ */
+
+#include "ThreadSimulation.h"
+#include "ComptableMemoire.h"
+#include "Traceur.h"
+#include "../Population/Ecosysteme.h"
+#include "../Population/ModeleChampMoyen.h"
+#include "../Population/PopulationGenerique.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Effectifs des courbes : espèces du registre rangées selon leur régime
+ */
+static void CompterCourbes(const Ecosysteme& eco, int& proies, int& predateurs)
+{
+    proies = eco.GetNombreProies();
+    predateurs = eco.GetNombrePredateurs();
+    if (const PopulationGenerique* especes = eco.GetEspeces())
+    {
+        int herbivores, carnivores;
+        especes->CompterParRegime(herbivores, carnivores);
+        proies += herbivores;
+        predateurs += carnivores;
+    }
+}
+
+/**
+ * @brief Constructeur
+ */
+ThreadSimulation::ThreadSimulation(Fabrique fabrique, bool champMoyen)
+    : mFabrique(std::move(fabrique)),
+      mAvecChampMoyen(champMoyen),
+      mEco(nullptr),
+      mChampMoyen(nullptr),
+      mArret(false),
+      mPause(false)
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+ThreadSimulation::~ThreadSimulation()
+{
+    Arreter();
+    delete mEco;
+    delete mChampMoyen;
+}
+
+/**
+ * @brief Relance sur place si l'écosystème la sait faire, sinon fabrique ; le champ moyen repart de ses effectifs
+ */
+bool ThreadSimulation::Creer(const ParametresRelance& parametres)
+{
+    /* Les modes choisis au menu ne changent pas : seuls les effectifs et la graine diffèrent */
+    bool surPlace = mEco && mEco->Reinitialiser(parametres.nbProies, parametres.nbPredateurs,
+                                                parametres.nbPlantes, parametres.graine);
+    if (surPlace)
+        mEco->SetDelaiPlantes(parametres.delaiPlantes);
+    else
+    {
+        delete mEco;
+        srand(parametres.graine);
+        mEco = mFabrique(parametres);
+    }
+
+    if (!mAvecChampMoyen)
+        return surPlace;
+
+    int proies, predateurs;
+    CompterCourbes(*mEco, proies, predateurs);
+    ModeleChampMoyen modele(mEco->GetLargeur(), mEco->GetHauteur(),
+                            static_cast<float>(mEco->GetMaxPlantes()), mEco->GetRepoussePlantes());
+    modele.Initialiser(proies, predateurs, mEco->GetNombrePlantes());
+    if (mChampMoyen)
+        *mChampMoyen = modele;
+    else
+        mChampMoyen = new ModeleChampMoyen(modele);
+    return surPlace;
+}
+
+/**
+ * @brief Capture imputée au rendu, puis échange avec l'instantané du milieu
+ */
+void ThreadSimulation::Publier()
+{
+    ZoneMemoire zone(MEMOIRE_RENDU);
+    mInstantanes.Ecriture().Capturer(*mEco, mChampMoyen);
+    mInstantanes.Publier();
+}
+
+/**
+ * @brief Pause et reprise, relance ; seule la dernière relance compte
+ */
+bool ThreadSimulation::TraiterCommandes()
+{
+    const CommandeSimulation* relance = nullptr;
+    for (const CommandeSimulation& commande : mATraiter)
+    {
+        if (commande.type == COMMANDE_PAUSE)
+            mPause = true;
+        else if (commande.type == COMMANDE_REPRISE)
+            mPause = false;
+        else
+            relance = &commande;
+    }
+
+    if (relance)
+    {
+        auto debut = std::chrono::steady_clock::now();
+        bool surPlace = Creer(relance->relance);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - debut).count();
+        std::cout << "Ecosysteme relancé " << (surPlace ? "sur place" : "par reconstruction")
+                  << " en " << ms << " ms !" << std::endl;
+    }
+    mATraiter.clear();
+    return relance != nullptr;
+}
+
+/**
+ * @brief Un tick par période, au temps réel écoulé depuis le précédent
+ */
+void ThreadSimulation::Boucle()
+{
+    Traceur::NommerThread("Simulation");
+
+    using Horloge = std::chrono::steady_clock;
+    const auto periode = std::chrono::duration_cast<Horloge::duration>(std::chrono::duration<double>(PERIODE_TICK));
+    Horloge::time_point precedent = Horloge::now();
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> verrou(mMutex);
+            /* En pause, rien ne tourne jusqu'à la prochaine commande */
+            mSignal.wait(verrou, [this] { return mArret || !mPause || !mCommandes.empty(); });
+            if (mArret)
+                break;
+            mATraiter.swap(mCommandes);
+        }
+
+        bool etaitEnPause = mPause;
+        bool relance = TraiterCommandes();
+        if (relance)
+            Publier();
+
+        /* La durée d'une pause ou d'une création n'est pas du temps simulé */
+        if (etaitEnPause || relance)
+            precedent = Horloge::now();
+        if (mPause)
+            continue;
+
+        Horloge::time_point debut = Horloge::now();
+        float deltaTime = std::chrono::duration<float>(debut - precedent).count();
+        precedent = debut;
+
+        Traceur::Debut("Tick");
+        mEco->Update(deltaTime);
+        if (mChampMoyen)
+        {
+            mChampMoyen->Avancer(deltaTime);
+            int proies, predateurs;
+            CompterCourbes(*mEco, proies, predateurs);
+            mChampMoyen->Comparer(proies, predateurs, mEco->GetNombrePlantes());
+        }
+        Traceur::Fin();
+
+        Traceur::Debut("Instantane");
+        Publier();
+        Traceur::Fin();
+
+        /* Attente du tick suivant, écourtée par une commande */
+        std::unique_lock<std::mutex> verrou(mMutex);
+        mSignal.wait_until(verrou, debut + periode, [this] { return mArret || !mCommandes.empty(); });
+    }
+}
+
+/**
+ * @brief Création et premier instantané sur le thread appelant, avant le lancement
+ */
+void ThreadSimulation::Demarrer(const ParametresRelance& parametres)
+{
+    Creer(parametres);
+    Publier();
+    mInstantanes.Lire();
+    mThread = std::thread(&ThreadSimulation::Boucle, this);
+}
+
+/**
+ * @brief Ajoute l'ordre à la file et réveille le thread
+ */
+void ThreadSimulation::Envoyer(const CommandeSimulation& commande)
+{
+    {
+        std::lock_guard<std::mutex> verrou(mMutex);
+        mCommandes.push_back(commande);
+    }
+    mSignal.notify_one();
+}
+
+/**
+ * @brief Prend la dernière publication si elle est nouvelle
+ */
+const InstantaneRendu& ThreadSimulation::Consulter()
+{
+    mInstantanes.Lire();
+    return mInstantanes.Lecture();
+}
+
+/**
+ * @brief Demande l'arrêt et rejoint le thread
+ */
+void ThreadSimulation::Arreter()
+{
+    if (!mThread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> verrou(mMutex);
+        mArret = true;
+    }
+    mSignal.notify_one();
+    mThread.join();
+}
@@ -0,0 +1,155 @@
+/**
+ * @file ThreadSimulation.h
+ * @brief Simulation sur son propre thread : instantanés publiés, commandes reçues
+ */
+
+#ifndef THREAD_SIMULATION_H
+#define THREAD_SIMULATION_H
+
+#include "TripleTampon.h"
+#include "../Population/InstantaneRendu.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Ecosysteme;
+class ModeleChampMoyen;
+
+/**
+ * @struct ParametresRelance
+ * @brief Réglages du panneau de contrôle appliqués à la création d'un écosystème
+ */
+struct ParametresRelance
+{
+    int nbProies;           /**< Proies initiales */
+    int nbPredateurs;       /**< Prédateurs initiaux */
+    int nbPlantes;          /**< Plantes initiales */
+    float delaiPlantes;     /**< Intervalle d'apparition des plantes */
+    unsigned int graine;    /**< Graine de rand() pour le peuplement */
+};
+
+/**
+ * @enum TypeCommande
+ * @brief Ordres du thread principal au thread de simulation
+ */
+enum TypeCommande
+{
+    COMMANDE_PAUSE,         /**< Suspendre les ticks */
+    COMMANDE_REPRISE,       /**< Reprendre les ticks */
+    COMMANDE_RELANCER       /**< Repeupler l'écosystème avec de nouveaux réglages */
+};
+
+/**
+ * @struct CommandeSimulation
+ * @brief Ordre mis en file pour le thread de simulation
+ */
+struct CommandeSimulation
+{
+    TypeCommande type;              /**< Nature de l'ordre */
+    ParametresRelance relance;      /**< Réglages (COMMANDE_RELANCER) */
+};
+
+/**
+ * @class ThreadSimulation
+ * @brief Possède l'écosystème et le fait avancer à son rythme, hors du thread d'affichage
+ *
+ * Le thread de simulation enchaîne ticks et captures ; le thread principal
+ * dessine le dernier instantané publié, que la frame précédente ait duré
+ * 5 ou 50 ms : un tick lent ne fige plus l'interface, un rendu lent ne
+ * ralentit plus la simulation. Les instantanés passent par un triple tampon
+ * sans verrou ; les ordres du panneau de contrôle remontent par une file
+ * protégée, vidée une fois par tick.
+ * L'écosystème n'est touché que par le thread de simulation une fois
+ * Demarrer appelé. Le système de tâches est partagé avec le rendu : les
+ * boucles des tuiles et celles de la carte de densité s'y côtoient.
+ */
+class ThreadSimulation
+{
+public:
+    /**
+     * @brief Crée et règle un écosystème (appelée sur le thread de simulation pour une relance)
+     */
+    using Fabrique = std::function<Ecosysteme*(const ParametresRelance&)>;
+
+private:
+    Fabrique mFabrique;                             /**< Création des écosystèmes */
+    bool mAvecChampMoyen;                           /**< Suivre le modèle en champ moyen */
+    Ecosysteme* mEco;                               /**< Écosystème simulé (possédé) */
+    ModeleChampMoyen* mChampMoyen;                  /**< Modèle suivi (possédé, nullptr sans suivi) */
+    TripleTampon<InstantaneRendu> mInstantanes;     /**< Instantanés publiés */
+    std::thread mThread;                            /**< Thread de simulation */
+    std::mutex mMutex;                              /**< Protège mCommandes et mArret */
+    std::condition_variable mSignal;                /**< Signale une commande ou l'arrêt */
+    std::vector<CommandeSimulation> mCommandes;     /**< Commandes envoyées, pas encore prises */
+    std::vector<CommandeSimulation> mATraiter;      /**< Commandes prises (thread de simulation) */
+    bool mArret;                                    /**< Demande d'arrêt */
+    bool mPause;                                    /**< Ticks suspendus (thread de simulation) */
+
+    static constexpr double PERIODE_TICK = 1.0 / 60.0;     /**< Intervalle visé entre deux ticks (s) */
+
+    /**
+     * @brief Boucle du thread : commandes, tick, publication, attente du tick suivant
+     */
+    void Boucle();
+
+    /**
+     * @brief Relance l'écosystème sur place, ou le remplace par un neuf ; le champ moyen repart
+     * @param parametres Réglages de création
+     * @return true si l'écosystème existant a été relancé sans reconstruction
+     */
+    bool Creer(const ParametresRelance& parametres);
+
+    /**
+     * @brief Applique les commandes prises dans la file
+     * @return true si l'écosystème a été recréé
+     */
+    bool TraiterCommandes();
+
+    /**
+     * @brief Capture l'écosystème dans l'instantané libre et le publie
+     */
+    void Publier();
+
+public:
+    /**
+     * @brief Constructeur
+     * @param fabrique Création d'un écosystème réglé (espèces du registre comprises)
+     * @param champMoyen true pour suivre le modèle en champ moyen à côté des agents
+     */
+    ThreadSimulation(Fabrique fabrique, bool champMoyen);
+
+    /**
+     * @brief Arrête le thread et libère l'écosystème
+     */
+    ~ThreadSimulation();
+
+    ThreadSimulation(const ThreadSimulation&) = delete;
+    ThreadSimulation& operator=(const ThreadSimulation&) = delete;
+
+    /**
+     * @brief Crée l'écosystème, publie un premier instantané et lance le thread
+     * @param parametres Réglages de création
+     */
+    void Demarrer(const ParametresRelance& parametres);
+
+    /**
+     * @brief Met un ordre en file ; il sera appliqué avant le prochain tick
+     * @param commande Ordre
+     */
+    void Envoyer(const CommandeSimulation& commande);
+
+    /**
+     * @brief Dernier instantané publié (thread principal)
+     * @return Instantané, valable jusqu'au prochain appel
+     */
+    const InstantaneRendu& Consulter();
+
+    /**
+     * @brief Arrête le thread de simulation et attend sa fin
+     */
+    void Arreter();
+};
+
+#endif /* THREAD_SIMULATION_H */
@@ -0,0 +1,223 @@
+/**
+ * @file Traceur.cpp
+ * @brief Tampons de phases par thread et export JSON
+ */
+
+#include "Traceur.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Traceur::sActif(false);
+
+/**
+ * @struct PhaseTracee
+ * @brief Phase terminée : nom, début et durée en nanosecondes depuis Demarrer
+ */
+struct PhaseTracee
+{
+    const char* nom;    /**< Nom littéral passé à Debut */
+    int64_t debut;      /**< Début (ns) */
+    int64_t duree;      /**< Durée (ns) */
+};
+
+/**
+ * @struct TamponTrace
+ * @brief Phases d'un thread : anneau des terminées, pile des ouvertes
+ */
+struct TamponTrace
+{
+    int tid;                                        /**< Numéro du thread dans la trace */
+    std::string nom;                                /**< Nom affiché (vide : numéro seul) */
+    std::vector<PhaseTracee> phases;                /**< Anneau de CAPACITE_THREAD phases */
+    uint64_t nbTerminees;                           /**< Phases écrites depuis le début (anneau compris) */
+    const char* pileNoms[Traceur::PROFONDEUR_MAX];  /**< Noms des phases ouvertes */
+    int64_t pileDebuts[Traceur::PROFONDEUR_MAX];    /**< Débuts des phases ouvertes */
+    int profondeur;                                 /**< Phases ouvertes (peut dépasser PROFONDEUR_MAX) */
+};
+
+/**
+ * @struct RegistreTampons
+ * @brief Tampons de tous les threads ayant tracé, libérés à la fin du programme
+ *
+ * Un tampon survit à son thread : les encodeurs rejoints avant l'export
+ * gardent leurs phases.
+ */
+struct RegistreTampons
+{
+    std::mutex mutex;                               /**< Protège la liste des tampons */
+    std::vector<TamponTrace*> tampons;              /**< Un tampon par thread (possédés) */
+    std::chrono::steady_clock::time_point origine;  /**< Instant de Demarrer */
+
+    ~RegistreTampons()
+    {
+        for (auto* tampon : tampons)
+            delete tampon;
+    }
+};
+
+static RegistreTampons sRegistre;
+static thread_local TamponTrace* tTampon = nullptr;    /**< Tampon du thread (nullptr avant sa première phase) */
+static thread_local std::string tNomThread;            /**< Nom donné par NommerThread */
+
+/**
+ * @brief Nanosecondes écoulées depuis Demarrer
+ */
+static int64_t Maintenant()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - sRegistre.origine).count();
+}
+
+/**
+ * @brief Tampon du thread appelant, alloué en entier à sa première phase
+ */
+static TamponTrace* TamponDuThread()
+{
+    if (tTampon)
+        return tTampon;
+
+    TamponTrace* tampon = new TamponTrace;
+    tampon->nom = tNomThread;
+    tampon->phases.resize(Traceur::CAPACITE_THREAD);
+    tampon->nbTerminees = 0;
+    tampon->profondeur = 0;
+
+    std::lock_guard<std::mutex> verrou(sRegistre.mutex);
+    tampon->tid = static_cast<int>(sRegistre.tampons.size()) + 1;
+    sRegistre.tampons.push_back(tampon);
+    tTampon = tampon;
+    return tampon;
+}
+
+/**
+ * @brief L'origine des temps est fixée avant l'activation
+ */
+void Traceur::Demarrer()
+{
+    if (sActif)
+        return;
+    sRegistre.origine = std::chrono::steady_clock::now();
+    sActif = true;
+}
+
+/**
+ * @brief Au-delà de PROFONDEUR_MAX, la phase est seulement comptée pour rester appariée
+ */
+void Traceur::Empiler(const char* nom)
+{
+    TamponTrace* tampon = TamponDuThread();
+    if (tampon->profondeur < PROFONDEUR_MAX)
+    {
+        tampon->pileNoms[tampon->profondeur] = nom;
+        tampon->pileDebuts[tampon->profondeur] = Maintenant();
+    }
+    tampon->profondeur++;
+}
+
+/**
+ * @brief Une fin sans début (phase ouverte avant Demarrer) est ignorée
+ */
+void Traceur::Depiler()
+{
+    TamponTrace* tampon = tTampon;
+    if (!tampon || tampon->profondeur == 0)
+        return;
+
+    tampon->profondeur--;
+    if (tampon->profondeur >= PROFONDEUR_MAX)
+        return;
+
+    PhaseTracee& phase = tampon->phases[tampon->nbTerminees % CAPACITE_THREAD];
+    phase.nom = tampon->pileNoms[tampon->profondeur];
+    phase.debut = tampon->pileDebuts[tampon->profondeur];
+    phase.duree = Maintenant() - phase.debut;
+    tampon->nbTerminees++;
+}
+
+/**
+ * @brief Le nom est gardé par le thread jusqu'à sa première phase
+ */
+void Traceur::NommerThread(const std::string& nom)
+{
+    tNomThread = nom;
+    if (tTampon)
+        tTampon->nom = nom;
+}
+
+/**
+ * @brief Écrit une chaîne JSON (guillemets et antislashs échappés)
+ */
+static void EcrireChaine(FILE* fichier, const std::string& texte)
+{
+    fputc('"', fichier);
+    for (char c : texte)
+    {
+        if (c == '"' || c == '\\')
+            fputc('\\', fichier);
+        if (static_cast<unsigned char>(c) >= 0x20)
+            fputc(c, fichier);
+    }
+    fputc('"', fichier);
+}
+
+/**
+ * @brief Noms des threads (événements « M »), puis phases complètes (« X »), de la plus ancienne à la plus récente
+ */
+bool Traceur::Exporter(const std::string& chemin, int processus)
+{
+    if (!sActif.exchange(false))
+        return false;
+
+    FILE* fichier = fopen(chemin.c_str(), "w");
+    if (!fichier)
+    {
+        std::cerr << "❌ Impossible d'écrire la trace " << chemin << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> verrou(sRegistre.mutex);
+    uint64_t nbEcrites = 0;
+    uint64_t nbPerdues = 0;
+    bool premier = true;
+
+    fprintf(fichier, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (auto* tampon : sRegistre.tampons)
+    {
+        fprintf(fichier, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+                premier ? "" : ",\n", processus, tampon->tid);
+        EcrireChaine(fichier, tampon->nom.empty() ? "Thread " + std::to_string(tampon->tid) : tampon->nom);
+        fprintf(fichier, "}}");
+        premier = false;
+
+        uint64_t gardees = std::min<uint64_t>(tampon->nbTerminees, CAPACITE_THREAD);
+        uint64_t premiere = tampon->nbTerminees - gardees;
+        for (uint64_t i = premiere; i < tampon->nbTerminees; i++)
+        {
+            const PhaseTracee& phase = tampon->phases[i % CAPACITE_THREAD];
+            fprintf(fichier, ",\n{\"name\":");
+            EcrireChaine(fichier, phase.nom);
+            fprintf(fichier, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                    phase.debut / 1000.0, phase.duree / 1000.0, processus, tampon->tid);
+        }
+        nbEcrites += gardees;
+        nbPerdues += premiere;
+    }
+    fprintf(fichier, "\n]}\n");
+
+    if (fclose(fichier) != 0)
+    {
+        std::cerr << "❌ Écriture de la trace " << chemin << " incomplète" << std::endl;
+        return false;
+    }
+
+    std::cout << "📈 Trace écrite dans " << chemin << " : " << nbEcrites << " phases, "
+              << sRegistre.tampons.size() << " threads";
+    if (nbPerdues > 0)
+        std::cout << " (" << nbPerdues << " plus anciennes écrasées)";
+    std::cout << std::endl;
+    return true;
+}
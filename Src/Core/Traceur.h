@@ -0,0 +1,95 @@
+/**
+ * @file Traceur.h
+ * @brief Trace des phases de simulation et de rendu, exportée au format Chrome trace-event
+ */
+
+#ifndef TRACEUR_H
+#define TRACEUR_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class Traceur
+ * @brief Enregistre début et fin de chaque phase, par thread, pour chrome://tracing ou Perfetto
+ *
+ * Désactivé, Debut et Fin se réduisent à la lecture d'un booléen atomique.
+ * Activé, chaque thread écrit dans son propre tampon, alloué une fois à sa
+ * première phase : aucun verrou ni allocation ensuite. Le tampon est
+ * circulaire, si bien qu'une longue session garde les CAPACITE_THREAD
+ * dernières phases de chaque thread ; les plus anciennes sont comptées
+ * perdues. Une phase est mémorisée à sa fin, en un seul événement complet
+ * (début et durée) : un tampon qui a fait le tour ne laisse jamais de
+ * début sans fin.
+ *
+ * Les noms de phases doivent être des chaînes littérales (seul le pointeur
+ * est gardé). Une seule session par processus : Demarrer, puis Exporter une
+ * fois que plus aucun thread ne trace.
+ */
+class Traceur
+{
+private:
+    static std::atomic<bool> sActif;    /**< Session en cours */
+
+    /**
+     * @brief Empile le début d'une phase du thread appelant
+     * @param nom Nom de la phase (littéral)
+     */
+    static void Empiler(const char* nom);
+
+    /**
+     * @brief Dépile la phase courante et la mémorise
+     */
+    static void Depiler();
+
+public:
+    static constexpr size_t CAPACITE_THREAD = 1 << 18;     /**< Phases gardées par thread (6 Mo) */
+    static constexpr int PROFONDEUR_MAX = 32;               /**< Phases imbriquées suivies par thread */
+
+    /**
+     * @brief Ouvre la session : l'origine des temps est maintenant
+     */
+    static void Demarrer();
+
+    /**
+     * @brief Indique si une session est en cours
+     * @return true entre Demarrer et Exporter
+     */
+    static bool EstActif() { return sActif.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Ouvre une phase du thread appelant
+     * @param nom Nom de la phase (chaîne littérale)
+     */
+    static void Debut(const char* nom)
+    {
+        if (EstActif())
+            Empiler(nom);
+    }
+
+    /**
+     * @brief Ferme la dernière phase ouverte par le thread appelant
+     */
+    static void Fin()
+    {
+        if (EstActif())
+            Depiler();
+    }
+
+    /**
+     * @brief Nomme le thread appelant dans la trace
+     * @param nom Nom affiché (copié ; peut précéder Demarrer)
+     */
+    static void NommerThread(const std::string& nom);
+
+    /**
+     * @brief Clôt la session et écrit toutes les phases gardées
+     * @param chemin Fichier JSON à écrire
+     * @param processus Numéro de processus dans la trace (une bande distribuée chacune)
+     * @return false si le fichier n'a pas pu être écrit
+     */
+    static bool Exporter(const std::string& chemin, int processus = 1);
+};
+
+#endif /* TRACEUR_H */
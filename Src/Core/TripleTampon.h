@@ -0,0 +1,81 @@
+/**
+ * @file TripleTampon.h
+ * @brief Triple tampon sans verrou : un producteur publie, un consommateur lit le plus récent
+ */
+
+#ifndef TRIPLE_TAMPON_H
+#define TRIPLE_TAMPON_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleTampon
+ * @brief Trois exemplaires d'une valeur : un écrit, un publié, un lu
+ * @tparam T Valeur échangée (réutilisée : ses tampons internes survivent d'un tour à l'autre)
+ *
+ * Le producteur remplit Ecriture puis Publier l'échange avec l'exemplaire du
+ * milieu ; le consommateur, par Lire, échange le sien avec celui du milieu
+ * s'il est plus récent. Aucun des deux n'attend jamais l'autre : le
+ * producteur écrase une publication que personne n'a lue, le consommateur
+ * garde la dernière lue tant qu'il n'y en a pas de nouvelle. Un seul
+ * producteur et un seul consommateur.
+ */
+template<typename T>
+class TripleTampon
+{
+private:
+    static constexpr uint8_t INDICE = 0x3;      /**< Bits de l'indice dans mMilieu */
+    static constexpr uint8_t NOUVEAU = 0x4;     /**< Le milieu n'a pas encore été lu */
+
+    T mExemplaires[3];                  /**< Les trois exemplaires */
+    std::atomic<uint8_t> mMilieu;       /**< Indice de l'exemplaire publié, et NOUVEAU */
+    uint8_t mEcriture;                  /**< Exemplaire du producteur */
+    uint8_t mLecture;                   /**< Exemplaire du consommateur */
+
+public:
+    /**
+     * @brief Constructeur : rien de publié
+     */
+    TripleTampon() : mMilieu(1), mEcriture(0), mLecture(2) {}
+
+    TripleTampon(const TripleTampon&) = delete;
+    TripleTampon& operator=(const TripleTampon&) = delete;
+
+    /**
+     * @brief Exemplaire à remplir (producteur)
+     * @return Exemplaire réservé au producteur jusqu'à Publier
+     */
+    T& Ecriture() { return mExemplaires[mEcriture]; }
+
+    /**
+     * @brief Publie l'exemplaire rempli et en reprend un libre (producteur)
+     */
+    void Publier()
+    {
+        /* release : le contenu écrit est visible de qui prendra le milieu */
+        uint8_t ancien = mMilieu.exchange(static_cast<uint8_t>(mEcriture | NOUVEAU), std::memory_order_acq_rel);
+        mEcriture = ancien & INDICE;
+    }
+
+    /**
+     * @brief Prend la dernière publication s'il y en a une nouvelle (consommateur)
+     * @return true si Lecture a changé
+     */
+    bool Lire()
+    {
+        if (!(mMilieu.load(std::memory_order_relaxed) & NOUVEAU))
+            return false;
+        uint8_t ancien = mMilieu.exchange(mLecture, std::memory_order_acq_rel);
+        mLecture = ancien & INDICE;
+        return true;
+    }
+
+    /**
+     * @brief Dernier exemplaire pris par Lire (consommateur)
+     * @return Exemplaire réservé au consommateur jusqu'au prochain Lire
+     */
+    const T& Lecture() const { return mExemplaires[mLecture]; }
+};
+
+#endif /* TRIPLE_TAMPON_H */
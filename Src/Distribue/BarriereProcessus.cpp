@@ -0,0 +1,77 @@
+/**
+ * @file BarriereProcessus.cpp
+ * @brief Implémentation de la barrière inter-processus (pthread partagé)
+ */
+
+#include "BarriereProcessus.h"
+#include "MemoirePartagee.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Constructeur
+ */
+BarriereProcessus::BarriereProcessus()
+    : mBarriere(nullptr)
+    , mNbProcessus(0)
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+BarriereProcessus::~BarriereProcessus()
+{
+#ifdef __linux__
+    if (mBarriere)
+    {
+        pthread_barrier_destroy(static_cast<pthread_barrier_t*>(mBarriere));
+        LibererMemoirePartagee(mBarriere, sizeof(pthread_barrier_t));
+    }
+#endif
+}
+
+/**
+ * @brief Crée une barrière PTHREAD_PROCESS_SHARED dans une zone partagée
+ */
+bool BarriereProcessus::Creer(int nbProcessus)
+{
+#ifdef __linux__
+    mBarriere = AllouerMemoirePartagee(sizeof(pthread_barrier_t));
+    if (!mBarriere)
+        return false;
+
+    pthread_barrierattr_t attributs;
+    pthread_barrierattr_init(&attributs);
+    pthread_barrierattr_setpshared(&attributs, PTHREAD_PROCESS_SHARED);
+    int erreur = pthread_barrier_init(static_cast<pthread_barrier_t*>(mBarriere),
+                                      &attributs, nbProcessus);
+    pthread_barrierattr_destroy(&attributs);
+
+    if (erreur != 0)
+    {
+        LibererMemoirePartagee(mBarriere, sizeof(pthread_barrier_t));
+        mBarriere = nullptr;
+        return false;
+    }
+
+    mNbProcessus = nbProcessus;
+    return true;
+#else
+    (void)nbProcessus;
+    return false;
+#endif
+}
+
+/**
+ * @brief Attend tous les participants
+ */
+void BarriereProcessus::Attendre()
+{
+#ifdef __linux__
+    if (mBarriere)
+        pthread_barrier_wait(static_cast<pthread_barrier_t*>(mBarriere));
+#endif
+}
@@ -0,0 +1,47 @@
+/**
+ * @file BarriereProcessus.h
+ * @brief Barrière de synchronisation entre processus
+ */
+
+#ifndef BARRIERE_PROCESSUS_H
+#define BARRIERE_PROCESSUS_H
+
+/**
+ * @class BarriereProcessus
+ * @brief Bloque chaque processus jusqu'à ce que tous aient atteint le même point
+ *
+ * La barrière vit en mémoire partagée : elle doit être créée avant fork() et
+ * reste utilisable par tous les fils. Les fils se terminent par _exit() : seul
+ * le processus créateur exécute le destructeur et détruit la barrière.
+ */
+class BarriereProcessus
+{
+private:
+    void* mBarriere;        /**< pthread_barrier_t partagé */
+    int mNbProcessus;       /**< Nombre de participants */
+
+public:
+    /**
+     * @brief Constructeur (barrière non créée)
+     */
+    BarriereProcessus();
+
+    /**
+     * @brief Destructeur (détruit la barrière si elle a été créée ici)
+     */
+    ~BarriereProcessus();
+
+    /**
+     * @brief Crée la barrière en mémoire partagée
+     * @param nbProcessus Nombre de processus qui l'attendront
+     * @return true si succès, false sinon
+     */
+    bool Creer(int nbProcessus);
+
+    /**
+     * @brief Attend que tous les participants soient arrivés
+     */
+    void Attendre();
+};
+
+#endif /* BARRIERE_PROCESSUS_H */
@@ -0,0 +1,39 @@
+/**
+ * @file MemoirePartagee.cpp
+ * @brief Implémentation de l'allocation partagée (mmap anonyme)
+ */
+
+#include "MemoirePartagee.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Alloue une zone MAP_SHARED | MAP_ANONYMOUS (déjà remplie de zéros)
+ */
+void* AllouerMemoirePartagee(size_t taille)
+{
+#ifdef __linux__
+    void* zone = mmap(nullptr, taille, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    return (zone == MAP_FAILED) ? nullptr : zone;
+#else
+    (void)taille;
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Libère une zone partagée
+ */
+void LibererMemoirePartagee(void* zone, size_t taille)
+{
+#ifdef __linux__
+    if (zone)
+        munmap(zone, taille);
+#else
+    (void)zone;
+    (void)taille;
+#endif
+}
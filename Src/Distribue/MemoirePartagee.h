@@ -0,0 +1,25 @@
+/**
+ * @file MemoirePartagee.h
+ * @brief Allocation de mémoire partagée entre un processus et ses fils
+ */
+
+#ifndef MEMOIRE_PARTAGEE_H
+#define MEMOIRE_PARTAGEE_H
+
+#include <cstddef>
+
+/**
+ * @brief Alloue une zone anonyme partagée, héritée par les processus créés ensuite
+ * @param taille Taille en octets
+ * @return Zone mise à zéro, nullptr en cas d'échec ou hors Linux
+ */
+void* AllouerMemoirePartagee(size_t taille);
+
+/**
+ * @brief Libère une zone allouée par AllouerMemoirePartagee
+ * @param zone Zone à libérer (nullptr accepté)
+ * @param taille Taille passée à l'allocation
+ */
+void LibererMemoirePartagee(void* zone, size_t taille);
+
+#endif /* MEMOIRE_PARTAGEE_H */
@@ -0,0 +1,571 @@
+/**
+ * @file SimulationDistribuee.cpp
+ * @brief Implémentation de la simulation distribuée en bandes
+ */
+
+#include "SimulationDistribuee.h"
+#include "BarriereProcessus.h"
+#include "MemoirePartagee.h"
+#include "TransportMemoirePartagee.h"
+#include "TransportSocket.h"
+#include "../Core/PoolThreads.h"
+#include "../Core/Traceur.h"
+#include "../Population/DecompositionSpatiale.h"
+#include "../Population/Ecosysteme.h"
+#include "../Population/Proie.h"
+#include "../Population/Predateur.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @struct StatistiquesBande
+ * @brief Populations d'une bande à la fin d'un tick (mémoire partagée)
+ */
+struct StatistiquesBande
+{
+    int32_t proies;         /**< Proies possédées */
+    int32_t predateurs;     /**< Prédateurs possédés */
+    int32_t plantes;        /**< Plantes disponibles */
+};
+
+/**
+ * @struct EnteteFrontiere
+ * @brief Début d'un message entre bandes voisines
+ *
+ * Suivi de : nbProies MigrantProie, nbPredateurs EtatAnimal (migrants),
+ * nbFantomesProies puis nbFantomesPredateurs EtatAnimal (fantômes), et
+ * nbProiesTuees uint32_t (indices dans les fantômes reçus au tick précédent).
+ */
+struct EnteteFrontiere
+{
+    uint32_t nbProies;
+    uint32_t nbPredateurs;
+    uint32_t nbFantomesProies;
+    uint32_t nbFantomesPredateurs;
+    uint32_t nbProiesTuees;
+};
+
+/**
+ * @struct MigrantProie
+ * @brief Proie changeant de bande
+ */
+struct MigrantProie
+{
+    EtatAnimal etat;        /**< État de la proie */
+    int32_t fantome;        /**< Indice de son fantôme chez le destinataire, -1 s'il n'en avait pas */
+};
+
+/**
+ * @brief Ajoute n éléments à la fin d'un message
+ */
+template<typename T>
+static void Ecrire(std::vector<uint8_t>& message, const T* elements, size_t n)
+{
+    size_t debut = message.size();
+    message.resize(debut + n * sizeof(T));
+    if (n > 0)
+        memcpy(message.data() + debut, elements, n * sizeof(T));
+}
+
+/**
+ * @brief Lit n éléments d'un message à partir d'une position
+ * @return false si le message est trop court
+ */
+template<typename T>
+static bool Lire(const std::vector<uint8_t>& message, size_t& position, T* elements, size_t n)
+{
+    if (position + n * sizeof(T) > message.size())
+        return false;
+    if (n > 0)
+        memcpy(elements, message.data() + position, n * sizeof(T));
+    position += n * sizeof(T);
+    return true;
+}
+
+/**
+ * @class Bande
+ * @brief État propre à un processus fils : son écosystème et ses échanges
+ */
+class Bande
+{
+private:
+    Ecosysteme& mEco;                           /**< Écosystème restreint à la bande */
+    int mRang;                                  /**< Rang de la bande */
+    bool mVoisin[2];                            /**< Existence des voisins gauche et droite */
+    float mX0;                                  /**< Bord gauche de la bande */
+    float mX1;                                  /**< Bord droit de la bande (exclu) */
+
+    std::vector<Proie*> mReserveProies[2];      /**< Objets fantômes réutilisés, par côté */
+    std::vector<Predateur*> mReservePredateurs[2];  /**< Objets fantômes prédateurs, par côté */
+    size_t mNbFantomesProies[2];                /**< Fantômes proies actifs de chaque côté */
+    size_t mNbFantomesPredateurs[2];            /**< Fantômes prédateurs actifs de chaque côté */
+    std::vector<Proie*> mFantomesProies;        /**< Fantômes vus par l'écosystème (gauche puis droite) */
+    std::vector<Predateur*> mFantomesPredateurs;    /**< Idem pour les prédateurs */
+
+    std::vector<Proie*> mExportees[2];          /**< Proies envoyées en fantôme au tick précédent */
+    std::vector<Proie*> mNouvellesExportees[2]; /**< Proies envoyées en fantôme à ce tick */
+    std::vector<uint32_t> mTuees[2];            /**< Fantômes reçus mangés ici ce tick */
+    std::vector<bool> mFantomeTue[2];           /**< Même information, indexée par fantôme */
+
+    std::vector<Proie*> mSortantesProies;       /**< Émigrants, libérés après l'échange */
+    std::vector<Predateur*> mSortantsPredateurs;    /**< Idem pour les prédateurs */
+
+    /* Tampons de (dé)sérialisation réutilisés d'un tick à l'autre, par côté */
+    std::vector<MigrantProie> mMigrantsProies[2];
+    std::vector<EtatAnimal> mMigrantsPredateurs[2];
+    std::vector<EtatAnimal> mEtatsFantomesProies[2];
+    std::vector<EtatAnimal> mEtatsFantomesPredateurs[2];
+
+    /**
+     * @brief Côté vers lequel un animal a quitté la bande
+     */
+    int CoteSortie(float x) const
+    {
+        return (x < mX0) ? TransportFrontiere::GAUCHE : TransportFrontiere::DROITE;
+    }
+
+    /**
+     * @brief Recopie les fantômes reçus d'un côté dans la réserve
+     */
+    void ChargerFantomes(int cote, const EtatAnimal* proies, size_t nbProies,
+                         const EtatAnimal* predateurs, size_t nbPredateurs)
+    {
+        while (mReserveProies[cote].size() < nbProies)
+            mReserveProies[cote].push_back(new Proie(0.0f, 0.0f));
+        while (mReservePredateurs[cote].size() < nbPredateurs)
+            mReservePredateurs[cote].push_back(new Predateur(0.0f, 0.0f));
+
+        for (size_t i = 0; i < nbProies; i++)
+            mReserveProies[cote][i]->AppliquerEtat(proies[i]);
+        for (size_t i = 0; i < nbPredateurs; i++)
+            mReservePredateurs[cote][i]->AppliquerEtat(predateurs[i]);
+
+        mNbFantomesProies[cote] = nbProies;
+        mNbFantomesPredateurs[cote] = nbPredateurs;
+    }
+
+public:
+    Bande(Ecosysteme& eco, int rang, int nbProcessus, float x0, float x1)
+        : mEco(eco)
+        , mRang(rang)
+        , mVoisin{rang > 0, rang < nbProcessus - 1}
+        , mX0(x0)
+        , mX1(x1)
+        , mNbFantomesProies{0, 0}
+        , mNbFantomesPredateurs{0, 0}
+    {
+        mEco.DefinirFantomes(mFantomesProies, mFantomesPredateurs);
+    }
+
+    ~Bande()
+    {
+        for (int cote = 0; cote < 2; cote++)
+        {
+            for (auto* proie : mReserveProies[cote])
+                delete proie;
+            for (auto* pred : mReservePredateurs[cote])
+                delete pred;
+        }
+    }
+
+    /**
+     * @brief Construit les messages pour les voisins après Update
+     * @param envois Messages gauche et droite
+     */
+    void Preparer(std::vector<uint8_t> envois[2])
+    {
+        const float rayon = DecompositionSpatiale::RAYON_FANTOME;
+
+        for (int cote = 0; cote < 2; cote++)
+        {
+            mMigrantsProies[cote].clear();
+            mMigrantsPredateurs[cote].clear();
+            mEtatsFantomesProies[cote].clear();
+            mEtatsFantomesPredateurs[cote].clear();
+            mNouvellesExportees[cote].clear();
+
+            /* Fantômes reçus que nos prédateurs ont mangés */
+            mTuees[cote].clear();
+            mFantomeTue[cote].assign(mNbFantomesProies[cote], false);
+            for (size_t i = 0; i < mNbFantomesProies[cote]; i++)
+            {
+                if (!mReserveProies[cote][i]->EstVivant())
+                {
+                    mTuees[cote].push_back(static_cast<uint32_t>(i));
+                    mFantomeTue[cote][i] = true;
+                }
+            }
+        }
+
+        /* Émigrants : le destinataire apprend quel fantôme ils étaient */
+        mEco.ExtraireHorsBande(mSortantesProies, mSortantsPredateurs);
+        for (auto* proie : mSortantesProies)
+        {
+            int cote = CoteSortie(proie->GetX());
+            MigrantProie migrant;
+            migrant.etat = proie->GetEtat(mEco.GetMonde());
+            auto trouve = std::find(mExportees[cote].begin(), mExportees[cote].end(), proie);
+            migrant.fantome = (trouve == mExportees[cote].end())
+                            ? -1 : static_cast<int32_t>(trouve - mExportees[cote].begin());
+            mMigrantsProies[cote].push_back(migrant);
+        }
+        for (auto* pred : mSortantsPredateurs)
+            mMigrantsPredateurs[CoteSortie(pred->GetX())].push_back(pred->GetEtat(mEco.GetMonde()));
+
+        /* Fantômes : animaux vivants à moins d'un rayon de détection d'une frontière */
+        for (auto* proie : mEco.GetProies())
+        {
+            if (!proie->EstVivant())
+                continue;
+            if (mVoisin[TransportFrontiere::GAUCHE] && proie->GetX() < mX0 + rayon)
+            {
+                mNouvellesExportees[TransportFrontiere::GAUCHE].push_back(proie);
+                mEtatsFantomesProies[TransportFrontiere::GAUCHE].push_back(proie->GetEtat(mEco.GetMonde()));
+            }
+            if (mVoisin[TransportFrontiere::DROITE] && proie->GetX() >= mX1 - rayon)
+            {
+                mNouvellesExportees[TransportFrontiere::DROITE].push_back(proie);
+                mEtatsFantomesProies[TransportFrontiere::DROITE].push_back(proie->GetEtat(mEco.GetMonde()));
+            }
+        }
+        for (auto* pred : mEco.GetPredateurs())
+        {
+            if (!pred->EstVivant())
+                continue;
+            if (mVoisin[TransportFrontiere::GAUCHE] && pred->GetX() < mX0 + rayon)
+                mEtatsFantomesPredateurs[TransportFrontiere::GAUCHE].push_back(pred->GetEtat(mEco.GetMonde()));
+            if (mVoisin[TransportFrontiere::DROITE] && pred->GetX() >= mX1 - rayon)
+                mEtatsFantomesPredateurs[TransportFrontiere::DROITE].push_back(pred->GetEtat(mEco.GetMonde()));
+        }
+
+        for (int cote = 0; cote < 2; cote++)
+        {
+            EnteteFrontiere entete;
+            entete.nbProies = static_cast<uint32_t>(mMigrantsProies[cote].size());
+            entete.nbPredateurs = static_cast<uint32_t>(mMigrantsPredateurs[cote].size());
+            entete.nbFantomesProies = static_cast<uint32_t>(mEtatsFantomesProies[cote].size());
+            entete.nbFantomesPredateurs = static_cast<uint32_t>(mEtatsFantomesPredateurs[cote].size());
+            entete.nbProiesTuees = static_cast<uint32_t>(mTuees[cote].size());
+
+            envois[cote].clear();
+            Ecrire(envois[cote], &entete, 1);
+            Ecrire(envois[cote], mMigrantsProies[cote].data(), mMigrantsProies[cote].size());
+            Ecrire(envois[cote], mMigrantsPredateurs[cote].data(), mMigrantsPredateurs[cote].size());
+            Ecrire(envois[cote], mEtatsFantomesProies[cote].data(), mEtatsFantomesProies[cote].size());
+            Ecrire(envois[cote], mEtatsFantomesPredateurs[cote].data(), mEtatsFantomesPredateurs[cote].size());
+            Ecrire(envois[cote], mTuees[cote].data(), mTuees[cote].size());
+        }
+    }
+
+    /**
+     * @brief Applique les messages des voisins (morts, immigrants, fantômes)
+     * @param receptions Messages reçus de gauche et de droite
+     * @return false si un message est mal formé
+     */
+    bool Appliquer(const std::vector<uint8_t> receptions[2])
+    {
+        for (int cote = 0; cote < 2; cote++)
+        {
+            if (!mVoisin[cote])
+                continue;
+
+            const std::vector<uint8_t>& message = receptions[cote];
+            size_t position = 0;
+            EnteteFrontiere entete;
+            if (!Lire(message, position, &entete, 1))
+                return false;
+
+            mMigrantsProies[cote].resize(entete.nbProies);
+            mMigrantsPredateurs[cote].resize(entete.nbPredateurs);
+            mEtatsFantomesProies[cote].resize(entete.nbFantomesProies);
+            mEtatsFantomesPredateurs[cote].resize(entete.nbFantomesPredateurs);
+            mTuees[cote].resize(entete.nbProiesTuees);
+
+            if (!Lire(message, position, mMigrantsProies[cote].data(), entete.nbProies)
+                || !Lire(message, position, mMigrantsPredateurs[cote].data(), entete.nbPredateurs)
+                || !Lire(message, position, mEtatsFantomesProies[cote].data(), entete.nbFantomesProies)
+                || !Lire(message, position, mEtatsFantomesPredateurs[cote].data(), entete.nbFantomesPredateurs)
+                || !Lire(message, position, mTuees[cote].data(), entete.nbProiesTuees))
+                return false;
+
+            /* Nos fantômes mangés chez le voisin : mêmes indices que nos exportations */
+            for (uint32_t indice : mTuees[cote])
+            {
+                if (indice < mExportees[cote].size())
+                    mExportees[cote][indice]->PerdreEnergie(100.0f);
+            }
+
+            /* Un immigrant que l'on a déjà mangé sous forme de fantôme n'arrive jamais */
+            for (const MigrantProie& migrant : mMigrantsProies[cote])
+            {
+                bool mange = (migrant.fantome >= 0
+                              && static_cast<size_t>(migrant.fantome) < mFantomeTue[cote].size()
+                              && mFantomeTue[cote][migrant.fantome]);
+                if (!mange)
+                    mEco.AjouterProie(migrant.etat);
+            }
+            for (const EtatAnimal& etat : mMigrantsPredateurs[cote])
+                mEco.AjouterPredateur(etat);
+
+            ChargerFantomes(cote, mEtatsFantomesProies[cote].data(), entete.nbFantomesProies,
+                            mEtatsFantomesPredateurs[cote].data(), entete.nbFantomesPredateurs);
+        }
+
+        /* Les émigrants n'étaient gardés que pour les notifications de ce tick */
+        for (auto* proie : mSortantesProies)
+            delete proie;
+        for (auto* pred : mSortantsPredateurs)
+            delete pred;
+        mSortantesProies.clear();
+        mSortantsPredateurs.clear();
+
+        for (int cote = 0; cote < 2; cote++)
+            mExportees[cote].swap(mNouvellesExportees[cote]);
+
+        mFantomesProies.clear();
+        mFantomesPredateurs.clear();
+        for (int cote = 0; cote < 2; cote++)
+        {
+            mFantomesProies.insert(mFantomesProies.end(), mReserveProies[cote].begin(),
+                                   mReserveProies[cote].begin() + mNbFantomesProies[cote]);
+            mFantomesPredateurs.insert(mFantomesPredateurs.end(), mReservePredateurs[cote].begin(),
+                                       mReservePredateurs[cote].begin() + mNbFantomesPredateurs[cote]);
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Constructeur
+ */
+SimulationDistribuee::SimulationDistribuee(const ConfigDistribuee& config)
+    : mConfig(config)
+{
+}
+
+/**
+ * @brief Part d'une quantité revenant à une bande (le reste va à la dernière)
+ */
+static int PartDeBande(int total, int rang, int nbProcessus)
+{
+    int part = total / nbProcessus;
+    return (rang == nbProcessus - 1) ? total - part * (nbProcessus - 1) : part;
+}
+
+/**
+ * @brief Fichier de trace d'une bande : trace.json devient trace_bande2.json
+ */
+static std::string CheminTraceBande(const std::string& chemin, int rang)
+{
+    std::string suffixe = "_bande" + std::to_string(rang);
+    size_t point = chemin.rfind('.');
+    size_t separateur = chemin.find_last_of("/\\");
+    if (point == std::string::npos || (separateur != std::string::npos && point < separateur))
+        return chemin + suffixe;
+    return chemin.substr(0, point) + suffixe + chemin.substr(point);
+}
+
+/**
+ * @brief Boucle d'un processus fils : tick, échange, barrière
+ */
+int SimulationDistribuee::ExecuterBande(int rang, TransportFrontiere& transport,
+                                        BarriereProcessus& barriere, StatistiquesBande* statistiques)
+{
+    int nbProcessus = mConfig.nbProcessus;
+    srand(mConfig.graine + 7919u * rang);
+    transport.Attacher(rang);
+
+    if (!mConfig.fichierTrace.empty())
+    {
+        Traceur::NommerThread("Bande " + std::to_string(rang));
+        Traceur::Demarrer();
+    }
+
+    float largeurBande = mConfig.largeurMonde / nbProcessus;
+    float x0 = rang * largeurBande;
+    float x1 = (rang == nbProcessus - 1) ? mConfig.largeurMonde : (rang + 1) * largeurBande;
+
+    /* Les cœurs sont partagés entre bandes : chacune son système de tâches, créé après fork */
+    int nbCoeurs = static_cast<int>(std::thread::hardware_concurrency());
+    PoolThreads taches(std::max(1, nbCoeurs / nbProcessus));
+
+    Ecosysteme eco(0, 0, 0, mConfig.largeurMonde, mConfig.hauteurMonde, mConfig.repartition, &taches);
+    eco.SetDelaiPlantes(mConfig.delaiPlantes);
+    eco.DefinirBande(x0, x1);
+    eco.DiffererLiberation(true);
+    eco.Peupler(PartDeBande(mConfig.nbProies, rang, nbProcessus),
+                PartDeBande(mConfig.nbPredateurs, rang, nbProcessus),
+                PartDeBande(mConfig.nbPlantes, rang, nbProcessus));
+
+    Bande bande(eco, rang, nbProcessus, x0, x1);
+    std::vector<uint8_t> envois[2];
+    std::vector<uint8_t> receptions[2];
+
+    auto debut = std::chrono::steady_clock::now();
+
+    for (int tick = 0; tick < mConfig.nbTicks; tick++)
+    {
+        eco.Update(mConfig.pasTemps);
+
+        Traceur::Debut("Echange");
+        bande.Preparer(envois);
+        bool echange = transport.Echanger(envois, receptions) && bande.Appliquer(receptions);
+        Traceur::Fin();
+        if (!echange)
+        {
+            std::cerr << "❌ Bande " << rang << " : échange interrompu au tick " << tick << std::endl;
+            return 1;
+        }
+
+        /* Double tampon : le rang 0 lit le tick t pendant que les autres écrivent t + 1 */
+        StatistiquesBande& stats = statistiques[(tick % 2) * nbProcessus + rang];
+        stats.proies = eco.GetNombreProies();
+        stats.predateurs = eco.GetNombrePredateurs();
+        stats.plantes = eco.GetNombrePlantes();
+
+        Traceur::Debut("Barriere");
+        barriere.Attendre();
+        Traceur::Fin();
+
+        bool rapport = (mConfig.intervalleRapport > 0 && (tick + 1) % mConfig.intervalleRapport == 0);
+        if (rang == 0 && rapport)
+        {
+            int proies = 0;
+            int predateurs = 0;
+            int plantes = 0;
+            for (int r = 0; r < nbProcessus; r++)
+            {
+                const StatistiquesBande& s = statistiques[(tick % 2) * nbProcessus + r];
+                proies += s.proies;
+                predateurs += s.predateurs;
+                plantes += s.plantes;
+            }
+            std::cout << "Tick " << (tick + 1) << " : " << proies << " proies, "
+                      << predateurs << " prédateurs, " << plantes << " plantes" << std::endl;
+        }
+    }
+
+    if (rang == 0)
+    {
+        double secondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        std::cout << "⏱  " << mConfig.nbTicks << " ticks en " << secondes << " s ("
+                  << (secondes > 0.0 ? mConfig.nbTicks / secondes : 0.0) << " ticks/s)" << std::endl;
+    }
+
+    if (!mConfig.fichierTrace.empty())
+        Traceur::Exporter(CheminTraceBande(mConfig.fichierTrace, rang), rang + 1);
+    return 0;
+}
+
+/**
+ * @brief Crée transport, barrière et compteurs, puis un processus par bande
+ */
+int SimulationDistribuee::Executer()
+{
+#ifdef __linux__
+    /* Une bande plus étroite qu'une tuile laisserait un fantôme traverser deux frontières */
+    int maxProcessus = std::max(1, static_cast<int>(mConfig.largeurMonde / DecompositionSpatiale::TAILLE_MIN));
+    if (mConfig.nbProcessus > maxProcessus)
+    {
+        std::cout << "⚠️  Monde trop étroit : " << maxProcessus << " bandes au lieu de "
+                  << mConfig.nbProcessus << std::endl;
+        mConfig.nbProcessus = maxProcessus;
+    }
+    int nbProcessus = std::max(1, mConfig.nbProcessus);
+    mConfig.nbProcessus = nbProcessus;
+
+    TransportFrontiere* transport = nullptr;
+    if (mConfig.transportSocket)
+        transport = new TransportSocket();
+    else
+        transport = new TransportMemoirePartagee();
+
+    BarriereProcessus barriere;
+    size_t tailleStatistiques = 2 * nbProcessus * sizeof(StatistiquesBande);
+    auto* statistiques = static_cast<StatistiquesBande*>(AllouerMemoirePartagee(tailleStatistiques));
+
+    if (!transport->Creer(nbProcessus) || !barriere.Creer(nbProcessus) || !statistiques)
+    {
+        std::cerr << "❌ Échec création des canaux entre processus" << std::endl;
+        LibererMemoirePartagee(statistiques, tailleStatistiques);
+        delete transport;
+        return 1;
+    }
+
+    std::cout << "🧩 " << nbProcessus << " bandes de " << (mConfig.largeurMonde / nbProcessus)
+              << " px, transport " << transport->GetNom() << std::endl;
+    std::cout.flush();
+
+    std::vector<pid_t> fils;
+    for (int rang = 0; rang < nbProcessus; rang++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            /* _exit : ni destructeurs du parent ni tampons dupliqués */
+            int code = ExecuterBande(rang, *transport, barriere, statistiques);
+            std::cout.flush();
+            _exit(code);
+        }
+        if (pid < 0)
+        {
+            std::cerr << "❌ fork() a échoué" << std::endl;
+            for (pid_t autre : fils)
+                kill(autre, SIGTERM);
+            break;
+        }
+        fils.push_back(pid);
+    }
+
+    /* Une bande en erreur bloquerait les autres à la barrière : on arrête tout */
+    int resultat = (static_cast<int>(fils.size()) == nbProcessus) ? 0 : 1;
+    for (size_t i = 0; i < fils.size(); i++)
+    {
+        int statut = 0;
+        pid_t termine = wait(&statut);
+        bool echec = !WIFEXITED(statut) || WEXITSTATUS(statut) != 0;
+        if (termine > 0 && echec && resultat == 0)
+        {
+            resultat = 1;
+            for (pid_t autre : fils)
+            {
+                if (autre != termine)
+                    kill(autre, SIGTERM);
+            }
+        }
+    }
+
+    if (resultat == 0 && mConfig.nbTicks > 0)
+    {
+        int dernier = (mConfig.nbTicks - 1) % 2;
+        int proies = 0;
+        int predateurs = 0;
+        int plantes = 0;
+        for (int r = 0; r < nbProcessus; r++)
+        {
+            proies += statistiques[dernier * nbProcessus + r].proies;
+            predateurs += statistiques[dernier * nbProcessus + r].predateurs;
+            plantes += statistiques[dernier * nbProcessus + r].plantes;
+        }
+        std::cout << "✅ Fin : " << proies << " proies, " << predateurs << " prédateurs, "
+                  << plantes << " plantes" << std::endl;
+    }
+
+    LibererMemoirePartagee(statistiques, tailleStatistiques);
+    delete transport;
+    return resultat;
+#else
+    std::cerr << "❌ Simulation distribuée disponible uniquement sous Linux" << std::endl;
+    return 1;
+#endif
+}
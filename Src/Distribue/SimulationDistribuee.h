@@ -0,0 +1,80 @@
+/**
+ * @file SimulationDistribuee.h
+ * @brief Un monde partagé en bandes verticales, une bande par processus
+ */
+
+#ifndef SIMULATION_DISTRIBUEE_H
+#define SIMULATION_DISTRIBUEE_H
+
+#include "../Population/RepartitionInitiale.h"
+#include <string>
+
+class TransportFrontiere;
+class BarriereProcessus;
+struct StatistiquesBande;
+
+/**
+ * @struct ConfigDistribuee
+ * @brief Paramètres d'une simulation distribuée sans affichage
+ */
+struct ConfigDistribuee
+{
+    int nbProcessus;            /**< Nombre de bandes (un processus chacune) */
+    bool transportSocket;       /**< Sockets locales au lieu de la mémoire partagée */
+    int nbTicks;                /**< Durée de la simulation */
+    float pasTemps;             /**< Durée d'un tick (secondes simulées) */
+    float largeurMonde;         /**< Largeur du monde entier */
+    float hauteurMonde;         /**< Hauteur du monde entier */
+    int nbProies;               /**< Proies initiales dans tout le monde */
+    int nbPredateurs;           /**< Prédateurs initiaux dans tout le monde */
+    int nbPlantes;              /**< Plantes initiales dans tout le monde */
+    float delaiPlantes;         /**< Délai de repousse des plantes (secondes) */
+    unsigned int graine;        /**< Graine aléatoire (chaque bande la décale de son rang) */
+    RepartitionInitiale repartition;    /**< Disposition initiale, masque déjà chargé (copiée par fork) */
+    std::string fichierTrace;   /**< Trace des phases, un fichier par bande (vide : pas de trace) */
+    int intervalleRapport;      /**< Ticks entre deux lignes de statistiques */
+};
+
+/**
+ * @class SimulationDistribuee
+ * @brief Lance un processus par bande et les fait avancer au même pas
+ *
+ * Chaque processus possède un Ecosysteme restreint à sa bande. À chaque tick,
+ * il envoie à ses deux voisins les animaux sortis de sa bande, une copie
+ * (fantôme) de ceux situés à moins de RAYON_FANTOME de la frontière, et la
+ * liste des fantômes reçus qu'il a vu mourir sous ses prédateurs ; une
+ * barrière partagée termine le tick. Les plantes restent locales à leur bande.
+ * Le transport se limite à des octets : il peut être remplacé par un
+ * transport réseau pour répartir le monde sur plusieurs machines.
+ */
+class SimulationDistribuee
+{
+private:
+    ConfigDistribuee mConfig;   /**< Paramètres de la simulation */
+
+    /**
+     * @brief Corps d'un processus fils
+     * @param rang Rang de la bande simulée
+     * @param transport Transport déjà créé par le parent
+     * @param barriere Barrière de fin de tick
+     * @param statistiques Compteurs partagés (2 × nbProcessus)
+     * @return Code de sortie du processus
+     */
+    int ExecuterBande(int rang, TransportFrontiere& transport,
+                      BarriereProcessus& barriere, StatistiquesBande* statistiques);
+
+public:
+    /**
+     * @brief Constructeur
+     * @param config Paramètres de la simulation
+     */
+    explicit SimulationDistribuee(const ConfigDistribuee& config);
+
+    /**
+     * @brief Crée les processus, attend leur fin et affiche le bilan
+     * @return 0 si toutes les bandes ont terminé normalement
+     */
+    int Executer();
+};
+
+#endif /* SIMULATION_DISTRIBUEE_H */
@@ -0,0 +1,58 @@
+/**
+ * @file TransportFrontiere.h
+ * @brief Interface d'échange de messages entre bandes voisines
+ */
+
+#ifndef TRANSPORT_FRONTIERE_H
+#define TRANSPORT_FRONTIERE_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TransportFrontiere
+ * @brief Canal entre chaque processus et ses deux voisins (gauche = 0, droite = 1)
+ *
+ * Le transport est créé par le processus parent pour tous les rangs, puis
+ * chaque fils appelle Attacher avec son rang pour ne garder que ses extrémités.
+ */
+class TransportFrontiere
+{
+public:
+    static constexpr int GAUCHE = 0;    /**< Indice du voisin de gauche */
+    static constexpr int DROITE = 1;    /**< Indice du voisin de droite */
+
+    /**
+     * @brief Destructeur virtuel
+     */
+    virtual ~TransportFrontiere() {}
+
+    /**
+     * @brief Crée les canaux pour tous les processus (avant fork)
+     * @param nbProcessus Nombre de bandes
+     * @return true si succès, false sinon
+     */
+    virtual bool Creer(int nbProcessus) = 0;
+
+    /**
+     * @brief Sélectionne les canaux du processus courant (après fork)
+     * @param rang Rang de la bande de ce processus
+     */
+    virtual void Attacher(int rang) = 0;
+
+    /**
+     * @brief Envoie un message à chaque voisin existant et reçoit le sien
+     * @param envois Messages pour la gauche et la droite
+     * @param receptions Messages reçus de la gauche et de la droite (vides sans voisin)
+     * @return false si un canal est rompu ou un message trop grand
+     */
+    virtual bool Echanger(const std::vector<uint8_t> envois[2], std::vector<uint8_t> receptions[2]) = 0;
+
+    /**
+     * @brief Nom du transport pour les journaux
+     * @return Nom court
+     */
+    virtual const char* GetNom() const = 0;
+};
+
+#endif /* TRANSPORT_FRONTIERE_H */
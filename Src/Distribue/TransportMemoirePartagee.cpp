@@ -0,0 +1,194 @@
+/**
+ * @file TransportMemoirePartagee.cpp
+ * @brief Implémentation des anneaux en mémoire partagée
+ */
+
+#include "TransportMemoirePartagee.h"
+#include "MemoirePartagee.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+/**
+ * @struct Anneau
+ * @brief En-tête d'un anneau, immédiatement suivi de CAPACITE_ANNEAU octets de données
+ *
+ * Les positions croissent sans fin ; la position dans le tampon est leur reste
+ * modulo la capacité. Elles sont sur des lignes de cache séparées pour que
+ * producteur et consommateur ne se disputent pas la même ligne.
+ */
+struct Anneau
+{
+    alignas(64) std::atomic<uint64_t> ecriture;    /**< Octets publiés par le producteur */
+    alignas(64) std::atomic<uint64_t> lecture;     /**< Octets consommés par le consommateur */
+
+    /**
+     * @brief Début du tampon de données
+     * @return Premier octet suivant l'en-tête
+     */
+    uint8_t* Donnees() { return reinterpret_cast<uint8_t*>(this + 1); }
+    const uint8_t* Donnees() const { return reinterpret_cast<const uint8_t*>(this + 1); }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "les positions des anneaux doivent être sans verrou pour être partagées entre processus");
+
+static constexpr size_t TAILLE_ANNEAU = sizeof(Anneau) + TransportMemoirePartagee::CAPACITE_ANNEAU;
+
+/**
+ * @brief Copie des octets dans l'anneau à partir d'une position, en repliant
+ */
+static void CopierVers(Anneau* anneau, uint64_t position, const uint8_t* source, size_t taille)
+{
+    size_t debut = position % TransportMemoirePartagee::CAPACITE_ANNEAU;
+    size_t premier = std::min(taille, TransportMemoirePartagee::CAPACITE_ANNEAU - debut);
+    memcpy(anneau->Donnees() + debut, source, premier);
+    memcpy(anneau->Donnees(), source + premier, taille - premier);
+}
+
+/**
+ * @brief Copie des octets depuis l'anneau à partir d'une position, en repliant
+ */
+static void CopierDepuis(const Anneau* anneau, uint64_t position, uint8_t* destination, size_t taille)
+{
+    size_t debut = position % TransportMemoirePartagee::CAPACITE_ANNEAU;
+    size_t premier = std::min(taille, TransportMemoirePartagee::CAPACITE_ANNEAU - debut);
+    memcpy(destination, anneau->Donnees() + debut, premier);
+    memcpy(destination + premier, anneau->Donnees(), taille - premier);
+}
+
+/**
+ * @brief Écrit un message (taille puis contenu), en attendant la place libre
+ */
+static bool Ecrire(Anneau* anneau, const std::vector<uint8_t>& message)
+{
+    uint32_t taille = static_cast<uint32_t>(message.size());
+    size_t total = sizeof(taille) + message.size();
+    if (total > TransportMemoirePartagee::CAPACITE_ANNEAU)
+        return false;
+
+    uint64_t ecriture = anneau->ecriture.load(std::memory_order_relaxed);
+    while (ecriture + total - anneau->lecture.load(std::memory_order_acquire)
+           > TransportMemoirePartagee::CAPACITE_ANNEAU)
+        std::this_thread::yield();
+
+    CopierVers(anneau, ecriture, reinterpret_cast<const uint8_t*>(&taille), sizeof(taille));
+    CopierVers(anneau, ecriture + sizeof(taille), message.data(), message.size());
+    anneau->ecriture.store(ecriture + total, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Lit le prochain message, en attendant sa publication
+ */
+static void Lire(Anneau* anneau, std::vector<uint8_t>& message)
+{
+    uint64_t lecture = anneau->lecture.load(std::memory_order_relaxed);
+    while (anneau->ecriture.load(std::memory_order_acquire) == lecture)
+        std::this_thread::yield();
+
+    /* Le producteur publie un message entier d'un coup */
+    uint32_t taille;
+    CopierDepuis(anneau, lecture, reinterpret_cast<uint8_t*>(&taille), sizeof(taille));
+    message.resize(taille);
+    CopierDepuis(anneau, lecture + sizeof(taille), message.data(), taille);
+    anneau->lecture.store(lecture + sizeof(taille) + taille, std::memory_order_release);
+}
+
+/**
+ * @brief Constructeur
+ */
+TransportMemoirePartagee::TransportMemoirePartagee()
+    : mZone(nullptr)
+    , mTailleZone(0)
+    , mNbProcessus(0)
+    , mRang(0)
+    , mSortants{nullptr, nullptr}
+    , mEntrants{nullptr, nullptr}
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+TransportMemoirePartagee::~TransportMemoirePartagee()
+{
+    LibererMemoirePartagee(mZone, mTailleZone);
+}
+
+/**
+ * @brief Adresse d'un anneau dans la zone
+ */
+Anneau* TransportMemoirePartagee::AnneauNumero(int indice) const
+{
+    return reinterpret_cast<Anneau*>(static_cast<uint8_t*>(mZone) + indice * TAILLE_ANNEAU);
+}
+
+/**
+ * @brief Alloue deux anneaux par frontière (positions à zéro grâce à mmap)
+ */
+bool TransportMemoirePartagee::Creer(int nbProcessus)
+{
+    mNbProcessus = nbProcessus;
+    int nbAnneaux = 2 * (nbProcessus - 1);
+    if (nbAnneaux <= 0)
+        return true;
+
+    /* Les pages ne sont réellement allouées qu'au premier accès */
+    mTailleZone = nbAnneaux * TAILLE_ANNEAU;
+    mZone = AllouerMemoirePartagee(mTailleZone);
+    return mZone != nullptr;
+}
+
+/**
+ * @brief Frontière b (entre b et b + 1) : anneau 2b vers la droite, 2b + 1 vers la gauche
+ */
+void TransportMemoirePartagee::Attacher(int rang)
+{
+    mRang = rang;
+
+    if (rang > 0)
+    {
+        int frontiere = rang - 1;
+        mEntrants[GAUCHE] = AnneauNumero(2 * frontiere);
+        mSortants[GAUCHE] = AnneauNumero(2 * frontiere + 1);
+    }
+    if (rang < mNbProcessus - 1)
+    {
+        int frontiere = rang;
+        mSortants[DROITE] = AnneauNumero(2 * frontiere);
+        mEntrants[DROITE] = AnneauNumero(2 * frontiere + 1);
+    }
+}
+
+/**
+ * @brief Écrit vers les deux voisins puis lit leurs messages
+ *
+ * Tant qu'un message tient dans un anneau, écrire d'abord ne peut pas bloquer :
+ * chaque anneau est vidé par son lecteur avant la barrière de fin de tick.
+ */
+bool TransportMemoirePartagee::Echanger(const std::vector<uint8_t> envois[2], std::vector<uint8_t> receptions[2])
+{
+    for (int cote = 0; cote < 2; cote++)
+    {
+        if (mSortants[cote] && !Ecrire(mSortants[cote], envois[cote]))
+            return false;
+    }
+
+    for (int cote = 0; cote < 2; cote++)
+    {
+        receptions[cote].clear();
+        if (mEntrants[cote])
+            Lire(mEntrants[cote], receptions[cote]);
+    }
+    return true;
+}
+
+/**
+ * @brief Nom du transport
+ */
+const char* TransportMemoirePartagee::GetNom() const
+{
+    return "memoire";
+}
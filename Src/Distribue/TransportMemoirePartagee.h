@@ -0,0 +1,59 @@
+/**
+ * @file TransportMemoirePartagee.h
+ * @brief Échange entre bandes par anneaux en mémoire partagée
+ */
+
+#ifndef TRANSPORT_MEMOIRE_PARTAGEE_H
+#define TRANSPORT_MEMOIRE_PARTAGEE_H
+
+#include "TransportFrontiere.h"
+#include <cstddef>
+
+struct Anneau;
+
+/**
+ * @class TransportMemoirePartagee
+ * @brief Deux anneaux producteur unique / consommateur unique par frontière
+ *
+ * Chaque message est précédé de sa taille. Le producteur publie la position
+ * d'écriture après avoir copié tout le message ; le consommateur n'avance la
+ * position de lecture qu'après l'avoir recopié. Aucun appel système n'est fait
+ * pendant l'échange : l'attente est active (avec cession du processeur).
+ */
+class TransportMemoirePartagee : public TransportFrontiere
+{
+private:
+    void* mZone;                /**< Zone partagée contenant tous les anneaux */
+    size_t mTailleZone;         /**< Taille de la zone */
+    int mNbProcessus;           /**< Nombre de bandes */
+    int mRang;                  /**< Rang du processus courant */
+    Anneau* mSortants[2];       /**< Anneaux vers la gauche et la droite (nullptr sans voisin) */
+    Anneau* mEntrants[2];       /**< Anneaux depuis la gauche et la droite */
+
+    /**
+     * @brief Adresse d'un anneau
+     * @param indice Indice (2 par frontière : vers la droite puis vers la gauche)
+     * @return Anneau
+     */
+    Anneau* AnneauNumero(int indice) const;
+
+public:
+    static constexpr size_t CAPACITE_ANNEAU = 16u << 20;   /**< Octets par anneau (message max) */
+
+    /**
+     * @brief Constructeur
+     */
+    TransportMemoirePartagee();
+
+    /**
+     * @brief Destructeur (libère la zone dans le processus créateur)
+     */
+    ~TransportMemoirePartagee() override;
+
+    bool Creer(int nbProcessus) override;
+    void Attacher(int rang) override;
+    bool Echanger(const std::vector<uint8_t> envois[2], std::vector<uint8_t> receptions[2]) override;
+    const char* GetNom() const override;
+};
+
+#endif /* TRANSPORT_MEMOIRE_PARTAGEE_H */
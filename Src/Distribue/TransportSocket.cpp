@@ -0,0 +1,220 @@
+/**
+ * @file TransportSocket.cpp
+ * @brief Implémentation du transport par sockets locales
+ */
+
+#include "TransportSocket.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Constructeur
+ */
+TransportSocket::TransportSocket()
+    : mNbProcessus(0)
+    , mVoisins{-1, -1}
+{
+}
+
+/**
+ * @brief Ferme les descripteurs encore ouverts
+ */
+TransportSocket::~TransportSocket()
+{
+#ifdef __linux__
+    for (int descripteur : mPaires)
+    {
+        if (descripteur >= 0)
+            close(descripteur);
+    }
+#endif
+}
+
+/**
+ * @brief Crée une paire de sockets non bloquantes par frontière
+ */
+bool TransportSocket::Creer(int nbProcessus)
+{
+#ifdef __linux__
+    mNbProcessus = nbProcessus;
+    for (int frontiere = 0; frontiere < nbProcessus - 1; frontiere++)
+    {
+        int paire[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, paire) != 0)
+            return false;
+
+        for (int descripteur : paire)
+            fcntl(descripteur, F_SETFL, fcntl(descripteur, F_GETFL) | O_NONBLOCK);
+
+        mPaires.push_back(paire[0]);    /* Côté gauche de la frontière */
+        mPaires.push_back(paire[1]);    /* Côté droit de la frontière */
+    }
+    return true;
+#else
+    (void)nbProcessus;
+    return false;
+#endif
+}
+
+/**
+ * @brief Garde les extrémités du rang et ferme toutes les autres
+ */
+void TransportSocket::Attacher(int rang)
+{
+#ifdef __linux__
+    for (int frontiere = 0; frontiere < mNbProcessus - 1; frontiere++)
+    {
+        int& gauche = mPaires[2 * frontiere];
+        int& droite = mPaires[2 * frontiere + 1];
+
+        /* La frontière b sépare les rangs b et b + 1 */
+        if (frontiere == rang)
+            mVoisins[DROITE] = gauche;
+        else
+            close(gauche);
+
+        if (frontiere == rang - 1)
+            mVoisins[GAUCHE] = droite;
+        else
+            close(droite);
+
+        gauche = -1;
+        droite = -1;
+    }
+    mPaires.clear();
+    mPaires.push_back(mVoisins[GAUCHE]);
+    mPaires.push_back(mVoisins[DROITE]);
+#else
+    (void)rang;
+#endif
+}
+
+/**
+ * @brief Envoie et reçoit simultanément (poll) pour ne jamais bloquer les deux voisins
+ *
+ * Chaque message est précédé de sa taille sur 4 octets. Écrire tout avant de
+ * lire pourrait bloquer si les deux côtés remplissent le tampon noyau en même
+ * temps : on avance donc envois et réceptions au fil de leur disponibilité.
+ */
+bool TransportSocket::Echanger(const std::vector<uint8_t> envois[2], std::vector<uint8_t> receptions[2])
+{
+#ifdef __linux__
+    uint32_t entetesEnvoi[2];
+    uint32_t entetesReception[2] = {0, 0};
+    size_t envoye[2] = {0, 0};
+    size_t recu[2] = {0, 0};
+    bool envoiFini[2];
+    bool receptionFinie[2];
+
+    for (int cote = 0; cote < 2; cote++)
+    {
+        entetesEnvoi[cote] = static_cast<uint32_t>(envois[cote].size());
+        envoiFini[cote] = (mVoisins[cote] < 0);
+        receptionFinie[cote] = (mVoisins[cote] < 0);
+        receptions[cote].clear();
+    }
+
+    const size_t ENTETE = sizeof(uint32_t);
+
+    while (!envoiFini[0] || !envoiFini[1] || !receptionFinie[0] || !receptionFinie[1])
+    {
+        pollfd attentes[2];
+        for (int cote = 0; cote < 2; cote++)
+        {
+            attentes[cote].fd = mVoisins[cote];
+            attentes[cote].events = (envoiFini[cote] ? 0 : POLLOUT) | (receptionFinie[cote] ? 0 : POLLIN);
+            attentes[cote].revents = 0;
+            if (attentes[cote].events == 0)
+                attentes[cote].fd = -1;
+        }
+
+        if (poll(attentes, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+
+        for (int cote = 0; cote < 2; cote++)
+        {
+            if (attentes[cote].revents & (POLLERR | POLLNVAL))
+                return false;
+
+            /* Envoi : en-tête puis contenu */
+            if (!envoiFini[cote] && (attentes[cote].revents & POLLOUT))
+            {
+                const uint8_t* source;
+                size_t reste;
+                if (envoye[cote] < ENTETE)
+                {
+                    source = reinterpret_cast<const uint8_t*>(&entetesEnvoi[cote]) + envoye[cote];
+                    reste = ENTETE - envoye[cote];
+                }
+                else
+                {
+                    source = envois[cote].data() + (envoye[cote] - ENTETE);
+                    reste = envois[cote].size() - (envoye[cote] - ENTETE);
+                }
+
+                ssize_t n = send(mVoisins[cote], source, reste, MSG_NOSIGNAL);
+                if (n < 0 && errno != EAGAIN && errno != EINTR)
+                    return false;
+                if (n > 0)
+                    envoye[cote] += n;
+                envoiFini[cote] = (envoye[cote] == ENTETE + envois[cote].size());
+            }
+
+            /* Réception : en-tête puis contenu */
+            if (!receptionFinie[cote] && (attentes[cote].revents & (POLLIN | POLLHUP)))
+            {
+                uint8_t* destination;
+                size_t reste;
+                if (recu[cote] < ENTETE)
+                {
+                    destination = reinterpret_cast<uint8_t*>(&entetesReception[cote]) + recu[cote];
+                    reste = ENTETE - recu[cote];
+                }
+                else
+                {
+                    destination = receptions[cote].data() + (recu[cote] - ENTETE);
+                    reste = receptions[cote].size() - (recu[cote] - ENTETE);
+                }
+
+                ssize_t n = recv(mVoisins[cote], destination, reste, 0);
+                if (n == 0)
+                    return false;   /* Voisin terminé */
+                if (n < 0 && errno != EAGAIN && errno != EINTR)
+                    return false;
+                if (n > 0)
+                {
+                    recu[cote] += n;
+                    if (recu[cote] == ENTETE)
+                        receptions[cote].resize(entetesReception[cote]);
+                }
+                receptionFinie[cote] = (recu[cote] >= ENTETE
+                                        && recu[cote] == ENTETE + receptions[cote].size());
+            }
+        }
+    }
+    return true;
+#else
+    (void)envois;
+    (void)receptions;
+    return false;
+#endif
+}
+
+/**
+ * @brief Nom du transport
+ */
+const char* TransportSocket::GetNom() const
+{
+    return "socket";
+}
@@ -0,0 +1,43 @@
+/**
+ * @file TransportSocket.h
+ * @brief Échange entre bandes par sockets locales (AF_UNIX)
+ */
+
+#ifndef TRANSPORT_SOCKET_H
+#define TRANSPORT_SOCKET_H
+
+#include "TransportFrontiere.h"
+
+/**
+ * @class TransportSocket
+ * @brief Une paire de sockets connectées par frontière
+ *
+ * Plus lent que la mémoire partagée (deux copies noyau par message) mais sans
+ * limite de taille de message, et c'est le même protocole à flux d'octets
+ * qu'un transport TCP entre machines.
+ */
+class TransportSocket : public TransportFrontiere
+{
+private:
+    int mNbProcessus;               /**< Nombre de bandes */
+    std::vector<int> mPaires;       /**< Deux descripteurs par frontière (gauche, droite) */
+    int mVoisins[2];                /**< Descripteurs vers la gauche et la droite (-1 sans voisin) */
+
+public:
+    /**
+     * @brief Constructeur
+     */
+    TransportSocket();
+
+    /**
+     * @brief Destructeur (ferme les descripteurs encore ouverts)
+     */
+    ~TransportSocket() override;
+
+    bool Creer(int nbProcessus) override;
+    void Attacher(int rang) override;
+    bool Echanger(const std::vector<uint8_t> envois[2], std::vector<uint8_t> receptions[2]) override;
+    const char* GetNom() const override;
+};
+
+#endif /* TRANSPORT_SOCKET_H */
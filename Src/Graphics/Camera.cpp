@@ -0,0 +1,207 @@
+/**
+ * @file Camera.cpp
+ * @brief Implémentation de la caméra 2D
+ */
+
+#include "Camera.h"
+#include <algorithm>
+
+/**
+ * @brief Constructeur (vue 1:1 sur l'origine)
+ */
+Camera::Camera()
+    : mX(0.0f)
+    , mY(0.0f)
+    , mZoom(1.0f)
+    , mLargeurMonde(1.0f)
+    , mHauteurMonde(1.0f)
+    , mLargeurVue(1)
+    , mHauteurVue(1)
+    , mGlissement(false)
+{
+}
+
+/**
+ * @brief Définit les dimensions du monde observé
+ */
+void Camera::DefinirMonde(float largeur, float hauteur)
+{
+    mLargeurMonde = largeur;
+    mHauteurMonde = hauteur;
+    Limiter();
+}
+
+/**
+ * @brief Définit la taille de la fenêtre
+ */
+void Camera::DefinirTailleVue(int largeur, int hauteur)
+{
+    mLargeurVue = std::max(1, largeur);
+    mHauteurVue = std::max(1, hauteur);
+    Limiter();
+}
+
+/**
+ * @brief Zoom minimal : le monde entier tient dans la fenêtre
+ */
+float Camera::ZoomMin() const
+{
+    float zoomLargeur = mLargeurVue / mLargeurMonde;
+    float zoomHauteur = mHauteurVue / mHauteurMonde;
+
+    return std::min(1.0f, std::min(zoomLargeur, zoomHauteur));
+}
+
+/**
+ * @brief Borne le zoom et centre le monde s'il est plus petit que la vue
+ */
+void Camera::Limiter()
+{
+    mZoom = std::min(std::max(mZoom, ZoomMin()), ZOOM_MAX);
+
+    float largeurVisible = mLargeurVue / mZoom;
+    float hauteurVisible = mHauteurVue / mZoom;
+
+    if (largeurVisible >= mLargeurMonde)
+        mX = (mLargeurMonde - largeurVisible) / 2.0f;
+    else
+        mX = std::min(std::max(mX, 0.0f), mLargeurMonde - largeurVisible);
+
+    if (hauteurVisible >= mHauteurMonde)
+        mY = (mHauteurMonde - hauteurVisible) / 2.0f;
+    else
+        mY = std::min(std::max(mY, 0.0f), mHauteurMonde - hauteurVisible);
+}
+
+/**
+ * @brief Cadre la vue sur l'ensemble du monde
+ */
+void Camera::Recentrer()
+{
+    mZoom = ZoomMin();
+    mX = 0.0f;
+    mY = 0.0f;
+    Limiter();
+}
+
+/**
+ * @brief Décale la vue d'un nombre de pixels écran
+ */
+void Camera::Deplacer(float dxEcran, float dyEcran)
+{
+    mX += dxEcran / mZoom;
+    mY += dyEcran / mZoom;
+    Limiter();
+}
+
+/**
+ * @brief Zoome en gardant fixe le point du monde sous l'ancre
+ */
+void Camera::Zoomer(float facteur, float ancreX, float ancreY)
+{
+    /* Point du monde sous l'ancre avant le zoom */
+    float mondeX = mX + ancreX / mZoom;
+    float mondeY = mY + ancreY / mZoom;
+
+    mZoom = std::min(std::max(mZoom * facteur, ZoomMin()), ZOOM_MAX);
+
+    /* Replacer ce point sous l'ancre */
+    mX = mondeX - ancreX / mZoom;
+    mY = mondeY - ancreY / mZoom;
+    Limiter();
+}
+
+/**
+ * @brief Traite molette, glisser (clic droit ou milieu) et touche Origine
+ */
+void Camera::TraiterEvenement(const SDL_Event& event)
+{
+    switch (event.type)
+    {
+        case SDL_EVENT_MOUSE_WHEEL:
+            if (event.wheel.y != 0.0f)
+            {
+                float facteur = (event.wheel.y > 0.0f) ? FACTEUR_MOLETTE : 1.0f / FACTEUR_MOLETTE;
+                Zoomer(facteur, event.wheel.mouse_x, event.wheel.mouse_y);
+            }
+            break;
+
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            if (event.button.button == SDL_BUTTON_RIGHT || event.button.button == SDL_BUTTON_MIDDLE)
+                mGlissement = true;
+            break;
+
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+            if (event.button.button == SDL_BUTTON_RIGHT || event.button.button == SDL_BUTTON_MIDDLE)
+                mGlissement = false;
+            break;
+
+        case SDL_EVENT_MOUSE_MOTION:
+            if (mGlissement)
+                Deplacer(-event.motion.xrel, -event.motion.yrel);
+            break;
+
+        case SDL_EVENT_KEY_DOWN:
+            if (event.key.key == SDLK_HOME)
+                Recentrer();
+            break;
+    }
+}
+
+/**
+ * @brief Défilement continu aux flèches / ZQSD
+ */
+void Camera::MettreAJour(float deltaTime)
+{
+    const bool* touches = SDL_GetKeyboardState(nullptr);
+    float dx = 0.0f;
+    float dy = 0.0f;
+
+    /* Positions physiques : ZQSD sur AZERTY, WASD sur QWERTY */
+    if (touches[SDL_SCANCODE_LEFT] || touches[SDL_SCANCODE_A])
+        dx -= 1.0f;
+    if (touches[SDL_SCANCODE_RIGHT] || touches[SDL_SCANCODE_D])
+        dx += 1.0f;
+    if (touches[SDL_SCANCODE_UP] || touches[SDL_SCANCODE_W])
+        dy -= 1.0f;
+    if (touches[SDL_SCANCODE_DOWN] || touches[SDL_SCANCODE_S])
+        dy += 1.0f;
+
+    if (dx != 0.0f || dy != 0.0f)
+        Deplacer(dx * VITESSE_CLAVIER * deltaTime, dy * VITESSE_CLAVIER * deltaTime);
+}
+
+/**
+ * @brief Convertit une abscisse monde en abscisse écran
+ */
+float Camera::MondeVersEcranX(float x) const
+{
+    return (x - mX) * mZoom;
+}
+
+/**
+ * @brief Convertit une ordonnée monde en ordonnée écran
+ */
+float Camera::MondeVersEcranY(float y) const
+{
+    return (y - mY) * mZoom;
+}
+
+/**
+ * @brief Récupère le rectangle du monde visible
+ */
+void Camera::ZoneVisible(float& x0, float& y0, float& x1, float& y1) const
+{
+    x0 = mX;
+    y0 = mY;
+    x1 = mX + mLargeurVue / mZoom;
+    y1 = mY + mHauteurVue / mZoom;
+}
+
+/**
+ * @brief Récupère le facteur de zoom
+ */
+float Camera::GetZoom() const
+{
+    return mZoom;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file Camera.h
+ * @brief Caméra 2D déplaçable et zoomable sur le monde de simulation
+ */
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <SDL3/SDL.h>
+
+/**
+ * @class Camera
+ * @brief Convertit les coordonnées monde en coordonnées écran
+ *
+ * La caméra mémorise le point du monde affiché en haut à gauche de la fenêtre
+ * et un facteur de zoom (pixels écran par pixel monde).
+ */
+class Camera
+{
+private:
+    float mX;                   /**< Position monde du bord gauche de la vue */
+    float mY;                   /**< Position monde du bord haut de la vue */
+    float mZoom;                /**< Pixels écran par pixel monde */
+    float mLargeurMonde;        /**< Largeur du monde observé */
+    float mHauteurMonde;        /**< Hauteur du monde observé */
+    int mLargeurVue;            /**< Largeur de la fenêtre (pixels écran) */
+    int mHauteurVue;            /**< Hauteur de la fenêtre (pixels écran) */
+    bool mGlissement;           /**< Déplacement à la souris en cours */
+
+    static constexpr float ZOOM_MAX = 4.0f;              /**< Grossissement maximal */
+    static constexpr float FACTEUR_MOLETTE = 1.15f;      /**< Zoom par cran de molette */
+    static constexpr float VITESSE_CLAVIER = 600.0f;     /**< Défilement clavier (pixels écran/s) */
+
+    /**
+     * @brief Zoom minimal : le monde entier tient dans la fenêtre
+     * @return Facteur de zoom minimal
+     */
+    float ZoomMin() const;
+
+    /**
+     * @brief Empêche la vue de sortir du monde
+     */
+    void Limiter();
+
+public:
+    /**
+     * @brief Constructeur (vue 1:1 sur l'origine)
+     */
+    Camera();
+
+    /**
+     * @brief Définit les dimensions du monde observé
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     */
+    void DefinirMonde(float largeur, float hauteur);
+
+    /**
+     * @brief Définit la taille de la fenêtre
+     * @param largeur Largeur en pixels écran
+     * @param hauteur Hauteur en pixels écran
+     */
+    void DefinirTailleVue(int largeur, int hauteur);
+
+    /**
+     * @brief Cadre la vue sur l'ensemble du monde
+     */
+    void Recentrer();
+
+    /**
+     * @brief Décale la vue
+     * @param dxEcran Décalage horizontal en pixels écran
+     * @param dyEcran Décalage vertical en pixels écran
+     */
+    void Deplacer(float dxEcran, float dyEcran);
+
+    /**
+     * @brief Zoome en gardant fixe un point de l'écran
+     * @param facteur Facteur multiplicatif (>1 pour grossir)
+     * @param ancreX Abscisse écran du point fixe
+     * @param ancreY Ordonnée écran du point fixe
+     */
+    void Zoomer(float facteur, float ancreX, float ancreY);
+
+    /**
+     * @brief Traite molette, glisser (clic droit ou milieu) et touche Origine
+     * @param event Événement SDL
+     */
+    void TraiterEvenement(const SDL_Event& event);
+
+    /**
+     * @brief Défilement continu aux flèches / ZQSD
+     * @param deltaTime Temps réel écoulé (secondes)
+     */
+    void MettreAJour(float deltaTime);
+
+    /**
+     * @brief Convertit une abscisse monde en abscisse écran
+     * @param x Abscisse monde
+     * @return Abscisse écran
+     */
+    float MondeVersEcranX(float x) const;
+
+    /**
+     * @brief Convertit une ordonnée monde en ordonnée écran
+     * @param y Ordonnée monde
+     * @return Ordonnée écran
+     */
+    float MondeVersEcranY(float y) const;
+
+    /**
+     * @brief Récupère le rectangle du monde visible
+     * @param x0 Bord gauche (sortie)
+     * @param y0 Bord haut (sortie)
+     * @param x1 Bord droit (sortie)
+     * @param y1 Bord bas (sortie)
+     */
+    void ZoneVisible(float& x0, float& y0, float& x1, float& y1) const;
+
+    /**
+     * @brief Récupère le facteur de zoom
+     * @return Pixels écran par pixel monde
+     */
+    float GetZoom() const;
+};
+
+#endif /* CAMERA_H */
@@ -0,0 +1,355 @@
+/**
+ * @file CarteDensite.cpp
+ * @brief Implémentation du rendu en carte de densité
+ */
+
+#include "CarteDensite.h"
+#include "../Core/PoolThreads.h"
+#include "../Population/ChampVegetation.h"
+#include "../Population/Ecosysteme.h"
+#include "../Population/GrilleSpatiale.h"
+#include "../Population/InstantaneRendu.h"
+#include "../Population/PopulationGenerique.h"
+#include "../Population/RegistreEspeces.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/**
+ * @brief Constructeur
+ */
+CarteDensite::CarteDensite()
+    : mTexture(nullptr)
+    , mLargeur(0)
+    , mHauteur(0)
+    , mActive(false)
+    , mTaches(nullptr)
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+CarteDensite::~CarteDensite()
+{
+    Nettoyer();
+}
+
+/**
+ * @brief Crée la texture de la carte
+ */
+bool CarteDensite::Initialiser(SDL_Renderer* renderer, int largeur, int hauteur, PoolThreads* taches)
+{
+    mTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                 SDL_TEXTUREACCESS_STREAMING, largeur, hauteur);
+    if (!mTexture)
+    {
+        std::cerr << "Erreur SDL_CreateTexture (carte de densité): " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    /* Interpolation linéaire : la carte agrandie reste lisse */
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(mTexture, SDL_SCALEMODE_LINEAR);
+
+    mLargeur = largeur;
+    mHauteur = hauteur;
+    mTaches = taches;
+    mDensiteProies.assign(largeur * hauteur, 0.0f);
+    mDensitePredateurs.assign(largeur * hauteur, 0.0f);
+    mDensitePlantes.assign(largeur * hauteur, 0.0f);
+    return true;
+}
+
+/**
+ * @brief Libère la texture
+ */
+void CarteDensite::Nettoyer()
+{
+    if (mTexture)
+    {
+        SDL_DestroyTexture(mTexture);
+        mTexture = nullptr;
+    }
+}
+
+/**
+ * @brief Boucle parallèle sur les lignes si un système de tâches est prêté
+ */
+void CarteDensite::PourLignes(const std::function<void(int, int)>& corps)
+{
+    if (mTaches)
+        mTaches->Pour(0, mHauteur, LIGNES_PAR_MORCEAU, corps);
+    else
+        corps(0, mHauteur);
+}
+
+/**
+ * @brief Bascule avec hystérésis pour ne pas alterner à chaque frame
+ */
+bool CarteDensite::ChoisirNiveau(int nbVisibles, int seuilSprites, float zoom)
+{
+    if (!mTexture)
+        return false;
+
+    if (mActive)
+    {
+        if (nbVisibles < seuilSprites * HYSTERESIS && zoom > ZOOM_SEUIL / HYSTERESIS)
+            mActive = false;
+    }
+    else
+    {
+        if (nbVisibles > seuilSprites || zoom < ZOOM_SEUIL)
+            mActive = true;
+    }
+
+    return mActive;
+}
+
+/**
+ * @brief Répartit le comptage de chaque cellule visible sur les texels qu'elle recouvre
+ */
+void CarteDensite::AccumulerGrille(const GrilleSpatiale& grille, std::vector<float>& densites,
+                                   float x0, float y0, float x1, float y1)
+{
+    float taille = grille.GetTailleCellule();
+    float texelX = (x1 - x0) / mLargeur;
+    float texelY = (y1 - y0) / mHauteur;
+
+    int col0 = std::max(0, static_cast<int>(std::floor(x0 / taille)));
+    int lig0 = std::max(0, static_cast<int>(std::floor(y0 / taille)));
+    int col1 = std::min(grille.GetNombreColonnes() - 1, static_cast<int>(std::floor(x1 / taille)));
+    int lig1 = std::min(grille.GetNombreLignes() - 1, static_cast<int>(std::floor(y1 / taille)));
+
+    for (int ligne = lig0; ligne <= lig1; ligne++)
+    {
+        /* Texels recouverts par la ligne de cellules (avant découpage à la vue) */
+        int ty0 = static_cast<int>(std::floor((ligne * taille - y0) / texelY));
+        int ty1 = std::max(ty0, static_cast<int>(std::ceil(((ligne + 1) * taille - y0) / texelY)) - 1);
+
+        for (int colonne = col0; colonne <= col1; colonne++)
+        {
+            int nombre = grille.GetNombreDansCellule(colonne, ligne);
+            if (nombre == 0)
+                continue;
+
+            int tx0 = static_cast<int>(std::floor((colonne * taille - x0) / texelX));
+            int tx1 = std::max(tx0, static_cast<int>(std::ceil(((colonne + 1) * taille - x0) / texelX)) - 1);
+
+            /* Une grande cellule étale son comptage, une petite le dépose sur un texel */
+            float parTexel = static_cast<float>(nombre) / ((tx1 - tx0 + 1) * (ty1 - ty0 + 1));
+
+            for (int ty = std::max(ty0, 0); ty <= std::min(ty1, mHauteur - 1); ty++)
+            {
+                for (int tx = std::max(tx0, 0); tx <= std::min(tx1, mLargeur - 1); tx++)
+                    densites[ty * mLargeur + tx] += parTexel;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Grilles et champ de l'écosystème, lus entre deux ticks
+ */
+void CarteDensite::Construire(const Ecosysteme& eco, float x0, float y0, float x1, float y1)
+{
+    const PopulationGenerique* especes = eco.GetEspeces();
+    ConstruireDepuis(eco.GetGrilleProies(), eco.GetGrillePredateurs(), eco.GetGrillePlantes(),
+                     eco.GetChampVegetation(), especes ? &especes->GetRegistre() : nullptr,
+                     [especes](int e) -> const GrilleSpatiale& { return especes->GetGrille(e); },
+                     x0, y0, x1, y1);
+}
+
+/**
+ * @brief Mêmes accumulations, sur les grilles et le champ recopiés dans l'instantané
+ */
+void CarteDensite::Construire(const InstantaneRendu& instantane, float x0, float y0, float x1, float y1)
+{
+    const InstantaneRendu* source = &instantane;
+    ConstruireDepuis(instantane.GetGrilleProies(), instantane.GetGrillePredateurs(), instantane.GetGrillePlantes(),
+                     instantane.GetChampVegetation(), instantane.GetRegistre(),
+                     [source](int e) -> const GrilleSpatiale& { return source->GetEspece(e).grille; },
+                     x0, y0, x1, y1);
+}
+
+/**
+ * @brief Une tâche par espèce ; les espèces du registre passent après proies et prédateurs
+ */
+void CarteDensite::ConstruireDepuis(const GrilleSpatiale& grilleProies, const GrilleSpatiale& grillePredateurs,
+                                    const GrilleSpatiale& grillePlantes, const ChampVegetation* champ,
+                                    const RegistreEspeces* descriptions,
+                                    const std::function<const GrilleSpatiale&(int)>& grilleEspece,
+                                    float x0, float y0, float x1, float y1)
+{
+    if (!mTexture)
+        return;
+
+    auto proies = [&]
+    {
+        std::fill(mDensiteProies.begin(), mDensiteProies.end(), 0.0f);
+        AccumulerGrille(grilleProies, mDensiteProies, x0, y0, x1, y1);
+    };
+    auto predateurs = [&]
+    {
+        std::fill(mDensitePredateurs.begin(), mDensitePredateurs.end(), 0.0f);
+        AccumulerGrille(grillePredateurs, mDensitePredateurs, x0, y0, x1, y1);
+    };
+    auto plantes = [&]
+    {
+        if (champ)
+            EchantillonnerChamp(*champ, x0, y0, x1, y1);
+        else
+        {
+            std::fill(mDensitePlantes.begin(), mDensitePlantes.end(), 0.0f);
+            AccumulerGrille(grillePlantes, mDensitePlantes, x0, y0, x1, y1);
+        }
+    };
+
+    /* Espèces du registre : herbivores avec les proies, les autres avec les prédateurs */
+    const bool especes = (descriptions != nullptr);
+    auto registre = [&]
+    {
+        for (int e = 0; e < descriptions->GetNombreEspeces(); e++)
+        {
+            std::vector<float>& densites = descriptions->GetEspece(e).mangePlantes ? mDensiteProies : mDensitePredateurs;
+            AccumulerGrille(grilleEspece(e), densites, x0, y0, x1, y1);
+        }
+    };
+
+    if (mTaches)
+    {
+        /* std::ref : les tâches gardent une référence aux lambdas, sans allocation par frame */
+        PoolThreads::Tache* tacheProies = mTaches->Lancer(std::ref(proies));
+        PoolThreads::Tache* tachePredateurs = mTaches->Lancer(std::ref(predateurs));
+        PoolThreads::Tache* tachePlantes = mTaches->Lancer(std::ref(plantes));
+        PoolThreads::Tache* tacheRegistre = especes ? mTaches->Lancer(std::ref(registre), {tacheProies, tachePredateurs})
+                                                    : nullptr;
+        mTaches->Attendre(tacheProies);
+        mTaches->Attendre(tachePredateurs);
+        mTaches->Attendre(tachePlantes);
+        mTaches->Attendre(tacheRegistre);
+    }
+    else
+    {
+        proies();
+        predateurs();
+        plantes();
+        if (especes)
+            registre();
+    }
+
+    /* Normalisation par le maximum de chaque espèce (contraste automatique) ;
+       le champ est déjà en part de capacité */
+    float maxProies = std::max(1.0f, *std::max_element(mDensiteProies.begin(), mDensiteProies.end()));
+    float maxPredateurs = std::max(1.0f, *std::max_element(mDensitePredateurs.begin(), mDensitePredateurs.end()));
+    float maxPlantes = champ
+                       ? 1.0f : std::max(1.0f, *std::max_element(mDensitePlantes.begin(), mDensitePlantes.end()));
+    RemplirTexture(maxProies, maxPredateurs, maxPlantes);
+}
+
+/**
+ * @brief Végétation seule : proies et prédateurs restent transparents
+ */
+void CarteDensite::ConstruireVegetation(const ChampVegetation& champ, float x0, float y0, float x1, float y1)
+{
+    if (!mTexture)
+        return;
+
+    std::fill(mDensiteProies.begin(), mDensiteProies.end(), 0.0f);
+    std::fill(mDensitePredateurs.begin(), mDensitePredateurs.end(), 0.0f);
+    EchantillonnerChamp(champ, x0, y0, x1, y1);
+    RemplirTexture(1.0f, 1.0f, 1.0f);
+}
+
+/**
+ * @brief Un échantillon par texel : le coût ne dépend que de la résolution de la carte
+ */
+void CarteDensite::EchantillonnerChamp(const ChampVegetation& champ, float x0, float y0, float x1, float y1)
+{
+    float texelX = (x1 - x0) / mLargeur;
+    float texelY = (y1 - y0) / mHauteur;
+    float inverseCapacite = 1.0f / champ.GetCapacite();
+
+    auto lignes = [&](int debut, int fin)
+    {
+        for (int ty = debut; ty < fin; ty++)
+        {
+            float y = y0 + (ty + 0.5f) * texelY;
+            for (int tx = 0; tx < mLargeur; tx++)
+            {
+                float x = x0 + (tx + 0.5f) * texelX;
+                mDensitePlantes[ty * mLargeur + tx] = std::min(1.0f, champ.Lire(x, y) * inverseCapacite);
+            }
+        }
+    };
+    PourLignes(std::ref(lignes));
+}
+
+/**
+ * @brief Couleurs des courbes, opacité suivant l'espèce la plus dense du texel ; lignes en parallèle
+ */
+void CarteDensite::RemplirTexture(float maxProies, float maxPredateurs, float maxPlantes)
+{
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (!SDL_LockTexture(mTexture, nullptr, &pixels, &pitch))
+        return;
+
+    auto lignes = [&](int debut, int fin)
+    {
+        for (int ty = debut; ty < fin; ty++)
+        {
+            Uint8* ligne = static_cast<Uint8*>(pixels) + ty * pitch;
+
+            for (int tx = 0; tx < mLargeur; tx++)
+            {
+                int i = ty * mLargeur + tx;
+
+                /* Racine carrée : les faibles densités restent visibles */
+                float proies = std::sqrt(mDensiteProies[i] / maxProies);
+                float predateurs = std::sqrt(mDensitePredateurs[i] / maxPredateurs);
+                float plantes = std::sqrt(mDensitePlantes[i] / maxPlantes);
+
+                /* Mêmes couleurs que les courbes : vert, rouge, bleu */
+                float r = 0.40f * proies + 0.90f * predateurs + 0.35f * plantes;
+                float g = 0.80f * proies + 0.35f * predateurs + 0.65f * plantes;
+                float b = 0.45f * proies + 0.35f * predateurs + 0.90f * plantes;
+                float a = std::max(proies, std::max(predateurs, plantes));
+
+                ligne[tx * 4 + 0] = static_cast<Uint8>(std::min(1.0f, r) * 255.0f);
+                ligne[tx * 4 + 1] = static_cast<Uint8>(std::min(1.0f, g) * 255.0f);
+                ligne[tx * 4 + 2] = static_cast<Uint8>(std::min(1.0f, b) * 255.0f);
+                ligne[tx * 4 + 3] = static_cast<Uint8>(a * 220.0f);
+            }
+        }
+    };
+    PourLignes(std::ref(lignes));
+
+    SDL_UnlockTexture(mTexture);
+}
+
+/**
+ * @brief Dessine la carte sur toute la vue
+ */
+void CarteDensite::Dessiner(SDL_Renderer* renderer, int largeurVue, int hauteurVue)
+{
+    if (!mTexture)
+        return;
+
+    SDL_FRect destRect = {
+        0.0f,
+        0.0f,
+        static_cast<float>(largeurVue),
+        static_cast<float>(hauteurVue)
+    };
+
+    SDL_RenderTexture(renderer, mTexture, nullptr, &destRect);
+}
+
+/**
+ * @brief Indique si la carte remplace actuellement les sprites
+ */
+bool CarteDensite::EstActive() const
+{
+    return mActive;
+}
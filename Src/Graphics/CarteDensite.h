@@ -0,0 +1,182 @@
+/**
+ * @file CarteDensite.h
+ * @brief Rendu basse résolution des populations sous forme de carte de densité
+ */
+
+#ifndef CARTE_DENSITE_H
+#define CARTE_DENSITE_H
+
+#include <SDL3/SDL.h>
+#include <functional>
+#include <vector>
+
+class ChampVegetation;
+class Ecosysteme;
+class GrilleSpatiale;
+class InstantaneRendu;
+class PoolThreads;
+class RegistreEspeces;
+
+/**
+ * @class CarteDensite
+ * @brief Niveau de détail réduit : une texture de densité à la place des sprites
+ *
+ * Les densités sont lues dans les grilles spatiales de l'écosystème (un
+ * comptage par cellule) : le coût dépend du nombre de cellules visibles et de
+ * la résolution de la carte, jamais du nombre d'animaux. Avec un système de
+ * tâches, chaque espèce est accumulée par sa propre tâche (les espèces du
+ * registre attendent les proies et les prédateurs, qu'elles complètent) et
+ * les lignes de texels sont réparties en boucle parallèle.
+ */
+class CarteDensite
+{
+private:
+    SDL_Texture* mTexture;                  /**< Texture en écriture continue (streaming) */
+    int mLargeur;                           /**< Largeur de la carte (texels) */
+    int mHauteur;                           /**< Hauteur de la carte (texels) */
+    std::vector<float> mDensiteProies;      /**< Proies par texel */
+    std::vector<float> mDensitePredateurs;  /**< Prédateurs par texel */
+    std::vector<float> mDensitePlantes;     /**< Plantes par texel */
+    bool mActive;                           /**< Carte affichée au lieu des sprites */
+    PoolThreads* mTaches;                   /**< Système de tâches (non possédé, nullptr : séquentiel) */
+
+    static constexpr float ZOOM_SEUIL = 0.15f;  /**< Sous ce zoom, les sprites font moins de 6 px */
+    static constexpr float HYSTERESIS = 0.8f;   /**< Marge de retour aux sprites (évite le clignotement) */
+    static constexpr int LIGNES_PAR_MORCEAU = 16;   /**< Grain des boucles sur les lignes de texels */
+
+    /**
+     * @brief Applique corps à des morceaux de lignes couvrant la carte
+     * @param corps Fonction appelée sur les lignes [debut, fin[
+     */
+    void PourLignes(const std::function<void(int, int)>& corps);
+
+    /**
+     * @brief Répartit les comptages d'une grille sur les texels de la carte
+     * @param grille Grille spatiale d'une espèce
+     * @param densites Carte de l'espèce (accumulée)
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void AccumulerGrille(const GrilleSpatiale& grille, std::vector<float>& densites,
+                         float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Lit la biomasse au centre de chaque texel, en part de la capacité d'une cellule
+     * @param champ Champ de biomasse
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void EchantillonnerChamp(const ChampVegetation& champ, float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Convertit les densités en couleurs et met à jour la texture
+     * @param maxProies Densité de proies la plus forte (opacité maximale)
+     * @param maxPredateurs Densité de prédateurs la plus forte
+     * @param maxPlantes Densité de plantes la plus forte
+     */
+    void RemplirTexture(float maxProies, float maxPredateurs, float maxPlantes);
+
+    /**
+     * @brief Remplit la carte à partir des grilles d'une source (écosystème ou instantané)
+     * @param proies Grille des proies
+     * @param predateurs Grille des prédateurs
+     * @param plantes Grille des plantes disponibles
+     * @param champ Champ de biomasse (nullptr : plantes individuelles)
+     * @param registre Registre des espèces (nullptr : aucune)
+     * @param grilleEspece Grille de l'espèce d'indice donné
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void ConstruireDepuis(const GrilleSpatiale& proies, const GrilleSpatiale& predateurs,
+                          const GrilleSpatiale& plantes, const ChampVegetation* champ,
+                          const RegistreEspeces* registre,
+                          const std::function<const GrilleSpatiale&(int)>& grilleEspece,
+                          float x0, float y0, float x1, float y1);
+
+public:
+    /**
+     * @brief Constructeur
+     */
+    CarteDensite();
+
+    /**
+     * @brief Destructeur
+     */
+    ~CarteDensite();
+
+    /**
+     * @brief Crée la texture de la carte
+     * @param renderer Renderer SDL
+     * @param largeur Largeur de la carte (texels)
+     * @param hauteur Hauteur de la carte (texels)
+     * @param taches Système de tâches de l'application (nullptr : séquentiel)
+     * @return true si succès, false sinon
+     */
+    bool Initialiser(SDL_Renderer* renderer, int largeur, int hauteur, PoolThreads* taches = nullptr);
+
+    /**
+     * @brief Libère la texture (à appeler avant de détruire le renderer)
+     */
+    void Nettoyer();
+
+    /**
+     * @brief Choisit automatiquement entre sprites et carte de densité
+     * @param nbVisibles Nombre d'animaux dans la vue
+     * @param seuilSprites Nombre d'animaux au-delà duquel on passe à la carte
+     * @param zoom Zoom de la caméra
+     * @return true si la carte doit être affichée
+     */
+    bool ChoisirNiveau(int nbVisibles, int seuilSprites, float zoom);
+
+    /**
+     * @brief Remplit la carte pour la zone visible et met à jour la texture
+     * @param eco Écosystème observé
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void Construire(const Ecosysteme& eco, float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Remplit la carte depuis un instantané publié par le thread de simulation
+     * @param instantane Instantané dessiné
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void Construire(const InstantaneRendu& instantane, float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Remplit la carte avec la seule végétation (sous les sprites)
+     * @param champ Champ de biomasse
+     * @param x0 Bord gauche de la zone visible
+     * @param y0 Bord haut de la zone visible
+     * @param x1 Bord droit de la zone visible
+     * @param y1 Bord bas de la zone visible
+     */
+    void ConstruireVegetation(const ChampVegetation& champ, float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Dessine la carte sur toute la vue
+     * @param renderer Renderer SDL
+     * @param largeurVue Largeur de la vue (pixels écran)
+     * @param hauteurVue Hauteur de la vue (pixels écran)
+     */
+    void Dessiner(SDL_Renderer* renderer, int largeurVue, int hauteurVue);
+
+    /**
+     * @brief Indique si la carte remplace actuellement les sprites
+     * @return true si la carte est active
+     */
+    bool EstActive() const;
+};
+
+#endif /* CARTE_DENSITE_H */
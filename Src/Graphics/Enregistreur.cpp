@@ -0,0 +1,337 @@
+/**
+ * @file Enregistreur.cpp
+ * @brief Implémentation de l'enregistrement vidéo hors écran
+ */
+
+#include "Enregistreur.h"
+#include "../Core/ComptableMemoire.h"
+#include "../Core/Traceur.h"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+/**
+ * @brief Constructeur (inactif)
+ */
+Enregistreur::Enregistreur()
+    : mRenderer(nullptr)
+    , mCible(nullptr)
+    , mActif(false)
+    , mTaches(nullptr)
+    , mDernierEncodage(nullptr)
+    , mFluxY4M(nullptr)
+    , mNbCapturees(0)
+    , mNbPerdues(0)
+    , mNbEcrites(0)
+    , mNbErreurs(0)
+{
+}
+
+/**
+ * @brief Destructeur : termine l'enregistrement en cours
+ */
+Enregistreur::~Enregistreur()
+{
+    Arreter();
+}
+
+/**
+ * @brief Prépare cible, sortie et tampons recyclés
+ */
+bool Enregistreur::Demarrer(SDL_Renderer* renderer, const ConfigEnregistrement& config, PoolThreads& taches)
+{
+    Arreter();
+
+    if (config.largeur <= 0 || config.hauteur <= 0)
+    {
+        std::cerr << "❌ Résolution d'enregistrement invalide" << std::endl;
+        return false;
+    }
+
+    std::error_code erreur;
+    std::filesystem::create_directories(config.dossier, erreur);
+    if (erreur)
+    {
+        std::cerr << "❌ Impossible de créer " << config.dossier << " : " << erreur.message() << std::endl;
+        return false;
+    }
+
+    mCible = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                               config.largeur, config.hauteur);
+    if (!mCible)
+    {
+        std::cerr << "Erreur SDL_CreateTexture (cible d'enregistrement): " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    mConfig = config;
+    if (mConfig.formatY4M)
+    {
+        /* Un flux vidéo impose l'ordre des images : un seul encodage à la fois */
+        mConfig.nbEncodeurs = 1;
+
+        std::string chemin = mConfig.dossier + "/simulation.y4m";
+        mFluxY4M = fopen(chemin.c_str(), "wb");
+        if (!mFluxY4M)
+        {
+            std::cerr << "❌ Impossible d'ouvrir " << chemin << std::endl;
+            SDL_DestroyTexture(mCible);
+            mCible = nullptr;
+            return false;
+        }
+        fprintf(mFluxY4M, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+                mConfig.largeur, mConfig.hauteur, std::max(1, mConfig.imagesParSeconde));
+    }
+    mConfig.nbEncodeurs = std::max(1, mConfig.nbEncodeurs);
+    mConfig.capaciteFile = std::max(1, mConfig.capaciteFile);
+
+    /* Un tampon par place de la file et par encodage simultané : plus aucune allocation ensuite */
+    size_t taille = static_cast<size_t>(mConfig.largeur) * mConfig.hauteur * 4;
+    for (int i = 0; i < mConfig.capaciteFile + mConfig.nbEncodeurs; i++)
+    {
+        ImageCapturee* image = new ImageCapturee;
+        image->numero = 0;
+        image->pixels.resize(taille);
+        mTampons.push_back(image);
+        mLibres.push_back(image);
+    }
+
+    mRenderer = renderer;
+    mTaches = &taches;
+    mDernierEncodage = nullptr;
+    mNbCapturees = 0;
+    mNbPerdues = 0;
+    mNbEcrites = 0;
+    mNbErreurs = 0;
+
+    mActif = true;
+    std::cout << "🎬 Enregistrement " << (mConfig.formatY4M ? "Y4M" : "PNG") << " "
+              << mConfig.largeur << "x" << mConfig.hauteur << " dans " << mConfig.dossier << std::endl;
+    return true;
+}
+
+/**
+ * @brief Dessine dans la cible ; l'échelle fait correspondre la vue à la cible
+ */
+void Enregistreur::DebutFrame(int largeurVue, int hauteurVue)
+{
+    if (!mActif)
+        return;
+
+    SDL_SetRenderTarget(mRenderer, mCible);
+    SDL_SetRenderScale(mRenderer,
+                       static_cast<float>(mConfig.largeur) / std::max(1, largeurVue),
+                       static_cast<float>(mConfig.hauteur) / std::max(1, hauteurVue));
+}
+
+/**
+ * @brief Relecture dans un tampon libre, encodage lancé sans attente, retour à la fenêtre
+ */
+void Enregistreur::FinFrame()
+{
+    if (!mActif)
+        return;
+    Traceur::Debut("Capture");
+
+    /* Retour aux pixels de la cible, pour la relecture comme pour la fenêtre */
+    SDL_SetRenderScale(mRenderer, 1.0f, 1.0f);
+
+    ImageCapturee* image = nullptr;
+    {
+        std::lock_guard<std::mutex> verrou(mMutex);
+        if (!mLibres.empty())
+        {
+            image = mLibres.back();
+            mLibres.pop_back();
+        }
+    }
+
+    if (image)
+    {
+        SDL_Surface* lue = SDL_RenderReadPixels(mRenderer, nullptr);
+        SDL_Surface* rgba = lue;
+        if (lue && lue->format != SDL_PIXELFORMAT_RGBA32)
+            rgba = SDL_ConvertSurface(lue, SDL_PIXELFORMAT_RGBA32);
+
+        bool lueEntiere = rgba && rgba->w == mConfig.largeur && rgba->h == mConfig.hauteur;
+        if (lueEntiere)
+        {
+            size_t ligne = static_cast<size_t>(mConfig.largeur) * 4;
+            const uint8_t* source = static_cast<const uint8_t*>(rgba->pixels);
+            for (int y = 0; y < mConfig.hauteur; y++)
+                memcpy(&image->pixels[y * ligne], source + static_cast<size_t>(y) * rgba->pitch, ligne);
+        }
+        else
+            std::cerr << "Erreur SDL_RenderReadPixels: " << SDL_GetError() << std::endl;
+
+        if (rgba != lue)
+            SDL_DestroySurface(rgba);
+        SDL_DestroySurface(lue);
+
+        if (lueEntiere)
+        {
+            image->numero = mNbCapturees++;
+            if (mConfig.formatY4M)
+            {
+                PoolThreads::Tache* encodage = mTaches->Lancer([this, image] { Encoder(image); },
+                                                               {mDernierEncodage});
+                mTaches->Liberer(mDernierEncodage);
+                mDernierEncodage = encodage;
+            }
+            else
+                mTaches->Liberer(mTaches->Lancer([this, image] { Encoder(image); }));
+        }
+        else
+        {
+            std::lock_guard<std::mutex> verrou(mMutex);
+            mLibres.push_back(image);
+            mNbPerdues++;
+        }
+    }
+    else
+    {
+        /* Encodages saturés : la simulation n'attend pas */
+        mNbPerdues++;
+    }
+
+    /* La fenêtre affiche la cible ; le reste de la frame s'y dessine */
+    SDL_SetRenderTarget(mRenderer, nullptr);
+    if (SDL_GetRenderWindow(mRenderer))
+        SDL_RenderTexture(mRenderer, mCible, nullptr, nullptr);
+    Traceur::Fin();
+}
+
+/**
+ * @brief Encode l'image, puis recycle son tampon
+ */
+void Enregistreur::Encoder(ImageCapturee* image)
+{
+    ZoneMemoire zone(MEMOIRE_RENDU);
+
+    Traceur::Debut("Encodage");
+    bool ok = mConfig.formatY4M ? EcrireY4M(*image) : EcrirePNG(*image);
+    Traceur::Fin();
+    if (ok)
+        mNbEcrites++;
+    else
+        mNbErreurs++;
+
+    /* Notifié sous le verrou : Arreter ne peut pas détruire l'enregistreur avant qu'on l'ait rendu */
+    std::lock_guard<std::mutex> verrou(mMutex);
+    mLibres.push_back(image);
+    mRendu.notify_all();
+}
+
+/**
+ * @brief Écrit dossier/image_NNNNNN.png
+ */
+bool Enregistreur::EcrirePNG(ImageCapturee& image)
+{
+    char nom[32];
+    snprintf(nom, sizeof(nom), "/image_%06d.png", image.numero);
+    std::string chemin = mConfig.dossier + nom;
+
+    SDL_Surface* surface = SDL_CreateSurfaceFrom(mConfig.largeur, mConfig.hauteur, SDL_PIXELFORMAT_RGBA32,
+                                                 image.pixels.data(), mConfig.largeur * 4);
+    if (!surface)
+        return false;
+
+    bool ok = IMG_SavePNG(surface, chemin.c_str());
+    SDL_DestroySurface(surface);
+    return ok;
+}
+
+/**
+ * @brief Conversion BT.601 (plage vidéo) en trois plans pleins, puis écriture
+ */
+bool Enregistreur::EcrireY4M(const ImageCapturee& image)
+{
+    size_t nbPixels = static_cast<size_t>(mConfig.largeur) * mConfig.hauteur;
+    uint8_t* planY = static_cast<uint8_t*>(mTaches->Brouillon(nbPixels * 3));
+    uint8_t* planU = planY + nbPixels;
+    uint8_t* planV = planU + nbPixels;
+
+    for (size_t i = 0; i < nbPixels; i++)
+    {
+        int r = image.pixels[i * 4 + 0];
+        int v = image.pixels[i * 4 + 1];
+        int b = image.pixels[i * 4 + 2];
+        planY[i] = static_cast<uint8_t>(16 + ((66 * r + 129 * v + 25 * b + 128) >> 8));
+        planU[i] = static_cast<uint8_t>(128 + ((-38 * r - 74 * v + 112 * b + 128) >> 8));
+        planV[i] = static_cast<uint8_t>(128 + ((112 * r - 94 * v - 18 * b + 128) >> 8));
+    }
+
+    fputs("FRAME\n", mFluxY4M);
+    return fwrite(planY, 1, nbPixels * 3, mFluxY4M) == nbPixels * 3;
+}
+
+/**
+ * @brief Attend que tous les tampons soient rendus, puis libère cible et tampons
+ */
+void Enregistreur::Arreter()
+{
+    if (!mActif)
+        return;
+
+    {
+        std::unique_lock<std::mutex> verrou(mMutex);
+        mRendu.wait(verrou, [this] { return mLibres.size() == mTampons.size(); });
+    }
+    mTaches->Liberer(mDernierEncodage);
+    mDernierEncodage = nullptr;
+
+    if (mFluxY4M)
+    {
+        fclose(mFluxY4M);
+        mFluxY4M = nullptr;
+    }
+
+    SDL_DestroyTexture(mCible);
+    mCible = nullptr;
+
+    for (auto* image : mTampons)
+        delete image;
+    mTampons.clear();
+    mLibres.clear();
+    mActif = false;
+
+    std::cout << "🎬 Enregistrement terminé : " << mNbEcrites << " images écrites, "
+              << mNbPerdues << " perdues";
+    if (mNbErreurs > 0)
+        std::cout << ", ⚠️ " << mNbErreurs << " erreurs d'écriture";
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Indique si un enregistrement est en cours
+ */
+bool Enregistreur::EstActif() const
+{
+    return mActif;
+}
+
+/**
+ * @brief Indique si l'interface figure dans les images
+ */
+bool Enregistreur::AvecInterface() const
+{
+    return mActif && mConfig.avecInterface;
+}
+
+/**
+ * @brief Compte les images écrites
+ */
+int Enregistreur::GetNombreEcrites() const
+{
+    return mNbEcrites;
+}
+
+/**
+ * @brief Compte les images perdues
+ */
+int Enregistreur::GetNombrePerdues() const
+{
+    return mNbPerdues;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file Enregistreur.h
+ * @brief Enregistrement vidéo hors écran : rendu dans une cible, encodage en arrière-plan
+ */
+
+#ifndef ENREGISTREUR_H
+#define ENREGISTREUR_H
+
+#include "../Core/PoolThreads.h"
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ConfigEnregistrement
+ * @brief Paramètres d'un enregistrement
+ */
+struct ConfigEnregistrement
+{
+    std::string dossier;    /**< Dossier de sortie (créé si besoin) */
+    bool formatY4M;         /**< Flux Y4M unique au lieu d'une suite de PNG numérotés */
+    int largeur;            /**< Largeur des images (pixels) */
+    int hauteur;            /**< Hauteur des images (pixels) */
+    bool avecInterface;     /**< L'interface ImGui figure dans les images */
+    int imagesParSeconde;   /**< Cadence annoncée dans l'en-tête Y4M */
+    int nbEncodeurs;        /**< Encodages PNG simultanés au plus (un seul en Y4M : l'ordre compte) */
+    int capaciteFile;       /**< Images en attente d'encodage au maximum */
+};
+
+/**
+ * @class Enregistreur
+ * @brief Capture chaque frame dans une texture cible et l'encode sur le système de tâches
+ *
+ * Entre DebutFrame et FinFrame, tout le rendu va dans une texture cible à la
+ * résolution choisie (une mise à l'échelle garde les coordonnées de la vue).
+ * FinFrame relit les pixels dans un tampon, lance une tâche d'encodage et,
+ * s'il y a une fenêtre, y recopie la cible. En Y4M, chaque tâche a la
+ * précédente pour prérequis : le flux garde l'ordre. Les tampons d'image sont
+ * recyclés : quand ils sont tous en attente ou en cours d'encodage, la frame
+ * est perdue et comptée, sans jamais attendre les encodages.
+ *
+ * Fonctionne aussi avec un renderer logiciel (SDL_CreateSoftwareRenderer),
+ * sans fenêtre, pour les simulations sans affichage.
+ */
+class Enregistreur
+{
+private:
+    /**
+     * @struct ImageCapturee
+     * @brief Pixels RGBA d'une frame relue
+     */
+    struct ImageCapturee
+    {
+        int numero;                     /**< Rang de l'image dans l'enregistrement */
+        std::vector<uint8_t> pixels;    /**< RGBA, lignes contiguës */
+    };
+
+    ConfigEnregistrement mConfig;       /**< Paramètres de l'enregistrement en cours */
+    SDL_Renderer* mRenderer;            /**< Renderer dessinant dans la cible (non possédé) */
+    SDL_Texture* mCible;                /**< Texture cible à la résolution d'enregistrement */
+    bool mActif;                        /**< Enregistrement démarré */
+
+    PoolThreads* mTaches;                   /**< Système de tâches des encodages (non possédé) */
+    PoolThreads::Tache* mDernierEncodage;   /**< Encodage Y4M le plus récent, prérequis du suivant */
+    std::mutex mMutex;                      /**< Protège les tampons libres */
+    std::condition_variable mRendu;         /**< Signale un tampon rendu par un encodage */
+    std::vector<ImageCapturee*> mLibres;    /**< Tampons recyclables */
+    std::vector<ImageCapturee*> mTampons;   /**< Tous les tampons (possédés) */
+
+    FILE* mFluxY4M;                     /**< Flux de sortie en Y4M (nullptr en PNG) */
+    int mNbCapturees;                   /**< Images déposées dans la file */
+    int mNbPerdues;                     /**< Images abandonnées faute de place */
+    std::atomic<int> mNbEcrites;        /**< Images encodées et écrites */
+    std::atomic<int> mNbErreurs;        /**< Écritures échouées */
+
+    /**
+     * @brief Tâche d'encodage : écrit l'image, puis rend son tampon
+     * @param image Image à écrire
+     */
+    void Encoder(ImageCapturee* image);
+
+    /**
+     * @brief Écrit une image en PNG numéroté
+     * @param image Image à écrire
+     * @return true si succès
+     */
+    bool EcrirePNG(ImageCapturee& image);
+
+    /**
+     * @brief Convertit une image en YUV 4:4:4 (dans le brouillon du thread) et l'ajoute au flux Y4M
+     * @param image Image à écrire
+     * @return true si succès
+     */
+    bool EcrireY4M(const ImageCapturee& image);
+
+public:
+    /**
+     * @brief Constructeur (inactif)
+     */
+    Enregistreur();
+
+    /**
+     * @brief Destructeur : termine l'enregistrement en cours
+     */
+    ~Enregistreur();
+
+    Enregistreur(const Enregistreur&) = delete;
+    Enregistreur& operator=(const Enregistreur&) = delete;
+
+    /**
+     * @brief Crée la cible, ouvre la sortie et prépare les tampons
+     * @param renderer Renderer de la fenêtre, ou renderer logiciel sans fenêtre
+     * @param config Paramètres de l'enregistrement
+     * @param taches Système de tâches de l'application, qui exécute les encodages
+     * @return true si l'enregistrement a démarré
+     */
+    bool Demarrer(SDL_Renderer* renderer, const ConfigEnregistrement& config, PoolThreads& taches);
+
+    /**
+     * @brief Redirige le rendu vers la cible
+     * @param largeurVue Largeur de la vue dessinée (pixels écran)
+     * @param hauteurVue Hauteur de la vue dessinée (pixels écran)
+     */
+    void DebutFrame(int largeurVue, int hauteurVue);
+
+    /**
+     * @brief Relit la cible, dépose l'image et rend la main à la fenêtre
+     *
+     * Sans tampon libre, l'image est comptée perdue sans être relue. Avec une
+     * fenêtre, la cible y est recopiée : la suite du rendu (interface exclue
+     * de l'enregistrement) s'y dessine par-dessus.
+     */
+    void FinFrame();
+
+    /**
+     * @brief Attend les encodages en cours et ferme la sortie
+     */
+    void Arreter();
+
+    /**
+     * @brief Indique si un enregistrement est en cours
+     * @return true si démarré
+     */
+    bool EstActif() const;
+
+    /**
+     * @brief Indique si l'interface doit être dessinée avant FinFrame
+     * @return true si l'interface figure dans les images
+     */
+    bool AvecInterface() const;
+
+    /**
+     * @brief Compte les images écrites
+     * @return Images encodées depuis Demarrer
+     */
+    int GetNombreEcrites() const;
+
+    /**
+     * @brief Compte les images perdues
+     * @return Frames abandonnées parce que les encodages ne suivaient pas
+     */
+    int GetNombrePerdues() const;
+};
+
+#endif /* ENREGISTREUR_H */
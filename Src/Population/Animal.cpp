@@ -1,127 +1,160 @@
-/**
- * @file Animal.cpp
- * @brief Implémentation des méthodes de la classe Animal
- */
-
-#include "Animal.h"
-#include <cmath>
-
-/**
- * @brief Constructeur de la classe Animal
- * @param posX Position initiale en X
- * @param posY Position initiale en Y
- * @param largeur Largeur du monde de simulation
- * @param hauteur Hauteur du monde de simulation
- */
-Animal::Animal(float posX, float posY, float largeur, float hauteur)
-    : mX(posX)
-    , mY(posY)
-    , mVx(0.0f)
-    , mVy(0.0f)
-    , mEnergie(100.0f)
-    , mVivant(true)
-    , mLargeurMonde(largeur)
-    , mHauteurMonde(hauteur)
-    , mTempsDepuisReproduction(0.0f)
-{
-    /* Initialisation via liste d'initialisation */
-}
-
-/**
- * @brief Réduit l'énergie de l'animal
- * @param quantite Quantité d'énergie à soustraire
- */
-void Animal::PerdreEnergie(float quantite)
-{
-    mEnergie -= quantite;
-
-    /* Mort si énergie épuisée */
-    if (mEnergie <= 0.0f)
-    {
-        mEnergie = 0.0f;
-        mVivant = false;
-    }
-}
-
-/**
- * @brief Augmente l'énergie de l'animal
- * @param quantite Quantité d'énergie à ajouter
- */
-void Animal::GagnerEnergie(float quantite)
-{
-    mEnergie += quantite;
-
-    /* Plafonner à 100 */
-    if (mEnergie > 100.0f)
-        mEnergie = 100.0f;
-}
-
-/**
- * @brief Incrémente le temps écoulé depuis dernière reproduction
- * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
- */
-void Animal::IncrementerTempsReproduction(float deltaTime)
-{
-    mTempsDepuisReproduction += deltaTime;
-}
-
-/**
- * @brief Réinitialise le compteur de reproduction
- */
-void Animal::ReinitialiserReproduction()
-{
-    mTempsDepuisReproduction = 0.0f;
-}
-
-/**
- * @brief Récupère la position horizontale
- * @return Position X actuelle
- */
-float Animal::GetX() const
-{
-    return mX;
-}
-
-/**
- * @brief Récupère la position verticale
- * @return Position Y actuelle
- */
-float Animal::GetY() const
-{
-    return mY;
-}
-
-/**
- * @brief Vérifie si l'animal est vivant
- * @return true si vivant, false sinon
- */
-bool Animal::EstVivant() const
-{
-    return mVivant;
-}
-
-/**
- * @brief Récupère le niveau d'énergie
- * @return Énergie actuelle (0-100)
- */
-float Animal::GetEnergie() const
-{
-    return mEnergie;
-}
-
-/**
- * @brief Recupère la direction du déplqcement
- * @return Vitesse de déplacement
- */
-float Animal::GetDirection()
-{
-    return mVx;
-}
-
-/**
- * @brief Destructeur de la classe Animal
- */
-Animal::~Animal()
-{
-}
-
+/**
+ * @file Animal.cpp
+ * @brief Implémentation des méthodes de la classe Animal
+ */
+
+#include "Animal.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructeur de la classe Animal
+ * @param posX Position initiale en X
+ * @param posY Position initiale en Y
+ */
+Animal::Animal(float posX, float posY)
+    : mX(posX)
+    , mY(posY)
+    , mVx(0.0f)
+    , mVy(0.0f)
+    , mEnergie(100.0f)
+    , mTempsDepuisReproduction(0.0f)
+    , mRang(AnnexesAnimaux::SANS_RANG)
+    , mVivant(true)
+    , mEndormi(false)
+{
+    /* Initialisation via liste d'initialisation */
+}
+
+/**
+ * @brief Minuterie du rang de l'animal dans les annexes du contexte
+ */
+Minuterie* Animal::MinuterieReproduction(const ContexteMonde& monde) const
+{
+    if (!monde.annexes || mRang == AnnexesAnimaux::SANS_RANG)
+        return nullptr;
+    return &monde.annexes->GetMinuterie(mRang);
+}
+
+/**
+ * @brief Temps écoulé depuis dernière reproduction
+ * @return Compteur figé, ou compteur à l'armement plus le temps écoulé depuis
+ */
+float Animal::GetTempsDepuisReproduction(const ContexteMonde& monde) const
+{
+    const Minuterie* minuterie = MinuterieReproduction(monde);
+    if (minuterie && minuterie->EstArmee())
+        return mTempsDepuisReproduction + minuterie->roue->SecondesDepuisArmement(*minuterie);
+    return mTempsDepuisReproduction;
+}
+
+/**
+ * @brief Récupère le rang de l'animal dans les annexes
+ */
+uint32_t Animal::GetRang() const
+{
+    return mRang;
+}
+
+/**
+ * @brief Mémorise le rang donné ou repris par l'écosystème
+ */
+void Animal::SetRang(uint32_t rang)
+{
+    mRang = rang;
+}
+
+/**
+ * @brief Fige le compteur de reproduction à sa valeur courante
+ */
+void Animal::FigerReproduction(const ContexteMonde& monde)
+{
+    Minuterie* minuterie = MinuterieReproduction(monde);
+    if (!minuterie || !minuterie->EstArmee())
+        return;
+    mTempsDepuisReproduction = GetTempsDepuisReproduction(monde);
+    minuterie->roue->Desarmer(*minuterie);
+}
+
+/**
+ * @brief Fige le compteur de reproduction à l'échéance de sa minuterie
+ * @param delai Délai de reproduction de l'espèce
+ */
+void Animal::AtteindreMaturite(float delai)
+{
+    mTempsDepuisReproduction = std::max(mTempsDepuisReproduction, delai);
+}
+
+/**
+ * @brief Réinitialise le compteur de reproduction
+ */
+void Animal::ReinitialiserReproduction(const ContexteMonde& monde)
+{
+    FigerReproduction(monde);
+    mTempsDepuisReproduction = 0.0f;
+}
+
+/**
+ * @brief Copie l'état dynamique d'un animal éveillé
+ * @return Position, vitesse, énergie et compteur de reproduction
+ */
+EtatAnimal Animal::GetEtat(const ContexteMonde& monde) const
+{
+    EtatAnimal etat;
+    etat.x = mX;
+    etat.y = mY;
+    etat.vx = mVx;
+    etat.vy = mVy;
+    etat.energie = mEnergie;
+    etat.tempsDepuisReproduction = GetTempsDepuisReproduction(monde);
+    return etat;
+}
+
+/**
+ * @brief Remplace l'état dynamique de l'animal
+ * @param etat État à appliquer
+ */
+void Animal::AppliquerEtat(const EtatAnimal& etat)
+{
+    mX = etat.x;
+    mY = etat.y;
+    mVx = etat.vx;
+    mVy = etat.vy;
+    mEnergie = etat.energie;
+    mTempsDepuisReproduction = etat.tempsDepuisReproduction;
+    mVivant = (etat.energie > 0.0f);
+}
+
+/**
+ * @brief Décalage borné au monde ; le rebond éventuel a lieu au déplacement suivant
+ */
+void Animal::Decaler(float dx, float dy, const ContexteMonde& monde)
+{
+    mX = std::min(std::max(mX + dx, 0.0f), monde.largeur);
+    mY = std::min(std::max(mY + dy, 0.0f), monde.hauteur);
+}
+
+/**
+ * @brief Fige l'état courant comme origine de la trajectoire
+ */
+void Animal::Endormir()
+{
+    mEndormi = true;
+}
+
+/**
+ * @brief Recupère la direction du déplqcement
+ * @return Vitesse de déplacement
+ */
+float Animal::GetDirection()
+{
+    return mVx;
+}
+
+/**
+ * @brief Destructeur de la classe Animal
+ */
+Animal::~Animal()
+{
+}
+
@@ -1,148 +1,704 @@
-/**
- * @file Animal.h
- * @brief Classe abstraite représentant un animal de l'écosystème
- */
-
-#ifndef ANIMAL_H
-#define ANIMAL_H
-
-#include <vector>
-
-class Proie;
-class Predateur;
-class Plante;
-
-/**
- * @class Animal
- * @brief Classe de base pour tous les animaux (proies et prédateurs)
- */
-class Animal
-{
-protected:
-    float mX;                        /**< Position horizontale dans le monde */
-    float mY;                        /**< Position verticale dans le monde */
-    float mVx;                       /**< Vitesse horizontale (pixels/seconde) */
-    float mVy;                       /**< Vitesse verticale (pixels/seconde) */
-    float mEnergie;                  /**< Niveau d'énergie actuel (0-100) */
-    bool mVivant;                    /**< État vital de l'animal */
-    float mLargeurMonde;             /**< Largeur de la zone de simulation */
-    float mHauteurMonde;             /**< Hauteur de la zone de simulation */
-    float mTempsDepuisReproduction;  /**< Temps écoulé depuis dernière reproduction */
-    
-public:
-    /**
-     * @brief Constructeur de la classe Animal
-     * @param posX Position initiale en X
-     * @param posY Position initiale en Y
-     * @param largeur Largeur du monde de simulation
-     * @param hauteur Hauteur du monde de simulation
-     */
-    Animal(float posX, float posY, float largeur, float hauteur);
-    
-    /**
-     * @brief Destructeur virtuel
-     */
-    virtual ~Animal();
-    
-    /**
-     * @brief Déplace l'animal selon sa vitesse et gère les rebonds
-     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
-     */
-    virtual void Deplacer(float deltaTime) = 0;
-    
-
-    /**
-     * @brief Recupère la direction du déplqcement
-     * @return Vitesse de déplacement
-     */
-    float GetDirection();
-
-
-    /**
-     * @brief Réduit l'énergie de l'animal
-     * @param quantite Quantité d'énergie à soustraire
-     */
-    void PerdreEnergie(float quantite);
-
-    /**
-     * @brief Incrémente le temps écoulé depuis dernière reproduction
-     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
-     */
-    void IncrementerTempsReproduction(float deltaTime);
-    
-    /**
-     * @brief Augmente l'énergie de l'animal
-     * @param quantite Quantité d'énergie à ajouter
-     */
-    void GagnerEnergie(float quantite);
-    
-    /**
-     * @brief Récupère la position horizontale
-     * @return Position X actuelle
-     */
-    float GetX() const;
-    
-    /**
-     * @brief Récupère la position verticale
-     * @return Position Y actuelle
-     */
-    float GetY() const;
-    
-    /**
-     * @brief Vérifie si l'animal est vivant
-     * @return true si vivant, false sinon
-     */
-    bool EstVivant() const;
-    
-    /**
-     * @brief Récupère le niveau d'énergie
-     * @return Énergie actuelle (0-100)
-     */
-    float GetEnergie() const;
-
-    /**
-     * @brief Récupère l'énergie minimal pour se reproduire
-     * @return La quantité d'energie necessaire par espèce (0-100)
-     */
-    virtual float GetSeuil() const = 0;
-    
-    /**
-     * @brief Réinitialise le compteur de reproduction
-     */
-    void ReinitialiserReproduction();
-    
-    /**
-     * @brief Définit le comportement spécifique de l'espèce
-     * @param proies Liste des proies dans le monde
-     * @param predateurs Liste des prédateurs dans le monde
-     * @param plantes Liste des plantes disponibles
-     * 
-     * Méthode abstraite à implémenter dans les classes dérivées
-     */
-    virtual void Comportement(const std::vector<Proie*>& proies,
-                             const std::vector<Predateur*>& predateurs,
-                             const std::vector<Plante*>& plantes) = 0;
-
-protected:
-    /**
-     * @brief Vérifie conditions de reproduction
-     * @return true si peut se reproduire, false sinon
-     */
-    virtual bool PeutSeReproduire() const = 0;
-    
-    /**
-     * @brief Détecte entités proches
-     * @param proies Liste des proies
-     * @param predateurs Liste des prédateurs
-     */
-    virtual void Detecter(const std::vector<Proie*>& proies,
-                         const std::vector<Predateur*>& predateurs) = 0;
-    
-    /**
-     * @brief Gère perte d'énergie métabolique
-     * @param deltaTime Temps écoulé (secondes)
-     */
-    virtual void Metabolisme(float deltaTime) = 0;
-};
-
+/**
+ * @file Animal.h
+ * @brief Classe abstraite représentant un animal de l'écosystème
+ */
+
+#ifndef ANIMAL_H
+#define ANIMAL_H
+
+#include "../Core/GenerateurAleatoire.h"
+#include "AnnexesAnimaux.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+class Proie;
+class Predateur;
+class Plante;
+class ChampVegetation;
+class CarteNourriture;
+
+/**
+ * @struct EtatAnimal
+ * @brief Copie de l'état dynamique d'un animal (transfert, sauvegarde)
+ */
+struct EtatAnimal
+{
+    float x;                         /**< Position horizontale */
+    float y;                         /**< Position verticale */
+    float vx;                        /**< Vitesse horizontale */
+    float vy;                        /**< Vitesse verticale */
+    float energie;                   /**< Niveau d'énergie */
+    float tempsDepuisReproduction;   /**< Temps depuis la dernière reproduction */
+};
+
+/**
+ * @struct ContexteMonde
+ * @brief Ce que l'écosystème propriétaire prête à ses animaux pendant la mise à jour
+ *
+ * Tenu par l'écosystème et passé à chaque appel : deux écosystèmes d'un même
+ * processus (relance, bandes, tests) ne partagent ni dimensions ni végétation.
+ * Chaque tuile en passe une copie pointant sur son propre flux aléatoire.
+ */
+struct ContexteMonde
+{
+    float largeur;                   /**< Largeur du monde */
+    float hauteur;                   /**< Hauteur du monde */
+    const ChampVegetation* champ;    /**< Végétation continue (nullptr : plantes individuelles) */
+    const CarteNourriture* carte;    /**< Plante la plus proche par cellule (nullptr : recherche) */
+    GenerateurAleatoire* alea;       /**< Flux des tirages d'errance (écosystème, ou tuile en cours) */
+    AnnexesAnimaux* annexes;         /**< Minuteries et délais de suivi, par rang (nullptr : animaux hors écosystème) */
+};
+
+/**
+ * @class Animal
+ * @brief Classe de base pour tous les animaux (proies et prédateurs)
+ */
+class Animal
+{
+protected:
+    float mX;                        /**< Position horizontale dans le monde */
+    float mY;                        /**< Position verticale dans le monde */
+    float mVx;                       /**< Vitesse horizontale (pixels/seconde) */
+    float mVy;                       /**< Vitesse verticale (pixels/seconde) */
+    float mEnergie;                  /**< Niveau d'énergie actuel (0-100) */
+    float mTempsDepuisReproduction;  /**< Temps depuis dernière reproduction, à l'armement de sa minuterie */
+    uint32_t mRang;                  /**< Rang dans les annexes de l'écosystème (SANS_RANG : hors écosystème) */
+    bool mVivant;                    /**< État vital de l'animal */
+    bool mEndormi;                   /**< Suit une trajectoire calculée par le planificateur de sommeil */
+
+    static constexpr float TOLERANCE_SUIVI = 5.0f;        /**< Écart max (pixels) entre la cible suivie et la plus proche */
+    static constexpr float INTERVALLE_SUIVI_MAX = 0.25f;  /**< Délai max entre deux détections complètes (nouveaux venus) */
+    static constexpr float FACTEUR_DIAGONALE = 1.4143f;   /**< Vitesse max / VITESSE_BASE (errance en diagonale) */
+    
+public:
+    /**
+     * @brief Constructeur de la classe Animal
+     * @param posX Position initiale en X
+     * @param posY Position initiale en Y
+     */
+    Animal(float posX, float posY);
+
+    /**
+     * @brief Copie de l'état d'un animal (relogement en mémoire)
+     * @param modele Animal copié
+     *
+     * La copie garde le rang du modèle : minuterie, délai de suivi et état
+     * de sommeil la suivent sans être déplacés.
+     */
+    Animal(const Animal& modele) = default;
+
+    /**
+     * @brief Destructeur virtuel
+     */
+    virtual ~Animal();
+    
+    /**
+     * @brief Déplace l'animal selon sa vitesse et gère les rebonds
+     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
+     * @param monde Dimensions du monde
+     */
+    virtual void Deplacer(float deltaTime, const ContexteMonde& monde) = 0;
+    
+
+    /**
+     * @brief Recupère la direction du déplqcement
+     * @return Vitesse de déplacement
+     */
+    float GetDirection();
+
+
+    /**
+     * @brief Réduit l'énergie de l'animal
+     * @param quantite Quantité d'énergie à soustraire
+     */
+    void PerdreEnergie(float quantite);
+
+    /**
+     * @brief Temps écoulé depuis dernière reproduction
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     * @return Secondes (lues sur la roue si la minuterie de reproduction est armée)
+     */
+    float GetTempsDepuisReproduction(const ContexteMonde& monde) const;
+
+    /**
+     * @brief Récupère le rang de l'animal dans les annexes
+     * @return Rang donné à l'accueil, SANS_RANG hors écosystème
+     */
+    uint32_t GetRang() const;
+
+    /**
+     * @brief Mémorise le rang donné ou repris par l'écosystème
+     * @param rang Rang dans les annexes, AnnexesAnimaux::SANS_RANG au départ
+     */
+    void SetRang(uint32_t rang);
+
+    /**
+     * @brief Fige le compteur de reproduction à sa valeur courante et désarme sa minuterie
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     *
+     * À appeler avant que l'animal ne quitte l'écosystème propriétaire de la roue.
+     */
+    void FigerReproduction(const ContexteMonde& monde);
+
+    /**
+     * @brief Fige le compteur de reproduction à l'échéance de sa minuterie
+     * @param delai Délai de reproduction de l'espèce
+     */
+    void AtteindreMaturite(float delai);
+    
+    /**
+     * @brief Augmente l'énergie de l'animal
+     * @param quantite Quantité d'énergie à ajouter
+     */
+    void GagnerEnergie(float quantite);
+    
+    /**
+     * @brief Récupère la position horizontale
+     * @return Position X actuelle (celle de l'endormissement si l'animal dort)
+     */
+    float GetX() const;
+    
+    /**
+     * @brief Récupère la position verticale
+     * @return Position Y actuelle (celle de l'endormissement si l'animal dort)
+     */
+    float GetY() const;
+
+    /**
+     * @brief Position sur la trajectoire rectiligne, un temps donné plus loin
+     * @param duree Temps écoulé depuis l'endormissement (secondes)
+     * @param x Position horizontale prolongée
+     * @param y Position verticale prolongée
+     *
+     * Réservée au planificateur de sommeil, qui tient l'instant d'endormissement :
+     * les boucles de mise à jour ne voient que des éveillés et lisent GetX/GetY.
+     */
+    void PositionApres(float duree, float& x, float& y) const;
+
+    /**
+     * @brief Décompte le délai avant la prochaine détection complète (mode suivi)
+     * @param deltaTime Temps écoulé (secondes)
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     */
+    void DecompterSuivi(float deltaTime, const ContexteMonde& monde);
+
+    /**
+     * @brief Vérifie si l'animal est vivant
+     * @return true si vivant, false sinon
+     */
+    bool EstVivant() const;
+    
+    /**
+     * @brief Récupère le niveau d'énergie
+     * @return Énergie actuelle (0-100), celle de l'endormissement si l'animal dort
+     */
+    float GetEnergie() const;
+
+    /**
+     * @brief Récupère l'énergie minimal pour se reproduire
+     * @return La quantité d'energie necessaire par espèce (0-100)
+     */
+    virtual float GetSeuil() const = 0;
+    
+    /**
+     * @brief Réinitialise le compteur de reproduction (et désarme sa minuterie)
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     */
+    void ReinitialiserReproduction(const ContexteMonde& monde);
+
+    /**
+     * @brief Copie l'état dynamique d'un animal éveillé
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     * @return Position, vitesse, énergie et compteur de reproduction
+     *
+     * Les bandes, seules à transférer des animaux, n'endorment personne.
+     */
+    EtatAnimal GetEtat(const ContexteMonde& monde) const;
+
+    /**
+     * @brief Remplace l'état dynamique d'un animal hors écosystème (l'animal redevient vivant)
+     * @param etat État à appliquer
+     *
+     * Fantôme ou arrivant pas encore accueilli : aucun rang, rien à désarmer.
+     */
+    void AppliquerEtat(const EtatAnimal& etat);
+
+    /**
+     * @brief Déplace l'animal d'un décalage imposé, sans sortir du monde
+     * @param dx Décalage horizontal (pixels)
+     * @param dy Décalage vertical (pixels)
+     * @param monde Dimensions du monde
+     */
+    void Decaler(float dx, float dy, const ContexteMonde& monde);
+    
+    /**
+     * @brief Déplace l'animal et le fait rebondir à MARGE_BORD des bords
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
+     * @param monde Dimensions du monde
+     */
+    template<typename Politique>
+    void DeplacerSelon(float deltaTime, const ContexteMonde& monde);
+
+    /**
+     * @brief Perte d'énergie de base et coût du déplacement
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    template<typename Politique>
+    void MetabolismeSelon(float deltaTime);
+
+    /**
+     * @brief Vérifie énergie et délai de reproduction
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     * @return true si l'animal peut se reproduire (minuterie échue et assez d'énergie)
+     */
+    template<typename Politique>
+    bool PeutSeReproduireSelon(const ContexteMonde& monde) const;
+
+    /**
+     * @brief Indique si l'animal suit une trajectoire calculée
+     * @return true si endormi
+     */
+    bool EstEndormi() const;
+
+    /**
+     * @brief Fige l'état courant : position et énergie évoluent ensuite en formule fermée
+     *
+     * L'instant d'endormissement est tenu par le planificateur, sous le rang de l'animal.
+     */
+    void Endormir();
+
+    /**
+     * @brief Durée avant le premier événement prévisible du sommeil
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param xMin Bord gauche de la cellule de veille
+     * @param yMin Bord haut de la cellule de veille
+     * @param xMax Bord droit de la cellule de veille
+     * @param yMax Bord bas de la cellule de veille
+     * @param monde Dimensions du monde et annexes
+     * @return Secondes avant sortie de cellule, rebond, épuisement ou droit à la reproduction
+     */
+    template<typename Politique>
+    double DureeAvantEvenementSelon(float xMin, float yMin, float xMax, float yMax,
+                                    const ContexteMonde& monde) const;
+
+    /**
+     * @brief Rattrape position et énergie depuis l'endormissement
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param duree Temps passé endormi (secondes)
+     * @param changerDirection true pour tirer une nouvelle direction d'errance
+     * @param monde Dimensions du monde
+     */
+    template<typename Politique>
+    void ReveillerSelon(float duree, bool changerDirection, const ContexteMonde& monde);
+    
+    /**
+     * @brief Définit le comportement spécifique de l'espèce
+     * @param proies Liste des proies dans le monde
+     * @param predateurs Liste des prédateurs dans le monde
+     * @param plantes Liste des plantes disponibles
+     * @param monde Dimensions et végétation de l'écosystème
+     * 
+     * Méthode abstraite à implémenter dans les classes dérivées
+     */
+    virtual void Comportement(const std::vector<Proie*>& proies,
+                             const std::vector<Predateur*>& predateurs,
+                             const std::vector<Plante*>& plantes,
+                             const ContexteMonde& monde) = 0;
+
+protected:
+    /**
+     * @brief Vérifie conditions de reproduction
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     * @return true si peut se reproduire, false sinon
+     */
+    virtual bool PeutSeReproduire(const ContexteMonde& monde) const = 0;
+    
+    /**
+     * @brief Détecte entités proches
+     * @param proies Liste des proies
+     * @param predateurs Liste des prédateurs
+     * @param monde Contexte de l'écosystème propriétaire (délais de suivi)
+     */
+    virtual void Detecter(const std::vector<Proie*>& proies,
+                         const std::vector<Predateur*>& predateurs,
+                         const ContexteMonde& monde) = 0;
+    
+    /**
+     * @brief Gère perte d'énergie métabolique
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    virtual void Metabolisme(float deltaTime) = 0;
+
+    /**
+     * @brief Change parfois de direction (8 directions possibles) à VITESSE_BASE
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param alea Flux aléatoire du thread qui met l'animal à jour
+     */
+    template<typename Politique>
+    void ErrerSelon(GenerateurAleatoire& alea);
+
+    /**
+     * @brief Part dans l'une des 8 directions à VITESSE_BASE
+     * @tparam Politique PolitiqueEspece de l'espèce
+     * @param alea Flux aléatoire du thread qui met l'animal à jour
+     */
+    template<typename Politique>
+    void ChoisirDirectionSelon(GenerateurAleatoire& alea);
+
+    /**
+     * @brief Garde la cible actuelle ou cherche l'entité vivante la plus proche
+     * @tparam Cible Proie ou Predateur
+     * @param cibles Entités visibles
+     * @param cible Cible actuelle (nullptr si aucune)
+     * @param rayon Rayon de détection
+     * @param vitesseMax Vitesse max de l'animal (VITESSE_BASE de son espèce)
+     * @param vitesseMaxCible Vitesse max des cibles (VITESSE_BASE de leur espèce)
+     * @param monde Contexte de l'écosystème propriétaire (délais de suivi)
+     * @return Cible retenue, nullptr si aucune à portée
+     *
+     * Hors mode suivi, parcourt toujours toutes les cibles. En mode suivi, la
+     * cible est gardée tant qu'elle est vivante et à portée, et que le délai
+     * calculé lors de la dernière détection complète n'est pas écoulé. Ce délai
+     * est le temps minimal pour que la deuxième entité la plus proche devance
+     * la première de plus de TOLERANCE_SUIVI (ou, sans cible, pour qu'une entité
+     * entre de plus de TOLERANCE_SUIVI dans le rayon), distances se rapprochant
+     * au plus de la somme des vitesses max. Plafonné à INTERVALLE_SUIVI_MAX pour
+     * les entités apparues depuis (naissances, changements de tuile).
+     */
+    template<typename Cible>
+    Cible* SuivreOuDetecter(const std::vector<Cible*>& cibles, Cible* cible,
+                            float rayon, float vitesseMax, float vitesseMaxCible,
+                            const ContexteMonde& monde);
+
+    /**
+     * @brief Force une détection complète au prochain Comportement
+     * @param monde Contexte de l'écosystème propriétaire (délais de suivi)
+     */
+    void RelancerDetection(const ContexteMonde& monde);
+
+    /**
+     * @brief Minuterie de reproduction rangée dans les annexes
+     * @param monde Contexte de l'écosystème propriétaire
+     * @return Minuterie du rang, nullptr hors écosystème
+     */
+    Minuterie* MinuterieReproduction(const ContexteMonde& monde) const;
+};
+
+/*
+ * Accesseurs lus à chaque comparaison de distance : définis ici pour que les
+ * boucles par espèce (MettreAJourLot, ListesVoisins) n'appellent rien.
+ */
+
+/**
+ * @brief Position horizontale (rattrapée au réveil si l'animal dort)
+ */
+inline float Animal::GetX() const
+{
+    return mX;
+}
+
+/**
+ * @brief Position verticale (rattrapée au réveil si l'animal dort)
+ */
+inline float Animal::GetY() const
+{
+    return mY;
+}
+
+/**
+ * @brief Prolonge la trajectoire rectiligne depuis l'endormissement
+ */
+inline void Animal::PositionApres(float duree, float& x, float& y) const
+{
+    x = mX + mVx * duree;
+    y = mY + mVy * duree;
+}
+
+/**
+ * @brief Vérifie si l'animal est vivant
+ */
+inline bool Animal::EstVivant() const
+{
+    return mVivant;
+}
+
+/**
+ * @brief Récupère le niveau d'énergie
+ */
+inline float Animal::GetEnergie() const
+{
+    return mEnergie;
+}
+
+/**
+ * @brief Indique si l'animal suit une trajectoire calculée
+ */
+inline bool Animal::EstEndormi() const
+{
+    return mEndormi;
+}
+
+/**
+ * @brief Réduit l'énergie ; l'animal meurt à zéro
+ */
+inline void Animal::PerdreEnergie(float quantite)
+{
+    mEnergie -= quantite;
+
+    /* Mort si énergie épuisée */
+    if (mEnergie <= 0.0f)
+    {
+        mEnergie = 0.0f;
+        mVivant = false;
+    }
+}
+
+/**
+ * @brief Augmente l'énergie, plafonnée à 100
+ */
+inline void Animal::GagnerEnergie(float quantite)
+{
+    mEnergie += quantite;
+
+    if (mEnergie > 100.0f)
+        mEnergie = 100.0f;
+}
+
+/**
+ * @brief Décompte le délai rangé sous le rang de l'animal, en mode suivi seulement
+ */
+inline void Animal::DecompterSuivi(float deltaTime, const ContexteMonde& monde)
+{
+    if (monde.annexes && monde.annexes->SuiviActif())
+        monde.annexes->DelaiSuivi(mRang) -= deltaTime;
+}
+
+/**
+ * @brief Force une détection complète au prochain Comportement
+ */
+inline void Animal::RelancerDetection(const ContexteMonde& monde)
+{
+    if (monde.annexes && monde.annexes->SuiviActif())
+        monde.annexes->DelaiSuivi(mRang) = 0.0f;
+}
+
+/**
+ * @brief Déplacement et rebonds à MARGE_BORD des bords
+ */
+template<typename Politique>
+inline void Animal::DeplacerSelon(float deltaTime, const ContexteMonde& monde)
+{
+    const float marge = Politique::MARGE_BORD;
+
+    /* Mise à jour de la position */
+    mX += mVx * deltaTime;
+    mY += mVy * deltaTime;
+
+    /* Gestion des rebonds sur bords horizontaux */
+    if (mX < marge || mX > monde.largeur - marge)
+    {
+        mVx = -mVx;
+
+        /* Correction pour éviter blocage hors limites */
+        if (mX < marge)
+            mX = marge;
+
+        if (mX > monde.largeur - marge)
+            mX = monde.largeur - marge;
+    }
+
+    /* Gestion des rebonds sur bords verticaux */
+    if (mY < marge || mY > monde.hauteur - marge)
+    {
+        mVy = -mVy;
+
+        if (mY < marge)
+            mY = marge;
+
+        if (mY > monde.hauteur - marge)
+            mY = monde.hauteur - marge;
+    }
+}
+
+/**
+ * @brief Métabolisme de base puis coût du déplacement
+ */
+template<typename Politique>
+inline void Animal::MetabolismeSelon(float deltaTime)
+{
+    PerdreEnergie(Politique::METABOLISME_BASE * deltaTime);
+
+    float vitesse = std::sqrt(mVx * mVx + mVy * mVy);
+    PerdreEnergie(vitesse * Politique::COUT_DEPLACEMENT * deltaTime);
+}
+
+/**
+ * @brief Vérifie énergie et temps depuis dernière reproduction
+ */
+template<typename Politique>
+inline bool Animal::PeutSeReproduireSelon(const ContexteMonde& monde) const
+{
+    if (mEnergie <= Politique::SEUIL_ENERGIE_REPRODUCTION || mTempsDepuisReproduction < Politique::DELAI_REPRODUCTION)
+        return false;
+    const Minuterie* minuterie = MinuterieReproduction(monde);
+    return !minuterie || !minuterie->EstArmee();
+}
+
+/**
+ * @brief Change aléatoirement de direction
+ */
+template<typename Politique>
+inline void Animal::ErrerSelon(GenerateurAleatoire& alea)
+{
+    if (alea.Entier(100) < Politique::CHANCE_CHANGEMENT_DIRECTION)
+        ChoisirDirectionSelon<Politique>(alea);
+}
+
+/**
+ * @brief Tire l'une des 8 directions
+ */
+template<typename Politique>
+inline void Animal::ChoisirDirectionSelon(GenerateurAleatoire& alea)
+{
+    const float v = Politique::VITESSE_BASE;
+
+    /* Bas, haut, droite, gauche, bas-droite, haut-gauche, bas-gauche, haut-droite */
+    static const float DIRECTIONS[8][2] = {
+        { 0,  1}, { 0, -1}, { 1,  0}, {-1,  0},
+        { 1,  1}, {-1, -1}, {-1,  1}, { 1, -1}
+    };
+    int direction = alea.Entier(8);
+    mVx = DIRECTIONS[direction][0] * v;
+    mVy = DIRECTIONS[direction][1] * v;
+}
+
+/**
+ * @brief Suivi de la cible tant que l'ordre des distances ne peut pas avoir changé
+ */
+template<typename Cible>
+inline Cible* Animal::SuivreOuDetecter(const std::vector<Cible*>& cibles, Cible* cible,
+                                       float rayon, float vitesseMax, float vitesseMaxCible,
+                                       const ContexteMonde& monde)
+{
+    /* Même seuil que la détection historique : distance au carré sous 9999 et sous le rayon */
+    const float seuilCarre = std::min(rayon * rayon, 9999.0f);
+    float* delaiSuivi = (monde.annexes && monde.annexes->SuiviActif()) ? &monde.annexes->DelaiSuivi(mRang) : nullptr;
+
+    if (delaiSuivi && *delaiSuivi > 0.0f)
+    {
+        if (!cible)
+            return nullptr;
+        if (cible->EstVivant())
+        {
+            float dx = cible->GetX() - GetX();
+            float dy = cible->GetY() - GetY();
+            if (dx * dx + dy * dy < seuilCarre)
+                return cible;
+        }
+    }
+
+    /* Détection complète : plus proche et deuxième plus proche, même hors de portée */
+    float x = GetX();
+    float y = GetY();
+    float premierCarre = 1e30f;
+    float deuxiemeCarre = 1e30f;
+    Cible* plusProche = nullptr;
+    for (auto* autre : cibles)
+    {
+        if (!autre->EstVivant()) continue;
+
+        float dx = autre->GetX() - x;
+        float dy = autre->GetY() - y;
+        float distanceCarre = dx * dx + dy * dy;
+        if (distanceCarre < premierCarre)
+        {
+            deuxiemeCarre = premierCarre;
+            premierCarre = distanceCarre;
+            plusProche = autre;
+        }
+        else if (distanceCarre < deuxiemeCarre)
+            deuxiemeCarre = distanceCarre;
+    }
+
+    Cible* retenue = (premierCarre < seuilCarre) ? plusProche : nullptr;
+    if (!delaiSuivi)
+        return retenue;
+
+    /* Deux distances se rapprochent au plus de la somme des vitesses max */
+    float rapprochement = (vitesseMax + vitesseMaxCible) * FACTEUR_DIAGONALE;
+    float delai = INTERVALLE_SUIVI_MAX;
+    if (retenue)
+        delai = (std::sqrt(deuxiemeCarre) - std::sqrt(premierCarre) + TOLERANCE_SUIVI) / (2.0f * rapprochement);
+    else if (plusProche)
+        delai = (std::sqrt(premierCarre) - std::sqrt(seuilCarre) + TOLERANCE_SUIVI) / rapprochement;
+    *delaiSuivi = std::min(delai, INTERVALLE_SUIVI_MAX);
+
+    return retenue;
+}
+
+/**
+ * @brief Premier instant où la trajectoire rectiligne cesse d'être valable
+ */
+template<typename Politique>
+inline double Animal::DureeAvantEvenementSelon(float xMin, float yMin, float xMax, float yMax,
+                                               const ContexteMonde& monde) const
+{
+    const float marge = Politique::MARGE_BORD;
+    double duree = 1e30;
+
+    /* Sortie de la cellule, ou rebond si le bord du monde est plus proche */
+    float gauche = std::max(xMin, marge);
+    float droite = std::min(xMax, monde.largeur - marge);
+    float haut = std::max(yMin, marge);
+    float bas = std::min(yMax, monde.hauteur - marge);
+    if (mVx > 0.0f)
+        duree = std::min(duree, static_cast<double>((droite - mX) / mVx));
+    else if (mVx < 0.0f)
+        duree = std::min(duree, static_cast<double>((gauche - mX) / mVx));
+    if (mVy > 0.0f)
+        duree = std::min(duree, static_cast<double>((bas - mY) / mVy));
+    else if (mVy < 0.0f)
+        duree = std::min(duree, static_cast<double>((haut - mY) / mVy));
+
+    /* Épuisement : l'énergie baisse à vitesse constante */
+    float taux = Politique::METABOLISME_BASE
+               + std::sqrt(mVx * mVx + mVy * mVy) * Politique::COUT_DEPLACEMENT;
+    if (taux > 0.0f)
+        duree = std::min(duree, static_cast<double>(mEnergie / taux));
+
+    /* Droit à la reproduction, s'il reste assez d'énergie à ce moment-là */
+    float tempsReproduction = GetTempsDepuisReproduction(monde);
+    if (tempsReproduction <= Politique::DELAI_REPRODUCTION)
+    {
+        float attente = Politique::DELAI_REPRODUCTION - tempsReproduction;
+        if (mEnergie - taux * attente > Politique::SEUIL_ENERGIE_REPRODUCTION)
+            duree = std::min(duree, static_cast<double>(attente));
+    }
+
+    return std::max(0.0, duree);
+}
+
+/**
+ * @brief Applique d'un coup le déplacement et les pertes du sommeil
+ */
+template<typename Politique>
+inline void Animal::ReveillerSelon(float duree, bool changerDirection, const ContexteMonde& monde)
+{
+    const float marge = Politique::MARGE_BORD;
+    mEndormi = false;
+
+    mX = std::min(std::max(mX + mVx * duree, marge), monde.largeur - marge);
+    mY = std::min(std::max(mY + mVy * duree, marge), monde.hauteur - marge);
+    MetabolismeSelon<Politique>(duree);
+    RelancerDetection(monde);
+
+    if (changerDirection)
+        ChoisirDirectionSelon<Politique>(*monde.alea);
+}
+
 #endif /* ANIMAL_H */
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+ * @file AnnexesAnimaux.cpp
+ * @brief Implémentation des tables annexes des animaux
+ */
+
+#include "AnnexesAnimaux.h"
+#include <algorithm>
+
+/**
+ * @brief Tables vides
+ */
+AnnexesAnimaux::AnnexesAnimaux()
+    : mNbRangs(0)
+    , mSuivi(false)
+{
+}
+
+/**
+ * @brief Libère les blocs ; chaque minuterie armée se retire de sa roue
+ */
+AnnexesAnimaux::~AnnexesAnimaux()
+{
+    for (auto* bloc : mBlocs)
+        delete[] bloc;
+}
+
+/**
+ * @brief Reprend le dernier rang rendu, sinon distribue le suivant (un bloc de plus si besoin)
+ */
+uint32_t AnnexesAnimaux::Allouer()
+{
+    uint32_t rang;
+    if (!mLibres.empty())
+    {
+        rang = mLibres.back();
+        mLibres.pop_back();
+    }
+    else
+    {
+        rang = mNbRangs++;
+        if (rang / TAILLE_BLOC >= mBlocs.size())
+            mBlocs.push_back(new Minuterie[TAILLE_BLOC]);
+        if (rang >= mDelaisSuivi.size())
+            mDelaisSuivi.push_back(0.0f);
+    }
+
+    mDelaisSuivi[rang] = 0.0f;
+    return rang;
+}
+
+/**
+ * @brief Désarme la minuterie du rang et le met de côté
+ */
+void AnnexesAnimaux::Liberer(uint32_t rang)
+{
+    Minuterie& minuterie = GetMinuterie(rang);
+    if (minuterie.roue)
+        minuterie.roue->Desarmer(minuterie);
+    mLibres.push_back(rang);
+}
+
+/**
+ * @brief Rangs oubliés sans rendre blocs ni capacités
+ */
+void AnnexesAnimaux::Vider()
+{
+    mLibres.clear();
+    mNbRangs = 0;
+}
+
+/**
+ * @brief Change de mode ; la prochaine détection de chacun est complète
+ */
+void AnnexesAnimaux::ActiverSuivi(bool actif)
+{
+    mSuivi = actif;
+    std::fill(mDelaisSuivi.begin(), mDelaisSuivi.end(), 0.0f);
+}
@@ -0,0 +1,142 @@
+/**
+ * @file AnnexesAnimaux.h
+ * @brief État rarement lu des animaux, rangé hors des objets et indexé par rang
+ */
+
+#ifndef ANNEXES_ANIMAUX_H
+#define ANNEXES_ANIMAUX_H
+
+#include "../Core/RoueTemporisation.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class AnnexesAnimaux
+ * @brief Minuteries de reproduction et délais de suivi des animaux d'un écosystème
+ *
+ * Les boucles de mise à jour et de recherche de voisins lisent position,
+ * vitesse et énergie de milliers d'animaux ; la minuterie de reproduction
+ * (64 octets) et le délai de suivi n'y servent presque jamais. Rangés ici,
+ * ils n'élargissent plus chaque Proie et chaque Predateur.
+ *
+ * L'écosystème donne un rang à chaque animal qu'il accueille et le reprend à
+ * sa mort ou à son départ ; la copie d'un animal relogé garde le rang de
+ * l'original. Les minuteries sont chaînées par la roue : elles sont prises
+ * dans des blocs qui ne bougent plus. Les rangs rendus servent en premier.
+ */
+class AnnexesAnimaux
+{
+private:
+    static constexpr uint32_t TAILLE_BLOC = 1024;      /**< Minuteries ajoutées quand tous les rangs sont pris */
+
+    std::vector<Minuterie*> mBlocs;         /**< Blocs de minuteries (possédés, adresses stables) */
+    std::vector<float> mDelaisSuivi;        /**< Temps avant la prochaine détection complète, par rang */
+    std::vector<uint32_t> mLibres;          /**< Rangs rendus, repris du dernier au premier */
+    uint32_t mNbRangs;                      /**< Rangs distribués au moins une fois */
+    bool mSuivi;                            /**< Mode suivi : les délais sont lus et décomptés */
+
+public:
+    static constexpr uint32_t SANS_RANG = UINT32_MAX;                               /**< Animal hors de tout écosystème */
+    static constexpr size_t OCTETS_PAR_RANG = sizeof(Minuterie) + sizeof(float);    /**< Place d'un animal dans les tables */
+
+    /**
+     * @brief Constructeur : aucun rang distribué, suivi inactif
+     */
+    AnnexesAnimaux();
+
+    /**
+     * @brief Destructeur : les minuteries encore armées quittent leur roue
+     *
+     * La roue doit survivre aux annexes (membre déclaré avant elles).
+     */
+    ~AnnexesAnimaux();
+
+    AnnexesAnimaux(const AnnexesAnimaux&) = delete;
+    AnnexesAnimaux& operator=(const AnnexesAnimaux&) = delete;
+
+    /**
+     * @brief Donne un rang à un animal accueilli
+     * @return Rang dont la minuterie est désarmée et le délai de suivi nul
+     */
+    uint32_t Allouer();
+
+    /**
+     * @brief Reprend le rang d'un animal mort ou parti (sa minuterie est désarmée)
+     * @param rang Rang donné par Allouer
+     */
+    void Liberer(uint32_t rang);
+
+    /**
+     * @brief Oublie tous les rangs (écosystème relancé), blocs gardés
+     *
+     * À appeler après RoueTemporisation::Reinitialiser, qui a déjà détaché
+     * les minuteries. Les rangs repartent de zéro, comme dans des annexes neuves.
+     */
+    void Vider();
+
+    /**
+     * @brief Active ou coupe le mode suivi ; tous les délais repartent de zéro
+     * @param actif true pour que les animaux gardent leur cible entre deux détections
+     */
+    void ActiverSuivi(bool actif);
+
+    /**
+     * @brief Indique si les délais de suivi sont lus
+     * @return true en mode suivi
+     */
+    bool SuiviActif() const;
+
+    /**
+     * @brief Accès à la minuterie de reproduction d'un rang
+     * @param rang Rang d'un animal accueilli
+     * @return Minuterie, à l'adresse fixe tant que les annexes vivent
+     */
+    Minuterie& GetMinuterie(uint32_t rang);
+    const Minuterie& GetMinuterie(uint32_t rang) const;
+
+    /**
+     * @brief Accès au délai de suivi d'un rang
+     * @param rang Rang d'un animal accueilli
+     * @return Temps avant la prochaine détection complète (secondes)
+     */
+    float& DelaiSuivi(uint32_t rang);
+};
+
+/*
+ * Lus par les animaux à chaque détection : définis ici, comme les accesseurs d'Animal.
+ */
+
+/**
+ * @brief Indique si les délais de suivi sont lus
+ */
+inline bool AnnexesAnimaux::SuiviActif() const
+{
+    return mSuivi;
+}
+
+/**
+ * @brief Minuterie du rang, dans son bloc
+ */
+inline Minuterie& AnnexesAnimaux::GetMinuterie(uint32_t rang)
+{
+    return mBlocs[rang / TAILLE_BLOC][rang % TAILLE_BLOC];
+}
+
+/**
+ * @brief Minuterie du rang, dans son bloc
+ */
+inline const Minuterie& AnnexesAnimaux::GetMinuterie(uint32_t rang) const
+{
+    return mBlocs[rang / TAILLE_BLOC][rang % TAILLE_BLOC];
+}
+
+/**
+ * @brief Délai de suivi du rang
+ */
+inline float& AnnexesAnimaux::DelaiSuivi(uint32_t rang)
+{
+    return mDelaisSuivi[rang];
+}
+
+#endif /* ANNEXES_ANIMAUX_H */
@@ -0,0 +1,166 @@
+/**
+ * @file BudgetPopulation.cpp
+ * @brief Implémentation de l'admission des naissances
+ */
+
+#include "BudgetPopulation.h"
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * @brief Constructeur : budget vide jusqu'à la première mesure
+ */
+BudgetPopulation::BudgetPopulation(size_t maxAnimaux, size_t maxOctets, PolitiqueBudget politique)
+    : mMaxAnimaux(maxAnimaux)
+    , mMaxOctets(maxOctets)
+    , mPolitique(politique)
+    , mAnimaux(0)
+    , mOctets(0)
+    , mFreinage(false)
+    , mEpisodes(0)
+    , mRefusees(0)
+    , mRefuseesTick(0)
+{
+}
+
+/**
+ * @brief Plafonds et politique gardés, compteurs remis à zéro
+ */
+void BudgetPopulation::Reinitialiser()
+{
+    mAnimaux = 0;
+    mOctets = 0;
+    mFreinage = false;
+    mEpisodes = 0;
+    mRefusees = 0;
+    mRefuseesTick = 0;
+}
+
+/**
+ * @brief Plus forte des parts animaux et octets
+ */
+float BudgetPopulation::Part(size_t animaux, size_t octets) const
+{
+    float part = 0.0f;
+    if (mMaxAnimaux > 0)
+        part = std::max(part, static_cast<float>(animaux) / mMaxAnimaux);
+    if (mMaxOctets > 0)
+        part = std::max(part, static_cast<float>(static_cast<double>(octets) / mMaxOctets));
+    return part;
+}
+
+/**
+ * @brief Nouvelle occupation, détection d'un début de freinage
+ */
+void BudgetPopulation::Mesurer(size_t animaux, size_t octets)
+{
+    mAnimaux = animaux;
+    mOctets = octets;
+    mRefuseesTick = 0;
+
+    bool freinage = GetUtilisation() >= SEUIL_FREINAGE;
+    if (freinage && !mFreinage)
+        mEpisodes++;
+    mFreinage = freinage;
+}
+
+/**
+ * @brief Plafond infranchissable, puis chance de naître selon la politique
+ */
+bool BudgetPopulation::AutoriserNaissance(size_t octets)
+{
+    bool accepte;
+    if (Part(mAnimaux + 1, mOctets + octets) > 1.0f)
+        accepte = false;
+    else
+    {
+        float utilisation = GetUtilisation();
+        float chance = 1.0f;
+        if (mPolitique == BUDGET_PROBABILITE && utilisation > SEUIL_FREINAGE)
+            chance = (1.0f - utilisation) / (1.0f - SEUIL_FREINAGE);
+        else if (mPolitique == BUDGET_CAPACITE)
+            chance = 1.0f - utilisation;
+
+        /* Pas de tirage hors freinage : la suite aléatoire reste celle d'une simulation sans budget */
+        if (chance >= 1.0f)
+            accepte = true;
+        else if (chance <= 0.0f)
+            accepte = false;
+        else
+            accepte = (rand() % 1000) < static_cast<int>(chance * 1000.0f);
+    }
+
+    if (accepte)
+    {
+        mAnimaux++;
+        mOctets += octets;
+    }
+    else
+    {
+        mRefusees++;
+        mRefuseesTick++;
+    }
+    return accepte;
+}
+
+/**
+ * @brief Occupation courante rapportée aux plafonds
+ */
+float BudgetPopulation::GetUtilisation() const
+{
+    return Part(mAnimaux, mOctets);
+}
+
+/**
+ * @brief État du freinage à la dernière mesure
+ */
+bool BudgetPopulation::EstEnFreinage() const
+{
+    return mFreinage;
+}
+
+/**
+ * @brief Accès au nombre d'épisodes de freinage
+ */
+int BudgetPopulation::GetEpisodes() const
+{
+    return mEpisodes;
+}
+
+/**
+ * @brief Accès au total des naissances refusées
+ */
+uint64_t BudgetPopulation::GetNaissancesRefusees() const
+{
+    return mRefusees;
+}
+
+/**
+ * @brief Accès aux naissances refusées du dernier tick
+ */
+uint64_t BudgetPopulation::GetRefuseesTick() const
+{
+    return mRefuseesTick;
+}
+
+/**
+ * @brief Accès à la politique
+ */
+PolitiqueBudget BudgetPopulation::GetPolitique() const
+{
+    return mPolitique;
+}
+
+/**
+ * @brief Noms repris par l'option --politique-budget
+ */
+const char* BudgetPopulation::GetNom(PolitiqueBudget politique)
+{
+    switch (politique)
+    {
+        case BUDGET_PROBABILITE: return "probabilite";
+        case BUDGET_CAPACITE: return "capacite";
+        case BUDGET_REFUS: return "refus";
+    }
+    return "?";
+}
@@ -0,0 +1,136 @@
+/**
+ * @file BudgetPopulation.h
+ * @brief Plafond d'animaux et de mémoire, naissances freinées à son approche
+ */
+
+#ifndef BUDGET_POPULATION_H
+#define BUDGET_POPULATION_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum PolitiqueBudget
+ * @brief Manière de freiner les naissances quand le budget se remplit
+ */
+enum PolitiqueBudget
+{
+    BUDGET_PROBABILITE = 0,     /**< Chance de naître réduite entre SEUIL_FREINAGE et le plafond */
+    BUDGET_CAPACITE,            /**< Capacité de charge : chance de naître proportionnelle à la place restante */
+    BUDGET_REFUS                /**< Naissances libres jusqu'au plafond, refusées au-delà */
+};
+
+/**
+ * @class BudgetPopulation
+ * @brief Admission des naissances sous un plafond d'animaux et d'octets
+ *
+ * L'utilisation est la plus forte des deux parts du budget : animaux sur
+ * plafond d'animaux, octets des entités sur plafond d'octets. Elle est
+ * mesurée au début de chaque tick, puis chaque naissance acceptée s'y ajoute :
+ * aucune politique ne laisse dépasser le plafond, quel que soit le nombre de
+ * naissances du tick. Une naissance refusée n'alloue rien.
+ *
+ * Le freinage commence à SEUIL_FREINAGE (sauf pour la capacité de charge, qui
+ * freine dès le premier animal) ; ses débuts et les naissances refusées sont
+ * comptés pour l'interface et les rapports.
+ */
+class BudgetPopulation
+{
+private:
+    size_t mMaxAnimaux;         /**< Plafond d'animaux (0 : aucun) */
+    size_t mMaxOctets;          /**< Plafond d'octets des entités (0 : aucun) */
+    PolitiqueBudget mPolitique; /**< Freinage appliqué */
+
+    size_t mAnimaux;            /**< Animaux à la mesure, plus les naissances acceptées depuis */
+    size_t mOctets;             /**< Octets des entités à la mesure, plus ceux des naissances acceptées */
+    bool mFreinage;             /**< Utilisation au-dessus de SEUIL_FREINAGE à la dernière mesure */
+    int mEpisodes;              /**< Passages au freinage depuis la création */
+    uint64_t mRefusees;         /**< Naissances refusées depuis la création */
+    uint64_t mRefuseesTick;     /**< Naissances refusées depuis la dernière mesure */
+
+    /**
+     * @brief Part du budget que représente une occupation
+     * @param animaux Animaux
+     * @param octets Octets des entités
+     * @return Plus forte des deux parts (0 si aucun plafond)
+     */
+    float Part(size_t animaux, size_t octets) const;
+
+public:
+    static constexpr float SEUIL_FREINAGE = 0.8f;   /**< Part du budget à partir de laquelle les naissances sont freinées */
+
+    /**
+     * @brief Constructeur
+     * @param maxAnimaux Plafond d'animaux, toutes espèces (0 : aucun)
+     * @param maxOctets Plafond d'octets occupés par les entités (0 : aucun)
+     * @param politique Freinage des naissances
+     */
+    BudgetPopulation(size_t maxAnimaux, size_t maxOctets, PolitiqueBudget politique);
+
+    /**
+     * @brief Remet à zéro occupation, épisodes et naissances refusées (écosystème relancé)
+     */
+    void Reinitialiser();
+
+    /**
+     * @brief Relève l'occupation au début d'un tick
+     * @param animaux Animaux vivants, toutes espèces
+     * @param octets Octets occupés par les entités
+     */
+    void Mesurer(size_t animaux, size_t octets);
+
+    /**
+     * @brief Décide d'une naissance selon la politique
+     * @param octets Octets qu'occuperait le nouveau-né
+     * @return true si la naissance peut avoir lieu (elle est alors comptée)
+     *
+     * Tire rand() seulement quand la chance de naître est strictement entre 0 et 1.
+     */
+    bool AutoriserNaissance(size_t octets);
+
+    /**
+     * @brief Part du budget occupée
+     * @return 0 (vide) à 1 (plafond atteint), naissances du tick comprises ;
+     *         au-delà de 1 tant qu'une population initiale trop grande n'a pas décru
+     */
+    float GetUtilisation() const;
+
+    /**
+     * @brief Indique si les naissances sont freinées
+     * @return true si l'utilisation dépassait SEUIL_FREINAGE à la dernière mesure
+     */
+    bool EstEnFreinage() const;
+
+    /**
+     * @brief Nombre de passages au freinage
+     * @return Épisodes de freinage depuis la création
+     */
+    int GetEpisodes() const;
+
+    /**
+     * @brief Naissances refusées depuis la création
+     * @return Naissances refusées
+     */
+    uint64_t GetNaissancesRefusees() const;
+
+    /**
+     * @brief Naissances refusées depuis la dernière mesure
+     * @return Naissances refusées au dernier tick
+     */
+    uint64_t GetRefuseesTick() const;
+
+    /**
+     * @brief Freinage appliqué
+     * @return Politique choisie à la construction
+     */
+    PolitiqueBudget GetPolitique() const;
+
+    /**
+     * @brief Nom affichable d'une politique
+     * @param politique Politique
+     * @return Nom court
+     */
+    static const char* GetNom(PolitiqueBudget politique);
+};
+
+#endif /* BUDGET_POPULATION_H */
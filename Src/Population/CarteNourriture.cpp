@@ -0,0 +1,167 @@
+/**
+ * @file CarteNourriture.cpp
+ * @brief Implémentation de la carte de la nourriture la plus proche
+ */
+
+#include "CarteNourriture.h"
+#include "Plante.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructeur : aucune cellule stockée tant qu'aucune plante n'est ajoutée
+ */
+CarteNourriture::CarteNourriture(float largeur, float hauteur, float portee)
+    : mNbColonnes(std::max(1, static_cast<int>(std::ceil(largeur / TAILLE_CELLULE)))),
+      mNbLignes(std::max(1, static_cast<int>(std::ceil(hauteur / TAILLE_CELLULE)))),
+      mAtteinte(portee + 0.5f * TAILLE_CELLULE * std::sqrt(2.0f))
+{
+}
+
+/**
+ * @brief Cellule contenant un point, bornée au monde
+ */
+uint32_t CarteNourriture::CelluleDe(float x, float y) const
+{
+    int colonne = std::min(std::max(static_cast<int>(x / TAILLE_CELLULE), 0), mNbColonnes - 1);
+    int ligne = std::min(std::max(static_cast<int>(y / TAILLE_CELLULE), 0), mNbLignes - 1);
+    return static_cast<uint32_t>(ligne) * mNbColonnes + colonne;
+}
+
+/**
+ * @brief Parcours des plantes rangées dans les cellules à atteinte du centre
+ */
+void CarteNourriture::Recalculer(int colonne, int ligne)
+{
+    const int etendue = static_cast<int>(std::ceil(mAtteinte / TAILLE_CELLULE));
+    const float cx = (colonne + 0.5f) * TAILLE_CELLULE;
+    const float cy = (ligne + 0.5f) * TAILLE_CELLULE;
+
+    Plante* meilleure = nullptr;
+    float meilleureCarre = mAtteinte * mAtteinte;
+    for (int l = std::max(0, ligne - etendue); l <= std::min(mNbLignes - 1, ligne + etendue); ++l)
+    {
+        for (int c = std::max(0, colonne - etendue); c <= std::min(mNbColonnes - 1, colonne + etendue); ++c)
+        {
+            auto occupants = mOccupants.find(static_cast<uint32_t>(l) * mNbColonnes + c);
+            if (occupants == mOccupants.end())
+                continue;
+            for (Plante* plante : occupants->second)
+            {
+                /* Consommée dans le même tick, pas encore retirée */
+                if (!plante->EstDisponible())
+                    continue;
+                float dx = plante->GetX() - cx;
+                float dy = plante->GetY() - cy;
+                float distanceCarre = dx * dx + dy * dy;
+                if (distanceCarre < meilleureCarre)
+                {
+                    meilleureCarre = distanceCarre;
+                    meilleure = plante;
+                }
+            }
+        }
+    }
+
+    uint32_t cellule = static_cast<uint32_t>(ligne) * mNbColonnes + colonne;
+    if (meilleure)
+        mPlusProches[cellule] = {meilleure, meilleureCarre};
+    else
+        mPlusProches.erase(cellule);
+}
+
+/**
+ * @brief Rangement, puis la plante remplace la cible des cellules dont elle est plus proche
+ */
+void CarteNourriture::AjouterPlante(Plante* plante)
+{
+    if (!plante->EstDisponible())
+        return;
+
+    const float x = plante->GetX();
+    const float y = plante->GetY();
+    mOccupants[CelluleDe(x, y)].push_back(plante);
+
+    const int etendue = static_cast<int>(std::ceil(mAtteinte / TAILLE_CELLULE));
+    const int colonne = std::min(std::max(static_cast<int>(x / TAILLE_CELLULE), 0), mNbColonnes - 1);
+    const int ligne = std::min(std::max(static_cast<int>(y / TAILLE_CELLULE), 0), mNbLignes - 1);
+    for (int l = std::max(0, ligne - etendue); l <= std::min(mNbLignes - 1, ligne + etendue); ++l)
+    {
+        for (int c = std::max(0, colonne - etendue); c <= std::min(mNbColonnes - 1, colonne + etendue); ++c)
+        {
+            float dx = x - (c + 0.5f) * TAILLE_CELLULE;
+            float dy = y - (l + 0.5f) * TAILLE_CELLULE;
+            float distanceCarre = dx * dx + dy * dy;
+            if (distanceCarre >= mAtteinte * mAtteinte)
+                continue;
+
+            uint32_t cellule = static_cast<uint32_t>(l) * mNbColonnes + c;
+            auto actuelle = mPlusProches.find(cellule);
+            if (actuelle == mPlusProches.end())
+                mPlusProches.emplace(cellule, PlusProche{plante, distanceCarre});
+            else if (distanceCarre < actuelle->second.distanceCarre)
+                actuelle->second = {plante, distanceCarre};
+        }
+    }
+}
+
+/**
+ * @brief Désindexation, puis recalcul des seules cellules qui la désignaient
+ */
+void CarteNourriture::RetirerPlante(Plante* plante)
+{
+    const float x = plante->GetX();
+    const float y = plante->GetY();
+
+    auto occupants = mOccupants.find(CelluleDe(x, y));
+    if (occupants == mOccupants.end())
+        return;
+    std::vector<Plante*>& liste = occupants->second;
+    auto position = std::find(liste.begin(), liste.end(), plante);
+    if (position == liste.end())
+        return;
+    liste.erase(position);
+    if (liste.empty())
+        mOccupants.erase(occupants);
+
+    const int etendue = static_cast<int>(std::ceil(mAtteinte / TAILLE_CELLULE));
+    const int colonne = std::min(std::max(static_cast<int>(x / TAILLE_CELLULE), 0), mNbColonnes - 1);
+    const int ligne = std::min(std::max(static_cast<int>(y / TAILLE_CELLULE), 0), mNbLignes - 1);
+    for (int l = std::max(0, ligne - etendue); l <= std::min(mNbLignes - 1, ligne + etendue); ++l)
+    {
+        for (int c = std::max(0, colonne - etendue); c <= std::min(mNbColonnes - 1, colonne + etendue); ++c)
+        {
+            auto cible = mPlusProches.find(static_cast<uint32_t>(l) * mNbColonnes + c);
+            if (cible != mPlusProches.end() && cible->second.plante == plante)
+                Recalculer(c, l);
+        }
+    }
+}
+
+/**
+ * @brief clear garde le nombre d'alvéoles : le repeuplement ne refait pas grandir les tables
+ */
+void CarteNourriture::Vider()
+{
+    mPlusProches.clear();
+    mOccupants.clear();
+}
+
+/**
+ * @brief Une recherche dans la table, sans parcourir de plante
+ */
+Plante* CarteNourriture::Lire(float x, float y) const
+{
+    auto cible = mPlusProches.find(CelluleDe(x, y));
+    if (cible == mPlusProches.end() || !cible->second.plante->EstDisponible())
+        return nullptr;
+    return cible->second.plante;
+}
+
+/**
+ * @brief Cellules ayant une plante à portée
+ */
+size_t CarteNourriture::GetNombreCellules() const
+{
+    return mPlusProches.size();
+}
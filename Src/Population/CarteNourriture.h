@@ -0,0 +1,115 @@
+/**
+ * @file CarteNourriture.h
+ * @brief Plante disponible la plus proche de chaque cellule, tenue à jour plante par plante
+ */
+
+#ifndef CARTE_NOURRITURE_H
+#define CARTE_NOURRITURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Plante;
+
+/**
+ * @class CarteNourriture
+ * @brief Champ de direction vers la nourriture, partagé par tous les herbivores
+ *
+ * Le monde est couvert de cellules de TAILLE_CELLULE pixels. Chaque cellule
+ * retient la plante disponible la plus proche de son centre parmi celles
+ * qu'un animal de la cellule pourrait percevoir (portée plus demi-diagonale).
+ * Un herbivore lit sa cellule au lieu de parcourir les plantes : la cible
+ * obtenue est la plus proche à une demi-diagonale de cellule près.
+ *
+ * Une plante qui apparaît ne touche que les cellules à sa portée ; une plante
+ * consommée ne fait recalculer que les cellules qui la désignaient, à partir
+ * des plantes rangées par cellule autour d'elles. Seules les cellules ayant
+ * de la nourriture à portée sont stockées : le coût mémoire suit les plantes,
+ * pas la taille du monde.
+ */
+class CarteNourriture
+{
+private:
+    /**
+     * @struct PlusProche
+     * @brief Plante retenue par une cellule et sa distance au centre
+     */
+    struct PlusProche
+    {
+        Plante* plante;         /**< Plante disponible la plus proche du centre */
+        float distanceCarre;    /**< Distance au carré entre la plante et le centre */
+    };
+
+    int mNbColonnes;            /**< Colonnes de cellules */
+    int mNbLignes;              /**< Lignes de cellules */
+    float mAtteinte;            /**< Portée plus demi-diagonale : au-delà, la cellule ne voit pas la plante */
+
+    std::unordered_map<uint32_t, PlusProche> mPlusProches;          /**< Cellules ayant une plante à portée */
+    std::unordered_map<uint32_t, std::vector<Plante*>> mOccupants;  /**< Plantes disponibles de chaque cellule */
+
+    /**
+     * @brief Trouve la cellule contenant un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Indice de la cellule
+     */
+    uint32_t CelluleDe(float x, float y) const;
+
+    /**
+     * @brief Cherche la plus proche plante disponible du centre d'une cellule
+     * @param colonne Colonne de la cellule
+     * @param ligne Ligne de la cellule
+     */
+    void Recalculer(int colonne, int ligne);
+
+public:
+    static constexpr float TAILLE_CELLULE = 32.0f;  /**< Côté d'une cellule (pixels monde) */
+
+    /**
+     * @brief Constructeur d'une carte vide
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param portee Rayon de perception des herbivores qui la lisent
+     */
+    CarteNourriture(float largeur, float hauteur, float portee);
+
+    /**
+     * @brief Signale une plante devenue disponible
+     * @param plante Nouvelle plante
+     */
+    void AjouterPlante(Plante* plante);
+
+    /**
+     * @brief Signale une plante consommée ou libérée
+     * @param plante Plante qui n'est plus disponible
+     */
+    void RetirerPlante(Plante* plante);
+
+    /**
+     * @brief Oublie toutes les plantes (écosystème relancé), tables de hachage gardées
+     *
+     * Les plantes rangées ne sont pas lues : elles peuvent déjà être libérées.
+     */
+    void Vider();
+
+    /**
+     * @brief Plante vers laquelle se diriger depuis un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Plante disponible la plus proche du centre de la cellule, nullptr si aucune à portée
+     *
+     * Une plante mangée plus tôt dans le tick n'est retirée qu'après les
+     * comportements : elle est ignorée et la cellule reste sans cible jusque-là.
+     */
+    Plante* Lire(float x, float y) const;
+
+    /**
+     * @brief Nombre de cellules ayant une plante à portée
+     * @return Cellules stockées
+     */
+    size_t GetNombreCellules() const;
+};
+
+#endif /* CARTE_NOURRITURE_H */
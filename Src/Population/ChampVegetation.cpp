@@ -0,0 +1,303 @@
+/**
+ * @file ChampVegetation.cpp
+ * @brief Noyau de repousse et diffusion du champ de biomasse
+ */
+
+#include "ChampVegetation.h"
+#include "../Core/PoolThreads.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * @struct CoefficientsPas
+ * @brief Constantes d'un pas, communes à toutes les cellules
+ */
+struct CoefficientsPas
+{
+    float diffusion;        /**< Part échangée avec chaque voisine */
+    float croissance;       /**< Croissance logistique sur le pas */
+    float germination;      /**< Germination sur le pas */
+    float inverseCapacite;  /**< 1 / capacité d'une cellule */
+};
+
+/**
+ * @brief Pas d'une ligne : b + d (somme des voisines - 4 b) + (c b + g)(1 - b / K), borné à 0
+ * @param haut Ligne du dessus (même colonne que centre[0])
+ * @param centre Ligne calculée ; centre[-1] et centre[nombre] sont lus
+ * @param bas Ligne du dessous
+ * @param sortie Ligne du pas suivant
+ * @param nombre Cellules de la ligne
+ * @param k Coefficients du pas
+ * @return Biomasse de la ligne après le pas
+ */
+static double PasLigne(const float* haut, const float* centre, const float* bas, float* sortie,
+                       int nombre, const CoefficientsPas& k)
+{
+    int x = 0;
+    double somme = 0.0;
+
+#ifdef __SSE2__
+    /* Quatre cellules à la fois : lectures décalées d'une cellule pour les voisines */
+    const __m128 quatre = _mm_set1_ps(4.0f);
+    const __m128 un = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 diffusion = _mm_set1_ps(k.diffusion);
+    const __m128 croissance = _mm_set1_ps(k.croissance);
+    const __m128 germination = _mm_set1_ps(k.germination);
+    const __m128 inverseCapacite = _mm_set1_ps(k.inverseCapacite);
+    __m128 sommes = _mm_setzero_ps();
+
+    for (; x + 4 <= nombre; x += 4)
+    {
+        __m128 b = _mm_loadu_ps(centre + x);
+        __m128 voisines = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(haut + x), _mm_loadu_ps(bas + x)),
+                                     _mm_add_ps(_mm_loadu_ps(centre + x - 1), _mm_loadu_ps(centre + x + 1)));
+        __m128 laplacien = _mm_sub_ps(voisines, _mm_mul_ps(quatre, b));
+        __m128 logistique = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(croissance, b), germination),
+                                       _mm_sub_ps(un, _mm_mul_ps(b, inverseCapacite)));
+        __m128 nouvelle = _mm_add_ps(b, _mm_add_ps(_mm_mul_ps(diffusion, laplacien), logistique));
+        nouvelle = _mm_max_ps(nouvelle, zero);
+        _mm_storeu_ps(sortie + x, nouvelle);
+        sommes = _mm_add_ps(sommes, nouvelle);
+    }
+
+    float partielles[4];
+    _mm_storeu_ps(partielles, sommes);
+    somme = static_cast<double>(partielles[0]) + partielles[1] + partielles[2] + partielles[3];
+#endif
+
+    /* Fin de ligne (ou ligne entière sans SSE2) */
+    for (; x < nombre; x++)
+    {
+        float b = centre[x];
+        float laplacien = haut[x] + bas[x] + centre[x - 1] + centre[x + 1] - 4.0f * b;
+        float logistique = (k.croissance * b + k.germination) * (1.0f - b * k.inverseCapacite);
+        float nouvelle = std::max(0.0f, b + k.diffusion * laplacien + logistique);
+        sortie[x] = nouvelle;
+        somme += nouvelle;
+    }
+    return somme;
+}
+
+/**
+ * @brief Cellules de TAILLE_CELLULE_MIN, agrandies si le monde en demanderait plus de MAX_CELLULES
+ */
+ChampVegetation::ChampVegetation(float largeur, float hauteur)
+    : mCapacite(1.0f)
+    , mCroissance(0.0f)
+    , mGermination(0.0f)
+    , mTempsAccumule(0.0f)
+    , mBiomasseTotale(0.0)
+    , mConsommee(0.0)
+{
+    mTailleCellule = std::max(TAILLE_CELLULE_MIN, std::sqrt(largeur * hauteur / MAX_CELLULES));
+    mInverseTaille = 1.0f / mTailleCellule;
+    mColonnes = std::max(1, static_cast<int>(std::ceil(largeur * mInverseTaille)));
+    mLignes = std::max(1, static_cast<int>(std::ceil(hauteur * mInverseTaille)));
+    mPas = mColonnes + 2;
+
+    mBiomasse.assign(static_cast<size_t>(mPas) * (mLignes + 2), 0.0f);
+    mSuivante.assign(mBiomasse.size(), 0.0f);
+    mSommesBlocs.assign((mLignes + LIGNES_PAR_BLOC - 1) / LIGNES_PAR_BLOC, 0.0);
+}
+
+/**
+ * @brief Capacité répartie sur les cellules ; taux tel que r K / 4 = productionMax
+ */
+void ChampVegetation::Calibrer(float capaciteTotale, float productionMax)
+{
+    float nbCellules = static_cast<float>(mColonnes) * mLignes;
+    mCapacite = std::max(1e-6f, capaciteTotale / nbCellules);
+    mCroissance = 4.0f * productionMax / std::max(1e-6f, capaciteTotale);
+    mGermination = PART_GERMINATION * productionMax / nbCellules;
+}
+
+/**
+ * @brief Copie de lecture : tout sauf le tampon du pas suivant
+ */
+void ChampVegetation::Recopier(const ChampVegetation& source)
+{
+    mColonnes = source.mColonnes;
+    mLignes = source.mLignes;
+    mPas = source.mPas;
+    mTailleCellule = source.mTailleCellule;
+    mInverseTaille = source.mInverseTaille;
+    mBiomasse = source.mBiomasse;
+    mSommesBlocs = source.mSommesBlocs;
+    mCapacite = source.mCapacite;
+    mCroissance = source.mCroissance;
+    mGermination = source.mGermination;
+    mTempsAccumule = source.mTempsAccumule;
+    mBiomasseTotale = source.mBiomasseTotale;
+    mConsommee = source.mConsommee;
+}
+
+/**
+ * @brief Tableaux remis à zéro sur place
+ */
+void ChampVegetation::Vider()
+{
+    std::fill(mBiomasse.begin(), mBiomasse.end(), 0.0f);
+    std::fill(mSuivante.begin(), mSuivante.end(), 0.0f);
+    std::fill(mSommesBlocs.begin(), mSommesBlocs.end(), 0.0);
+    mTempsAccumule = 0.0f;
+    mBiomasseTotale = 0.0;
+    mConsommee = 0.0;
+}
+
+/**
+ * @brief Cellule du point, bordée aux limites de la grille
+ */
+int ChampVegetation::Indice(float x, float y) const
+{
+    int colonne = std::min(mColonnes - 1, std::max(0, static_cast<int>(x * mInverseTaille)));
+    int ligne = std::min(mLignes - 1, std::max(0, static_cast<int>(y * mInverseTaille)));
+    return (ligne + 1) * mPas + colonne + 1;
+}
+
+/**
+ * @brief Ajoute la biomasse à sa cellule, sans plafond : la logistique y ramène
+ */
+void ChampVegetation::Deposer(float x, float y, float quantite)
+{
+    mBiomasse[Indice(x, y)] += quantite;
+    mBiomasseTotale += quantite;
+}
+
+/**
+ * @brief Lignes et colonnes de bord recopiées dans la bordure
+ */
+void ChampVegetation::RemplirBordure()
+{
+    float* grille = mBiomasse.data();
+    for (int ligne = 1; ligne <= mLignes; ligne++)
+    {
+        grille[ligne * mPas] = grille[ligne * mPas + 1];
+        grille[ligne * mPas + mColonnes + 1] = grille[ligne * mPas + mColonnes];
+    }
+    std::copy(grille + mPas, grille + 2 * mPas, grille);
+    std::copy(grille + mLignes * mPas, grille + (mLignes + 1) * mPas, grille + (mLignes + 1) * mPas);
+}
+
+/**
+ * @brief Applique le noyau aux lignes [premiere, fin[
+ */
+double ChampVegetation::CalculerLignes(int premiere, int fin, float deltaTime)
+{
+    CoefficientsPas k;
+    k.diffusion = std::min(0.2f, DIFFUSION * deltaTime * mInverseTaille * mInverseTaille);
+    k.croissance = mCroissance * deltaTime;
+    k.germination = mGermination * deltaTime;
+    k.inverseCapacite = 1.0f / mCapacite;
+
+    const float* source = mBiomasse.data();
+    float* destination = mSuivante.data();
+    double somme = 0.0;
+    for (int ligne = premiere; ligne < fin; ligne++)
+    {
+        const float* centre = source + ligne * mPas + 1;
+        somme += PasLigne(centre - mPas, centre, centre + mPas, destination + ligne * mPas + 1, mColonnes, k);
+    }
+    return somme;
+}
+
+/**
+ * @brief Un pas tous les INTERVALLE_MISE_A_JOUR, blocs de lignes répartis sur le système de tâches
+ */
+bool ChampVegetation::Avancer(float deltaTime, PoolThreads* pool)
+{
+    mTempsAccumule += deltaTime;
+    if (mTempsAccumule < INTERVALLE_MISE_A_JOUR)
+        return false;
+
+    float pas = mTempsAccumule;
+    mTempsAccumule = 0.0f;
+    RemplirBordure();
+
+    int nbBlocs = static_cast<int>(mSommesBlocs.size());
+    auto bloc = [this, pas](int i)
+    {
+        int premiere = 1 + i * LIGNES_PAR_BLOC;
+        int fin = std::min(mLignes + 1, premiere + LIGNES_PAR_BLOC);
+        mSommesBlocs[i] = CalculerLignes(premiere, fin, pas);
+    };
+    if (pool)
+        pool->Executer(nbBlocs, bloc);
+    else
+        for (int i = 0; i < nbBlocs; i++)
+            bloc(i);
+
+    mBiomasse.swap(mSuivante);
+    mBiomasseTotale = 0.0;
+    for (double somme : mSommesBlocs)
+        mBiomasseTotale += somme;
+    return true;
+}
+
+/**
+ * @brief Retire au plus le contenu de la cellule
+ */
+float ChampVegetation::Prelever(float x, float y, float quantite)
+{
+    float& cellule = mBiomasse[Indice(x, y)];
+    float prise = std::min(quantite, cellule);
+    cellule -= prise;
+    mBiomasseTotale -= prise;
+    mConsommee += prise;
+    return prise;
+}
+
+/**
+ * @brief Biomasse de la cellule du point
+ */
+float ChampVegetation::Lire(float x, float y) const
+{
+    return mBiomasse[Indice(x, y)];
+}
+
+/**
+ * @brief Différences centrées ; aux bords, la bordure recopiée au pas précédent fait office de voisine
+ */
+void ChampVegetation::Gradient(float x, float y, float& gx, float& gy) const
+{
+    int i = Indice(x, y);
+    float facteur = 0.5f * mInverseTaille;
+    gx = (mBiomasse[i + 1] - mBiomasse[i - 1]) * facteur;
+    gy = (mBiomasse[i + mPas] - mBiomasse[i - mPas]) * facteur;
+}
+
+/**
+ * @brief Capacité d'accueil d'une cellule
+ */
+float ChampVegetation::GetCapacite() const
+{
+    return mCapacite;
+}
+
+/**
+ * @brief Biomasse totale du champ
+ */
+double ChampVegetation::GetBiomasseTotale() const
+{
+    return mBiomasseTotale;
+}
+
+/**
+ * @brief Biomasse broutée depuis la création
+ */
+double ChampVegetation::GetConsommee() const
+{
+    return mConsommee;
+}
+
+/**
+ * @brief Côté d'une cellule
+ */
+float ChampVegetation::GetTailleCellule() const
+{
+    return mTailleCellule;
+}
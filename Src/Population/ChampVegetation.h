@@ -0,0 +1,176 @@
+/**
+ * @file ChampVegetation.h
+ * @brief Végétation continue : biomasse par cellule, repousse logistique et diffusion
+ */
+
+#ifndef CHAMP_VEGETATION_H
+#define CHAMP_VEGETATION_H
+
+#include <vector>
+
+class PoolThreads;
+
+/**
+ * @class ChampVegetation
+ * @brief Grille de biomasse remplaçant les plantes individuelles
+ *
+ * La biomasse se compte en équivalents plantes. Chaque cellule repousse
+ * selon une loi logistique (plus une petite germination, pour qu'une zone
+ * rasée reverdisse) et échange avec ses quatre voisines par diffusion.
+ * Le pas est calculé par un noyau de stencil vectorisé, par blocs de lignes
+ * sur le système de tâches, toutes les INTERVALLE_MISE_A_JOUR secondes.
+ * Son coût dépend du nombre de cellules, pas de la quantité de végétation.
+ *
+ * La grille est entourée d'une bordure de cellules fantômes, recopiées des
+ * bords avant chaque pas : rien ne sort du monde, et le noyau ne fait aucun test.
+ */
+class ChampVegetation
+{
+private:
+    int mColonnes;                  /**< Cellules en X */
+    int mLignes;                    /**< Cellules en Y */
+    int mPas;                       /**< Largeur d'une ligne bordure comprise (mColonnes + 2) */
+    float mTailleCellule;           /**< Côté d'une cellule (pixels monde) */
+    float mInverseTaille;           /**< 1 / mTailleCellule */
+    std::vector<float> mBiomasse;   /**< Biomasse par cellule, bordure comprise */
+    std::vector<float> mSuivante;   /**< Tampon du pas suivant */
+    std::vector<double> mSommesBlocs;   /**< Biomasse de chaque bloc de lignes au dernier pas */
+    float mCapacite;                /**< Capacité d'accueil d'une cellule */
+    float mCroissance;              /**< Taux de croissance logistique (par seconde) */
+    float mGermination;             /**< Biomasse apparue par cellule vide et par seconde */
+    float mTempsAccumule;           /**< Temps écoulé depuis le dernier pas */
+    double mBiomasseTotale;         /**< Biomasse du champ au dernier pas, moins ce qui a été brouté depuis */
+    double mConsommee;              /**< Biomasse broutée depuis la création */
+
+    static constexpr float TAILLE_CELLULE_MIN = 32.0f;         /**< Côté minimal d'une cellule */
+    static constexpr int MAX_CELLULES = 1 << 21;               /**< Cellules au plus (agrandies au-delà) */
+    static constexpr int LIGNES_PAR_BLOC = 64;                 /**< Lignes calculées par tâche du pool */
+    static constexpr float DIFFUSION = 400.0f;                 /**< Coefficient de diffusion (pixels²/s) */
+    static constexpr float PART_GERMINATION = 0.1f;            /**< Part de la production maximale venant de la germination */
+
+    /**
+     * @brief Recopie les cellules des bords dans la bordure (flux nul)
+     */
+    void RemplirBordure();
+
+    /**
+     * @brief Calcule un bloc de lignes du pas suivant
+     * @param premiere Première ligne (1 à mLignes)
+     * @param fin Ligne après la dernière
+     * @param deltaTime Durée du pas (secondes)
+     * @return Biomasse des lignes calculées
+     */
+    double CalculerLignes(int premiere, int fin, float deltaTime);
+
+    /**
+     * @brief Indice de la cellule contenant un point (bordure comprise)
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Indice dans mBiomasse
+     */
+    int Indice(float x, float y) const;
+
+public:
+    static constexpr float INTERVALLE_MISE_A_JOUR = 4.0f / 60.0f;  /**< Temps entre deux pas (4 ticks) */
+
+    /**
+     * @brief Crée un champ vide couvrant le monde
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     */
+    ChampVegetation(float largeur, float hauteur);
+
+    /**
+     * @brief Fixe capacité et repousse pour retrouver l'équilibre des plantes individuelles
+     * @param capaciteTotale Biomasse maximale du monde (plafond de plantes)
+     * @param productionMax Repousse maximale du monde (plantes par seconde)
+     *
+     * La croissance logistique atteint productionMax à mi-capacité.
+     */
+    void Calibrer(float capaciteTotale, float productionMax);
+
+    /**
+     * @brief Recopie la biomasse et les réglages d'un champ de même grille
+     * @param source Champ recopié (créé pour le même monde)
+     *
+     * Le tampon du pas suivant n'est pas recopié : la copie sert à la lecture
+     * (instantané de rendu), sans allocation une fois la grille dimensionnée.
+     */
+    void Recopier(const ChampVegetation& source);
+
+    /**
+     * @brief Remet la biomasse à zéro (écosystème relancé), grille et réglages gardés
+     *
+     * Compteurs et pas en cours repartent de zéro, comme un champ neuf ;
+     * Calibrer et Deposer peuvent suivre.
+     */
+    void Vider();
+
+    /**
+     * @brief Dépose de la biomasse au point donné (peuplement initial)
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param quantite Biomasse déposée
+     */
+    void Deposer(float x, float y, float quantite);
+
+    /**
+     * @brief Avance le champ ; un pas est calculé quand assez de temps s'est écoulé
+     * @param deltaTime Temps écoulé (secondes)
+     * @param pool Système de tâches (nullptr : séquentiel)
+     * @return true si un pas a été calculé
+     */
+    bool Avancer(float deltaTime, PoolThreads* pool);
+
+    /**
+     * @brief Retire de la biomasse au point donné
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param quantite Biomasse demandée
+     * @return Biomasse effectivement retirée (au plus ce que contient la cellule)
+     */
+    float Prelever(float x, float y, float quantite);
+
+    /**
+     * @brief Biomasse de la cellule contenant un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Biomasse de la cellule
+     */
+    float Lire(float x, float y) const;
+
+    /**
+     * @brief Gradient de biomasse (différences centrées entre cellules voisines)
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param gx Composante horizontale (biomasse par pixel)
+     * @param gy Composante verticale (biomasse par pixel)
+     */
+    void Gradient(float x, float y, float& gx, float& gy) const;
+
+    /**
+     * @brief Capacité d'accueil d'une cellule
+     * @return Biomasse maximale d'une cellule à l'équilibre
+     */
+    float GetCapacite() const;
+
+    /**
+     * @brief Biomasse totale du champ
+     * @return Biomasse en équivalents plantes
+     */
+    double GetBiomasseTotale() const;
+
+    /**
+     * @brief Biomasse broutée depuis la création
+     * @return Biomasse en équivalents plantes
+     */
+    double GetConsommee() const;
+
+    /**
+     * @brief Côté d'une cellule
+     * @return Taille en pixels monde
+     */
+    float GetTailleCellule() const;
+};
+
+#endif /* CHAMP_VEGETATION_H */
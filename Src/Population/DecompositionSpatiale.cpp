@@ -0,0 +1,411 @@
+/**
+ * @file DecompositionSpatiale.cpp
+ * @brief Implémentation du découpage en tuiles parallèles
+ */
+
+#include "DecompositionSpatiale.h"
+#include "Proie.h"
+#include "Predateur.h"
+#include "Plante.h"
+#include "../Core/ArenaFrame.h"
+#include "../Core/PoolThreads.h"
+#include "../Core/Traceur.h"
+#include <algorithm>
+#include <cmath>
+
+static_assert(DecompositionSpatiale::RAYON_FANTOME >= PolitiqueEspece<Proie>::RAYON_DETECTION_PREDATEUR
+              && DecompositionSpatiale::RAYON_FANTOME >= PolitiqueEspece<Predateur>::RAYON_DETECTION_PROIE,
+              "la bordure fantôme doit couvrir le plus grand rayon de détection");
+
+/**
+ * @brief Constructeur (une seule tuile, pas de threads)
+ */
+DecompositionSpatiale::DecompositionSpatiale()
+    : mLargeur(0.0f)
+    , mHauteur(0.0f)
+    , mNbColonnes(1)
+    , mNbLignes(1)
+    , mPool(nullptr)
+    , mArena(nullptr)
+    , mTicksDepuisEquilibrage(0)
+{
+}
+
+/**
+ * @brief Choisit environ 8 tuiles par thread (2 par thread et par passe)
+ */
+void DecompositionSpatiale::Configurer(float largeur, float hauteur, int nbThreads, PoolThreads* pool,
+                                       ArenaFrame* arena)
+{
+    mLargeur = largeur;
+    mHauteur = hauteur;
+    mPool = pool;
+    mArena = arena;
+
+    int colonnesMax = std::max(1, static_cast<int>(largeur / TAILLE_MIN));
+    int lignesMax = std::max(1, static_cast<int>(hauteur / TAILLE_MIN));
+    int cible = 8 * std::max(1, nbThreads);
+
+    mNbColonnes = static_cast<int>(std::lround(std::sqrt(cible * largeur / hauteur)));
+    mNbColonnes = std::min(std::max(mNbColonnes, 1), colonnesMax);
+    mNbLignes = (cible + mNbColonnes - 1) / mNbColonnes;
+    mNbLignes = std::min(std::max(mNbLignes, 1), lignesMax);
+
+    mBordsX.assign(mNbColonnes + 1, 0.0f);
+    mBordsY.assign(mNbLignes + 1, 0.0f);
+    PlacerBords(mBordsX, nullptr, 0, largeur);
+    PlacerBords(mBordsY, nullptr, 0, hauteur);
+
+    mTuiles.assign(static_cast<size_t>(mNbColonnes) * mNbLignes, Tuile());
+    mTicksDepuisEquilibrage = 0;
+}
+
+/**
+ * @brief Bords réguliers, listes des tuiles laissées à Repartir
+ */
+void DecompositionSpatiale::Reinitialiser()
+{
+    PlacerBords(mBordsX, nullptr, 0, mLargeur);
+    PlacerBords(mBordsY, nullptr, 0, mHauteur);
+    mTicksDepuisEquilibrage = 0;
+}
+
+/**
+ * @brief Place les bords aux quantiles des positions puis impose TAILLE_MIN
+ */
+void DecompositionSpatiale::PlacerBords(std::vector<float>& bords, float* positions, size_t nombre,
+                                        float etendue)
+{
+    int n = static_cast<int>(bords.size()) - 1;
+
+    for (int i = 1; i < n; i++)
+    {
+        if (nombre == 0)
+        {
+            bords[i] = etendue * i / n;
+        }
+        else
+        {
+            /* Chaque tranche reçoit la même part de la population */
+            size_t rang = nombre * i / n;
+            std::nth_element(positions, positions + rang, positions + nombre);
+            bords[i] = positions[rang];
+        }
+    }
+    bords[0] = 0.0f;
+    bords[n] = etendue;
+
+    /* Largeur minimale : aller puis retour */
+    for (int i = 1; i < n; i++)
+        bords[i] = std::max(bords[i], bords[i - 1] + TAILLE_MIN);
+    for (int i = n - 1; i > 0; i--)
+        bords[i] = std::min(bords[i], bords[i + 1] - TAILLE_MIN);
+}
+
+/**
+ * @brief Trouve la tuile contenant un point (recherche dichotomique sur les bords)
+ */
+int DecompositionSpatiale::TuileDe(float x, float y) const
+{
+    int colonne = static_cast<int>(std::upper_bound(mBordsX.begin() + 1, mBordsX.end() - 1, x)
+                                   - (mBordsX.begin() + 1));
+    int ligne = static_cast<int>(std::upper_bound(mBordsY.begin() + 1, mBordsY.end() - 1, y)
+                                 - (mBordsY.begin() + 1));
+
+    return ligne * mNbColonnes + colonne;
+}
+
+/**
+ * @brief Flux numérotés par tuile, d'une même graine
+ */
+void DecompositionSpatiale::Semer(uint64_t graine)
+{
+    for (size_t i = 0; i < mTuiles.size(); i++)
+        mTuiles[i].alea = GenerateurAleatoire(graine, i + 1);
+}
+
+/**
+ * @brief Range toutes les entités dans leur tuile
+ */
+void DecompositionSpatiale::Repartir(const std::vector<Proie*>& proies,
+                                     const std::vector<Predateur*>& predateurs,
+                                     const std::vector<Plante*>& plantes)
+{
+    for (int ligne = 0; ligne < mNbLignes; ligne++)
+    {
+        for (int colonne = 0; colonne < mNbColonnes; colonne++)
+        {
+            Tuile& tuile = mTuiles[ligne * mNbColonnes + colonne];
+            tuile.x0 = mBordsX[colonne];
+            tuile.x1 = mBordsX[colonne + 1];
+            tuile.y0 = mBordsY[ligne];
+            tuile.y1 = mBordsY[ligne + 1];
+            tuile.proies.clear();
+            tuile.predateurs.clear();
+            tuile.plantes.clear();
+        }
+    }
+
+    for (auto* proie : proies)
+        AjouterProie(proie);
+
+    for (auto* pred : predateurs)
+        AjouterPredateur(pred);
+
+    for (auto* plante : plantes)
+        AjouterPlante(plante);
+}
+
+/**
+ * @brief Ajoute une proie à la tuile qui la contient
+ */
+void DecompositionSpatiale::AjouterProie(Proie* proie)
+{
+    mTuiles[TuileDe(proie->GetX(), proie->GetY())].proies.push_back(proie);
+}
+
+/**
+ * @brief Ajoute un prédateur à la tuile qui le contient
+ */
+void DecompositionSpatiale::AjouterPredateur(Predateur* predateur)
+{
+    mTuiles[TuileDe(predateur->GetX(), predateur->GetY())].predateurs.push_back(predateur);
+}
+
+/**
+ * @brief Ajoute une plante à la tuile qui la contient
+ */
+void DecompositionSpatiale::AjouterPlante(Plante* plante)
+{
+    mTuiles[TuileDe(plante->GetX(), plante->GetY())].plantes.push_back(plante);
+}
+
+/**
+ * @brief Copie les entités propres puis la bordure fantôme des 8 voisines
+ */
+void DecompositionSpatiale::ConstruireVisibles(int indice)
+{
+    Tuile& tuile = mTuiles[indice];
+    int colonne = indice % mNbColonnes;
+    int ligne = indice / mNbColonnes;
+
+    float bordX0 = tuile.x0 - RAYON_FANTOME;
+    float bordY0 = tuile.y0 - RAYON_FANTOME;
+    float bordX1 = tuile.x1 + RAYON_FANTOME;
+    float bordY1 = tuile.y1 + RAYON_FANTOME;
+
+    tuile.proiesVisibles.assign(tuile.proies.begin(), tuile.proies.end());
+    tuile.predateursVisibles.assign(tuile.predateurs.begin(), tuile.predateurs.end());
+    tuile.plantesVisibles.assign(tuile.plantes.begin(), tuile.plantes.end());
+
+    for (int dl = -1; dl <= 1; dl++)
+    {
+        for (int dc = -1; dc <= 1; dc++)
+        {
+            int c = colonne + dc;
+            int l = ligne + dl;
+            if ((dc == 0 && dl == 0) || c < 0 || l < 0 || c >= mNbColonnes || l >= mNbLignes)
+                continue;
+
+            const Tuile& voisine = mTuiles[l * mNbColonnes + c];
+
+            for (auto* proie : voisine.proies)
+            {
+                float x = proie->GetX();
+                float y = proie->GetY();
+                if (x >= bordX0 && x < bordX1 && y >= bordY0 && y < bordY1)
+                    tuile.proiesVisibles.push_back(proie);
+            }
+
+            for (auto* pred : voisine.predateurs)
+            {
+                float x = pred->GetX();
+                float y = pred->GetY();
+                if (x >= bordX0 && x < bordX1 && y >= bordY0 && y < bordY1)
+                    tuile.predateursVisibles.push_back(pred);
+            }
+
+            for (auto* plante : voisine.plantes)
+            {
+                float x = plante->GetX();
+                float y = plante->GetY();
+                if (x >= bordX0 && x < bordX1 && y >= bordY0 && y < bordY1)
+                    tuile.plantesVisibles.push_back(plante);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Même enchaînement que la boucle séquentielle d'Ecosysteme::Update
+ */
+void DecompositionSpatiale::MettreAJourTuile(int indice, float deltaTime, const ContexteMonde& monde)
+{
+    Tuile& tuile = mTuiles[indice];
+    Traceur::Debut("Tuile");
+
+    /* Même monde, tirages pris dans le flux de la tuile */
+    ContexteMonde mondeTuile = monde;
+    mondeTuile.alea = &tuile.alea;
+
+    /* Une proie mangée lors d'une passe précédente est ignorée par MettreAJourLot */
+    MettreAJourLot(tuile.proies, tuile.proiesVisibles, tuile.predateursVisibles, tuile.plantesVisibles, deltaTime,
+                   mondeTuile);
+    MettreAJourLot(tuile.predateurs, tuile.proiesVisibles, tuile.predateursVisibles, tuile.plantesVisibles, deltaTime,
+                   mondeTuile);
+    Traceur::Fin();
+}
+
+/**
+ * @brief Bordures en parallèle, puis quatre passes en damier
+ */
+void DecompositionSpatiale::MettreAJour(float deltaTime, const ContexteMonde& monde)
+{
+    int nbTuiles = static_cast<int>(mTuiles.size());
+
+    /* 1. Échange des bordures fantômes (lecture seule des voisines) */
+    mPool->Executer(nbTuiles, [this](int i)
+    {
+        Traceur::Debut("Bordures");
+        ConstruireVisibles(i);
+        Traceur::Fin();
+    });
+
+    /* 2. Passes (colonne paire/impaire) x (ligne paire/impaire) */
+    VecteurFrame<int> tuilesPasse{AllocateurFrame<int>(*mArena)};
+    tuilesPasse.reserve(nbTuiles / 4 + 1);
+
+    for (int passe = 0; passe < 4; passe++)
+    {
+        tuilesPasse.clear();
+        for (int ligne = passe / 2; ligne < mNbLignes; ligne += 2)
+        {
+            for (int colonne = passe % 2; colonne < mNbColonnes; colonne += 2)
+                tuilesPasse.push_back(ligne * mNbColonnes + colonne);
+        }
+
+        mPool->Executer(static_cast<int>(tuilesPasse.size()),
+                        [&](int k) { MettreAJourTuile(tuilesPasse[k], deltaTime, monde); });
+    }
+}
+
+/**
+ * @brief Tri en parallèle (garder / sortir / mort), puis transfert séquentiel
+ */
+void DecompositionSpatiale::Migrer()
+{
+    int nbTuiles = static_cast<int>(mTuiles.size());
+
+    mPool->Executer(nbTuiles, [this](int i)
+    {
+        Traceur::Debut("TriMigrants");
+        Tuile& tuile = mTuiles[i];
+        tuile.proiesSortantes.clear();
+        tuile.predateursSortants.clear();
+
+        size_t garde = 0;
+        for (auto* proie : tuile.proies)
+        {
+            if (!proie->EstVivant())
+                continue;
+
+            float x = proie->GetX();
+            float y = proie->GetY();
+            if (x >= tuile.x0 && x < tuile.x1 && y >= tuile.y0 && y < tuile.y1)
+                tuile.proies[garde++] = proie;
+            else
+                tuile.proiesSortantes.push_back(proie);
+        }
+        tuile.proies.resize(garde);
+
+        garde = 0;
+        for (auto* pred : tuile.predateurs)
+        {
+            if (!pred->EstVivant())
+                continue;
+
+            float x = pred->GetX();
+            float y = pred->GetY();
+            if (x >= tuile.x0 && x < tuile.x1 && y >= tuile.y0 && y < tuile.y1)
+                tuile.predateurs[garde++] = pred;
+            else
+                tuile.predateursSortants.push_back(pred);
+        }
+        tuile.predateurs.resize(garde);
+        Traceur::Fin();
+    });
+
+    for (auto& tuile : mTuiles)
+    {
+        for (auto* proie : tuile.proiesSortantes)
+            AjouterProie(proie);
+
+        for (auto* pred : tuile.predateursSortants)
+            AjouterPredateur(pred);
+    }
+}
+
+/**
+ * @brief Coût estimé : chaque animal compare sa position à toutes les entités visibles
+ */
+double DecompositionSpatiale::Charge(const Tuile& tuile)
+{
+    return static_cast<double>(tuile.proies.size())
+               * (tuile.predateursVisibles.size() + tuile.plantesVisibles.size() + 1)
+         + static_cast<double>(tuile.predateurs.size()) * (tuile.proiesVisibles.size() + 1);
+}
+
+/**
+ * @brief Redécoupe aux quantiles si la tuile la plus chargée dépasse la moyenne
+ */
+bool DecompositionSpatiale::Reequilibrer(const std::vector<Proie*>& proies,
+                                         const std::vector<Predateur*>& predateurs,
+                                         const std::vector<Plante*>& plantes)
+{
+    if (++mTicksDepuisEquilibrage < INTERVALLE_EQUILIBRAGE)
+        return false;
+    mTicksDepuisEquilibrage = 0;
+
+    double chargeMax = 0.0;
+    double chargeTotale = 0.0;
+    for (const auto& tuile : mTuiles)
+    {
+        double charge = Charge(tuile);
+        chargeMax = std::max(chargeMax, charge);
+        chargeTotale += charge;
+    }
+
+    double chargeMoyenne = chargeTotale / mTuiles.size();
+    if (chargeMoyenne <= 0.0 || chargeMax <= DESEQUILIBRE_MAX * chargeMoyenne)
+        return false;
+
+    /* Copies triées sur place, jetées avec l'arène au tick suivant */
+    VecteurFrame<float> positionsX{AllocateurFrame<float>(*mArena)};
+    VecteurFrame<float> positionsY{AllocateurFrame<float>(*mArena)};
+    positionsX.reserve(proies.size() + predateurs.size());
+    positionsY.reserve(proies.size() + predateurs.size());
+
+    for (auto* proie : proies)
+    {
+        positionsX.push_back(proie->GetX());
+        positionsY.push_back(proie->GetY());
+    }
+    for (auto* pred : predateurs)
+    {
+        positionsX.push_back(pred->GetX());
+        positionsY.push_back(pred->GetY());
+    }
+
+    PlacerBords(mBordsX, positionsX.data(), positionsX.size(), mLargeur);
+    PlacerBords(mBordsY, positionsY.data(), positionsY.size(), mHauteur);
+    Repartir(proies, predateurs, plantes);
+    return true;
+}
+
+/**
+ * @brief Récupère le nombre de tuiles
+ */
+int DecompositionSpatiale::GetNombreTuiles() const
+{
+    return static_cast<int>(mTuiles.size());
+}
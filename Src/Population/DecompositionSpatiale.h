@@ -0,0 +1,208 @@
+/**
+ * @file DecompositionSpatiale.h
+ * @brief Découpage du monde en tuiles mises à jour en parallèle
+ */
+
+#ifndef DECOMPOSITION_SPATIALE_H
+#define DECOMPOSITION_SPATIALE_H
+
+#include "../Core/GenerateurAleatoire.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Proie;
+class Predateur;
+class Plante;
+class PoolThreads;
+class ArenaFrame;
+struct ContexteMonde;
+
+/**
+ * @struct Tuile
+ * @brief Rectangle du monde et entités qui s'y trouvent
+ */
+struct Tuile
+{
+    float x0;                                   /**< Bord gauche */
+    float y0;                                   /**< Bord haut */
+    float x1;                                   /**< Bord droit (exclu) */
+    float y1;                                   /**< Bord bas (exclu) */
+
+    std::vector<Proie*> proies;                 /**< Proies appartenant à la tuile */
+    std::vector<Predateur*> predateurs;         /**< Prédateurs appartenant à la tuile */
+    std::vector<Plante*> plantes;               /**< Plantes appartenant à la tuile */
+
+    std::vector<Proie*> proiesVisibles;         /**< Proies de la tuile + bordure fantôme des voisines */
+    std::vector<Predateur*> predateursVisibles; /**< Prédateurs de la tuile + bordure fantôme */
+    std::vector<Plante*> plantesVisibles;       /**< Plantes de la tuile + bordure fantôme */
+
+    std::vector<Proie*> proiesSortantes;        /**< Proies ayant quitté la tuile ce tick */
+    std::vector<Predateur*> predateursSortants; /**< Prédateurs ayant quitté la tuile ce tick */
+
+    GenerateurAleatoire alea{0};                /**< Tirages d'errance des animaux mis à jour ici */
+};
+
+/**
+ * @class DecompositionSpatiale
+ * @brief Répartit les entités en tuiles et les met à jour sur plusieurs threads
+ *
+ * Chaque tuile ne voit que ses entités et une bordure fantôme de largeur
+ * RAYON_FANTOME prise chez ses voisines. Les tuiles sont traitées en quatre
+ * passes en damier (parité de colonne et de ligne) : deux tuiles d'une même
+ * passe sont séparées par une tuile entière, plus large que deux rayons de
+ * détection, et ne peuvent donc jamais toucher la même entité. Les animaux qui
+ * changent de tuile migrent en fin de tick ; les bords des tuiles suivent les
+ * quantiles de population quand la charge se déséquilibre.
+ */
+class DecompositionSpatiale
+{
+private:
+    float mLargeur;                     /**< Largeur du monde */
+    float mHauteur;                     /**< Hauteur du monde */
+    int mNbColonnes;                    /**< Nombre de colonnes de tuiles */
+    int mNbLignes;                      /**< Nombre de lignes de tuiles */
+    std::vector<float> mBordsX;         /**< Abscisses des bords de colonnes (nbColonnes + 1) */
+    std::vector<float> mBordsY;         /**< Ordonnées des bords de lignes (nbLignes + 1) */
+    std::vector<Tuile> mTuiles;         /**< Tuiles, rangées ligne par ligne */
+    PoolThreads* mPool;                 /**< Système de tâches (non possédé) */
+    ArenaFrame* mArena;                 /**< Arène du tick de l'écosystème (non possédée) */
+    int mTicksDepuisEquilibrage;        /**< Ticks écoulés depuis le dernier contrôle de charge */
+
+    static constexpr int INTERVALLE_EQUILIBRAGE = 60;   /**< Ticks entre deux contrôles de charge */
+    static constexpr float DESEQUILIBRE_MAX = 1.5f;     /**< Charge max / charge moyenne tolérée */
+
+    /**
+     * @brief Trouve la tuile contenant un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Indice de la tuile
+     */
+    int TuileDe(float x, float y) const;
+
+    /**
+     * @brief Place des bords réguliers ou aux quantiles, en respectant TAILLE_MIN
+     * @param bords Bords à calculer (taille n + 1)
+     * @param positions Positions des animaux (triées partiellement sur place), nullptr pour un découpage régulier
+     * @param nombre Nombre de positions
+     * @param etendue Taille du monde sur cet axe
+     */
+    static void PlacerBords(std::vector<float>& bords, float* positions, size_t nombre, float etendue);
+
+    /**
+     * @brief Construit les listes visibles (propres + fantômes) d'une tuile
+     * @param indice Indice de la tuile
+     */
+    void ConstruireVisibles(int indice);
+
+    /**
+     * @brief Met à jour comportement, déplacement et métabolisme d'une tuile
+     * @param indice Indice de la tuile
+     * @param deltaTime Temps écoulé (secondes)
+     * @param monde Dimensions et végétation de l'écosystème
+     */
+    void MettreAJourTuile(int indice, float deltaTime, const ContexteMonde& monde);
+
+    /**
+     * @brief Estime le coût de mise à jour d'une tuile
+     * @param tuile Tuile évaluée
+     * @return Nombre approximatif de tests de distance
+     */
+    static double Charge(const Tuile& tuile);
+
+public:
+    static constexpr float RAYON_FANTOME = 150.0f;      /**< Plus grand rayon de détection (RAYON_DETECTION_PREDATEUR) */
+    static constexpr float TAILLE_MIN = 2.0f * RAYON_FANTOME + 20.0f;  /**< Côté minimal d'une tuile (sûreté du damier) */
+
+    /**
+     * @brief Constructeur (une seule tuile, pas de threads)
+     */
+    DecompositionSpatiale();
+
+    /**
+     * @brief Définit le découpage
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param nbThreads Nombre de threads disponibles (fixe le nombre de tuiles)
+     * @param pool Système de tâches de l'application
+     * @param arena Arène du tick, pour les tableaux temporaires des passes et du rééquilibrage
+     */
+    void Configurer(float largeur, float hauteur, int nbThreads, PoolThreads* pool, ArenaFrame* arena);
+
+    /**
+     * @brief Ramène les bords au découpage régulier de Configurer, tuiles gardées
+     *
+     * Pour un écosystème relancé : Repartir doit suivre.
+     */
+    void Reinitialiser();
+
+    /**
+     * @brief Range toutes les entités dans leur tuile
+     * @param proies Toutes les proies
+     * @param predateurs Tous les prédateurs
+     * @param plantes Toutes les plantes
+     */
+    void Repartir(const std::vector<Proie*>& proies,
+                  const std::vector<Predateur*>& predateurs,
+                  const std::vector<Plante*>& plantes);
+
+    /**
+     * @brief Donne à chaque tuile son flux aléatoire
+     * @param graine Graine commune ; la tuile i tire le flux i + 1 (le flux 0 reste à l'écosystème)
+     *
+     * Un flux par tuile plutôt que rand() : les threads ne se disputent aucun
+     * état, et les tirages d'une tuile ne dépendent pas du thread qui la traite.
+     */
+    void Semer(uint64_t graine);
+
+    /**
+     * @brief Ajoute une proie née ou créée pendant le tick
+     * @param proie Nouvelle proie
+     */
+    void AjouterProie(Proie* proie);
+
+    /**
+     * @brief Ajoute un prédateur né ou créé pendant le tick
+     * @param predateur Nouveau prédateur
+     */
+    void AjouterPredateur(Predateur* predateur);
+
+    /**
+     * @brief Ajoute une plante apparue pendant le tick
+     * @param plante Nouvelle plante
+     */
+    void AjouterPlante(Plante* plante);
+
+    /**
+     * @brief Met à jour toutes les tuiles en quatre passes parallèles
+     * @param deltaTime Temps écoulé (secondes)
+     * @param monde Dimensions et végétation de l'écosystème
+     */
+    void MettreAJour(float deltaTime, const ContexteMonde& monde);
+
+    /**
+     * @brief Retire les morts et déplace les animaux sortis de leur tuile
+     *
+     * À appeler avant que l'écosystème ne libère les animaux morts.
+     */
+    void Migrer();
+
+    /**
+     * @brief Recalcule les bords si la charge est trop déséquilibrée
+     * @param proies Toutes les proies
+     * @param predateurs Tous les prédateurs
+     * @param plantes Toutes les plantes
+     * @return true si les tuiles ont été redécoupées
+     */
+    bool Reequilibrer(const std::vector<Proie*>& proies,
+                      const std::vector<Predateur*>& predateurs,
+                      const std::vector<Plante*>& plantes);
+
+    /**
+     * @brief Récupère le nombre de tuiles
+     * @return Nombre de tuiles
+     */
+    int GetNombreTuiles() const;
+};
+
+#endif /* DECOMPOSITION_SPATIALE_H */
@@ -0,0 +1,250 @@
+/**
+ * @file DetecteurCollisions.cpp
+ * @brief Implémentation du balayage et élagage et de la séparation des sprites
+ */
+
+#include "DetecteurCollisions.h"
+#include "Animal.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+/**
+ * @brief Constructeur
+ */
+DetecteurCollisions::DetecteurCollisions()
+    : mTestsFins(0),
+      mPermutations(0),
+      mAdressesAJour(false)
+{
+}
+
+/**
+ * @brief Le corps rejoindra le balayage au prochain tick, par fusion
+ */
+void DetecteurCollisions::Suivre(Animal* animal, float taille, bool proie)
+{
+    mNouveaux.push_back({animal, 0.0f, taille, proie});
+    mAdressesAJour = false;
+}
+
+/**
+ * @brief Listes vidées sans rendre leur capacité
+ */
+void DetecteurCollisions::Vider()
+{
+    mCorps.clear();
+    mNouveaux.clear();
+    mFusion.clear();
+    mCollisions.clear();
+    mEvenements.clear();
+    mTestsFins = 0;
+    mPermutations = 0;
+    mAdressesAJour = false;
+}
+
+/**
+ * @brief Compactage stable : l'ordre par x0 des survivants est gardé
+ */
+void DetecteurCollisions::OublierMorts()
+{
+    auto mort = [](const Corps& corps) { return !corps.animal->EstVivant(); };
+    mCorps.erase(std::remove_if(mCorps.begin(), mCorps.end(), mort), mCorps.end());
+    mNouveaux.erase(std::remove_if(mNouveaux.begin(), mNouveaux.end(), mort), mNouveaux.end());
+    mAdressesAJour = false;
+}
+
+/**
+ * @brief Un pointeur par corps et deux par collision ; les événements désignent les collisions
+ */
+void DetecteurCollisions::IndexerAdresses()
+{
+    mAdresses.clear();
+    for (Corps& corps : mCorps)
+        mAdresses.push_back({corps.animal, &corps.animal});
+    for (Corps& corps : mNouveaux)
+        mAdresses.push_back({corps.animal, &corps.animal});
+    for (Collision& collision : mCollisions)
+    {
+        mAdresses.push_back({collision.a, &collision.a});
+        mAdresses.push_back({collision.b, &collision.b});
+    }
+    std::sort(mAdresses.begin(), mAdresses.end(),
+              [](const std::pair<Animal*, Animal**>& a, const std::pair<Animal*, Animal**>& b) { return std::less<Animal*>()(a.first, b.first); });
+    mAdressesAJour = true;
+}
+
+/**
+ * @brief Recherche dichotomique de l'ancienne adresse, tous ses pointeurs redirigés
+ */
+void DetecteurCollisions::Reloger(Animal* ancien, Animal* nouveau)
+{
+    if (!mAdressesAJour)
+        IndexerAdresses();
+
+    /* Les clés restent les anciennes adresses : une copie n'en reprend jamais une encore vivante */
+    auto parAnimal = [](const std::pair<Animal*, Animal**>& entree, Animal* animal) { return std::less<Animal*>()(entree.first, animal); };
+    auto entree = std::lower_bound(mAdresses.begin(), mAdresses.end(), ancien, parAnimal);
+    for (; entree != mAdresses.end() && entree->first == ancien; ++entree)
+        *entree->second = nouveau;
+}
+
+/**
+ * @brief Compactage des vivants, tri par insertion, fusion des nouveaux venus triés à part
+ */
+void DetecteurCollisions::Trier()
+{
+    size_t garde = 0;
+    for (size_t i = 0; i < mCorps.size(); ++i)
+    {
+        Corps corps = mCorps[i];
+        if (!corps.animal->EstVivant())
+            continue;
+        corps.x0 = corps.animal->GetX();
+        mCorps[garde++] = corps;
+    }
+    mCorps.resize(garde);
+
+    /* D'un tick à l'autre, chaque corps ne recule que de quelques rangs */
+    auto parBord = [](const Corps& a, const Corps& b) { return a.x0 < b.x0; };
+    const size_t permutationsMax = PERMUTATIONS_MAX_PAR_CORPS * mCorps.size();
+    mPermutations = 0;
+    for (size_t i = 1; i < mCorps.size(); ++i)
+    {
+        /* Cohérence perdue (foule tout juste écartée) : un tri complet coûte moins */
+        if (mPermutations > permutationsMax)
+        {
+            std::sort(mCorps.begin(), mCorps.end(), parBord);
+            break;
+        }
+
+        Corps corps = mCorps[i];
+        size_t j = i;
+        while (j > 0 && mCorps[j - 1].x0 > corps.x0)
+        {
+            mCorps[j] = mCorps[j - 1];
+            --j;
+            ++mPermutations;
+        }
+        mCorps[j] = corps;
+    }
+
+    if (mNouveaux.empty())
+        return;
+
+    /* Un nouveau venu peut tomber n'importe où : l'insérer coûterait un décalage par rang */
+    garde = 0;
+    for (size_t i = 0; i < mNouveaux.size(); ++i)
+    {
+        Corps corps = mNouveaux[i];
+        if (!corps.animal->EstVivant())
+            continue;
+        corps.x0 = corps.animal->GetX();
+        mNouveaux[garde++] = corps;
+    }
+    mNouveaux.resize(garde);
+
+    std::sort(mNouveaux.begin(), mNouveaux.end(), parBord);
+    mFusion.resize(mCorps.size() + mNouveaux.size());
+    std::merge(mCorps.begin(), mCorps.end(), mNouveaux.begin(), mNouveaux.end(), mFusion.begin(), parBord);
+    mCorps.swap(mFusion);
+    mNouveaux.clear();
+}
+
+/**
+ * @brief Test des disques inscrits ; écartement symétrique entre animaux de même espèce
+ */
+void DetecteurCollisions::TesterPaire(const Corps& a, const Corps& b, const ContexteMonde& monde)
+{
+    ++mTestsFins;
+
+    float rayonA = 0.5f * a.taille;
+    float rayonB = 0.5f * b.taille;
+    float contact = rayonA + rayonB;
+    float dx = (b.animal->GetX() + rayonB) - (a.animal->GetX() + rayonA);
+    float dy = (b.animal->GetY() + rayonB) - (a.animal->GetY() + rayonA);
+    if (std::fabs(dy) >= contact)
+        return;
+
+    float distance2 = dx * dx + dy * dy;
+    if (distance2 >= contact * contact)
+        return;
+
+    float distance = std::sqrt(distance2);
+    float profondeur = contact - distance;
+    mCollisions.push_back({a.animal, b.animal, profondeur});
+
+    if (a.proie != b.proie)
+        return;
+
+    /* Centres confondus : aucune normale, on écarte sur l'axe du balayage */
+    float nx = 1.0f;
+    float ny = 0.0f;
+    if (distance > 1e-4f)
+    {
+        nx = dx / distance;
+        ny = dy / distance;
+    }
+    float demi = 0.5f * profondeur;
+    a.animal->Decaler(-nx * demi, -ny * demi, monde);
+    b.animal->Decaler(nx * demi, ny * demi, monde);
+}
+
+/**
+ * @brief Tri, balayage des voisins en x, puis un événement par collision
+ */
+void DetecteurCollisions::Resoudre(const ContexteMonde& monde)
+{
+    mCollisions.clear();
+    mEvenements.clear();
+    mTestsFins = 0;
+    mAdressesAJour = false;
+
+    Trier();
+
+    const size_t nombre = mCorps.size();
+    for (size_t i = 0; i < nombre; ++i)
+    {
+        const Corps& a = mCorps[i];
+        float bordDroit = a.x0 + a.taille;
+        for (size_t j = i + 1; j < nombre && mCorps[j].x0 < bordDroit; ++j)
+            TesterPaire(a, mCorps[j], monde);
+    }
+
+    /* mCollisions ne bouge plus : les pointeurs des événements restent valides */
+    mEvenements.reserve(mCollisions.size());
+    for (Collision& collision : mCollisions)
+        mEvenements.push_back({EVENT_COLLISION, &collision});
+}
+
+/**
+ * @brief Événements du dernier tick
+ */
+const std::vector<Event>& DetecteurCollisions::GetEvenements() const
+{
+    return mEvenements;
+}
+
+/**
+ * @brief Corps triés et nouveaux venus
+ */
+size_t DetecteurCollisions::GetNombreSuivis() const
+{
+    return mCorps.size() + mNouveaux.size();
+}
+
+/**
+ * @brief Paires passées à la phase fine au dernier tick
+ */
+size_t DetecteurCollisions::GetTestsFins() const
+{
+    return mTestsFins;
+}
+
+/**
+ * @brief Décalages du tri par insertion au dernier tick
+ */
+size_t DetecteurCollisions::GetPermutations() const
+{
+    return mPermutations;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file DetecteurCollisions.h
+ * @brief Collisions entre sprites d'animaux : balayage trié sur x, séparation et événements
+ */
+
+#ifndef DETECTEUR_COLLISIONS_H
+#define DETECTEUR_COLLISIONS_H
+
+#include "../Events/EventsTypes.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+class Animal;
+struct ContexteMonde;
+
+/**
+ * @struct Collision
+ * @brief Paire d'animaux dont les sprites se chevauchent (données d'un EVENT_COLLISION)
+ */
+struct Collision
+{
+    Animal* a;              /**< Premier animal (bord gauche le plus petit) */
+    Animal* b;              /**< Second animal */
+    float profondeur;       /**< Pénétration des deux disques au moment du test (pixels) */
+};
+
+/**
+ * @class DetecteurCollisions
+ * @brief Détecte les chevauchements de sprites par balayage et élagage, puis les résout
+ *
+ * Phase large : les corps sont gardés triés par bord gauche d'un tick à
+ * l'autre. Les animaux ne bougeant que de quelques pixels par tick, l'ordre
+ * change peu et un tri par insertion le rétablit en temps quasi linéaire (un
+ * tri complet le relaie si l'ordre est trop bouleversé) ; les nouveaux venus,
+ * triés à part, sont fusionnés en une passe. Le balayage ne compare ensuite
+ * un corps qu'aux suivants dont le bord gauche précède son bord droit, soit
+ * ses seuls voisins en x.
+ *
+ * Phase fine : chaque sprite est assimilé au disque inscrit dans son carré.
+ * Deux animaux de même espèce qui se chevauchent sont écartés chacun de la
+ * moitié de la pénétration ; une proie et un prédateur ne sont pas séparés
+ * (la chasse se joue à ce contact), mais la collision est signalée.
+ *
+ * Les positions lues sont celles du tick : le sommeil (positions calculées
+ * sur la trajectoire) est incompatible. Un animal recopié ailleurs (tri
+ * spatial) est signalé par Reloger. Les espèces du registre, rangées en
+ * tableaux par attribut, ne sont pas suivies.
+ */
+class DetecteurCollisions
+{
+private:
+    /**
+     * @struct Corps
+     * @brief Animal suivi et bord gauche de son sprite au dernier tri
+     */
+    struct Corps
+    {
+        Animal* animal;     /**< Animal suivi (non possédé) */
+        float x0;           /**< Bord gauche du sprite */
+        float taille;       /**< Côté du sprite */
+        bool proie;         /**< Espèce, pour décider de la séparation */
+    };
+
+    std::vector<Corps> mCorps;              /**< Corps triés par x0 */
+    std::vector<Corps> mNouveaux;           /**< Corps suivis depuis le dernier tick */
+    std::vector<Corps> mFusion;             /**< Tampon de fusion des nouveaux (réutilisé) */
+    std::vector<Collision> mCollisions;     /**< Collisions du dernier tick */
+    std::vector<Event> mEvenements;         /**< Un EVENT_COLLISION par élément de mCollisions */
+    size_t mTestsFins;                      /**< Paires passées à la phase fine au dernier tick */
+    size_t mPermutations;                   /**< Décalages du tri par insertion au dernier tick */
+    std::vector<std::pair<Animal*, Animal**>> mAdresses;   /**< Pointeurs vers chaque animal (corps, collisions), triés par animal */
+    bool mAdressesAJour;                    /**< mAdresses reflète les listes actuelles */
+
+    static constexpr size_t PERMUTATIONS_MAX_PAR_CORPS = 16;   /**< Au-delà, le tri par insertion cède à std::sort */
+
+    /**
+     * @brief Retire les morts, relit les positions et rétablit l'ordre par x0
+     */
+    void Trier();
+
+    /**
+     * @brief Teste une paire voisine en x et la sépare si besoin
+     * @param a Corps de bord gauche le plus petit
+     * @param b Corps suivant
+     * @param monde Dimensions du monde (bornes de la séparation)
+     */
+    void TesterPaire(const Corps& a, const Corps& b, const ContexteMonde& monde);
+
+    /**
+     * @brief Recense les pointeurs d'animaux des corps et des collisions, triés par animal
+     */
+    void IndexerAdresses();
+
+public:
+    /**
+     * @brief Constructeur (aucun corps suivi)
+     */
+    DetecteurCollisions();
+
+    /**
+     * @brief Suit un animal à partir du prochain tick
+     * @param animal Animal possédé par l'écosystème
+     * @param taille Côté de son sprite (pixels)
+     * @param proie true pour une proie, false pour un prédateur
+     */
+    void Suivre(Animal* animal, float taille, bool proie);
+
+    /**
+     * @brief Oublie tous les corps (écosystème relancé), tampons gardés
+     */
+    void Vider();
+
+    /**
+     * @brief Retire les animaux morts des corps suivis
+     *
+     * À appeler avant que l'écosystème ne libère les morts du tick : leurs
+     * emplacements resservent aux naissances, qui seraient sinon suivies deux fois.
+     */
+    void OublierMorts();
+
+    /**
+     * @brief Reporte sur une copie tout ce qui désignait un animal
+     * @param ancien Adresse d'origine, libérée ensuite par l'appelant
+     * @param nouveau Copie qui le remplace
+     *
+     * Corps suivis et collisions du dernier tick sont mis à jour. Le premier
+     * appel après un changement des listes les indexe par adresse ; les
+     * suivants ne coûtent qu'une recherche dichotomique.
+     */
+    void Reloger(Animal* ancien, Animal* nouveau);
+
+    /**
+     * @brief Détecte et résout les chevauchements du tick
+     * @param monde Dimensions du monde (bornes de la séparation)
+     *
+     * À appeler après les déplacements et avant la libération des morts du
+     * tick : les morts sont oubliés ici, tant qu'ils sont encore adressables.
+     */
+    void Resoudre(const ContexteMonde& monde);
+
+    /**
+     * @brief Événements du dernier tick, valides jusqu'au prochain Resoudre
+     * @return Un EVENT_COLLISION par paire, data pointant sur une Collision
+     */
+    const std::vector<Event>& GetEvenements() const;
+
+    /**
+     * @brief Nombre de corps suivis
+     * @return Animaux vivants au dernier tick et nouveaux venus
+     */
+    size_t GetNombreSuivis() const;
+
+    /**
+     * @brief Paires passées à la phase fine au dernier tick
+     * @return Nombre de tests de disques
+     */
+    size_t GetTestsFins() const;
+
+    /**
+     * @brief Décalages du tri par insertion au dernier tick
+     * @return Nombre de déplacements d'un corps d'un cran (mesure de la cohérence)
+     */
+    size_t GetPermutations() const;
+};
+
+#endif /* DETECTEUR_COLLISIONS_H */
@@ -1,278 +1,1608 @@
-/**
- * @file Ecosysteme.cpp
- * @brief Implémentation de la classe Ecosysteme
- */
-
-#include "Ecosysteme.h"
-#include "Proie.h"
-#include "Predateur.h"
-#include "Plante.h"
-#include <cstdlib>
-
-/**
- * @brief Constructeur créant populations aléatoirement
- */
-Ecosysteme::Ecosysteme(int nbreProies, int nbrePredateurs, int nbrePlantes,
-                       float largeur, float hauteur)
-    : mLargeur(largeur)
-    , mHauteur(hauteur)
-    , mNbreProies(nbreProies)
-    , mNbrePredateurs(nbrePredateurs)
-    , mNbrePlantes(nbrePlantes)
-    , mTempsDepuisCreationPlante(0.0f)
-{
-
-    const float MARGE = 35.0f;  /* Marge indisponible  representant les bords */
-
-    /* Créer proies */
-    for (int i = 0; i < nbreProies; i++)
-    {
-        float x = static_cast<float>(rand() % static_cast<int>(largeur));
-        float y = static_cast<float>(rand() % static_cast<int>(hauteur));
-        mProies.push_back(new Proie(x, y, largeur, hauteur));
-    }
-    
-    /* Créer prédateurs */
-    for (int i = 0; i < nbrePredateurs; i++)
-    {
-        float x = static_cast<float>(rand() % static_cast<int>(largeur));
-        float y = static_cast<float>(rand() % static_cast<int>(hauteur));
-        mPredateurs.push_back(new Predateur(x, y, largeur, hauteur));
-    }
-    
-    /* Créer plantes */
-    for (int i = 0; i < nbrePlantes; i++)
-    {
-        float x = MARGE + (rand() % static_cast<int>(largeur - 2 * MARGE));
-        float y = MARGE + (rand() % static_cast<int>(hauteur - 2 * MARGE));
-        mPlantes.push_back(new Plante(x, y));
-    }
-}
-
-/**
- * @brief Destructeur libérant toute la mémoire
- */
-Ecosysteme::~Ecosysteme()
-{
-    for (auto* proie : mProies)
-        delete proie;
-    
-    for (auto* pred : mPredateurs)
-        delete pred;
-    
-    for (auto* plante : mPlantes)
-        delete plante;
-}
-
-/**
- * @brief Retourne vecteur des proies
- */
-const std::vector<Proie*>& Ecosysteme::GetProies() const
-{
-    return mProies;
-}
-
-/**
- * @brief Retourne vecteur des prédateurs
- */
-const std::vector<Predateur*>& Ecosysteme::GetPredateurs() const
-{
-    return mPredateurs;
-}
-
-/**
- * @brief Retourne vecteur des plantes
- */
-const std::vector<Plante*>& Ecosysteme::GetPlantes() const
-{
-    return mPlantes;
-}
-
-/**
- * @brief Compte proies vivantes
- */
-int Ecosysteme::GetNombreProies() const
-{
-    return mProies.size();
-}
-
-/**
- * @brief Compte prédateurs vivants
- */
-int Ecosysteme::GetNombrePredateurs() const
-{
-    return mPredateurs.size();
-}
-
-/**
- * @brief Compte le temps qui separe l'apparission de 2 plantes
- */
-int Ecosysteme::GetDelaiPlantes() const
-{
-    return INTERVALLE_CREATION_PLANTE;
-}
-
-/**
- * @brief Compte plantes disponibles
- */
-int Ecosysteme::GetNombrePlantes() const
-{
-    int count = 0;
-    for (auto* plante : mPlantes)
-    {
-        if (plante->EstDisponible())
-            count++;
-    }
-    return count;
-}
-
-void Ecosysteme::SupprimerMorts() {
-    for (int i = mPredateurs.size() - 1; i >= 0; i--) {
-        if (!mPredateurs[i]->EstVivant())
-        {
-            delete mPredateurs[i];
-            mPredateurs.erase(mPredateurs.begin() + i);
-        }
-        
-    }
-
-    for (int i = mProies.size() - 1; i >= 0; i--) {
-        if (!mProies[i]->EstVivant())
-        {
-            delete mProies[i];
-            mProies.erase(mProies.begin() + i);
-        }
-        
-    }
-}
-
-void Ecosysteme::Reproduction() {    
-    std::vector<Predateur*> nouveauxPredateurs;  // Liste temporaire
-    
-    for (auto* pred : mPredateurs)
-    {
-        if (pred->PeutSeReproduire() && (rand() % 100) > 75)
-        {
-            pred->PerdreEnergie(pred->GetSeuil());
-            pred->ReinitialiserReproduction();
-            nouveauxPredateurs.push_back(
-                new Predateur(pred->GetX(), pred->GetY(), mLargeur, mHauteur)
-            );
-        }
-    }
-    
-    // Ajouter tous les bébés APRÈS la boucle
-    for (auto* bebe : nouveauxPredateurs)
-    {
-        mPredateurs.push_back(bebe);
-    }
-
-        std::vector<Proie*> nouvellesProies;  // Liste temporaire
-    
-    for (auto* proi : mProies)
-    {
-        if (proi->PeutSeReproduire() && (rand() % 100) > 75)
-        {
-            proi->PerdreEnergie(proi->GetSeuil());
-            proi->ReinitialiserReproduction();
-            nouvellesProies.push_back(
-                new Proie(proi->GetX(), proi->GetY(), mLargeur, mHauteur)
-            );
-        }
-    }
-    
-    // Ajouter tous les bébés APRÈS la boucle
-    for (auto* bebe : nouvellesProies)
-    {
-        mProies.push_back(bebe);
-    }
-}
-
-/**
- * @brief Met à jour tout l'écosystème pour un frame
- * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
- */
-void Ecosysteme::Update(float deltaTime)
-{
-    /* Comportement et déplacement des proies */
-    for (auto* proie : mProies)
-    {
-        proie->Comportement(mProies, mPredateurs, mPlantes);
-        proie->Deplacer(deltaTime);
-        proie->Metabolisme(deltaTime);
-        proie->IncrementerTempsReproduction(deltaTime);
-    }
-
-    /* Comportement et déplacement des prédateurs */
-    for (auto* pred : mPredateurs)
-    {
-        pred->Comportement(mProies, mPredateurs, mPlantes);
-        pred->Deplacer(deltaTime);
-        pred->Metabolisme(deltaTime);
-        pred->IncrementerTempsReproduction(deltaTime);
-    }
-
-    /* Régénération des plantes toutes les 5 secondes */
-    mTempsDepuisCreationPlante += deltaTime;
-    
-    if (mTempsDepuisCreationPlante >= INTERVALLE_CREATION_PLANTE)
-    {
-        mTempsDepuisCreationPlante = 0.0f;  /* Reset timer */
-
-        const float MARGE = 30.0f;          /* Marge indisponible  representant les bords */
-        
-        /* Ajouter une plante si sous le maximum */
-        if (static_cast<int>(mPlantes.size()) < MAX_PLANTES)
-        {
-            float x = MARGE + (rand() % static_cast<int>(mLargeur - 2 * MARGE));
-            float y = MARGE + (rand() % static_cast<int>(mHauteur - 2 * MARGE));
-            mPlantes.push_back(new Plante(x, y));
-        }
-    }
-
-    /* Détecter et compter nouvelles plantes consommées */
-    for (auto* plante : mPlantes)
-    {
-        if (!plante->EstDisponible())
-        {
-            /* Vérifier si déjà comptée */
-            bool dejaComptee = false;
-            for (auto* consommee : mPlantesConsommees)
-            {
-                if (consommee == plante)
-                {
-                    dejaComptee = true;
-                    break;
-                }
-            }
-            
-            /* Ajouter si nouvelle */
-            if (!dejaComptee)
-            {
-                mPlantesConsommees.push_back(plante);
-            }
-        }
-    }
-
-    /* Supprimer les animaux morts */
-    SupprimerMorts();
-
-    /* Gérer les reproductions */
-    Reproduction();
-}
-
-/**
- * @brief Compte le nombre total de plantes consommées
- * @return Nombre de plantes consommées depuis le début
- */
-int Ecosysteme::GetTotalPlantesConsommees() const {
-    return mPlantesConsommees.size();
-}
-
-/**
- * @brief Actualise le temps qui sépare l'apparission de 2 plantes
- * @param Delai de réaparission
- */
-void Ecosysteme::SetDelaiPlantes(float delai) {
-    INTERVALLE_CREATION_PLANTE = delai;
-}
+/**
+ * @file Ecosysteme.cpp
+ * @brief Implémentation de la classe Ecosysteme
+ */
+
+#include "Ecosysteme.h"
+#include "Proie.h"
+#include "Predateur.h"
+#include "Plante.h"
+#include "BudgetPopulation.h"
+#include "CarteNourriture.h"
+#include "ChampVegetation.h"
+#include "DetecteurCollisions.h"
+#include "ListesVoisins.h"
+#include "PlanificateurSommeil.h"
+#include "PopulationGenerique.h"
+#include "ReserveObjets.h"
+#include "../Core/ComptableMemoire.h"
+#include "../Core/PoolThreads.h"
+#include "../Core/Traceur.h"
+#include <algorithm>
+#include <cstdlib>
+#include <type_traits>
+
+/**
+ * @brief Tire une position uniforme dans [min, max[
+ *
+ * N'utilise pas rand() % n : RAND_MAX vaut 32767 sous Windows, ce qui
+ * laisserait vide tout monde plus large.
+ */
+static float AleatoireEntre(float min, float max)
+{
+    return min + (max - min) * static_cast<float>(rand() / (RAND_MAX + 1.0));
+}
+
+/**
+ * @brief Construit un animal dans son emplacement, vitesse tirée comme par son constructeur
+ */
+template<typename T>
+static T* Construire(void* place, float x, float y, GenerateurAleatoire& alea)
+{
+    float vx = (alea.Entier(200) - 100) * 0.5f;
+    float vy = (alea.Entier(200) - 100) * 0.5f;
+    return new (place) T(x, y, vx, vy);
+}
+
+/**
+ * @brief Une plante n'a que sa position
+ */
+template<>
+Plante* Construire<Plante>(void* place, float x, float y, GenerateurAleatoire&)
+{
+    return new (place) Plante(x, y);
+}
+
+/**
+ * @brief Constructeur créant populations aléatoirement
+ */
+Ecosysteme::Ecosysteme(int nbreProies, int nbrePredateurs, int nbrePlantes,
+                       float largeur, float hauteur, const RepartitionInitiale& repartition,
+                       PoolThreads* taches)
+    : mNbPlantesConsommees(0)
+    , mLargeur(largeur)
+    , mHauteur(hauteur)
+    , mAlea(0)
+    , mGraineAlea(0)
+    , mNbreProies(nbreProies)
+    , mNbrePredateurs(nbrePredateurs)
+    , mNbrePlantes(nbrePlantes)
+    , mRepartition(repartition)
+    , mTaches(taches)
+    , mPool(nullptr)
+    , mEspeces(nullptr)
+    , mSommeil(nullptr)
+    , mChamp(nullptr)
+    , mSuivi(false)
+    , mCollisions(nullptr)
+    , mVoisins(nullptr)
+    , mCarteNourriture(nullptr)
+    , mTriSpatial(false)
+    , mIntervalleTri(1)
+    , mTicksAvantTri(1)
+    , mNbTris(0)
+    , mBudget(nullptr)
+    , mBandeX0(0.0f)
+    , mBandeX1(largeur)
+    , mFantomesProies(nullptr)
+    , mFantomesPredateurs(nullptr)
+    , mLiberationDifferee(false)
+{
+    ZoneMemoire zone(MEMOIRE_POPULATION);
+    AjusterVegetation();
+    mMonde.largeur = largeur;
+    mMonde.hauteur = hauteur;
+    mMonde.champ = nullptr;
+    mMonde.carte = nullptr;
+    mMonde.alea = &mAlea;
+    mMonde.annexes = &mAnnexes;
+
+    mGrilleProies.Configurer(largeur, hauteur, TAILLE_CELLULE_GRILLE);
+    mGrillePredateurs.Configurer(largeur, hauteur, TAILLE_CELLULE_GRILLE);
+    mGrillePlantes.Configurer(largeur, hauteur, TAILLE_CELLULE_GRILLE);
+
+    mRoue.Armer(mMinuterieRepousse, INTERVALLE_CREATION_PLANTE, MINUTERIE_REPOUSSE, nullptr);
+
+    Peupler(nbreProies, nbrePredateurs, nbrePlantes);
+}
+
+/**
+ * @brief Graine de 64 bits pour des flux GenerateurAleatoire, tirée par rand()
+ *
+ * RAND_MAX vaut 32767 sous Windows : trois tirages.
+ */
+static uint64_t TirerGraine()
+{
+    return (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand();
+}
+
+/**
+ * @brief Entrelace les bits de colonne et de ligne (courbe de Morton, 16 bits chacune)
+ */
+static uint32_t CleMorton(uint32_t colonne, uint32_t ligne)
+{
+    auto etaler = [](uint32_t v)
+    {
+        v &= 0xFFFF;
+        v = (v | (v << 8)) & 0x00FF00FF;
+        v = (v | (v << 4)) & 0x0F0F0F0F;
+        v = (v | (v << 2)) & 0x33333333;
+        v = (v | (v << 1)) & 0x55555555;
+        return v;
+    };
+    return etaler(colonne) | (etaler(ligne) << 1);
+}
+
+/**
+ * @brief Clé de Morton de la case contenant une entité
+ */
+template<typename T>
+static uint32_t CleCase(const T* entite, float tailleCase)
+{
+    uint32_t colonne = static_cast<uint32_t>(std::min(std::max(entite->GetX() / tailleCase, 0.0f), 65535.0f));
+    uint32_t ligne = static_cast<uint32_t>(std::min(std::max(entite->GetY() / tailleCase, 0.0f), 65535.0f));
+    return CleMorton(colonne, ligne);
+}
+
+/**
+ * @brief Part des entités consécutives dont la clé décroît (0 : triées, environ 0,5 : aléatoires)
+ */
+template<typename T>
+static float Desordre(const std::vector<T*>& entites, float tailleCase)
+{
+    if (entites.size() < 2)
+        return 0.0f;
+
+    size_t inversions = 0;
+    uint32_t precedente = CleCase(entites[0], tailleCase);
+    for (size_t i = 1; i < entites.size(); i++)
+    {
+        uint32_t cle = CleCase(entites[i], tailleCase);
+        if (cle < precedente)
+            inversions++;
+        precedente = cle;
+    }
+    return static_cast<float>(inversions) / (entites.size() - 1);
+}
+
+/**
+ * @brief Nouvelle adresse d'une entité relogée (nullptr si elle ne l'a pas été)
+ */
+template<typename T>
+static T* AdresseRelogee(const VecteurFrame<std::pair<T*, T*>>& adresses, T* ancienne)
+{
+    auto trouvee = std::lower_bound(adresses.begin(), adresses.end(), ancienne,
+                                    [](const std::pair<T*, T*>& a, T* b) { return std::less<T*>()(a.first, b); });
+    if (trouvee == adresses.end() || trouvee->first != ancienne)
+        return nullptr;
+    return trouvee->second;
+}
+
+/**
+ * @brief Rang dans les annexes, minuterie armée pour le reste du délai de l'espèce, sprite suivi
+ */
+template<typename Espece>
+void Ecosysteme::Accueillir(Espece* animal)
+{
+    using Politique = PolitiqueEspece<Espece>;
+    const int type = std::is_same<Espece, Proie>::value ? MINUTERIE_PROIE : MINUTERIE_PREDATEUR;
+
+    /* Un animal déjà mûr échoit au prochain tick ; le délai de suivi du rang part de zéro */
+    animal->SetRang(mAnnexes.Allouer());
+    float reste = Politique::DELAI_REPRODUCTION - animal->GetTempsDepuisReproduction(mMonde);
+    mRoue.Armer(mAnnexes.GetMinuterie(animal->GetRang()), std::max(0.0f, reste), type, animal);
+
+    if (mCollisions)
+        mCollisions->Suivre(animal, Politique::TAILLE_SPRITE, std::is_same<Espece, Proie>::value);
+}
+
+/**
+ * @brief Rang rendu aux annexes ; l'animal n'en a plus
+ */
+void Ecosysteme::Congedier(Animal* animal)
+{
+    mAnnexes.Liberer(animal->GetRang());
+    animal->SetRang(AnnexesAnimaux::SANS_RANG);
+}
+
+/**
+ * @brief Emplacements pris d'un bloc, tranches remplies chacune avec son flux aléatoire
+ */
+template<typename T>
+void Ecosysteme::CreerParTranches(std::vector<T*>& entites, int nombre, PoolThreads* pool)
+{
+    if (nombre <= 0)
+        return;
+
+    /* Après une relance, les places libérées sont reprises dans l'ordre où elles avaient été remplies */
+    mPlaces.clear();
+    ReserveObjets<T>::Reserver(nombre, mPlaces);
+
+    uint64_t graine = TirerGraine();
+
+    const size_t debut = entites.size();
+    entites.resize(debut + nombre);
+    const int nbTranches = (nombre + TAILLE_TRANCHE - 1) / TAILLE_TRANCHE;
+
+    auto tranche = [&](int t) {
+        Traceur::Debut("Tranche");
+        GenerateurAleatoire alea(graine, t);
+        int fin = std::min(nombre, (t + 1) * TAILLE_TRANCHE);
+        for (int i = t * TAILLE_TRANCHE; i < fin; i++)
+        {
+            float x, y;
+            mRepartition.Tirer(alea, x, y);
+            entites[debut + i] = Construire<T>(mPlaces[i], x, y, alea);
+        }
+        Traceur::Fin();
+    };
+
+    if (pool && nbTranches > 1)
+        pool->Executer(nbTranches, tranche);
+    else
+    {
+        for (int t = 0; t < nbTranches; t++)
+            tranche(t);
+    }
+}
+
+/**
+ * @brief Copies neuves aux adresses croissantes dans l'ordre de Morton, table ancienne -> nouvelle adresse
+ */
+template<typename T>
+void Ecosysteme::RelogerSelonMorton(std::vector<T*>& entites, VecteurFrame<std::pair<T*, T*>>& adresses)
+{
+    /* Le rang d'origine départage les entités d'une même case */
+    VecteurFrame<std::pair<uint32_t, uint32_t>> cles{AllocateurFrame<std::pair<uint32_t, uint32_t>>(mArena)};
+    cles.reserve(entites.size());
+    for (size_t i = 0; i < entites.size(); i++)
+        cles.push_back({CleCase(entites[i], TAILLE_CELLULE_GRILLE), static_cast<uint32_t>(i)});
+    std::sort(cles.begin(), cles.end());
+
+    /* Places libres reprises d'abord : d'un tri à l'autre, la population change de places sans grossir */
+    mPlaces.clear();
+    ReserveObjets<T>::Reserver(entites.size(), mPlaces);
+    std::sort(mPlaces.begin(), mPlaces.end(), std::less<void*>());
+
+    adresses.clear();
+    adresses.reserve(entites.size());
+    for (size_t i = 0; i < cles.size(); i++)
+    {
+        T* ancien = entites[cles[i].second];
+        T* nouveau = new (mPlaces[i]) T(*ancien);
+
+        /* La copie garde le rang : sa minuterie reste à sa place dans la roue, seule la cible change */
+        mAnnexes.GetMinuterie(nouveau->GetRang()).cible = nouveau;
+        if (mCollisions)
+            mCollisions->Reloger(ancien, nouveau);
+        adresses.push_back({ancien, nouveau});
+    }
+    for (size_t i = 0; i < adresses.size(); i++)
+        entites[i] = adresses[i].second;
+
+    std::sort(adresses.begin(), adresses.end(),
+              [](const std::pair<T*, T*>& a, const std::pair<T*, T*>& b) { return std::less<T*>()(a.first, b.first); });
+}
+
+/**
+ * @brief Mesure au délai échu ; relogement des animaux, puis des pointeurs qui les désignent
+ */
+void Ecosysteme::TrierSiDesordonne()
+{
+    if (--mTicksAvantTri > 0)
+        return;
+
+    float desordre = std::max(Desordre(mProies, TAILLE_CELLULE_GRILLE), Desordre(mPredateurs, TAILLE_CELLULE_GRILLE));
+    if (desordre > SEUIL_DESORDRE)
+    {
+        VecteurFrame<std::pair<Proie*, Proie*>> proiesRelogees{AllocateurFrame<std::pair<Proie*, Proie*>>(mArena)};
+        VecteurFrame<std::pair<Predateur*, Predateur*>> predateursReloges{AllocateurFrame<std::pair<Predateur*, Predateur*>>(mArena)};
+        RelogerSelonMorton(mProies, proiesRelogees);
+        RelogerSelonMorton(mPredateurs, predateursReloges);
+
+        /* Cibles et candidats à la reproduction : les morts du tick en sont déjà retirés */
+        for (auto* proie : mProies)
+        {
+            if (Predateur* menace = proie->GetMenaceDetectee())
+                proie->RemplacerMenace(AdresseRelogee(predateursReloges, menace));
+        }
+        for (auto* pred : mPredateurs)
+        {
+            if (Proie* cible = pred->GetProieDetectee())
+                pred->RemplacerProie(AdresseRelogee(proiesRelogees, cible));
+        }
+        for (auto*& proie : mProiesCandidates)
+            proie = AdresseRelogee(proiesRelogees, proie);
+        for (auto*& pred : mPredateursCandidats)
+            pred = AdresseRelogee(predateursReloges, pred);
+
+        for (const auto& relogee : proiesRelogees)
+            delete relogee.first;
+        for (const auto& relogee : predateursReloges)
+            delete relogee.first;
+        mNbTris++;
+
+        /* Les listes et les tuiles désignaient les anciennes adresses */
+        if (mVoisins)
+            mVoisins->Invalider();
+        if (mPool)
+            mDecomposition.Repartir(mProies, mPredateurs, mPlantes);
+
+        /* Mélangé bien avant la mesure : mesurer plus souvent */
+        if (desordre > 2.0f * SEUIL_DESORDRE)
+            mIntervalleTri = std::max(1, mIntervalleTri / 2);
+    }
+    else if (desordre < 0.5f * SEUIL_DESORDRE)
+        mIntervalleTri = std::min(INTERVALLE_TRI_MAX, mIntervalleTri * 2);
+    mTicksAvantTri = mIntervalleTri;
+}
+
+/**
+ * @brief Crée des animaux et plantes aléatoires dans la bande possédée
+ */
+void Ecosysteme::Peupler(int nbreProies, int nbrePredateurs, int nbrePlantes)
+{
+    const float MARGE = 35.0f;  /* Marge indisponible  representant les bords */
+    Traceur::Debut("Peupler");
+    ZoneMemoire zone(MEMOIRE_POPULATION);
+
+    /* Créer proies et prédateurs */
+    const size_t premiereProie = mProies.size();
+    const size_t premierPredateur = mPredateurs.size();
+    mRepartition.Preparer(mLargeur, mHauteur, mBandeX0, 0.0f, mBandeX1, mHauteur);
+    CreerParTranches(mProies, nbreProies, mTaches);
+    CreerParTranches(mPredateurs, nbrePredateurs, mTaches);
+
+    /* Créer plantes */
+    mRepartition.Preparer(mLargeur, mHauteur, std::max(MARGE, mBandeX0), MARGE,
+                          std::min(mLargeur - MARGE, mBandeX1), mHauteur - MARGE);
+    {
+        ZoneMemoire zonePlantes(MEMOIRE_PLANTES);
+        CreerParTranches(mPlantes, nbrePlantes, mTaches);
+    }
+
+    /* La roue n'est pas partagée entre threads : armement en série */
+    for (size_t i = premiereProie; i < mProies.size(); i++)
+        Accueillir(mProies[i]);
+    for (size_t i = premierPredateur; i < mPredateurs.size(); i++)
+        Accueillir(mPredateurs[i]);
+
+    /* Flux de l'errance : séquentielle et par tuile, repartis de la graine à chaque peuplement */
+    mGraineAlea = TirerGraine();
+    mAlea = GenerateurAleatoire(mGraineAlea);
+    if (mPool)
+    {
+        mDecomposition.Repartir(mProies, mPredateurs, mPlantes);
+        mDecomposition.Semer(mGraineAlea);
+    }
+
+    ReconstruireGrilles();
+    Traceur::Fin();
+}
+
+/**
+ * @brief Libère les entités en ordre inverse, vide sans rendre la capacité, repeuple
+ */
+bool Ecosysteme::Reinitialiser(int nbreProies, int nbrePredateurs, int nbrePlantes, unsigned int graine)
+{
+    /* Les fantômes et les animaux échangés dépendent des bandes voisines, relancées à part */
+    if (mFantomesProies || mBandeX0 > 0.0f || mBandeX1 < mLargeur)
+        return false;
+
+    Traceur::Debut("Reinitialiser");
+    ZoneMemoire zone(MEMOIRE_POPULATION);
+
+    /* Une réserve rend d'abord la dernière place libérée : la première entité
+       de chaque liste est libérée en dernier pour être recréée en premier */
+    for (auto* mort : mMortsEnAttente)
+        delete mort;
+    for (size_t i = mProies.size(); i-- > 0;)
+        delete mProies[i];
+    for (size_t i = mPredateurs.size(); i-- > 0;)
+        delete mPredateurs[i];
+    for (size_t i = mPlantes.size(); i-- > 0;)
+        delete mPlantes[i];
+    mMortsEnAttente.clear();
+    mProies.clear();
+    mPredateurs.clear();
+    mPlantes.clear();
+    mNbPlantesConsommees = 0;
+    mProiesCandidates.clear();
+    mPredateursCandidats.clear();
+
+    /* Temps de la roue remis à zéro : les échéances tombent aux mêmes ticks que dans un écosystème neuf */
+    mRoue.Reinitialiser();
+    mAnnexes.Vider();
+    mRoue.Armer(mMinuterieRepousse, INTERVALLE_CREATION_PLANTE, MINUTERIE_REPOUSSE, nullptr);
+
+    /* Ces index désignaient les entités libérées : vidés sans les lire */
+    if (mCollisions)
+        mCollisions->Vider();
+    if (mVoisins)
+        mVoisins->Invalider();
+    if (mSommeil)
+        mSommeil->Vider();
+    if (mChamp)
+        mChamp->Vider();
+    if (mCarteNourriture)
+        mCarteNourriture->Vider();
+    if (mPool)
+        mDecomposition.Reinitialiser();
+    mIntervalleTri = 1;
+    mTicksAvantTri = 1;
+    mNbTris = 0;
+
+    mNbreProies = nbreProies;
+    mNbrePredateurs = nbrePredateurs;
+    mNbrePlantes = nbrePlantes;
+    srand(graine);
+    Peupler(nbreProies, nbrePredateurs, nbrePlantes);
+
+    /* Remplis dans l'ordre de leur activation à la fabrication : les tirages de rand() suivent */
+    if (mSommeil)
+        RemplirSommeil();
+    if (mChamp)
+    {
+        ZoneMemoire zonePlantes(MEMOIRE_PLANTES);
+        SemerChamp();
+    }
+    if (mCarteNourriture)
+    {
+        ZoneMemoire zonePlantes(MEMOIRE_PLANTES);
+        for (auto* plante : mPlantes)
+            mCarteNourriture->AjouterPlante(plante);
+    }
+    if (mEspeces)
+        mEspeces->Reinitialiser();
+
+    if (mBudget)
+    {
+        mBudget->Reinitialiser();
+        mBudget->Mesurer(GetNombreAnimaux(), GetOctetsEntites());
+    }
+    Traceur::Fin();
+    return true;
+}
+
+/**
+ * @brief Recalcule plafond et repousse des plantes pour la surface de la bande
+ */
+void Ecosysteme::AjusterVegetation()
+{
+    /* La végétation garde la même densité quelle que soit la taille du monde */
+    float surface = (mBandeX1 - mBandeX0) * mHauteur;
+    float facteurSurface = std::max(1.0f, surface / SURFACE_REFERENCE);
+    mMaxPlantes = static_cast<int>(MAX_PLANTES * facteurSurface);
+    mPlantesParRepousse = static_cast<int>(facteurSurface);
+}
+
+/**
+ * @brief Restreint l'écosystème à une bande verticale du monde
+ */
+void Ecosysteme::DefinirBande(float x0, float x1)
+{
+    mBandeX0 = std::max(0.0f, x0);
+    mBandeX1 = std::min(mLargeur, x1);
+    AjusterVegetation();
+}
+
+/**
+ * @brief Ajoute une proie venue d'ailleurs
+ */
+void Ecosysteme::AjouterProie(const EtatAnimal& etat)
+{
+    Proie* proie = new Proie(etat.x, etat.y);
+    proie->AppliquerEtat(etat);
+    mProies.push_back(proie);
+    Accueillir(proie);
+    if (mPool)
+        mDecomposition.AjouterProie(proie);
+}
+
+/**
+ * @brief Ajoute un prédateur venu d'ailleurs
+ */
+void Ecosysteme::AjouterPredateur(const EtatAnimal& etat)
+{
+    Predateur* pred = new Predateur(etat.x, etat.y);
+    pred->AppliquerEtat(etat);
+    mPredateurs.push_back(pred);
+    Accueillir(pred);
+    if (mPool)
+        mDecomposition.AjouterPredateur(pred);
+}
+
+/**
+ * @brief Retire les animaux vivants sortis de la bande (compactage en place)
+ */
+void Ecosysteme::ExtraireHorsBande(std::vector<Proie*>& proies, std::vector<Predateur*>& predateurs)
+{
+    auto horsBande = [this](const Animal* animal) {
+        return animal->EstVivant() && (animal->GetX() < mBandeX0 || animal->GetX() >= mBandeX1);
+    };
+
+    /* Les partants ne sont plus candidats et quittent la roue avec leur compteur */
+    mProiesCandidates.erase(std::remove_if(mProiesCandidates.begin(), mProiesCandidates.end(), horsBande),
+                            mProiesCandidates.end());
+    mPredateursCandidats.erase(std::remove_if(mPredateursCandidats.begin(), mPredateursCandidats.end(), horsBande),
+                               mPredateursCandidats.end());
+
+    size_t garde = 0;
+    for (auto* proie : mProies)
+    {
+        if (horsBande(proie))
+        {
+            proie->FigerReproduction(mMonde);
+            Congedier(proie);
+            proies.push_back(proie);
+        }
+        else
+            mProies[garde++] = proie;
+    }
+    mProies.resize(garde);
+
+    garde = 0;
+    for (auto* pred : mPredateurs)
+    {
+        if (horsBande(pred))
+        {
+            pred->FigerReproduction(mMonde);
+            Congedier(pred);
+            predateurs.push_back(pred);
+        }
+        else
+            mPredateurs[garde++] = pred;
+    }
+    mPredateurs.resize(garde);
+}
+
+/**
+ * @brief Définit les animaux voisins visibles mais non simulés ici
+ */
+void Ecosysteme::DefinirFantomes(const std::vector<Proie*>& proies, const std::vector<Predateur*>& predateurs)
+{
+    /* Un dormeur ne serait pas prévenu de l'arrivée d'un fantôme ; un fantôme
+       est recyclé d'un tick à l'autre et ne peut pas rester une cible */
+    ActiverSommeil(false);
+    ActiverSuivi(false);
+    ActiverCollisions(false);
+    ActiverListesVoisins(false);
+    ActiverTriSpatial(false);
+
+    mFantomesProies = &proies;
+    mFantomesPredateurs = &predateurs;
+}
+
+/**
+ * @brief Reporte la libération des morts au tick suivant
+ */
+void Ecosysteme::DiffererLiberation(bool active)
+{
+    mLiberationDifferee = active;
+}
+
+/**
+ * @brief Destructeur libérant toute la mémoire
+ */
+Ecosysteme::~Ecosysteme()
+{
+    delete mEspeces;
+    delete mSommeil;
+    delete mCollisions;
+    delete mVoisins;
+    delete mBudget;
+    ActiverCarteNourriture(false);
+    delete mChamp;
+
+    for (auto* mort : mMortsEnAttente)
+        delete mort;
+
+    for (auto* proie : mProies)
+        delete proie;
+    
+    for (auto* pred : mPredateurs)
+        delete pred;
+    
+    for (auto* plante : mPlantes)
+        delete plante;
+}
+
+/**
+ * @brief Ajoute les espèces d'un registre
+ */
+void Ecosysteme::ChargerEspeces(const RegistreEspeces& registre, bool compact)
+{
+    ZoneMemoire zone(MEMOIRE_POPULATION);
+    delete mEspeces;
+    mEspeces = new PopulationGenerique(registre, mLargeur, mHauteur, TAILLE_CELLULE_GRILLE, compact);
+    mEspeces->DefinirBudget(mBudget);
+}
+
+/**
+ * @brief Accès aux espèces du registre
+ */
+const PopulationGenerique* Ecosysteme::GetEspeces() const
+{
+    return mEspeces;
+}
+
+/**
+ * @brief Tuiles dimensionnées pour nbThreads, réparties sur le système de tâches
+ */
+bool Ecosysteme::ActiverParallelisme(int nbThreads)
+{
+    mPool = nullptr;
+
+    /* Il faut au moins deux tuiles de TAILLE_MIN pour gagner quelque chose */
+    bool assezGrand = (mLargeur >= 2 * DecompositionSpatiale::TAILLE_MIN
+                       || mHauteur >= 2 * DecompositionSpatiale::TAILLE_MIN);
+    if (nbThreads <= 1 || !assezGrand || !mTaches || mTaches->GetNombreThreads() <= 1)
+        return false;
+
+    /* Les tuiles mettent tout le monde à jour : plus personne ne dort ; elles ont leurs propres listes */
+    ActiverSommeil(false);
+    ActiverListesVoisins(false);
+
+    mPool = mTaches;
+    mDecomposition.Configurer(mLargeur, mHauteur, std::min(nbThreads, mTaches->GetNombreThreads()), mPool, &mArena);
+    mDecomposition.Repartir(mProies, mPredateurs, mPlantes);
+    mDecomposition.Semer(mGraineAlea);
+    return true;
+}
+
+/**
+ * @brief Suit tous les animaux et plantes, ou réveille tout le monde
+ */
+bool Ecosysteme::ActiverSommeil(bool actif)
+{
+    if (!actif)
+    {
+        if (mSommeil)
+            mSommeil->ToutReveiller();
+        delete mSommeil;
+        mSommeil = nullptr;
+        return true;
+    }
+
+    if (mPool || mFantomesProies || mChamp || mCollisions || mVoisins || mCarteNourriture || mTriSpatial)
+        return false;
+    if (mSommeil)
+        return true;
+
+    mSommeil = new PlanificateurSommeil(mMonde);
+    RemplirSommeil();
+    return true;
+}
+
+/**
+ * @brief Tout le monde commence éveillé
+ */
+void Ecosysteme::RemplirSommeil()
+{
+    for (auto* proie : mProies)
+        mSommeil->Suivre(proie);
+    for (auto* pred : mPredateurs)
+        mSommeil->Suivre(pred);
+    for (auto* plante : mPlantesDisponibles)
+        mSommeil->AjouterPlante(plante);
+}
+
+/**
+ * @brief Propage le mode suivi à tous les animaux
+ */
+bool Ecosysteme::ActiverSuivi(bool actif)
+{
+    if (actif && mFantomesProies)
+        return false;
+
+    mSuivi = actif;
+    mAnnexes.ActiverSuivi(actif);
+    return true;
+}
+
+/**
+ * @brief Suit tous les animaux dans le détecteur, ou le supprime
+ */
+bool Ecosysteme::ActiverCollisions(bool actif)
+{
+    if (!actif)
+    {
+        delete mCollisions;
+        mCollisions = nullptr;
+        return true;
+    }
+
+    /* Un écart pousserait un dormeur hors de sa trajectoire, ou un animal hors de sa bande */
+    if (mSommeil || mFantomesProies || mBandeX0 > 0.0f || mBandeX1 < mLargeur)
+        return false;
+    if (mCollisions)
+        return true;
+
+    mCollisions = new DetecteurCollisions();
+    for (auto* proie : mProies)
+        mCollisions->Suivre(proie, PolitiqueEspece<Proie>::TAILLE_SPRITE, true);
+    for (auto* pred : mPredateurs)
+        mCollisions->Suivre(pred, PolitiqueEspece<Predateur>::TAILLE_SPRITE, false);
+    return true;
+}
+
+/**
+ * @brief Crée les listes (construites au premier tick), ou les supprime
+ */
+bool Ecosysteme::ActiverListesVoisins(bool actif)
+{
+    if (!actif)
+    {
+        delete mVoisins;
+        mVoisins = nullptr;
+        return true;
+    }
+
+    /* Un animal parti dans une autre bande resterait dans les listes */
+    if (mPool || mSommeil || mFantomesProies || mBandeX0 > 0.0f || mBandeX1 < mLargeur)
+        return false;
+    if (!mVoisins)
+        mVoisins = new ListesVoisins(mLargeur, mHauteur);
+    return true;
+}
+
+/**
+ * @brief Indexe les plantes disponibles et la partage avec les proies, ou la supprime
+ */
+bool Ecosysteme::ActiverCarteNourriture(bool actif)
+{
+    if (!actif)
+    {
+        if (mCarteNourriture)
+        {
+            delete mCarteNourriture;
+            mCarteNourriture = nullptr;
+            mMonde.carte = nullptr;
+        }
+        return true;
+    }
+
+    /* Sans plantes, rien à indexer ; le dormeur se réveille sur une recherche complète */
+    if (mChamp || mSommeil)
+        return false;
+    if (mCarteNourriture)
+        return true;
+
+    ZoneMemoire zone(MEMOIRE_PLANTES);
+    mCarteNourriture = new CarteNourriture(mLargeur, mHauteur, PolitiqueEspece<Proie>::RAYON_DETECTION_PLANTE);
+    for (auto* plante : mPlantes)
+        mCarteNourriture->AjouterPlante(plante);
+    mMonde.carte = mCarteNourriture;
+    return true;
+}
+
+/**
+ * @brief Première mesure au prochain tick, délai et compteur remis à zéro
+ */
+bool Ecosysteme::ActiverTriSpatial(bool actif)
+{
+    /* Les dormeurs gardent les adresses ; un fantôme désigne un animal d'ici */
+    if (actif && (mSommeil || mFantomesProies || mBandeX0 > 0.0f || mBandeX1 < mLargeur))
+        return false;
+
+    mTriSpatial = actif;
+    mIntervalleTri = 1;
+    mTicksAvantTri = 1;
+    mNbTris = 0;
+    return true;
+}
+
+/**
+ * @brief Convertit les plantes disponibles en biomasse, ou rend la main à la repousse des plantes
+ */
+bool Ecosysteme::ActiverChampVegetation(bool actif)
+{
+    if (!actif)
+    {
+        if (mChamp)
+        {
+            delete mChamp;
+            mChamp = nullptr;
+            mMonde.champ = nullptr;
+        }
+        return true;
+    }
+
+    if (mEspeces || mFantomesProies || mBandeX0 > 0.0f || mBandeX1 < mLargeur)
+        return false;
+    if (mChamp)
+        return true;
+
+    /* Le dormeur attend une plante qui n'existera plus, les listes et la carte la désignent */
+    ActiverSommeil(false);
+    ActiverCarteNourriture(false);
+    if (mVoisins)
+        mVoisins->Invalider();
+
+    ZoneMemoire zone(MEMOIRE_PLANTES);
+    mChamp = new ChampVegetation(mLargeur, mHauteur);
+    SemerChamp();
+
+    mMonde.champ = mChamp;
+    return true;
+}
+
+/**
+ * @brief La disposition initiale des plantes devient celle de la biomasse
+ */
+void Ecosysteme::SemerChamp()
+{
+    CalibrerChamp();
+    for (auto* plante : mPlantes)
+    {
+        if (plante->EstDisponible())
+            mChamp->Deposer(plante->GetX(), plante->GetY(), 1.0f);
+        delete plante;
+    }
+    mPlantes.clear();
+    mNbPlantesConsommees = 0;
+    if (mPool)
+        mDecomposition.Repartir(mProies, mPredateurs, mPlantes);
+    ReconstruireGrilles();
+}
+
+/**
+ * @brief Plafond de plantes (ou peuplement initial s'il le dépasse) pour capacité,
+ *        une repousse par délai pour production maximale
+ */
+void Ecosysteme::CalibrerChamp()
+{
+    /* Les plantes initiales en surnombre ne disparaissent pas d'elles-mêmes : la capacité les garde */
+    mChamp->Calibrer(static_cast<float>(std::max(mMaxPlantes, mNbrePlantes)), GetRepoussePlantes());
+}
+
+/**
+ * @brief Broutage en série (deux proies peuvent partager une cellule), puis pas du champ
+ */
+void Ecosysteme::AvancerChamp(float deltaTime)
+{
+    for (auto* proie : mProies)
+    {
+        if (proie->EstVivant())
+            proie->Brouter(*mChamp, deltaTime);
+    }
+    mChamp->Avancer(deltaTime, mTaches);
+}
+
+/**
+ * @brief Accès au champ de biomasse
+ */
+const ChampVegetation* Ecosysteme::GetChampVegetation() const
+{
+    return mChamp;
+}
+
+/**
+ * @brief Compte les animaux endormis
+ */
+int Ecosysteme::GetNombreEndormis() const
+{
+    return mSommeil ? mSommeil->GetNombreEndormis() : 0;
+}
+
+/**
+ * @brief Collisions du dernier tick
+ */
+const std::vector<Event>& Ecosysteme::GetEvenementsCollision() const
+{
+    static const std::vector<Event> aucune;
+    return mCollisions ? mCollisions->GetEvenements() : aucune;
+}
+
+/**
+ * @brief Listes de voisins, nullptr si désactivées
+ */
+const ListesVoisins* Ecosysteme::GetListesVoisins() const
+{
+    return mVoisins;
+}
+
+/**
+ * @brief Accès à la carte de la nourriture
+ */
+const CarteNourriture* Ecosysteme::GetCarteNourriture() const
+{
+    return mCarteNourriture;
+}
+
+/**
+ * @brief Remplace le budget, partagé avec les espèces du registre
+ */
+void Ecosysteme::DefinirBudget(size_t maxAnimaux, size_t maxOctets, PolitiqueBudget politique)
+{
+    delete mBudget;
+    mBudget = nullptr;
+    if (maxAnimaux > 0 || maxOctets > 0)
+    {
+        mBudget = new BudgetPopulation(maxAnimaux, maxOctets, politique);
+        mBudget->Mesurer(GetNombreAnimaux(), GetOctetsEntites());
+    }
+    if (mEspeces)
+        mEspeces->DefinirBudget(mBudget);
+}
+
+/**
+ * @brief Accès au budget
+ */
+const BudgetPopulation* Ecosysteme::GetBudget() const
+{
+    return mBudget;
+}
+
+/**
+ * @brief Animaux des deux listes et individus de chaque espèce du registre
+ */
+size_t Ecosysteme::GetNombreAnimaux() const
+{
+    size_t animaux = mProies.size() + mPredateurs.size();
+    if (mEspeces)
+    {
+        for (int e = 0; e < mEspeces->GetRegistre().GetNombreEspeces(); e++)
+            animaux += mEspeces->GetNombre(e);
+    }
+    return animaux;
+}
+
+/**
+ * @brief Objets, pointeurs et annexes des animaux ; individus du registre à leur taille d'état
+ */
+size_t Ecosysteme::GetOctetsEntites() const
+{
+    size_t octets = mProies.size() * (sizeof(Proie) + sizeof(Proie*) + AnnexesAnimaux::OCTETS_PAR_RANG)
+                  + mPredateurs.size() * (sizeof(Predateur) + sizeof(Predateur*) + AnnexesAnimaux::OCTETS_PAR_RANG)
+                  + mPlantes.size() * (sizeof(Plante) + sizeof(Plante*));
+    if (mEspeces)
+    {
+        for (int e = 0; e < mEspeces->GetRegistre().GetNombreEspeces(); e++)
+            octets += mEspeces->GetNombre(e) * mEspeces->GetOctetsParIndividu();
+    }
+    return octets;
+}
+
+/**
+ * @brief Accès au nombre de tris du stockage
+ */
+int Ecosysteme::GetNombreTris() const
+{
+    return mNbTris;
+}
+
+/**
+ * @brief Accès au délai entre deux mesures du désordre
+ */
+int Ecosysteme::GetIntervalleTri() const
+{
+    return mIntervalleTri;
+}
+
+/**
+ * @brief Retourne vecteur des proies
+ */
+const std::vector<Proie*>& Ecosysteme::GetProies() const
+{
+    return mProies;
+}
+
+/**
+ * @brief Retourne vecteur des prédateurs
+ */
+const std::vector<Predateur*>& Ecosysteme::GetPredateurs() const
+{
+    return mPredateurs;
+}
+
+/**
+ * @brief Retourne vecteur des plantes
+ */
+const std::vector<Plante*>& Ecosysteme::GetPlantes() const
+{
+    return mPlantes;
+}
+
+/**
+ * @brief Récupère la largeur du monde
+ */
+float Ecosysteme::GetLargeur() const
+{
+    return mLargeur;
+}
+
+/**
+ * @brief Récupère la hauteur du monde
+ */
+float Ecosysteme::GetHauteur() const
+{
+    return mHauteur;
+}
+
+/**
+ * @brief Accès au contexte prêté aux animaux
+ */
+const ContexteMonde& Ecosysteme::GetMonde() const
+{
+    return mMonde;
+}
+
+/**
+ * @brief Position rattrapée par le planificateur si le sommeil est actif
+ */
+void Ecosysteme::PositionAffichee(const Animal* animal, float& x, float& y) const
+{
+    if (mSommeil)
+        mSommeil->PositionEndormie(animal, x, y);
+    else
+    {
+        x = animal->GetX();
+        y = animal->GetY();
+    }
+}
+
+/**
+ * @brief Indexe des animaux à leur position rattrapée (dormeurs compris)
+ */
+template<typename T>
+static void ConstruireGrilleEndormis(GrilleSpatiale& grille, const PlanificateurSommeil& sommeil,
+                                     const std::vector<T*>& animaux, std::vector<float>& xs, std::vector<float>& ys)
+{
+    xs.resize(animaux.size());
+    ys.resize(animaux.size());
+    for (size_t i = 0; i < animaux.size(); i++)
+        sommeil.PositionEndormie(animaux[i], xs[i], ys[i]);
+    grille.Construire(xs, ys);
+}
+
+/**
+ * @brief Reconstruit les grilles spatiales à partir des positions actuelles
+ */
+void Ecosysteme::ReconstruireGrilles()
+{
+    if (mSommeil)
+    {
+        /* Les dormeurs sont indexés là où leur trajectoire les a menés */
+        ConstruireGrilleEndormis(mGrilleProies, *mSommeil, mProies, mPositionsX, mPositionsY);
+        ConstruireGrilleEndormis(mGrillePredateurs, *mSommeil, mPredateurs, mPositionsX, mPositionsY);
+    }
+    else
+    {
+        mGrilleProies.Construire(mProies);
+        mGrillePredateurs.Construire(mPredateurs);
+    }
+
+    /* Les plantes consommées restent dans mPlantes : on ne les indexe pas */
+    mPlantesDisponibles.clear();
+    for (auto* plante : mPlantes)
+    {
+        if (plante->EstDisponible())
+            mPlantesDisponibles.push_back(plante);
+    }
+    mGrillePlantes.Construire(mPlantesDisponibles);
+}
+
+/**
+ * @brief Récupère les entités des cellules recouvrant la zone
+ */
+void Ecosysteme::RequeteZone(float x0, float y0, float x1, float y1,
+                             std::vector<Proie*>& proies,
+                             std::vector<Predateur*>& predateurs,
+                             std::vector<Plante*>& plantes)
+{
+    proies.clear();
+    predateurs.clear();
+    plantes.clear();
+
+    mIndicesRequete.clear();
+    mGrilleProies.RequeteRectangle(x0, y0, x1, y1, mIndicesRequete);
+    for (uint32_t i : mIndicesRequete)
+        proies.push_back(mProies[i]);
+
+    mIndicesRequete.clear();
+    mGrillePredateurs.RequeteRectangle(x0, y0, x1, y1, mIndicesRequete);
+    for (uint32_t i : mIndicesRequete)
+        predateurs.push_back(mPredateurs[i]);
+
+    mIndicesRequete.clear();
+    mGrillePlantes.RequeteRectangle(x0, y0, x1, y1, mIndicesRequete);
+    for (uint32_t i : mIndicesRequete)
+        plantes.push_back(mPlantesDisponibles[i]);
+}
+
+/**
+ * @brief Compte les animaux d'une zone à partir des grilles
+ */
+int Ecosysteme::CompterAnimauxZone(float x0, float y0, float x1, float y1) const
+{
+    int total = mGrilleProies.CompterRectangle(x0, y0, x1, y1)
+              + mGrillePredateurs.CompterRectangle(x0, y0, x1, y1);
+    if (mEspeces)
+        total += mEspeces->CompterRectangle(x0, y0, x1, y1);
+    return total;
+}
+
+/**
+ * @brief Accès à l'index spatial des proies
+ */
+const GrilleSpatiale& Ecosysteme::GetGrilleProies() const
+{
+    return mGrilleProies;
+}
+
+/**
+ * @brief Accès à l'index spatial des prédateurs
+ */
+const GrilleSpatiale& Ecosysteme::GetGrillePredateurs() const
+{
+    return mGrillePredateurs;
+}
+
+/**
+ * @brief Accès à l'index spatial des plantes disponibles
+ */
+const GrilleSpatiale& Ecosysteme::GetGrillePlantes() const
+{
+    return mGrillePlantes;
+}
+
+/**
+ * @brief Compte proies vivantes
+ */
+int Ecosysteme::GetNombreProies() const
+{
+    return mProies.size();
+}
+
+/**
+ * @brief Compte prédateurs vivants
+ */
+int Ecosysteme::GetNombrePredateurs() const
+{
+    return mPredateurs.size();
+}
+
+/**
+ * @brief Compte le temps qui separe l'apparission de 2 plantes
+ */
+int Ecosysteme::GetDelaiPlantes() const
+{
+    return INTERVALLE_CREATION_PLANTE;
+}
+
+/**
+ * @brief Plafond de plantes de la zone simulée
+ */
+int Ecosysteme::GetMaxPlantes() const
+{
+    return mMaxPlantes;
+}
+
+/**
+ * @brief Plantes ajoutées par échéance, rapportées au délai entre échéances
+ */
+float Ecosysteme::GetRepoussePlantes() const
+{
+    return mPlantesParRepousse / std::max(0.1f, INTERVALLE_CREATION_PLANTE);
+}
+
+/**
+ * @brief Compte plantes disponibles
+ */
+int Ecosysteme::GetNombrePlantes() const
+{
+    if (mChamp)
+        return static_cast<int>(mChamp->GetBiomasseTotale());
+
+    int count = 0;
+    for (auto* plante : mPlantes)
+    {
+        if (plante->EstDisponible())
+            count++;
+    }
+    return count;
+}
+
+void Ecosysteme::SupprimerMorts() {
+    /* Les minuteries des morts se désarment quand leur rang est rendu ; reste à oublier les candidats */
+    auto mort = [](const Animal* animal) { return !animal->EstVivant(); };
+    mProiesCandidates.erase(std::remove_if(mProiesCandidates.begin(), mProiesCandidates.end(), mort),
+                            mProiesCandidates.end());
+    mPredateursCandidats.erase(std::remove_if(mPredateursCandidats.begin(), mPredateursCandidats.end(), mort),
+                               mPredateursCandidats.end());
+
+    /* Les listes de voisins survivent au tick : aucune ne doit garder un mort libéré */
+    if (mVoisins)
+        mVoisins->OublierMorts();
+
+    /* Même chose pour le détecteur : un emplacement libéré resservira à un nouveau-né */
+    if (mCollisions)
+        mCollisions->OublierMorts();
+
+    /* Les cibles suivies survivent au tick : aucune ne doit viser un mort libéré */
+    if (mSuivi)
+    {
+        for (auto* pred : mPredateurs)
+            pred->OublierCibleMorte(mMonde);
+        for (auto* proie : mProies)
+            proie->OublierCibleMorte(mMonde);
+    }
+
+    RetirerMorts(mPredateurs);
+    RetirerMorts(mProies);
+}
+
+/**
+ * @brief Compactage stable par échanges : les morts finissent en queue, libérés ensuite
+ */
+template<typename T>
+void Ecosysteme::RetirerMorts(std::vector<T*>& animaux)
+{
+    size_t garde = 0;
+    for (size_t i = 0; i < animaux.size(); i++)
+    {
+        if (animaux[i]->EstVivant())
+            std::swap(animaux[garde++], animaux[i]);
+    }
+
+    /* Une hécatombe coûte une passe, et non un erase par mort */
+    for (size_t i = animaux.size(); i-- > garde;)
+    {
+        Congedier(animaux[i]);
+        if (mLiberationDifferee)
+            mMortsEnAttente.push_back(animaux[i]);
+        else
+            delete animaux[i];
+    }
+    animaux.resize(garde);
+}
+
+/**
+ * @brief Naissances d'une espèce parmi ses candidats, constantes de l'espèce intégrées à la boucle
+ * @param candidats Animaux mûrs de l'espèce (compactés : restent ceux qui retenteront au tick suivant)
+ * @param bebes Nouveaux-nés (ajoutés, dans l'arène du tick)
+ * @param roue Roue où réarmer les minuteries de reproduction
+ * @param monde Contexte de l'écosystème (minuteries rangées dans ses annexes)
+ * @param type Type d'échéance de l'espèce
+ * @param delaiVerification Délai avant de relire l'énergie d'un candidat affamé
+ */
+template<typename Espece>
+static void ReproduireLot(std::vector<Espece*>& candidats, VecteurFrame<Espece*>& bebes,
+                          RoueTemporisation& roue, const ContexteMonde& monde, int type,
+                          float delaiVerification, BudgetPopulation* budget)
+{
+    using Politique = PolitiqueEspece<Espece>;
+    AnnexesAnimaux& annexes = *monde.annexes;
+
+    size_t garde = 0;
+    for (auto* parent : candidats)
+    {
+        /* Un dormeur attend son réveil (prévu au plus tard à sa maturité) */
+        if (parent->EstEndormi())
+        {
+            candidats[garde++] = parent;
+            continue;
+        }
+
+        /* Affamé : l'énergie sera relue plus tard plutôt qu'à chaque tick */
+        if (!parent->template PeutSeReproduireSelon<Politique>(monde))
+        {
+            roue.Armer(annexes.GetMinuterie(parent->GetRang()), delaiVerification, type, parent);
+            continue;
+        }
+
+        if ((rand() % 100) > 75)
+        {
+            /* Budget plein : la naissance est reportée comme celle d'un affamé, rien n'est alloué */
+            if (budget && !budget->AutoriserNaissance(sizeof(Espece) + sizeof(Espece*) + AnnexesAnimaux::OCTETS_PAR_RANG))
+            {
+                roue.Armer(annexes.GetMinuterie(parent->GetRang()), delaiVerification, type, parent);
+                continue;
+            }
+            parent->PerdreEnergie(Politique::SEUIL_ENERGIE_REPRODUCTION);
+            parent->ReinitialiserReproduction(monde);
+            roue.Armer(annexes.GetMinuterie(parent->GetRang()), Politique::DELAI_REPRODUCTION, type, parent);
+            bebes.push_back(new Espece(parent->GetX(), parent->GetY()));
+        }
+        else
+            candidats[garde++] = parent;
+    }
+    candidats.resize(garde);
+}
+
+void Ecosysteme::Reproduction() {    
+    /* Seuls les animaux dont la minuterie de maturité a échu sont parcourus */
+    VecteurFrame<Predateur*> nouveauxPredateurs{AllocateurFrame<Predateur*>(mArena)};  // Liste temporaire
+    ReproduireLot(mPredateursCandidats, nouveauxPredateurs, mRoue, mMonde, MINUTERIE_PREDATEUR, DELAI_VERIFICATION, mBudget);
+    
+    // Ajouter tous les bébés APRÈS la boucle
+    for (auto* bebe : nouveauxPredateurs)
+    {
+        mPredateurs.push_back(bebe);
+        Accueillir(bebe);
+        if (mPool)
+            mDecomposition.AjouterPredateur(bebe);
+        if (mSommeil)
+            mSommeil->Suivre(bebe);
+    }
+
+    VecteurFrame<Proie*> nouvellesProies{AllocateurFrame<Proie*>(mArena)};  // Liste temporaire
+    ReproduireLot(mProiesCandidates, nouvellesProies, mRoue, mMonde, MINUTERIE_PROIE, DELAI_VERIFICATION, mBudget);
+    
+    // Ajouter tous les bébés APRÈS la boucle
+    for (auto* bebe : nouvellesProies)
+    {
+        mProies.push_back(bebe);
+        Accueillir(bebe);
+        if (mPool)
+            mDecomposition.AjouterProie(bebe);
+        if (mSommeil)
+            mSommeil->Suivre(bebe);
+    }
+}
+
+/**
+ * @brief Ajoute des plantes dans la bande, sous le plafond
+ */
+void Ecosysteme::FaireRepousser()
+{
+    const float MARGE = 30.0f;          /* Marge indisponible  representant les bords */
+    ZoneMemoire zone(MEMOIRE_PLANTES);
+    
+    /* Ajouter des plantes si sous le maximum */
+    for (int i = 0; i < mPlantesParRepousse && static_cast<int>(mPlantes.size()) < mMaxPlantes; i++)
+    {
+        float x = AleatoireEntre(std::max(MARGE, mBandeX0), std::min(mLargeur - MARGE, mBandeX1));
+        float y = AleatoireEntre(MARGE, mHauteur - MARGE);
+        mPlantes.push_back(new Plante(x, y));
+        if (mPool)
+            mDecomposition.AjouterPlante(mPlantes.back());
+        if (mSommeil)
+            mSommeil->AjouterPlante(mPlantes.back());
+        if (mCarteNourriture)
+            mCarteNourriture->AjouterPlante(mPlantes.back());
+    }
+}
+
+/**
+ * @brief Candidat si assez d'énergie, sinon nouvelle vérification plus tard
+ * @param animal Animal dont la minuterie de maturité vient d'échoir
+ * @param candidats Candidats de l'espèce
+ * @param roue Roue où réarmer la vérification
+ * @param annexes Annexes où est rangée la minuterie de l'animal
+ * @param type Type d'échéance de l'espèce
+ * @param delaiVerification Délai avant de relire l'énergie
+ */
+template<typename Espece>
+static void Murir(Espece* animal, std::vector<Espece*>& candidats,
+                  RoueTemporisation& roue, AnnexesAnimaux& annexes, int type, float delaiVerification)
+{
+    using Politique = PolitiqueEspece<Espece>;
+
+    /* Mort pendant le tick : sa minuterie sera désarmée avec le rang rendu */
+    if (!animal->EstVivant())
+        return;
+
+    animal->AtteindreMaturite(Politique::DELAI_REPRODUCTION);
+    if (animal->GetEnergie() > Politique::SEUIL_ENERGIE_REPRODUCTION)
+        candidats.push_back(animal);
+    else
+        roue.Armer(annexes.GetMinuterie(animal->GetRang()), delaiVerification, type, animal);
+}
+
+/**
+ * @brief Traite les échéances du tick, dans l'ordre de la roue
+ */
+void Ecosysteme::TraiterEcheances()
+{
+    for (Minuterie* echue : mEchues)
+    {
+        switch (echue->type)
+        {
+            case MINUTERIE_REPOUSSE:
+                if (!mChamp)
+                    FaireRepousser();
+                mRoue.Armer(mMinuterieRepousse, INTERVALLE_CREATION_PLANTE, MINUTERIE_REPOUSSE, nullptr);
+                break;
+
+            case MINUTERIE_PROIE:
+                Murir(static_cast<Proie*>(echue->cible), mProiesCandidates,
+                      mRoue, mAnnexes, MINUTERIE_PROIE, DELAI_VERIFICATION);
+                break;
+
+            case MINUTERIE_PREDATEUR:
+                Murir(static_cast<Predateur*>(echue->cible), mPredateursCandidats,
+                      mRoue, mAnnexes, MINUTERIE_PREDATEUR, DELAI_VERIFICATION);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Met à jour tout l'écosystème pour un frame
+ * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
+ */
+void Ecosysteme::Update(float deltaTime)
+{
+    Traceur::Debut("Update");
+    ZoneMemoire zone(MEMOIRE_POPULATION);
+
+    /* Les tableaux temporaires du tick précédent ont tous disparu */
+    mArena.Reinitialiser();
+
+    /* Les morts du tick précédent ne sont plus référencés par personne */
+    for (auto* mort : mMortsEnAttente)
+        delete mort;
+    mMortsEnAttente.clear();
+
+    /* Occupation du début du tick ; chaque naissance acceptée s'y ajoutera */
+    if (mBudget)
+        mBudget->Mesurer(GetNombreAnimaux(), GetOctetsEntites());
+
+    Traceur::Debut("Comportement");
+    if (mPool)
+    {
+        /* Tuiles indépendantes réparties sur les threads */
+        mDecomposition.MettreAJour(deltaTime, mMonde);
+    }
+    else if (mSommeil)
+    {
+        /* Seuls les éveillés agissent ; aucun dormeur n'est à portée de quiconque */
+        mSommeil->Avancer(deltaTime);
+        const std::vector<Proie*>& proies = mSommeil->GetProiesEveillees();
+        const std::vector<Predateur*>& predateurs = mSommeil->GetPredateursEveilles();
+
+        MettreAJourLot(proies, proies, predateurs, mPlantes, deltaTime, mMonde);
+        MettreAJourLot(predateurs, proies, predateurs, mPlantes, deltaTime, mMonde);
+    }
+    else if (mVoisins)
+    {
+        /* Même ordre que la boucle normale, cibles cherchées dans les listes */
+        mVoisins->MettreAJour(mProies, mPredateurs, mPlantes, deltaTime, mMonde, mSuivi);
+    }
+    else
+    {
+        /* Les fantômes des bandes voisines sont vus, jamais déplacés */
+        const std::vector<Proie*>* proiesVues = &mProies;
+        const std::vector<Predateur*>* predateursVus = &mPredateurs;
+        if (mFantomesProies && (!mFantomesProies->empty() || !mFantomesPredateurs->empty()))
+        {
+            mProiesVues.assign(mProies.begin(), mProies.end());
+            mProiesVues.insert(mProiesVues.end(), mFantomesProies->begin(), mFantomesProies->end());
+            mPredateursVus.assign(mPredateurs.begin(), mPredateurs.end());
+            mPredateursVus.insert(mPredateursVus.end(), mFantomesPredateurs->begin(), mFantomesPredateurs->end());
+            proiesVues = &mProiesVues;
+            predateursVus = &mPredateursVus;
+        }
+
+        /* Comportement et déplacement, une boucle générée par espèce */
+        MettreAJourLot(mProies, *proiesVues, *predateursVus, mPlantes, deltaTime, mMonde);
+        MettreAJourLot(mPredateurs, *proiesVues, *predateursVus, mPlantes, deltaTime, mMonde);
+    }
+    Traceur::Fin();
+
+    /* Espèces du registre : plantes indexées au tick précédent */
+    if (mEspeces)
+    {
+        Traceur::Debut("Especes");
+        mEspeces->MettreAJour(deltaTime, mPlantesDisponibles, mGrillePlantes);
+        Traceur::Fin();
+    }
+
+    /* Végétation continue : broutage, repousse et diffusion */
+    if (mChamp)
+    {
+        Traceur::Debut("Vegetation");
+        AvancerChamp(deltaTime);
+        Traceur::Fin();
+    }
+
+    /* Échéances du tick : repousse des plantes, animaux devenus mûrs */
+    Traceur::Debut("Echeances");
+    mRoue.Avancer(deltaTime, mEchues);
+    TraiterEcheances();
+    Traceur::Fin();
+
+    /* Détecter et compter nouvelles plantes consommées */
+    Traceur::Debut("PlantesConsommees");
+    {
+        ZoneMemoire zonePlantes(MEMOIRE_PLANTES);
+        for (auto* plante : mPlantes)
+        {
+            /* Chaque plante porte sa marque : une seule lecture par plante et par tick */
+            if (!plante->EstDisponible() && !plante->EstComptee())
+            {
+                plante->MarquerComptee();
+                mNbPlantesConsommees++;
+                if (mSommeil)
+                    mSommeil->RetirerPlante(plante);
+                if (mCarteNourriture)
+                    mCarteNourriture->RetirerPlante(plante);
+            }
+        }
+    }
+    Traceur::Fin();
+
+    /* Sprites écartés avant que les tuiles ne trient leurs migrants et que les morts ne soient libérés */
+    if (mCollisions)
+    {
+        Traceur::Debut("Collisions");
+        mCollisions->Resoudre(mMonde);
+        Traceur::Fin();
+    }
+
+    /* Les tuiles oublient leurs morts et échangent leurs migrants avant la libération */
+    if (mPool)
+    {
+        Traceur::Debut("Migration");
+        mDecomposition.Migrer();
+        Traceur::Fin();
+    }
+
+    /* Morts oubliés, changements de cellule signalés, animaux calmes endormis */
+    if (mSommeil)
+    {
+        Traceur::Debut("Sommeil");
+        mSommeil->Actualiser();
+        Traceur::Fin();
+    }
+
+    /* Supprimer les animaux morts */
+    Traceur::Debut("SupprimerMorts");
+    SupprimerMorts();
+    Traceur::Fin();
+
+    /* Gérer les reproductions */
+    Traceur::Debut("Reproduction");
+    Reproduction();
+    Traceur::Fin();
+
+    if (mPool)
+    {
+        Traceur::Debut("Reequilibrage");
+        mDecomposition.Reequilibrer(mProies, mPredateurs, mPlantes);
+        Traceur::Fin();
+    }
+
+    /* Ranger le stockage avant que les grilles n'en indexent les rangs */
+    if (mTriSpatial)
+    {
+        Traceur::Debut("TriSpatial");
+        TrierSiDesordonne();
+        Traceur::Fin();
+    }
+
+    /* Indexer les positions finales pour les requêtes de la frame */
+    Traceur::Debut("Grilles");
+    ReconstruireGrilles();
+    Traceur::Fin();
+
+    Traceur::Fin();
+}
+
+/**
+ * @brief Compte le nombre total de plantes consommées
+ * @return Nombre de plantes consommées depuis le début
+ */
+int Ecosysteme::GetTotalPlantesConsommees() const {
+    if (mChamp)
+        return static_cast<int>(mChamp->GetConsommee());
+    return mNbPlantesConsommees;
+}
+
+/**
+ * @brief Actualise le temps qui sépare l'apparission de 2 plantes
+ * @param Delai de réaparission
+ */
+void Ecosysteme::SetDelaiPlantes(float delai) {
+    if (delai == INTERVALLE_CREATION_PLANTE)
+        return;
+
+    /* La repousse en cours garde le temps déjà écoulé */
+    float ecoule = INTERVALLE_CREATION_PLANTE - mRoue.SecondesRestantes(mMinuterieRepousse);
+    INTERVALLE_CREATION_PLANTE = delai;
+    mRoue.Armer(mMinuterieRepousse, std::max(0.0f, delai - ecoule), MINUTERIE_REPOUSSE, nullptr);
+    if (mChamp)
+        CalibrerChamp();
+}
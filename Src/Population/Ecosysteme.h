@@ -1,125 +1,663 @@
-/**
- * @file Ecosysteme.h
- * @brief Gestionnaire central de l'écosystème
- */
-
-#ifndef ECOSYSTEME_H
-#define ECOSYSTEME_H
-
-#include <vector>
-
-class Proie;
-class Predateur;
-class Plante;
-
-/**
- * @class Ecosysteme
- * @brief Orchestre tous les éléments vivants de la simulation
- */
-class Ecosysteme
-{
-private:
-    std::vector<Proie*> mProies;                /**< Liste des proies */
-    std::vector<Predateur*> mPredateurs;        /**< Liste des prédateurs */
-    std::vector<Plante*> mPlantes;              /**< Liste des plantes */
-    std::vector<Plante*> mPlantesConsommees;    /**< Liste des plantes déjà consommées */
-
-    float mTempsDepuisCreationPlante;                          /**< Timer pour créer nouvelles plantes */
-    float INTERVALLE_CREATION_PLANTE = 5.0f;  /**< Délai entre créations (secondes) */
-    static constexpr int MAX_PLANTES = 60;                     /**< Nombre maximum de plantes */
-    
-    float mLargeur;                 /**< Largeur du monde */
-    float mHauteur;                 /**< Hauteur du monde */
-    int mNbreProies;                /**< Nombre actuel de proies */
-    int mNbrePredateurs;            /**< Nombre actuel de prédateurs */
-    int mNbrePlantes;               /**< Nombre actuel de plantes */
-    
-    /**
-     * @brief Supprime les animaux morts
-     */
-    void SupprimerMorts();
-    
-    /**
-     * @brief Gère les reproductions
-     */
-    void Reproduction();
-    
-public:
-    /**
-     * @brief Constructeur créant populations initiales
-     * @param nbreProies Nombre de proies à créer
-     * @param nbrePredateurs Nombre de prédateurs à créer
-     * @param nbrePlantes Nombre de plantes à créer
-     * @param largeur Largeur du monde
-     * @param hauteur Hauteur du monde
-     */
-    Ecosysteme(int nbreProies, int nbrePredateurs, int nbrePlantes,
-               float largeur, float hauteur);
-    
-    /**
-     * @brief Destructeur libérant mémoire
-     */
-    ~Ecosysteme();
-    
-    /**
-     * @brief Met à jour tout l'écosystème
-     * @param deltaTime Temps écoulé (secondes)
-     */
-    void Update(float deltaTime);
-    
-    /**
-     * @brief Accès lecture seule aux proies
-     * @return Vecteur des proies
-     */
-    const std::vector<Proie*>& GetProies() const;
-    
-    /**
-     * @brief Accès lecture seule aux prédateurs
-     * @return Vecteur des prédateurs
-     */
-    const std::vector<Predateur*>& GetPredateurs() const;
-    
-    /**
-     * @brief Accès lecture seule aux plantes
-     * @return Vecteur des plantes
-     */
-    const std::vector<Plante*>& GetPlantes() const;
-    
-    /**
-     * @brief Compte les proies vivantes
-     * @return Nombre de proies
-     */
-    int GetNombreProies() const;
-    
-    /**
-     * @brief Compte les prédateurs vivants
-     * @return Nombre de prédateurs
-     */
-    int GetNombrePredateurs() const;
-    
-    /**
-     * @brief Compte les plantes disponibles
-     * @return Nombre de plantes
-     */
-    int GetNombrePlantes() const;
-
-    /**
-     * @brief Compte les plantes consommées depuis le debut du jeu
-     * @return Nombre de plantes consommées
-     */
-    int GetTotalPlantesConsommees() const;
-
-    /**
-     * @brief Compte le temps qui separe l'apparission de 2 plantes
-     * @return Intervalle d'apparission des plantes
-     */
-    int GetDelaiPlantes() const;
-
-    /**
-     * @brief Actualise le temps qui sépare l'apparission de 2 plantes
-     * @param Delai de réaparission
-     */
-    void SetDelaiPlantes(float delai);
-};
-
+/**
+ * @file Ecosysteme.h
+ * @brief Gestionnaire central de l'écosystème
+ */
+
+#ifndef ECOSYSTEME_H
+#define ECOSYSTEME_H
+
+#include "Animal.h"
+#include "AnnexesAnimaux.h"
+#include "../Core/ArenaFrame.h"
+#include "../Core/RoueTemporisation.h"
+#include "../Events/EventsTypes.h"
+#include "BudgetPopulation.h"
+#include "DecompositionSpatiale.h"
+#include "GrilleSpatiale.h"
+#include "RepartitionInitiale.h"
+#include <vector>
+
+class Proie;
+class Predateur;
+class Plante;
+class CarteNourriture;
+class ChampVegetation;
+class DetecteurCollisions;
+class ListesVoisins;
+class PlanificateurSommeil;
+class PoolThreads;
+class PopulationGenerique;
+class RegistreEspeces;
+
+/**
+ * @class Ecosysteme
+ * @brief Orchestre tous les éléments vivants de la simulation
+ */
+class Ecosysteme
+{
+private:
+    std::vector<Proie*> mProies;                /**< Liste des proies */
+    std::vector<Predateur*> mPredateurs;        /**< Liste des prédateurs */
+    std::vector<Plante*> mPlantes;              /**< Liste des plantes */
+    int mNbPlantesConsommees;                   /**< Plantes consommées depuis le début */
+
+    float INTERVALLE_CREATION_PLANTE = 5.0f;  /**< Délai entre créations (secondes) */
+    static constexpr float DELAI_VERIFICATION = 1.0f;          /**< Relecture de l'énergie d'un animal mûr trop faible (secondes) */
+    static constexpr int MAX_PLANTES = 60;                     /**< Nombre maximum de plantes (surface de référence) */
+    static constexpr float SURFACE_REFERENCE = 1280.0f * 640.0f;   /**< Surface pour laquelle MAX_PLANTES est calibré */
+    static constexpr float TAILLE_CELLULE_GRILLE = 256.0f;         /**< Côté des cellules des grilles spatiales */
+    static constexpr int TAILLE_TRANCHE = 16384;                   /**< Entités créées par tranche de Peupler (un flux aléatoire chacune) */
+    static constexpr float SEUIL_DESORDRE = 0.2f;                  /**< Part de voisins de stockage mal ordonnés qui déclenche un tri */
+    static constexpr int INTERVALLE_TRI_MAX = 240;                 /**< Plus long délai entre deux mesures du désordre (ticks) */
+    
+    float mLargeur;                 /**< Largeur du monde */
+    float mHauteur;                 /**< Hauteur du monde */
+    ContexteMonde mMonde;           /**< Dimensions et végétation prêtées aux animaux à chaque tick */
+    GenerateurAleatoire mAlea;      /**< Tirages d'errance et de sommeil de la mise à jour séquentielle */
+    uint64_t mGraineAlea;           /**< Graine de mAlea et des flux des tuiles, tirée par Peupler */
+    int mNbreProies;                /**< Nombre actuel de proies */
+    int mNbrePredateurs;            /**< Nombre actuel de prédateurs */
+    int mNbrePlantes;               /**< Nombre actuel de plantes */
+    int mMaxPlantes;                /**< Plafond de plantes adapté à la surface du monde */
+    int mPlantesParRepousse;        /**< Plantes ajoutées à chaque repousse */
+
+    GrilleSpatiale mGrilleProies;       /**< Index spatial des proies */
+    GrilleSpatiale mGrillePredateurs;   /**< Index spatial des prédateurs */
+    GrilleSpatiale mGrillePlantes;      /**< Index spatial des plantes disponibles */
+    std::vector<Plante*> mPlantesDisponibles;  /**< Plantes indexées par mGrillePlantes */
+    std::vector<uint32_t> mIndicesRequete;  /**< Tampon réutilisé par RequeteZone */
+    std::vector<float> mPositionsX;         /**< Positions rattrapées des animaux (grilles en mode sommeil) */
+    std::vector<float> mPositionsY;         /**< Pendant vertical de mPositionsX */
+
+    RepartitionInitiale mRepartition;       /**< Disposition des entités créées par Peupler */
+    DecompositionSpatiale mDecomposition;   /**< Tuiles mises à jour en parallèle */
+    PoolThreads* mTaches;                   /**< Système de tâches de l'application (non possédé, nullptr : séquentiel) */
+    PoolThreads* mPool;                     /**< mTaches en mode tuiles, nullptr sinon */
+    PopulationGenerique* mEspeces;          /**< Espèces du registre (nullptr si aucune) */
+    PlanificateurSommeil* mSommeil;         /**< Sommeil des animaux isolés (nullptr si désactivé) */
+    ChampVegetation* mChamp;                /**< Végétation continue (nullptr : plantes individuelles) */
+    bool mSuivi;                            /**< Les animaux gardent leur cible entre deux détections */
+    DetecteurCollisions* mCollisions;       /**< Séparation des sprites (nullptr si désactivée) */
+    ListesVoisins* mVoisins;                /**< Listes de voisins gardées entre les ticks (nullptr si désactivées) */
+    CarteNourriture* mCarteNourriture;      /**< Plante la plus proche par cellule (nullptr si désactivée) */
+    bool mTriSpatial;                       /**< Stockage remis dans l'ordre de Morton quand il se mélange */
+    int mIntervalleTri;                     /**< Ticks entre deux mesures du désordre (adapté aux déplacements) */
+    int mTicksAvantTri;                     /**< Ticks restants avant la prochaine mesure */
+    int mNbTris;                            /**< Tris effectués depuis l'activation */
+    std::vector<void*> mPlaces;             /**< Emplacements pris pour un peuplement ou un relogement (réutilisé) */
+    BudgetPopulation* mBudget;              /**< Admission des naissances (nullptr : croissance libre) */
+
+    float mBandeX0;                 /**< Bord gauche de la bande possédée (simulation distribuée) */
+    float mBandeX1;                 /**< Bord droit de la bande possédée (exclu) */
+    const std::vector<Proie*>* mFantomesProies;         /**< Proies des voisins visibles d'ici (non possédées) */
+    const std::vector<Predateur*>* mFantomesPredateurs; /**< Prédateurs des voisins visibles d'ici (non possédés) */
+    std::vector<Proie*> mProiesVues;            /**< Proies possédées + fantômes */
+    std::vector<Predateur*> mPredateursVus;     /**< Prédateurs possédés + fantômes */
+    bool mLiberationDifferee;                   /**< Les morts sont libérés au tick suivant */
+    std::vector<Animal*> mMortsEnAttente;       /**< Morts du tick précédent, encore adressables */
+
+    /**
+     * @enum TypeMinuterie
+     * @brief Nature des échéances de mRoue
+     */
+    enum TypeMinuterie
+    {
+        MINUTERIE_REPOUSSE,     /**< Repousse des plantes */
+        MINUTERIE_PROIE,        /**< Maturité d'une proie */
+        MINUTERIE_PREDATEUR     /**< Maturité d'un prédateur */
+    };
+
+    RoueTemporisation mRoue;                    /**< Échéances de la simulation (repousse, reproductions) */
+    AnnexesAnimaux mAnnexes;                    /**< Minuteries et délais de suivi des animaux (détruit avant mRoue) */
+    Minuterie mMinuterieRepousse;               /**< Prochaine repousse des plantes */
+    std::vector<Minuterie*> mEchues;            /**< Échéances du tick (tampon réutilisé) */
+    ArenaFrame mArena;                          /**< Données temporaires du tick, rendues au début du suivant */
+    std::vector<Proie*> mProiesCandidates;          /**< Proies mûres et assez nourries pour se reproduire */
+    std::vector<Predateur*> mPredateursCandidats;   /**< Prédateurs mûrs et assez nourris pour se reproduire */
+
+    /**
+     * @brief Prépare un animal qui rejoint l'écosystème (reproduction, suivi de cible)
+     * @tparam Espece Proie ou Predateur
+     * @param animal Animal possédé par l'écosystème
+     *
+     * Lui donne un rang dans mAnnexes, arme sa minuterie de reproduction pour
+     * le reste de son délai et le confie au détecteur de collisions s'il est actif.
+     */
+    template<typename Espece>
+    void Accueillir(Espece* animal);
+
+    /**
+     * @brief Reprend le rang d'un animal mort ou parti (sa minuterie est désarmée)
+     * @param animal Animal qui quitte l'écosystème
+     */
+    void Congedier(Animal* animal);
+
+    /**
+     * @brief Crée des entités par tranches, en parallèle si un pool est fourni
+     * @tparam T Proie, Predateur ou Plante
+     * @param entites Liste où les entités sont ajoutées, dans l'ordre des tranches
+     * @param nombre Nombre d'entités à créer
+     * @param pool Threads de travail (nullptr : séquentiel)
+     *
+     * Les emplacements sont pris d'un bloc dans ReserveObjets<T>. Chaque tranche
+     * a son propre flux aléatoire, dérivé d'une graine tirée par rand() : le
+     * résultat dépend de srand, pas du nombre de threads. Les positions suivent
+     * mRepartition, préparée par l'appelant.
+     */
+    template<typename T>
+    void CreerParTranches(std::vector<T*>& entites, int nombre, PoolThreads* pool);
+
+    /**
+     * @brief Reloge des animaux dans l'ordre de Morton de leur case, à des adresses croissantes
+     * @tparam T Proie ou Predateur
+     * @param entites Liste remplacée par les copies, dans l'ordre de Morton
+     * @param adresses Couples (ancienne, nouvelle adresse), triés par ancienne adresse
+     *
+     * Les minuteries de reproduction passent aux copies. Les originaux restent
+     * à libérer par l'appelant, une fois les pointeurs qui les désignent mis à
+     * jour. Les animaux d'une même case gardent leur ordre relatif.
+     */
+    template<typename T>
+    void RelogerSelonMorton(std::vector<T*>& entites, VecteurFrame<std::pair<T*, T*>>& adresses);
+
+    /**
+     * @brief Mesure le désordre du stockage si le délai est écoulé, trie s'il dépasse le seuil
+     *
+     * Le délai entre deux mesures s'allonge tant que le stockage reste ordonné
+     * et raccourcit quand le désordre a largement dépassé le seuil.
+     */
+    void TrierSiDesordonne();
+
+    /**
+     * @brief Traite les échéances du tick : repousse et animaux devenus mûrs
+     */
+    void TraiterEcheances();
+
+    /**
+     * @brief Règle capacité et repousse du champ sur le plafond et le délai des plantes
+     */
+    void CalibrerChamp();
+
+    /**
+     * @brief Calibre le champ et y convertit les plantes disponibles, puis libère toutes les plantes
+     */
+    void SemerChamp();
+
+    /**
+     * @brief Confie au planificateur de sommeil tous les animaux et les plantes disponibles
+     */
+    void RemplirSommeil();
+
+    /**
+     * @brief Les proies broutent leur cellule, puis le champ repousse et diffuse
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    void AvancerChamp(float deltaTime);
+
+    /**
+     * @brief Ajoute des plantes dans la bande, sous le plafond
+     */
+    void FaireRepousser();
+
+    /**
+     * @brief Recalcule plafond et repousse des plantes pour la surface de la bande
+     */
+    void AjusterVegetation();
+    
+    /**
+     * @brief Supprime les animaux morts
+     */
+    void SupprimerMorts();
+
+    /**
+     * @brief Retire les morts d'une liste en une passe, puis les libère (ou les met en attente)
+     * @tparam T Proie ou Predateur
+     * @param animaux Liste compactée, survivants dans leur ordre
+     */
+    template<typename T>
+    void RetirerMorts(std::vector<T*>& animaux);
+    
+    /**
+     * @brief Gère les reproductions des candidats mûrs
+     */
+    void Reproduction();
+
+    /**
+     * @brief Reconstruit les grilles spatiales à partir des positions actuelles
+     */
+    void ReconstruireGrilles();
+    
+public:
+    /**
+     * @brief Constructeur créant populations initiales
+     * @param nbreProies Nombre de proies à créer
+     * @param nbrePredateurs Nombre de prédateurs à créer
+     * @param nbrePlantes Nombre de plantes à créer
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param repartition Disposition des populations initiales (et de celles de Peupler)
+     * @param taches Système de tâches prêté par l'application (nullptr : tout en séquentiel)
+     */
+    Ecosysteme(int nbreProies, int nbrePredateurs, int nbrePlantes,
+               float largeur, float hauteur,
+               const RepartitionInitiale& repartition = RepartitionInitiale(),
+               PoolThreads* taches = nullptr);
+    
+    /**
+     * @brief Destructeur libérant mémoire
+     */
+    ~Ecosysteme();
+    
+    /**
+     * @brief Met à jour tout l'écosystème
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    void Update(float deltaTime);
+
+    /**
+     * @brief Crée des animaux et plantes aléatoires dans la bande possédée
+     * @param nbreProies Nombre de proies à créer
+     * @param nbrePredateurs Nombre de prédateurs à créer
+     * @param nbrePlantes Nombre de plantes à créer
+     *
+     * Les positions suivent la répartition donnée au constructeur. La création
+     * est répartie par tranches sur le système de tâches, s'il y en a un.
+     */
+    void Peupler(int nbreProies, int nbrePredateurs, int nbrePlantes);
+
+    /**
+     * @brief Relance la simulation dans le stockage existant
+     * @param nbreProies Proies initiales
+     * @param nbrePredateurs Prédateurs initiaux
+     * @param nbrePlantes Plantes initiales
+     * @param graine Graine de rand() pour le nouveau peuplement
+     * @return false si un mode actif ne sait pas repartir de zéro (écosystème inchangé)
+     *
+     * Les entités rendent leurs emplacements à leur réserve, puis le
+     * peuplement les reprend : listes, grilles, tuiles, roue et tampons gardent
+     * leur capacité, et une relance ne coûte que le peuplement, sans passer par
+     * l'allocateur tant que la population ne dépasse pas celle de la
+     * simulation précédente. Les modes activés le restent. Avec la même
+     * graine, la suite est celle d'un écosystème neuf réglé de la même façon.
+     * Dormeurs, champ de végétation, carte de la nourriture et espèces du
+     * registre sont vidés sur place puis remplis comme à leur activation.
+     * Seules les bandes distribuées refusent : il faut reconstruire.
+     */
+    bool Reinitialiser(int nbreProies, int nbrePredateurs, int nbrePlantes, unsigned int graine);
+
+    /**
+     * @brief Restreint l'écosystème à une bande verticale du monde
+     * @param x0 Bord gauche de la bande
+     * @param x1 Bord droit de la bande (exclu)
+     *
+     * Les plantes ne repoussent que dans la bande, avec un plafond proportionnel
+     * à sa surface. Les animaux peuvent en sortir : ExtraireHorsBande les rend.
+     */
+    void DefinirBande(float x0, float x1);
+
+    /**
+     * @brief Ajoute une proie venue d'ailleurs
+     * @param etat État de la proie
+     */
+    void AjouterProie(const EtatAnimal& etat);
+
+    /**
+     * @brief Ajoute un prédateur venu d'ailleurs
+     * @param etat État du prédateur
+     */
+    void AjouterPredateur(const EtatAnimal& etat);
+
+    /**
+     * @brief Retire les animaux vivants sortis de la bande
+     * @param proies Proies sorties (ajoutées ; l'appelant devient propriétaire)
+     * @param predateurs Prédateurs sortis (ajoutés ; l'appelant devient propriétaire)
+     */
+    void ExtraireHorsBande(std::vector<Proie*>& proies, std::vector<Predateur*>& predateurs);
+
+    /**
+     * @brief Définit les animaux voisins visibles mais non simulés ici
+     * @param proies Proies fantômes (restent valides jusqu'au prochain appel)
+     * @param predateurs Prédateurs fantômes
+     *
+     * Les fantômes sont vus par Comportement (fuite, chasse) sans être déplacés ;
+     * une proie fantôme mangée est seulement marquée morte. Ignorés en mode tuiles.
+     */
+    void DefinirFantomes(const std::vector<Proie*>& proies, const std::vector<Predateur*>& predateurs);
+
+    /**
+     * @brief Reporte la libération des morts au tick suivant
+     * @param active true pour garder les morts adressables un tick de plus
+     *
+     * Permet de traiter après Update des notifications visant des animaux morts
+     * pendant le tick sans risque de pointeur libéré.
+     */
+    void DiffererLiberation(bool active);
+
+    /**
+     * @brief Ajoute les espèces décrites par un registre et leurs populations initiales
+     * @param registre Registre chargé (doit survivre à l'écosystème)
+     * @param compact true pour stocker les individus sous forme quantifiée (LotCompact)
+     *
+     * Ces espèces partagent les plantes de l'écosystème et sont mises à jour
+     * après les proies et prédateurs, en séquentiel.
+     */
+    void ChargerEspeces(const RegistreEspeces& registre, bool compact = false);
+
+    /**
+     * @brief Accès aux espèces du registre
+     * @return Population, nullptr si aucun registre n'a été chargé
+     */
+    const PopulationGenerique* GetEspeces() const;
+
+    /**
+     * @brief Active la mise à jour parallèle par tuiles, sur le système de tâches
+     * @param nbThreads Threads visés, qui fixent le nombre de tuiles (1 ou moins : séquentiel)
+     * @return true si le monde est assez grand pour être découpé et qu'un système de tâches est prêté
+     */
+    bool ActiverParallelisme(int nbThreads);
+
+    /**
+     * @brief Active la mise en sommeil des animaux isolés
+     * @param actif true pour endormir les animaux sans voisin utile, false pour tout réveiller
+     * @return false si le mode tuiles ou les bandes distribuées l'empêchent
+     *
+     * Un animal sans menace ni nourriture à portée file en ligne droite sans
+     * calcul par tick jusqu'au prochain événement (voir PlanificateurSommeil).
+     * Les trajectoires diffèrent du mode normal : les changements de direction
+     * sont tirés en temps continu.
+     */
+    bool ActiverSommeil(bool actif);
+
+    /**
+     * @brief Active le suivi de cible entre deux détections complètes
+     * @param actif true pour que proies et prédateurs gardent menace et proie suivies
+     * @return false si les bandes distribuées l'empêchent
+     *
+     * Une détection complète n'a lieu que si la cible meurt, sort du rayon, ou
+     * quand le délai tiré des vitesses et de l'écart entre les deux plus
+     * proches est écoulé (voir Animal::SuivreOuDetecter) : la cible gardée est
+     * au plus à Animal::TOLERANCE_SUIVI de la plus proche.
+     */
+    bool ActiverSuivi(bool actif);
+
+    /**
+     * @brief Active la détection et la résolution des collisions entre sprites
+     * @param actif true pour écarter les animaux qui se chevauchent, false pour les laisser se superposer
+     * @return false si le sommeil ou les bandes distribuées l'empêchent
+     *
+     * Chaque tick, après les déplacements, deux animaux de même espèce dont
+     * les sprites se chevauchent sont écartés, et chaque chevauchement produit
+     * un EVENT_COLLISION (voir DetecteurCollisions). Les espèces du registre
+     * ne sont pas concernées.
+     */
+    bool ActiverCollisions(bool actif);
+
+    /**
+     * @brief Active les listes de voisins à peau pour la détection
+     * @param actif true pour chercher les cibles dans des listes gardées d'un tick à l'autre
+     * @return false si le mode tuiles, le sommeil ou les bandes distribuées l'empêchent
+     *
+     * Chaque animal ne regarde plus tout le monde, mais la liste des entités
+     * qui étaient à portée (plus une peau) à la dernière construction ; les
+     * listes ne sont refaites que lorsqu'un animal a assez bougé pour qu'elles
+     * puissent manquer une cible (voir ListesVoisins). Les cibles choisies sont
+     * celles d'une recherche complète. Avec le suivi, menaces et proies sont
+     * cherchées dans toute la population, les plantes dans les listes.
+     */
+    bool ActiverListesVoisins(bool actif);
+
+    /**
+     * @brief Active la carte de la nourriture pour la recherche de plantes
+     * @param actif true pour que les proies lisent leur cellule au lieu de parcourir les plantes
+     * @return false si le champ de végétation ou le sommeil l'empêchent
+     *
+     * La carte retient, par cellule, la plante disponible la plus proche ; elle
+     * est tenue à jour à chaque repousse et à chaque plante consommée (voir
+     * CarteNourriture). La plante choisie peut différer de la plus proche d'une
+     * demi-diagonale de cellule.
+     */
+    bool ActiverCarteNourriture(bool actif);
+
+    /**
+     * @brief Active le rangement périodique des animaux dans l'ordre de Morton
+     * @param actif true pour reloger proies et prédateurs par case
+     * @return false si le sommeil ou les bandes distribuées l'empêchent
+     *
+     * Les déplacements et les naissances mélangent l'ordre des listes et de la
+     * mémoire : des voisins dans le monde finissent loin l'un de l'autre. Quand
+     * le désordre dépasse un seuil, les animaux sont recopiés dans l'ordre de
+     * la courbe de Morton de leur case, à des adresses croissantes ; cibles,
+     * minuteries, candidats à la reproduction et corps du détecteur de
+     * collisions suivent. Les parcours des
+     * listes, les requêtes de grille et l'instantané de rendu lisent alors une
+     * mémoire presque contiguë. L'ordre de mise à jour change, donc les
+     * effectifs aussi.
+     */
+    bool ActiverTriSpatial(bool actif);
+
+    /**
+     * @brief Plafonne le nombre d'animaux et la mémoire des entités
+     * @param maxAnimaux Plafond d'animaux, espèces du registre comprises (0 : aucun)
+     * @param maxOctets Plafond d'octets des entités (0 : aucun)
+     * @param politique Freinage des naissances à l'approche du plafond
+     *
+     * Chaque naissance, d'un animal ou d'un individu du registre, est soumise
+     * au budget (voir BudgetPopulation) : une explosion de population ne peut
+     * plus épuiser la mémoire de la machine. Sans aucun plafond, le budget est
+     * supprimé.
+     */
+    void DefinirBudget(size_t maxAnimaux, size_t maxOctets, PolitiqueBudget politique);
+
+    /**
+     * @brief Remplace les plantes individuelles par un champ de biomasse continu
+     * @param actif true pour le champ, false pour revenir aux plantes
+     * @return false si le sommeil, les espèces du registre ou les bandes distribuées l'empêchent
+     *
+     * Chaque plante disponible devient une unité de biomasse dans sa cellule,
+     * puis est libérée. Les proies broutent la cellule où elles se trouvent et
+     * remontent le gradient de biomasse au lieu de chercher une plante.
+     * Capacité et repousse maximale reprennent le plafond et le délai des
+     * plantes : l'équilibre reste comparable.
+     */
+    bool ActiverChampVegetation(bool actif);
+
+    /**
+     * @brief Accès au champ de biomasse
+     * @return Champ, nullptr en mode plantes individuelles
+     */
+    const ChampVegetation* GetChampVegetation() const;
+
+    /**
+     * @brief Compte les animaux endormis
+     * @return Nombre de dormeurs (0 si le sommeil est désactivé)
+     */
+    int GetNombreEndormis() const;
+
+    /**
+     * @brief Collisions détectées au dernier tick
+     * @return Un EVENT_COLLISION par paire (vide si la détection est désactivée)
+     */
+    const std::vector<Event>& GetEvenementsCollision() const;
+
+    /**
+     * @brief Accès aux listes de voisins (statistiques)
+     * @return Listes, nullptr si désactivées
+     */
+    const ListesVoisins* GetListesVoisins() const;
+
+    /**
+     * @brief Accès à la carte de la nourriture (statistiques)
+     * @return Carte, nullptr si désactivée
+     */
+    const CarteNourriture* GetCarteNourriture() const;
+
+    /**
+     * @brief Nombre de tris du stockage depuis l'activation
+     * @return Tris effectués (0 si le tri spatial est désactivé)
+     */
+    int GetNombreTris() const;
+
+    /**
+     * @brief Délai actuel entre deux mesures du désordre
+     * @return Ticks entre deux mesures
+     */
+    int GetIntervalleTri() const;
+
+    /**
+     * @brief Accès au budget (utilisation, naissances refusées)
+     * @return Budget, nullptr si la croissance est libre
+     */
+    const BudgetPopulation* GetBudget() const;
+
+    /**
+     * @brief Compte les animaux de toutes les espèces
+     * @return Proies, prédateurs et individus du registre
+     */
+    size_t GetNombreAnimaux() const;
+
+    /**
+     * @brief Mémoire tenue par les entités
+     * @return Octets des objets et de leur place dans les listes (hors index spatiaux)
+     */
+    size_t GetOctetsEntites() const;
+    
+    /**
+     * @brief Accès lecture seule aux proies
+     * @return Vecteur des proies
+     */
+    const std::vector<Proie*>& GetProies() const;
+    
+    /**
+     * @brief Accès lecture seule aux prédateurs
+     * @return Vecteur des prédateurs
+     */
+    const std::vector<Predateur*>& GetPredateurs() const;
+    
+    /**
+     * @brief Accès lecture seule aux plantes
+     * @return Vecteur des plantes
+     */
+    const std::vector<Plante*>& GetPlantes() const;
+
+    /**
+     * @brief Récupère les entités situées dans une zone du monde
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @param proies Proies trouvées (vidé puis rempli)
+     * @param predateurs Prédateurs trouvés (vidé puis rempli)
+     * @param plantes Plantes trouvées (vidé puis rempli)
+     *
+     * Ne parcourt que les cellules des grilles recouvrant la zone : le coût dépend
+     * du contenu de la zone et non de la taille du monde.
+     */
+    void RequeteZone(float x0, float y0, float x1, float y1,
+                     std::vector<Proie*>& proies,
+                     std::vector<Predateur*>& predateurs,
+                     std::vector<Plante*>& plantes);
+
+    /**
+     * @brief Compte les animaux d'une zone sans les parcourir
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @return Nombre approché de proies et prédateurs dans la zone
+     */
+    int CompterAnimauxZone(float x0, float y0, float x1, float y1) const;
+
+    /**
+     * @brief Accès à l'index spatial des proies
+     * @return Grille des proies
+     */
+    const GrilleSpatiale& GetGrilleProies() const;
+
+    /**
+     * @brief Accès à l'index spatial des prédateurs
+     * @return Grille des prédateurs
+     */
+    const GrilleSpatiale& GetGrillePredateurs() const;
+
+    /**
+     * @brief Accès à l'index spatial des plantes disponibles
+     * @return Grille des plantes
+     */
+    const GrilleSpatiale& GetGrillePlantes() const;
+
+    /**
+     * @brief Récupère la largeur du monde
+     * @return Largeur (pixels monde)
+     */
+    float GetLargeur() const;
+
+    /**
+     * @brief Récupère la hauteur du monde
+     * @return Hauteur (pixels monde)
+     */
+    float GetHauteur() const;
+
+    /**
+     * @brief Accès au contexte prêté aux animaux (dimensions, végétation, annexes)
+     * @return Contexte de l'écosystème
+     */
+    const ContexteMonde& GetMonde() const;
+
+    /**
+     * @brief Position d'un animal telle qu'affichée (dormeurs rattrapés sur leur trajectoire)
+     * @param animal Proie ou prédateur de l'écosystème
+     * @param x Position horizontale
+     * @param y Position verticale
+     */
+    void PositionAffichee(const Animal* animal, float& x, float& y) const;
+    
+    /**
+     * @brief Compte les proies vivantes
+     * @return Nombre de proies
+     */
+    int GetNombreProies() const;
+    
+    /**
+     * @brief Compte les prédateurs vivants
+     * @return Nombre de prédateurs
+     */
+    int GetNombrePredateurs() const;
+    
+    /**
+     * @brief Compte les plantes disponibles
+     * @return Nombre de plantes (biomasse du champ en équivalents plantes)
+     */
+    int GetNombrePlantes() const;
+
+    /**
+     * @brief Compte les plantes consommées depuis le debut du jeu
+     * @return Nombre de plantes consommées (biomasse broutée en équivalents plantes)
+     */
+    int GetTotalPlantesConsommees() const;
+
+    /**
+     * @brief Compte le temps qui separe l'apparission de 2 plantes
+     * @return Intervalle d'apparission des plantes
+     */
+    int GetDelaiPlantes() const;
+
+    /**
+     * @brief Plafond de plantes de la zone simulée
+     * @return Nombre de plantes au-delà duquel rien ne repousse
+     */
+    int GetMaxPlantes() const;
+
+    /**
+     * @brief Repousse moyenne sous le plafond
+     * @return Plantes apparues par seconde
+     */
+    float GetRepoussePlantes() const;
+
+    /**
+     * @brief Actualise le temps qui sépare l'apparission de 2 plantes
+     * @param Delai de réaparission
+     */
+    void SetDelaiPlantes(float delai);
+};
+
 #endif /* ECOSYSTEME_H */
\ No newline at end of file
@@ -0,0 +1,179 @@
+/**
+ * @file GrilleSpatiale.cpp
+ * @brief Implémentation de l'index spatial en grille uniforme
+ */
+
+#include "GrilleSpatiale.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructeur d'une grille vide (une seule cellule)
+ */
+GrilleSpatiale::GrilleSpatiale()
+    : mTailleCellule(1.0f)
+    , mNbColonnes(1)
+    , mNbLignes(1)
+    , mTriee(false)
+{
+    mDebuts.assign(2, 0);
+}
+
+/**
+ * @brief Dimensionne la grille pour couvrir tout le monde
+ */
+void GrilleSpatiale::Configurer(float largeur, float hauteur, float tailleCellule)
+{
+    mTailleCellule = tailleCellule;
+    mNbColonnes = std::max(1, static_cast<int>(std::ceil(largeur / tailleCellule)));
+    mNbLignes = std::max(1, static_cast<int>(std::ceil(hauteur / tailleCellule)));
+
+    mDebuts.assign(static_cast<size_t>(mNbColonnes) * mNbLignes + 1, 0);
+    mIndices.clear();
+}
+
+/**
+ * @brief Tri par comptage à partir de tableaux de positions
+ */
+void GrilleSpatiale::Construire(const std::vector<float>& xs, const std::vector<float>& ys)
+{
+    const size_t nbCellules = static_cast<size_t>(mNbColonnes) * mNbLignes;
+
+    mDebuts.assign(nbCellules + 1, 0);
+    mCellules.resize(xs.size());
+    mIndices.resize(xs.size());
+    mTriee = false;
+
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        uint32_t cellule = CelluleDe(xs[i], ys[i]);
+        mCellules[i] = cellule;
+        mDebuts[cellule + 1]++;
+    }
+
+    Ranger();
+}
+
+/**
+ * @brief Comptage par cellule et somme préfixe : les entités restent en place
+ */
+void GrilleSpatiale::ConstruireTriee(const std::vector<uint32_t>& cellules)
+{
+    const size_t nbCellules = static_cast<size_t>(mNbColonnes) * mNbLignes;
+
+    mDebuts.assign(nbCellules + 1, 0);
+    mIndices.clear();
+    mTriee = true;
+
+    for (uint32_t cellule : cellules)
+        mDebuts[cellule + 1]++;
+    for (size_t c = 0; c < nbCellules; c++)
+        mDebuts[c + 1] += mDebuts[c];
+}
+
+/**
+ * @brief Somme préfixe des comptages, puis indices rangés à la suite dans leur cellule
+ */
+void GrilleSpatiale::Ranger()
+{
+    const size_t nbCellules = mDebuts.size() - 1;
+
+    for (size_t c = 0; c < nbCellules; c++)
+        mDebuts[c + 1] += mDebuts[c];
+
+    mCurseurs.assign(mDebuts.begin(), mDebuts.end() - 1);
+    for (size_t i = 0; i < mCellules.size(); i++)
+        mIndices[mCurseurs[mCellules[i]]++] = static_cast<uint32_t>(i);
+}
+
+/**
+ * @brief Calcule la cellule contenant un point (bornée à la grille)
+ */
+uint32_t GrilleSpatiale::CelluleDe(float x, float y) const
+{
+    int colonne = static_cast<int>(x / mTailleCellule);
+    int ligne = static_cast<int>(y / mTailleCellule);
+
+    colonne = std::min(std::max(colonne, 0), mNbColonnes - 1);
+    ligne = std::min(std::max(ligne, 0), mNbLignes - 1);
+
+    return static_cast<uint32_t>(ligne * mNbColonnes + colonne);
+}
+
+/**
+ * @brief Parcourt uniquement les cellules recouvrant la zone demandée
+ */
+void GrilleSpatiale::RequeteRectangle(float x0, float y0, float x1, float y1,
+                                      std::vector<uint32_t>& resultat) const
+{
+    int col0 = std::max(0, static_cast<int>(std::floor(x0 / mTailleCellule)));
+    int lig0 = std::max(0, static_cast<int>(std::floor(y0 / mTailleCellule)));
+    int col1 = std::min(mNbColonnes - 1, static_cast<int>(std::floor(x1 / mTailleCellule)));
+    int lig1 = std::min(mNbLignes - 1, static_cast<int>(std::floor(y1 / mTailleCellule)));
+
+    /* Une zone entièrement hors de la grille donne col0 > col1 : aucune ligne à parcourir */
+    for (int ligne = lig0; ligne <= lig1 && col0 <= col1; ligne++)
+    {
+        /* Les cellules d'une même ligne sont contiguës dans mIndices */
+        uint32_t debut = mDebuts[ligne * mNbColonnes + col0];
+        uint32_t fin = mDebuts[ligne * mNbColonnes + col1 + 1];
+
+        if (mTriee)
+        {
+            for (uint32_t i = debut; i < fin; i++)
+                resultat.push_back(i);
+        }
+        else
+            resultat.insert(resultat.end(), mIndices.begin() + debut, mIndices.begin() + fin);
+    }
+}
+
+/**
+ * @brief Compte les entités sans les parcourir : une soustraction par ligne
+ */
+int GrilleSpatiale::CompterRectangle(float x0, float y0, float x1, float y1) const
+{
+    int col0 = std::max(0, static_cast<int>(std::floor(x0 / mTailleCellule)));
+    int lig0 = std::max(0, static_cast<int>(std::floor(y0 / mTailleCellule)));
+    int col1 = std::min(mNbColonnes - 1, static_cast<int>(std::floor(x1 / mTailleCellule)));
+    int lig1 = std::min(mNbLignes - 1, static_cast<int>(std::floor(y1 / mTailleCellule)));
+    int total = 0;
+
+    for (int ligne = lig0; ligne <= lig1 && col0 <= col1; ligne++)
+        total += mDebuts[ligne * mNbColonnes + col1 + 1] - mDebuts[ligne * mNbColonnes + col0];
+
+    return total;
+}
+
+/**
+ * @brief Nombre d'entités rangées dans une cellule
+ */
+int GrilleSpatiale::GetNombreDansCellule(int colonne, int ligne) const
+{
+    uint32_t cellule = static_cast<uint32_t>(ligne * mNbColonnes + colonne);
+    return static_cast<int>(mDebuts[cellule + 1] - mDebuts[cellule]);
+}
+
+/**
+ * @brief Récupère le côté d'une cellule
+ */
+float GrilleSpatiale::GetTailleCellule() const
+{
+    return mTailleCellule;
+}
+
+/**
+ * @brief Récupère le nombre de colonnes
+ */
+int GrilleSpatiale::GetNombreColonnes() const
+{
+    return mNbColonnes;
+}
+
+/**
+ * @brief Récupère le nombre de lignes
+ */
+int GrilleSpatiale::GetNombreLignes() const
+{
+    return mNbLignes;
+}
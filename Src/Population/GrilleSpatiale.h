@@ -0,0 +1,160 @@
+/**
+ * @file GrilleSpatiale.h
+ * @brief Index spatial en grille uniforme pour les requêtes par zone
+ */
+
+#ifndef GRILLE_SPATIALE_H
+#define GRILLE_SPATIALE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class GrilleSpatiale
+ * @brief Range des entités par cellule carrée pour retrouver rapidement celles d'une zone
+ *
+ * La grille est reconstruite en entier (tri par comptage) à partir d'une liste
+ * d'entités. Les requêtes renvoient les indices des entités dans cette liste,
+ * valables jusqu'à la reconstruction suivante.
+ */
+class GrilleSpatiale
+{
+private:
+    float mTailleCellule;               /**< Côté d'une cellule (pixels monde) */
+    int mNbColonnes;                    /**< Nombre de cellules en X */
+    int mNbLignes;                      /**< Nombre de cellules en Y */
+    std::vector<uint32_t> mDebuts;      /**< Début de chaque cellule dans mIndices (taille cellules + 1) */
+    std::vector<uint32_t> mIndices;     /**< Indices des entités, regroupés par cellule */
+    std::vector<uint32_t> mCellules;    /**< Cellule de chaque entité (tampon de construction) */
+    std::vector<uint32_t> mCurseurs;    /**< Position d'écriture par cellule (tampon de construction) */
+    bool mTriee;                        /**< Entités déjà rangées par cellule : indices implicites, mIndices vide */
+
+    /**
+     * @brief Somme préfixe des comptages puis rangement des indices
+     *
+     * Suppose mCellules rempli et mDebuts[c + 1] égal au nombre d'entités de c.
+     */
+    void Ranger();
+
+public:
+    /**
+     * @brief Constructeur d'une grille vide
+     */
+    GrilleSpatiale();
+
+    /**
+     * @brief Dimensionne la grille pour couvrir le monde
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param tailleCellule Côté d'une cellule
+     */
+    void Configurer(float largeur, float hauteur, float tailleCellule);
+
+    /**
+     * @brief Reconstruit l'index à partir d'une liste d'entités
+     * @param entites Entités possédant GetX() et GetY()
+     */
+    template <typename T>
+    void Construire(const std::vector<T*>& entites);
+
+    /**
+     * @brief Reconstruit l'index à partir de tableaux de positions
+     * @param xs Positions horizontales
+     * @param ys Positions verticales (même taille que xs)
+     */
+    void Construire(const std::vector<float>& xs, const std::vector<float>& ys);
+
+    /**
+     * @brief Indexe des entités déjà triées par cellule
+     * @param cellules Cellule de chaque entité, croissante
+     *
+     * Seuls les débuts de cellules sont gardés : une requête renvoie des plages
+     * d'indices consécutifs, sans tableau d'indices par entité.
+     */
+    void ConstruireTriee(const std::vector<uint32_t>& cellules);
+
+    /**
+     * @brief Liste les entités des cellules touchant un rectangle
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @param resultat Indices trouvés (ajoutés à la suite)
+     *
+     * Le résultat est grossier : il peut contenir des entités légèrement hors zone.
+     */
+    void RequeteRectangle(float x0, float y0, float x1, float y1,
+                          std::vector<uint32_t>& resultat) const;
+
+    /**
+     * @brief Compte les entités des cellules touchant un rectangle
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @return Nombre d'entités (coût proportionnel au nombre de lignes de cellules)
+     */
+    int CompterRectangle(float x0, float y0, float x1, float y1) const;
+
+    /**
+     * @brief Calcule la cellule contenant un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Indice de la cellule
+     */
+    uint32_t CelluleDe(float x, float y) const;
+
+    /**
+     * @brief Nombre d'entités rangées dans une cellule
+     * @param colonne Colonne de la cellule
+     * @param ligne Ligne de la cellule
+     * @return Nombre d'entités
+     */
+    int GetNombreDansCellule(int colonne, int ligne) const;
+
+    /**
+     * @brief Récupère le côté d'une cellule
+     * @return Taille de cellule (pixels monde)
+     */
+    float GetTailleCellule() const;
+
+    /**
+     * @brief Récupère le nombre de colonnes
+     * @return Nombre de cellules en X
+     */
+    int GetNombreColonnes() const;
+
+    /**
+     * @brief Récupère le nombre de lignes
+     * @return Nombre de cellules en Y
+     */
+    int GetNombreLignes() const;
+};
+
+/**
+ * @brief Tri par comptage des entités selon leur cellule
+ */
+template <typename T>
+void GrilleSpatiale::Construire(const std::vector<T*>& entites)
+{
+    const size_t nbCellules = static_cast<size_t>(mNbColonnes) * mNbLignes;
+
+    mDebuts.assign(nbCellules + 1, 0);
+    mCellules.resize(entites.size());
+    mIndices.resize(entites.size());
+    mTriee = false;
+
+    /* 1. Compter les entités par cellule */
+    for (size_t i = 0; i < entites.size(); i++)
+    {
+        uint32_t cellule = CelluleDe(entites[i]->GetX(), entites[i]->GetY());
+        mCellules[i] = cellule;
+        mDebuts[cellule + 1]++;
+    }
+
+    /* 2. et 3. Début de chaque cellule, puis indices rangés à la suite */
+    Ranger();
+}
+
+#endif /* GRILLE_SPATIALE_H */
@@ -0,0 +1,309 @@
+/**
+ * @file InstantaneRendu.cpp
+ * @brief Implémentation de l'instantané de rendu
+ */
+
+#include "InstantaneRendu.h"
+#include "ChampVegetation.h"
+#include "Ecosysteme.h"
+#include "ModeleChampMoyen.h"
+#include "Plante.h"
+#include "PopulationGenerique.h"
+#include "Predateur.h"
+#include "Proie.h"
+#include "RegistreEspeces.h"
+
+/**
+ * @brief Copie des animaux vivants : positions et sens, sans rien garder de l'animal
+ */
+template<typename T>
+static void CopierAnimaux(const Ecosysteme& eco, const std::vector<T*>& animaux,
+                          std::vector<float>& xs, std::vector<float>& ys, std::vector<uint8_t>& gauche)
+{
+    xs.clear();
+    ys.clear();
+    gauche.clear();
+    for (T* animal : animaux)
+    {
+        if (!animal->EstVivant())
+            continue;
+        float x, y;
+        eco.PositionAffichee(animal, x, y);
+        xs.push_back(x);
+        ys.push_back(y);
+        gauche.push_back(animal->GetDirection() < 0 ? 1 : 0);
+    }
+}
+
+/**
+ * @brief Constructeur
+ */
+InstantaneRendu::InstantaneRendu()
+    : mRegistre(nullptr),
+      mChamp(nullptr),
+      mAvecChamp(false),
+      mChampMoyen(nullptr),
+      mAvecChampMoyen(false),
+      mNbPlantes(0),
+      mNbPlantesConsommees(0),
+      mNbProiesCourbe(0),
+      mNbPredateursCourbe(0),
+      mAvecBudget(false),
+      mUtilisationBudget(0.0f),
+      mNaissancesRefusees(0),
+      mFreinage(false),
+      mValide(false)
+{
+}
+
+/**
+ * @brief Destructeur
+ */
+InstantaneRendu::~InstantaneRendu()
+{
+    delete mChamp;
+    delete mChampMoyen;
+}
+
+/**
+ * @brief Copie des positions, grilles reconstruites sur les copies
+ */
+void InstantaneRendu::Capturer(const Ecosysteme& eco, const ModeleChampMoyen* champMoyen)
+{
+    const float largeur = eco.GetLargeur();
+    const float hauteur = eco.GetHauteur();
+
+    CopierAnimaux(eco, eco.GetProies(), mProiesX, mProiesY, mProiesGauche);
+    CopierAnimaux(eco, eco.GetPredateurs(), mPredateursX, mPredateursY, mPredateursGauche);
+    mGrilleProies.Configurer(largeur, hauteur, eco.GetGrilleProies().GetTailleCellule());
+    mGrilleProies.Construire(mProiesX, mProiesY);
+    mGrillePredateurs.Configurer(largeur, hauteur, eco.GetGrillePredateurs().GetTailleCellule());
+    mGrillePredateurs.Construire(mPredateursX, mPredateursY);
+
+    mPlantesX.clear();
+    mPlantesY.clear();
+    for (const Plante* plante : eco.GetPlantes())
+    {
+        if (!plante->EstDisponible())
+            continue;
+        mPlantesX.push_back(plante->GetX());
+        mPlantesY.push_back(plante->GetY());
+    }
+    mGrillePlantes.Configurer(largeur, hauteur, eco.GetGrillePlantes().GetTailleCellule());
+    mGrillePlantes.Construire(mPlantesX, mPlantesY);
+
+    /* Espèces du registre : mêmes grilles que la population, sur les copies */
+    const PopulationGenerique* especes = eco.GetEspeces();
+    mRegistre = especes ? &especes->GetRegistre() : nullptr;
+    mEspeces.resize(mRegistre ? mRegistre->GetNombreEspeces() : 0);
+    for (size_t e = 0; e < mEspeces.size(); e++)
+    {
+        EspeceInstantane& copie = mEspeces[e];
+        const size_t nombre = especes->GetNombre(static_cast<int>(e));
+        copie.xs.resize(nombre);
+        copie.ys.resize(nombre);
+        for (size_t i = 0; i < nombre; i++)
+            especes->GetPosition(static_cast<int>(e), i, copie.xs[i], copie.ys[i]);
+        copie.grille.Configurer(largeur, hauteur, especes->GetGrille(static_cast<int>(e)).GetTailleCellule());
+        copie.grille.Construire(copie.xs, copie.ys);
+    }
+
+    const ChampVegetation* champ = eco.GetChampVegetation();
+    mAvecChamp = (champ != nullptr);
+    if (champ)
+    {
+        if (!mChamp)
+            mChamp = new ChampVegetation(largeur, hauteur);
+        mChamp->Recopier(*champ);
+    }
+
+    mAvecChampMoyen = (champMoyen != nullptr);
+    if (champMoyen)
+    {
+        if (mChampMoyen)
+            *mChampMoyen = *champMoyen;
+        else
+            mChampMoyen = new ModeleChampMoyen(*champMoyen);
+    }
+
+    mNbProiesCourbe = eco.GetNombreProies();
+    mNbPredateursCourbe = eco.GetNombrePredateurs();
+    if (especes)
+    {
+        int herbivores, carnivores;
+        especes->CompterParRegime(herbivores, carnivores);
+        mNbProiesCourbe += herbivores;
+        mNbPredateursCourbe += carnivores;
+    }
+    mNbPlantes = eco.GetNombrePlantes();
+    mNbPlantesConsommees = eco.GetTotalPlantesConsommees();
+
+    const BudgetPopulation* budget = eco.GetBudget();
+    mAvecBudget = (budget != nullptr);
+    if (budget)
+    {
+        mUtilisationBudget = budget->GetUtilisation();
+        mNaissancesRefusees = budget->GetNaissancesRefusees();
+        mFreinage = budget->EstEnFreinage();
+    }
+    mValide = true;
+}
+
+/**
+ * @brief Indique si une capture a eu lieu
+ */
+bool InstantaneRendu::EstValide() const
+{
+    return mValide;
+}
+
+/**
+ * @brief Indices des trois grilles pour la zone
+ */
+void InstantaneRendu::RequeteZone(float x0, float y0, float x1, float y1,
+                                  std::vector<uint32_t>& proies,
+                                  std::vector<uint32_t>& predateurs,
+                                  std::vector<uint32_t>& plantes) const
+{
+    proies.clear();
+    predateurs.clear();
+    plantes.clear();
+    mGrilleProies.RequeteRectangle(x0, y0, x1, y1, proies);
+    mGrillePredateurs.RequeteRectangle(x0, y0, x1, y1, predateurs);
+    mGrillePlantes.RequeteRectangle(x0, y0, x1, y1, plantes);
+}
+
+/**
+ * @brief Somme des comptages par cellule de toutes les grilles d'animaux
+ */
+int InstantaneRendu::CompterAnimauxZone(float x0, float y0, float x1, float y1) const
+{
+    int total = mGrilleProies.CompterRectangle(x0, y0, x1, y1)
+              + mGrillePredateurs.CompterRectangle(x0, y0, x1, y1);
+    for (const EspeceInstantane& espece : mEspeces)
+        total += espece.grille.CompterRectangle(x0, y0, x1, y1);
+    return total;
+}
+
+/**
+ * @brief Position et sens d'une proie
+ */
+bool InstantaneRendu::GetProie(uint32_t i, float& x, float& y) const
+{
+    x = mProiesX[i];
+    y = mProiesY[i];
+    return mProiesGauche[i] != 0;
+}
+
+/**
+ * @brief Position et sens d'un prédateur
+ */
+bool InstantaneRendu::GetPredateur(uint32_t i, float& x, float& y) const
+{
+    x = mPredateursX[i];
+    y = mPredateursY[i];
+    return mPredateursGauche[i] != 0;
+}
+
+/**
+ * @brief Position d'une plante disponible
+ */
+void InstantaneRendu::GetPlante(uint32_t i, float& x, float& y) const
+{
+    x = mPlantesX[i];
+    y = mPlantesY[i];
+}
+
+/**
+ * @brief Accès à l'index spatial des proies
+ */
+const GrilleSpatiale& InstantaneRendu::GetGrilleProies() const
+{
+    return mGrilleProies;
+}
+
+/**
+ * @brief Accès à l'index spatial des prédateurs
+ */
+const GrilleSpatiale& InstantaneRendu::GetGrillePredateurs() const
+{
+    return mGrillePredateurs;
+}
+
+/**
+ * @brief Accès à l'index spatial des plantes
+ */
+const GrilleSpatiale& InstantaneRendu::GetGrillePlantes() const
+{
+    return mGrillePlantes;
+}
+
+/**
+ * @brief Accès au registre des espèces
+ */
+const RegistreEspeces* InstantaneRendu::GetRegistre() const
+{
+    return mRegistre;
+}
+
+/**
+ * @brief Positions d'une espèce du registre
+ */
+const EspeceInstantane& InstantaneRendu::GetEspece(int espece) const
+{
+    return mEspeces[espece];
+}
+
+/**
+ * @brief Copie du champ, si le champ est utilisé
+ */
+const ChampVegetation* InstantaneRendu::GetChampVegetation() const
+{
+    return mAvecChamp ? mChamp : nullptr;
+}
+
+/**
+ * @brief Copie du modèle, s'il est suivi
+ */
+const ModeleChampMoyen* InstantaneRendu::GetChampMoyen() const
+{
+    return mAvecChampMoyen ? mChampMoyen : nullptr;
+}
+
+/**
+ * @brief Effectifs des courbes
+ */
+void InstantaneRendu::GetEffectifsCourbes(int& proies, int& predateurs) const
+{
+    proies = mNbProiesCourbe;
+    predateurs = mNbPredateursCourbe;
+}
+
+/**
+ * @brief Compte les plantes disponibles
+ */
+int InstantaneRendu::GetNombrePlantes() const
+{
+    return mNbPlantes;
+}
+
+/**
+ * @brief Compte les plantes consommées
+ */
+int InstantaneRendu::GetTotalPlantesConsommees() const
+{
+    return mNbPlantesConsommees;
+}
+
+/**
+ * @brief État du budget à la capture
+ */
+bool InstantaneRendu::GetBudget(float& utilisation, uint64_t& refusees, bool& freinage) const
+{
+    if (!mAvecBudget)
+        return false;
+    utilisation = mUtilisationBudget;
+    refusees = mNaissancesRefusees;
+    freinage = mFreinage;
+    return true;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file InstantaneRendu.h
+ * @brief Instantané immuable de l'écosystème, publié par la simulation pour le rendu
+ */
+
+#ifndef INSTANTANE_RENDU_H
+#define INSTANTANE_RENDU_H
+
+#include "GrilleSpatiale.h"
+#include <cstdint>
+#include <vector>
+
+class ChampVegetation;
+class Ecosysteme;
+class ModeleChampMoyen;
+class RegistreEspeces;
+
+/**
+ * @struct EspeceInstantane
+ * @brief Positions d'une espèce du registre et leur index spatial
+ */
+struct EspeceInstantane
+{
+    std::vector<float> xs;      /**< Positions horizontales */
+    std::vector<float> ys;      /**< Positions verticales */
+    GrilleSpatiale grille;      /**< Index des positions */
+};
+
+/**
+ * @class InstantaneRendu
+ * @brief Ce que le rendu et l'interface lisent de l'écosystème, à la fin d'un tick
+ *
+ * Le thread de simulation remplit un instantané pendant que le thread
+ * principal en dessine un autre (voir ThreadSimulation) : rien n'y pointe
+ * dans l'écosystème. Positions en tableaux séparés, une grille par
+ * population reconstruite sur ces positions, copie du champ de végétation et
+ * du modèle en champ moyen, effectifs des courbes.
+ * Un instantané est réutilisé d'un tick à l'autre : une fois les tableaux
+ * dimensionnés, la capture n'alloue plus.
+ */
+class InstantaneRendu
+{
+private:
+    std::vector<float> mProiesX;                /**< Positions horizontales des proies vivantes */
+    std::vector<float> mProiesY;                /**< Positions verticales des proies */
+    std::vector<uint8_t> mProiesGauche;         /**< 1 si la proie va vers la gauche */
+    std::vector<float> mPredateursX;            /**< Positions horizontales des prédateurs vivants */
+    std::vector<float> mPredateursY;            /**< Positions verticales des prédateurs */
+    std::vector<uint8_t> mPredateursGauche;     /**< 1 si le prédateur va vers la gauche */
+    std::vector<float> mPlantesX;               /**< Positions horizontales des plantes disponibles */
+    std::vector<float> mPlantesY;               /**< Positions verticales des plantes disponibles */
+    GrilleSpatiale mGrilleProies;               /**< Index de mProiesX/Y */
+    GrilleSpatiale mGrillePredateurs;           /**< Index de mPredateursX/Y */
+    GrilleSpatiale mGrillePlantes;              /**< Index de mPlantesX/Y */
+    std::vector<EspeceInstantane> mEspeces;     /**< Espèces du registre */
+    const RegistreEspeces* mRegistre;           /**< Registre des espèces (nullptr : aucune) */
+
+    ChampVegetation* mChamp;                    /**< Copie du champ de biomasse (possédée, créée au besoin) */
+    bool mAvecChamp;                            /**< Le champ est utilisé */
+    ModeleChampMoyen* mChampMoyen;              /**< Copie du modèle en champ moyen (possédée, créée au besoin) */
+    bool mAvecChampMoyen;                       /**< Le modèle est suivi */
+
+    int mNbPlantes;                             /**< Plantes disponibles (ou biomasse) */
+    int mNbPlantesConsommees;                   /**< Plantes consommées depuis le début */
+    int mNbProiesCourbe;                        /**< Proies et herbivores du registre */
+    int mNbPredateursCourbe;                    /**< Prédateurs et autres espèces du registre */
+    bool mAvecBudget;                           /**< Les naissances sont soumises à un budget */
+    float mUtilisationBudget;                   /**< Part du budget occupée */
+    uint64_t mNaissancesRefusees;               /**< Naissances refusées depuis le début */
+    bool mFreinage;                             /**< Naissances freinées */
+    bool mValide;                               /**< Une capture a eu lieu */
+
+public:
+    /**
+     * @brief Constructeur : instantané vide
+     */
+    InstantaneRendu();
+
+    /**
+     * @brief Destructeur libérant les copies
+     */
+    ~InstantaneRendu();
+
+    InstantaneRendu(const InstantaneRendu&) = delete;
+    InstantaneRendu& operator=(const InstantaneRendu&) = delete;
+
+    /**
+     * @brief Recopie l'état de l'écosystème entre deux ticks
+     * @param eco Écosystème (non modifié pendant la capture)
+     * @param champMoyen Modèle en champ moyen suivi (nullptr : aucun)
+     */
+    void Capturer(const Ecosysteme& eco, const ModeleChampMoyen* champMoyen);
+
+    /**
+     * @brief Indique si une capture a eu lieu
+     * @return false pour un instantané jamais rempli
+     */
+    bool EstValide() const;
+
+    /**
+     * @brief Récupère les entités situées dans une zone du monde
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @param proies Indices des proies trouvées (vidé puis rempli)
+     * @param predateurs Indices des prédateurs trouvés (vidé puis rempli)
+     * @param plantes Indices des plantes trouvées (vidé puis rempli)
+     */
+    void RequeteZone(float x0, float y0, float x1, float y1,
+                     std::vector<uint32_t>& proies,
+                     std::vector<uint32_t>& predateurs,
+                     std::vector<uint32_t>& plantes) const;
+
+    /**
+     * @brief Compte les animaux d'une zone sans les parcourir
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @return Nombre approché d'animaux dans la zone, espèces du registre comprises
+     */
+    int CompterAnimauxZone(float x0, float y0, float x1, float y1) const;
+
+    /**
+     * @brief Position et sens d'une proie
+     * @param i Indice renvoyé par RequeteZone
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return true si la proie va vers la gauche
+     */
+    bool GetProie(uint32_t i, float& x, float& y) const;
+
+    /**
+     * @brief Position et sens d'un prédateur
+     * @param i Indice renvoyé par RequeteZone
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return true si le prédateur va vers la gauche
+     */
+    bool GetPredateur(uint32_t i, float& x, float& y) const;
+
+    /**
+     * @brief Position d'une plante disponible
+     * @param i Indice renvoyé par RequeteZone
+     * @param x Position horizontale
+     * @param y Position verticale
+     */
+    void GetPlante(uint32_t i, float& x, float& y) const;
+
+    /**
+     * @brief Accès à l'index spatial des proies
+     * @return Grille des proies de l'instantané
+     */
+    const GrilleSpatiale& GetGrilleProies() const;
+
+    /**
+     * @brief Accès à l'index spatial des prédateurs
+     * @return Grille des prédateurs de l'instantané
+     */
+    const GrilleSpatiale& GetGrillePredateurs() const;
+
+    /**
+     * @brief Accès à l'index spatial des plantes disponibles
+     * @return Grille des plantes de l'instantané
+     */
+    const GrilleSpatiale& GetGrillePlantes() const;
+
+    /**
+     * @brief Accès au registre des espèces
+     * @return Registre, nullptr si aucun n'a été chargé
+     */
+    const RegistreEspeces* GetRegistre() const;
+
+    /**
+     * @brief Positions d'une espèce du registre
+     * @param espece Indice de l'espèce
+     * @return Positions et grille de l'espèce
+     */
+    const EspeceInstantane& GetEspece(int espece) const;
+
+    /**
+     * @brief Accès à la copie du champ de biomasse
+     * @return Champ, nullptr en mode plantes individuelles
+     */
+    const ChampVegetation* GetChampVegetation() const;
+
+    /**
+     * @brief Accès à la copie du modèle en champ moyen
+     * @return Modèle, nullptr s'il n'est pas suivi
+     */
+    const ModeleChampMoyen* GetChampMoyen() const;
+
+    /**
+     * @brief Effectifs des courbes : espèces du registre rangées selon leur régime
+     * @param proies Proies et herbivores
+     * @param predateurs Prédateurs et autres espèces
+     */
+    void GetEffectifsCourbes(int& proies, int& predateurs) const;
+
+    /**
+     * @brief Compte les plantes disponibles
+     * @return Nombre de plantes (biomasse du champ en équivalents plantes)
+     */
+    int GetNombrePlantes() const;
+
+    /**
+     * @brief Compte les plantes consommées depuis le début
+     * @return Nombre de plantes consommées
+     */
+    int GetTotalPlantesConsommees() const;
+
+    /**
+     * @brief État du budget de population
+     * @param utilisation Part du budget occupée (0 à 1)
+     * @param refusees Naissances refusées depuis le début
+     * @param freinage true si les naissances sont freinées
+     * @return false si aucun budget n'est défini (paramètres inchangés)
+     */
+    bool GetBudget(float& utilisation, uint64_t& refusees, bool& freinage) const;
+};
+
+#endif /* INSTANTANE_RENDU_H */
@@ -0,0 +1,335 @@
+/**
+ * @file ListesVoisins.cpp
+ * @brief Implémentation des listes de voisins à peau
+ */
+
+#include "ListesVoisins.h"
+#include "PolitiqueEspece.h"
+#include "Proie.h"
+#include "Predateur.h"
+#include "Plante.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructeur : grilles à cellules du plus grand rayon de liste
+ */
+ListesVoisins::ListesVoisins(float largeur, float hauteur)
+    : mNbPlantes(0),
+      mValides(false),
+      mReconstructions(0)
+{
+    const float rayonMax = std::max(PolitiqueEspece<Proie>::RAYON_DETECTION_PREDATEUR,
+                                    PolitiqueEspece<Predateur>::RAYON_DETECTION_PROIE) + PEAU;
+    mGrilleProies.Configurer(largeur, hauteur, rayonMax);
+    mGrillePredateurs.Configurer(largeur, hauteur, rayonMax);
+    mGrillePlantes.Configurer(largeur, hauteur, rayonMax);
+}
+
+/**
+ * @brief Requêtes de grille filtrées au rayon de détection plus la peau
+ */
+void ListesVoisins::Construire(const std::vector<Proie*>& proies,
+                               const std::vector<Predateur*>& predateurs,
+                               const std::vector<Plante*>& plantes)
+{
+    const float rayonMenace = PolitiqueEspece<Proie>::RAYON_DETECTION_PREDATEUR + PEAU;
+    const float rayonPlante = PolitiqueEspece<Proie>::RAYON_DETECTION_PLANTE + PEAU;
+    const float rayonCible = PolitiqueEspece<Predateur>::RAYON_DETECTION_PROIE + PEAU;
+
+    mProies.assign(proies.begin(), proies.end());
+    mPredateurs.assign(predateurs.begin(), predateurs.end());
+    mNbPlantes = plantes.size();
+
+    mXProies.resize(proies.size());
+    mYProies.resize(proies.size());
+    for (size_t i = 0; i < proies.size(); ++i)
+    {
+        mXProies[i] = proies[i]->GetX();
+        mYProies[i] = proies[i]->GetY();
+    }
+    mXPredateurs.resize(predateurs.size());
+    mYPredateurs.resize(predateurs.size());
+    for (size_t i = 0; i < predateurs.size(); ++i)
+    {
+        mXPredateurs[i] = predateurs[i]->GetX();
+        mYPredateurs[i] = predateurs[i]->GetY();
+    }
+
+    mGrilleProies.Construire(proies);
+    mGrillePredateurs.Construire(predateurs);
+    mGrillePlantes.Construire(plantes);
+
+    /* Proies : prédateurs et plantes disponibles à portée, peau comprise */
+    mDebutsMenaces.clear();
+    mMenaces.clear();
+    mDebutsPlantes.clear();
+    mPlantes.clear();
+    for (size_t i = 0; i < proies.size(); ++i)
+    {
+        float x = mXProies[i];
+        float y = mYProies[i];
+
+        mDebutsMenaces.push_back(static_cast<uint32_t>(mMenaces.size()));
+        mCandidats.clear();
+        mGrillePredateurs.RequeteRectangle(x - rayonMenace, y - rayonMenace, x + rayonMenace, y + rayonMenace, mCandidats);
+        for (uint32_t j : mCandidats)
+        {
+            float dx = mXPredateurs[j] - x;
+            float dy = mYPredateurs[j] - y;
+            if (dx * dx + dy * dy <= rayonMenace * rayonMenace)
+                mMenaces.push_back(j);
+        }
+
+        mDebutsPlantes.push_back(static_cast<uint32_t>(mPlantes.size()));
+        mCandidats.clear();
+        mGrillePlantes.RequeteRectangle(x - rayonPlante, y - rayonPlante, x + rayonPlante, y + rayonPlante, mCandidats);
+        for (uint32_t j : mCandidats)
+        {
+            /* Une plante consommée ne redevient jamais disponible */
+            if (!plantes[j]->EstDisponible())
+                continue;
+            float dx = plantes[j]->GetX() - x;
+            float dy = plantes[j]->GetY() - y;
+            if (dx * dx + dy * dy <= rayonPlante * rayonPlante)
+                mPlantes.push_back(j);
+        }
+    }
+    mDebutsMenaces.push_back(static_cast<uint32_t>(mMenaces.size()));
+    mDebutsPlantes.push_back(static_cast<uint32_t>(mPlantes.size()));
+
+    /* Prédateurs : proies à portée, peau comprise */
+    mDebutsCibles.clear();
+    mCibles.clear();
+    for (size_t i = 0; i < predateurs.size(); ++i)
+    {
+        float x = mXPredateurs[i];
+        float y = mYPredateurs[i];
+
+        mDebutsCibles.push_back(static_cast<uint32_t>(mCibles.size()));
+        mCandidats.clear();
+        mGrilleProies.RequeteRectangle(x - rayonCible, y - rayonCible, x + rayonCible, y + rayonCible, mCandidats);
+        for (uint32_t j : mCandidats)
+        {
+            float dx = mXProies[j] - x;
+            float dy = mYProies[j] - y;
+            if (dx * dx + dy * dy <= rayonCible * rayonCible)
+                mCibles.push_back(j);
+        }
+    }
+    mDebutsCibles.push_back(static_cast<uint32_t>(mCibles.size()));
+
+    /* Tout le monde vient d'être rangé : aucun nouveau venu */
+    mRangsProies.resize(proies.size());
+    for (size_t i = 0; i < proies.size(); ++i)
+        mRangsProies[i] = static_cast<int32_t>(i);
+    mRangsPredateurs.resize(predateurs.size());
+    for (size_t i = 0; i < predateurs.size(); ++i)
+        mRangsPredateurs[i] = static_cast<int32_t>(i);
+    mProiesArrivees.clear();
+    mPredateursArrives.clear();
+
+    mValides = true;
+    ++mReconstructions;
+}
+
+/**
+ * @brief Parcours conjoint : l'écosystème a retiré des morts et ajouté à la fin
+ */
+bool ListesVoisins::Apparier(const std::vector<Proie*>& proies,
+                             const std::vector<Predateur*>& predateurs,
+                             const std::vector<Plante*>& plantes,
+                             float deltaTime)
+{
+    /* Deux écarts depuis la construction, plus le pas d'un animal déjà mis à jour ce tick
+       (errance en diagonale : VITESSE_BASE * racine de 2) */
+    const float pasMax = std::max(PolitiqueEspece<Proie>::VITESSE_BASE, PolitiqueEspece<Predateur>::VITESSE_BASE)
+                       * std::sqrt(2.0f) * deltaTime;
+    const float seuil = 0.5f * (PEAU - pasMax);
+    const float seuilCarre = seuil * seuil;
+    if (plantes.size() < mNbPlantes)
+        return false;
+
+    mRangsProies.resize(proies.size());
+    mProiesArrivees.clear();
+    size_t k = 0;
+    for (size_t i = 0; i < proies.size(); ++i)
+    {
+        Proie* proie = proies[i];
+        while (k < mProies.size() && mProies[k] != proie)
+            ++k;
+        if (k == mProies.size())
+        {
+            mRangsProies[i] = -1;
+            mProiesArrivees.push_back(proie);
+            continue;
+        }
+        float dx = proie->GetX() - mXProies[k];
+        float dy = proie->GetY() - mYProies[k];
+        if (dx * dx + dy * dy > seuilCarre)
+            return false;
+        mRangsProies[i] = static_cast<int32_t>(k++);
+    }
+
+    mRangsPredateurs.resize(predateurs.size());
+    mPredateursArrives.clear();
+    k = 0;
+    for (size_t i = 0; i < predateurs.size(); ++i)
+    {
+        Predateur* pred = predateurs[i];
+        while (k < mPredateurs.size() && mPredateurs[k] != pred)
+            ++k;
+        if (k == mPredateurs.size())
+        {
+            mRangsPredateurs[i] = -1;
+            mPredateursArrives.push_back(pred);
+            continue;
+        }
+        float dx = pred->GetX() - mXPredateurs[k];
+        float dy = pred->GetY() - mYPredateurs[k];
+        if (dx * dx + dy * dy > seuilCarre)
+            return false;
+        mRangsPredateurs[i] = static_cast<int32_t>(k++);
+    }
+
+    /* Chaque nouveau venu allonge toutes les listes, et un nouveau-né cherche partout */
+    size_t arrivees = mProiesArrivees.size() + mPredateursArrives.size() + (plantes.size() - mNbPlantes);
+    size_t total = proies.size() + predateurs.size() + plantes.size();
+    return arrivees * PART_ARRIVEES_MAX <= total;
+}
+
+/**
+ * @brief Même boucle que MettreAJourLot, voisins lus dans les listes
+ */
+void ListesVoisins::MettreAJour(const std::vector<Proie*>& proies,
+                                const std::vector<Predateur*>& predateurs,
+                                const std::vector<Plante*>& plantes,
+                                float deltaTime,
+                                const ContexteMonde& monde,
+                                bool suivi)
+{
+    using PolitiqueProie = PolitiqueEspece<Proie>;
+    using PolitiquePredateur = PolitiqueEspece<Predateur>;
+
+    if (!mValides || !Apparier(proies, predateurs, plantes, deltaTime))
+        Construire(proies, predateurs, plantes);
+
+    /* Les proies ne regardent pas les autres proies */
+    mTamponProies.clear();
+    for (size_t i = 0; i < proies.size(); ++i)
+    {
+        Proie* proie = proies[i];
+        if (!proie->EstVivant())
+            continue;
+
+        int32_t rang = mRangsProies[i];
+        if (rang < 0)
+            proie->Proie::Comportement(proies, predateurs, plantes, monde);
+        else
+        {
+            mTamponPlantes.clear();
+            for (uint32_t v = mDebutsPlantes[rang]; v < mDebutsPlantes[rang + 1]; ++v)
+                mTamponPlantes.push_back(plantes[mPlantes[v]]);
+            mTamponPlantes.insert(mTamponPlantes.end(), plantes.begin() + mNbPlantes, plantes.end());
+
+            /* Le délai du suivi a besoin des deux plus proches, même hors des listes */
+            if (suivi)
+            {
+                proie->Proie::Comportement(mTamponProies, predateurs, mTamponPlantes, monde);
+            }
+            else
+            {
+                mTamponPredateurs.clear();
+                for (uint32_t v = mDebutsMenaces[rang]; v < mDebutsMenaces[rang + 1]; ++v)
+                {
+                    if (Predateur* pred = mPredateurs[mMenaces[v]])
+                        mTamponPredateurs.push_back(pred);
+                }
+                mTamponPredateurs.insert(mTamponPredateurs.end(), mPredateursArrives.begin(), mPredateursArrives.end());
+
+                proie->Proie::Comportement(mTamponProies, mTamponPredateurs, mTamponPlantes, monde);
+            }
+        }
+        proie->DeplacerSelon<PolitiqueProie>(deltaTime, monde);
+        proie->MetabolismeSelon<PolitiqueProie>(deltaTime);
+        proie->DecompterSuivi(deltaTime, monde);
+    }
+
+    /* Les prédateurs ne regardent que les proies */
+    mTamponPredateurs.clear();
+    mTamponPlantes.clear();
+    for (size_t i = 0; i < predateurs.size(); ++i)
+    {
+        Predateur* pred = predateurs[i];
+        if (!pred->EstVivant())
+            continue;
+
+        int32_t rang = mRangsPredateurs[i];
+        if (rang < 0 || suivi)
+            pred->Predateur::Comportement(proies, predateurs, plantes, monde);
+        else
+        {
+            mTamponProies.clear();
+            for (uint32_t v = mDebutsCibles[rang]; v < mDebutsCibles[rang + 1]; ++v)
+            {
+                if (Proie* proie = mProies[mCibles[v]])
+                    mTamponProies.push_back(proie);
+            }
+            mTamponProies.insert(mTamponProies.end(), mProiesArrivees.begin(), mProiesArrivees.end());
+
+            pred->Predateur::Comportement(mTamponProies, mTamponPredateurs, mTamponPlantes, monde);
+        }
+        pred->DeplacerSelon<PolitiquePredateur>(deltaTime, monde);
+        pred->MetabolismeSelon<PolitiquePredateur>(deltaTime);
+        pred->DecompterSuivi(deltaTime, monde);
+    }
+}
+
+/**
+ * @brief Les entrées des morts deviennent nullptr : aucune adresse libérée ne reste
+ */
+void ListesVoisins::OublierMorts()
+{
+    for (auto& proie : mProies)
+    {
+        if (proie && !proie->EstVivant())
+            proie = nullptr;
+    }
+    for (auto& pred : mPredateurs)
+    {
+        if (pred && !pred->EstVivant())
+            pred = nullptr;
+    }
+    mProiesArrivees.clear();
+    mPredateursArrives.clear();
+}
+
+/**
+ * @brief La prochaine mise à jour reconstruit tout
+ */
+void ListesVoisins::Invalider()
+{
+    /* Les entités peuvent avoir été libérées ou relogées : OublierMorts ne doit plus les lire */
+    mValides = false;
+    mProies.clear();
+    mPredateurs.clear();
+}
+
+/**
+ * @brief Nombre de constructions depuis la création
+ */
+int ListesVoisins::GetReconstructions() const
+{
+    return mReconstructions;
+}
+
+/**
+ * @brief Entrées des trois listes rapportées au nombre d'animaux
+ */
+float ListesVoisins::GetVoisinsMoyens() const
+{
+    size_t animaux = mProies.size() + mPredateurs.size();
+    if (animaux == 0)
+        return 0.0f;
+    return static_cast<float>(mMenaces.size() + mPlantes.size() + mCibles.size()) / animaux;
+}
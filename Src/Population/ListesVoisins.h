@@ -0,0 +1,159 @@
+/**
+ * @file ListesVoisins.h
+ * @brief Listes de voisins à peau (listes de Verlet), reconstruites quand les animaux ont assez bougé
+ */
+
+#ifndef LISTES_VOISINS_H
+#define LISTES_VOISINS_H
+
+#include "GrilleSpatiale.h"
+#include <cstdint>
+#include <vector>
+
+class Proie;
+class Predateur;
+class Plante;
+struct ContexteMonde;
+
+/**
+ * @class ListesVoisins
+ * @brief Candidats de détection de chaque animal, gardés d'un tick à l'autre
+ *
+ * À la construction, chaque proie retient les prédateurs et les plantes, et
+ * chaque prédateur les proies, situés à moins du rayon de détection plus une
+ * peau de PEAU pixels. Tant qu'aucun animal ne s'est déplacé de plus de
+ * PEAU / 2 depuis (moins le pas d'un tick : les animaux déjà mis à jour ont
+ * bougé quand les suivants regardent), deux animaux absents de la liste l'un
+ * de l'autre sont encore à plus du rayon de détection : la plus proche cible
+ * trouvée dans la liste est celle d'une recherche dans tout le monde. Les
+ * listes ne sont refaites (par les grilles) qu'au premier animal qui dépasse
+ * ce seuil.
+ *
+ * Avec le suivi, le délai d'une détection se calcule sur la plus proche et
+ * la deuxième plus proche cible, même hors de portée : une liste peut ne pas
+ * les contenir. Proies et prédateurs cherchent alors leur menace ou leur
+ * proie dans toute la population (le suivi espace déjà ces recherches) ;
+ * seules les plantes sont lues dans les listes.
+ *
+ * Entre deux constructions, les morts sont effacés et les nouveaux venus
+ * (naissances, arrivées, repousses) sont ajoutés à toutes les listes ; un
+ * nouveau-né cherche dans tout le monde jusqu'à la construction suivante,
+ * avancée si les nouveaux venus deviennent trop nombreux.
+ *
+ * Les entités sont appariées à celles de l'écosystème dans l'ordre de ses
+ * listes, qui ne font que retirer des morts et ajouter à la fin : un tick
+ * tire ses nombres aléatoires dans le même ordre qu'une mise à jour normale.
+ */
+class ListesVoisins
+{
+private:
+    std::vector<Proie*> mProies;            /**< Proies à la construction (nullptr une fois mortes) */
+    std::vector<Predateur*> mPredateurs;    /**< Prédateurs à la construction (nullptr une fois morts) */
+    std::vector<float> mXProies;            /**< Position horizontale de chaque proie à la construction */
+    std::vector<float> mYProies;            /**< Position verticale de chaque proie à la construction */
+    std::vector<float> mXPredateurs;        /**< Position horizontale de chaque prédateur à la construction */
+    std::vector<float> mYPredateurs;        /**< Position verticale de chaque prédateur à la construction */
+    size_t mNbPlantes;                      /**< Plantes de l'écosystème à la construction */
+
+    std::vector<uint32_t> mDebutsMenaces;   /**< Début des prédateurs voisins de chaque proie (taille proies + 1) */
+    std::vector<uint32_t> mMenaces;         /**< Indices dans mPredateurs, regroupés par proie */
+    std::vector<uint32_t> mDebutsPlantes;   /**< Début des plantes voisines de chaque proie (taille proies + 1) */
+    std::vector<uint32_t> mPlantes;         /**< Indices dans les plantes de l'écosystème, regroupés par proie */
+    std::vector<uint32_t> mDebutsCibles;    /**< Début des proies voisines de chaque prédateur (taille prédateurs + 1) */
+    std::vector<uint32_t> mCibles;          /**< Indices dans mProies, regroupés par prédateur */
+
+    std::vector<int32_t> mRangsProies;      /**< Entrée de chaque proie de l'écosystème dans mProies (-1 : nouvelle) */
+    std::vector<int32_t> mRangsPredateurs;  /**< Entrée de chaque prédateur de l'écosystème dans mPredateurs (-1 : nouveau) */
+    std::vector<Proie*> mProiesArrivees;            /**< Proies apparues depuis la construction */
+    std::vector<Predateur*> mPredateursArrives;     /**< Prédateurs apparus depuis la construction */
+
+    std::vector<Proie*> mTamponProies;          /**< Proies vues par l'animal courant (réutilisé) */
+    std::vector<Predateur*> mTamponPredateurs;  /**< Prédateurs vus par l'animal courant (réutilisé) */
+    std::vector<Plante*> mTamponPlantes;        /**< Plantes vues par l'animal courant (réutilisé) */
+    std::vector<uint32_t> mCandidats;           /**< Résultat des requêtes de grille (réutilisé) */
+
+    GrilleSpatiale mGrilleProies;       /**< Index des proies, le temps d'une construction */
+    GrilleSpatiale mGrillePredateurs;   /**< Index des prédateurs, le temps d'une construction */
+    GrilleSpatiale mGrillePlantes;      /**< Index des plantes, le temps d'une construction */
+
+    bool mValides;                      /**< Listes construites et encore utilisables */
+    int mReconstructions;               /**< Constructions depuis la création */
+
+    static constexpr float PEAU = 50.0f;                /**< Marge ajoutée aux rayons de détection (pixels) */
+    static constexpr int PART_ARRIVEES_MAX = 8;         /**< Reconstruction quand un animal sur 8 est nouveau */
+
+    /**
+     * @brief Reconstruit toutes les listes à partir des positions actuelles
+     * @param proies Proies de l'écosystème
+     * @param predateurs Prédateurs de l'écosystème
+     * @param plantes Plantes de l'écosystème (disponibles ou non)
+     */
+    void Construire(const std::vector<Proie*>& proies,
+                    const std::vector<Predateur*>& predateurs,
+                    const std::vector<Plante*>& plantes);
+
+    /**
+     * @brief Apparie les animaux de l'écosystème aux entrées des listes
+     * @param proies Proies de l'écosystème
+     * @param predateurs Prédateurs de l'écosystème
+     * @param plantes Plantes de l'écosystème
+     * @param deltaTime Pas du tick à venir
+     * @return false si un animal a trop bougé ou si les nouveaux venus sont trop nombreux
+     */
+    bool Apparier(const std::vector<Proie*>& proies,
+                  const std::vector<Predateur*>& predateurs,
+                  const std::vector<Plante*>& plantes,
+                  float deltaTime);
+
+public:
+    /**
+     * @brief Constructeur
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     */
+    ListesVoisins(float largeur, float hauteur);
+
+    /**
+     * @brief Comportement, déplacement et métabolisme de tous les animaux, voisins pris dans les listes
+     * @param proies Proies de l'écosystème
+     * @param predateurs Prédateurs de l'écosystème
+     * @param plantes Plantes de l'écosystème
+     * @param deltaTime Temps écoulé (secondes)
+     * @param monde Dimensions et végétation de l'écosystème
+     * @param suivi true si les animaux suivent leur cible (menaces et proies cherchées partout)
+     *
+     * Reconstruit d'abord les listes si elles ne garantissent plus la détection.
+     */
+    void MettreAJour(const std::vector<Proie*>& proies,
+                     const std::vector<Predateur*>& predateurs,
+                     const std::vector<Plante*>& plantes,
+                     float deltaTime,
+                     const ContexteMonde& monde,
+                     bool suivi);
+
+    /**
+     * @brief Efface les morts des listes
+     *
+     * À appeler avant que l'écosystème ne libère les animaux morts du tick.
+     */
+    void OublierMorts();
+
+    /**
+     * @brief Force une reconstruction (plantes libérées, populations remplacées)
+     */
+    void Invalider();
+
+    /**
+     * @brief Nombre de constructions depuis la création
+     * @return Reconstructions, la première comprise
+     */
+    int GetReconstructions() const;
+
+    /**
+     * @brief Taille moyenne des listes
+     * @return Voisins retenus par animal à la dernière construction
+     */
+    float GetVoisinsMoyens() const;
+};
+
+#endif /* LISTES_VOISINS_H */
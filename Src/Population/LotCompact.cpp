@@ -0,0 +1,253 @@
+/**
+ * @file LotCompact.cpp
+ * @brief Codage et décodage des états quantifiés
+ */
+
+#include "LotCompact.h"
+#include <algorithm>
+#include <cmath>
+
+static constexpr float DEUX_PI = 6.28318531f;
+
+/**
+ * @brief Cosinus et sinus des 256 caps, calculés une seule fois
+ */
+struct TableCaps
+{
+    float cos[256];
+    float sin[256];
+
+    TableCaps()
+    {
+        for (int c = 0; c < 256; c++)
+        {
+            cos[c] = std::cos(c * DEUX_PI / 256.0f);
+            sin[c] = std::sin(c * DEUX_PI / 256.0f);
+        }
+    }
+};
+
+static const TableCaps TABLE_CAPS;
+
+/**
+ * @brief Lot vide d'une seule cellule
+ */
+LotCompact::LotCompact()
+    : mTailleCellule(1.0f)
+    , mNbColonnes(1)
+    , mVitesseMax(1.0f)
+    , mTemps(0.0)
+    , mAlea(GRAINE_ARRONDIS)
+{
+}
+
+/**
+ * @brief La plage des positions codées est celle d'une cellule de la grille
+ */
+void LotCompact::Configurer(float largeur, float hauteur, float tailleCellule, float vitesseMax)
+{
+    grille.Configurer(largeur, hauteur, tailleCellule);
+    mTailleCellule = tailleCellule;
+    mNbColonnes = grille.GetNombreColonnes();
+    mVitesseMax = std::max(1.0f, vitesseMax);
+}
+
+/**
+ * @brief Partie entière plus un tirage xorshift comparé à la partie fractionnaire
+ */
+uint32_t LotCompact::Arrondir(float valeur, uint32_t maximum)
+{
+    mAlea ^= mAlea << 13;
+    mAlea ^= mAlea >> 17;
+    mAlea ^= mAlea << 5;
+
+    /* Comparé à part : valeur + aleatoire serait lui-même arrondi, vers le haut au-delà de quelques milliers */
+    float aleatoire = (mAlea >> 8) * (1.0f / 16777216.0f);
+    float entier = std::floor(valeur);
+    float arrondi = entier + ((aleatoire < valeur - entier) ? 1.0f : 0.0f);
+    if (arrondi <= 0.0f)
+        return 0;
+    return std::min(static_cast<uint32_t>(arrondi), maximum);
+}
+
+/**
+ * @brief Tops de 1/16 s depuis la création du lot, modulo 65536
+ */
+uint16_t LotCompact::Horloge() const
+{
+    return static_cast<uint16_t>(static_cast<uint64_t>(mTemps * TOPS_PAR_SECONDE));
+}
+
+/**
+ * @brief Norme depuis la classe, direction depuis la table des caps
+ */
+void LotCompact::Vitesse(size_t i, float& vx, float& vy) const
+{
+    float vitesse = (mAllure[i] & ~BIT_MUR) * (mVitesseMax / NB_CLASSES_VITESSE);
+    vx = vitesse * TABLE_CAPS.cos[mCap[i]];
+    vy = vitesse * TABLE_CAPS.sin[mCap[i]];
+}
+
+/**
+ * @brief Position et énergie arrondies au hasard, vitesse au plus proche
+ */
+void LotCompact::Ecrire(size_t i, float x, float y, float vx, float vy, float energie)
+{
+    uint32_t cellule = grille.CelluleDe(x, y);
+    float x0 = (cellule % mNbColonnes) * mTailleCellule;
+    float y0 = (cellule / mNbColonnes) * mTailleCellule;
+    float echelle = ECHELLE_POSITION / mTailleCellule;
+
+    mCellules[i] = cellule;
+    mX[i] = static_cast<uint16_t>(Arrondir((x - x0) * echelle, 65535));
+    mY[i] = static_cast<uint16_t>(Arrondir((y - y0) * echelle, 65535));
+    mEnergie[i] = (energie > 0.0f) ? static_cast<uint16_t>(Arrondir(energie * ECHELLE_ENERGIE, 65535)) : 0;
+
+    /* Une vitesse décodée se recode à l'identique : pas de dérive à cap constant */
+    float vitesse = std::sqrt(vx * vx + vy * vy);
+    int classe = std::min(NB_CLASSES_VITESSE,
+                          static_cast<int>(std::lround(vitesse * NB_CLASSES_VITESSE / mVitesseMax)));
+    if (classe > 0)
+        mCap[i] = static_cast<uint8_t>(std::lround(std::atan2(vy, vx) * (256.0f / DEUX_PI)) & 255);
+    mAllure[i] = static_cast<uint8_t>((mAllure[i] & BIT_MUR) | classe);
+}
+
+/**
+ * @brief L'horloge est commune au lot : rien à faire par individu
+ */
+void LotCompact::AvancerTemps(float deltaTime)
+{
+    mTemps += deltaTime;
+}
+
+/**
+ * @brief Le délai écoulé est mémorisé dans BIT_MUR, l'âge n'étant connu que modulo 65536 tops
+ */
+bool LotCompact::PeutSeReproduire(size_t i, float seuil, float delai)
+{
+    if (!(mAllure[i] & BIT_MUR))
+    {
+        uint16_t age = static_cast<uint16_t>(Horloge() - mReproduction[i]);
+        if (age >= delai * TOPS_PAR_SECONDE)
+            mAllure[i] |= BIT_MUR;
+    }
+    return (mAllure[i] & BIT_MUR) && Energie(i) > seuil;
+}
+
+/**
+ * @brief Énergie cédée, délai relancé
+ */
+void LotCompact::Reproduire(size_t i, float seuil)
+{
+    mEnergie[i] = static_cast<uint16_t>(Arrondir((Energie(i) - seuil) * ECHELLE_ENERGIE, 65535));
+    mAllure[i] &= ~BIT_MUR;
+    mReproduction[i] = Horloge();
+}
+
+/**
+ * @brief Nouvel individu codé en fin de lot
+ */
+void LotCompact::Ajouter(float x, float y, float vx, float vy)
+{
+    mCellules.push_back(0);
+    mX.push_back(0);
+    mY.push_back(0);
+    mEnergie.push_back(0);
+    mCap.push_back(0);
+    mAllure.push_back(0);
+    mReproduction.push_back(Horloge());
+    Ecrire(mX.size() - 1, x, y, vx, vy, 100.0f);
+}
+
+/**
+ * @brief Les vivants sont recopiés à la suite, dans leur ordre
+ */
+void LotCompact::RetirerMorts()
+{
+    size_t garde = 0;
+    for (size_t i = 0; i < Taille(); i++)
+    {
+        if (!mEnergie[i])
+            continue;
+        mCellules[garde] = mCellules[i];
+        mX[garde] = mX[i];
+        mY[garde] = mY[i];
+        mEnergie[garde] = mEnergie[i];
+        mCap[garde] = mCap[i];
+        mAllure[garde] = mAllure[i];
+        mReproduction[garde] = mReproduction[i];
+        garde++;
+    }
+    mCellules.resize(garde);
+    mX.resize(garde);
+    mY.resize(garde);
+    mEnergie.resize(garde);
+    mCap.resize(garde);
+    mAllure.resize(garde);
+    mReproduction.resize(garde);
+}
+
+/**
+ * @brief Attributs vidés sans rendre leur capacité, horloge et générateur remis à l'état initial
+ */
+void LotCompact::Vider()
+{
+    mCellules.clear();
+    mX.clear();
+    mY.clear();
+    mEnergie.clear();
+    mCap.clear();
+    mAllure.clear();
+    mReproduction.clear();
+    mTemps = 0.0;
+    mAlea = GRAINE_ARRONDIS;
+}
+
+/**
+ * @brief Rangement par comptage dans le tampon (cellules encore dans l'ordre d'origine), puis échange
+ */
+template<typename T>
+void LotCompact::Ranger(std::vector<T>& tableau, std::vector<T>& tampon)
+{
+    tampon.resize(tableau.size());
+
+    mCurseurs.assign(mDebuts.begin(), mDebuts.end() - 1);
+    for (size_t i = 0; i < tableau.size(); i++)
+        tampon[mCurseurs[mCellules[i]]++] = tableau[i];
+
+    /* L'ancien attribut devient le tampon du suivant de même largeur */
+    tableau.swap(tampon);
+}
+
+/**
+ * @brief Tri par comptage stable sur la cellule, attribut par attribut
+ *
+ * Aucune permutation n'est gardée : chaque attribut est rangé en suivant les
+ * cellules d'origine, qui ne sont réécrites qu'à la fin. La mémoire transitoire
+ * se limite à un tampon par largeur (2 puis 1 octet par individu), rendus aussitôt.
+ */
+void LotCompact::Indexer()
+{
+    const size_t nbCellules = static_cast<size_t>(grille.GetNombreColonnes()) * grille.GetNombreLignes();
+
+    mDebuts.assign(nbCellules + 1, 0);
+    for (uint32_t cellule : mCellules)
+        mDebuts[cellule + 1]++;
+    for (size_t c = 0; c < nbCellules; c++)
+        mDebuts[c + 1] += mDebuts[c];
+
+    Ranger(mX, mTampon16);
+    Ranger(mY, mTampon16);
+    Ranger(mEnergie, mTampon16);
+    Ranger(mReproduction, mTampon16);
+    std::vector<uint16_t>().swap(mTampon16);
+    Ranger(mCap, mTampon8);
+    Ranger(mAllure, mTampon8);
+    std::vector<uint8_t>().swap(mTampon8);
+
+    /* Les cellules triées se déduisent des comptages */
+    for (size_t c = 0; c < nbCellules; c++)
+        std::fill(mCellules.begin() + mDebuts[c], mCellules.begin() + mDebuts[c + 1], static_cast<uint32_t>(c));
+
+    grille.ConstruireTriee(mCellules);
+}
@@ -0,0 +1,236 @@
+/**
+ * @file LotCompact.h
+ * @brief Individus d'une espèce du registre en représentation quantifiée (14 octets par animal)
+ */
+
+#ifndef LOT_COMPACT_H
+#define LOT_COMPACT_H
+
+#include "GrilleSpatiale.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class LotCompact
+ * @brief Même interface que LotEspece, états codés sur des entiers courts
+ *
+ * Chaque individu occupe 14 octets, répartis dans un tableau par attribut :
+ * - cellule de la grille (32 bits) et position dans la cellule en virgule fixe
+ *   (2 x 16 bits, pas de TailleCellule / 65536, soit 1/256 px en cellules de 256) ;
+ * - énergie (16 bits, pas de 100 / 65535) ;
+ * - cap (8 bits, 256 directions) et classe de vitesse (7 bits, pas de
+ *   vitesseMax / 127), plus un bit « délai de reproduction écoulé » ;
+ * - instant de la dernière reproduction (16 bits, 1/16 s, modulo 65536).
+ *
+ * Les dimensions du monde et les paramètres de l'espèce restent dans le lot.
+ * Le lot est trié par cellule à chaque Indexer : la grille ne garde que les
+ * débuts de cellules, sans indice par individu.
+ *
+ * Réservé aux espèces du registre (PopulationGenerique) : Proie et Predateur
+ * restent des objets, désignés par pointeur (cibles, sommeil, collisions,
+ * relogement) et ne sont jamais quantifiés. Leur état rarement lu (minuterie
+ * de reproduction, délai de suivi, sommeil) est rangé hors de l'objet, sous
+ * leur rang (AnnexesAnimaux, PlanificateurSommeil).
+ *
+ * Bornes d'erreur par rapport au stockage en float, à 60 ticks/s :
+ * - position et énergie sont arrondies au hasard (arrondi stochastique), donc
+ *   sans biais ; l'écart type après n ticks vaut au plus pas * sqrt(n) / 2,
+ *   soit 0,12 px et 0,05 d'énergie après une minute ;
+ * - la direction est juste à 0,7° près, la vitesse à 0,4 % de vitesseMax près
+ *   (les 8 directions d'errance et les rebonds sont exacts) ;
+ * - le droit à la reproduction arrive à moins de 1/16 s de l'instant exact,
+ *   en avance ou en retard (naissance et horloge sont comptées en tops).
+ */
+class LotCompact
+{
+private:
+    static constexpr float ECHELLE_POSITION = 65536.0f;    /**< Pas de position par cellule */
+    static constexpr float ECHELLE_ENERGIE = 655.35f;      /**< Pas d'énergie par unité (100 -> 65535) */
+    static constexpr int NB_CLASSES_VITESSE = 127;         /**< Classes de vitesse (7 bits) */
+    static constexpr uint8_t BIT_MUR = 0x80;               /**< Délai de reproduction écoulé */
+    static constexpr float TOPS_PAR_SECONDE = 16.0f;       /**< Résolution de l'horloge de reproduction */
+    static constexpr uint32_t GRAINE_ARRONDIS = 0x9E3779B9u;  /**< État initial du générateur des arrondis */
+
+    std::vector<uint32_t> mCellules;        /**< Cellule de la grille contenant l'individu */
+    std::vector<uint16_t> mX;               /**< Position horizontale dans la cellule */
+    std::vector<uint16_t> mY;               /**< Position verticale dans la cellule */
+    std::vector<uint16_t> mEnergie;         /**< Énergie codée (0 : mort) */
+    std::vector<uint8_t> mCap;              /**< Direction en 1/256 de tour */
+    std::vector<uint8_t> mAllure;           /**< Classe de vitesse (bits 0-6) et BIT_MUR */
+    std::vector<uint16_t> mReproduction;    /**< Instant de la dernière reproduction (tops) */
+
+    float mTailleCellule;                   /**< Côté d'une cellule (pixels monde) */
+    int mNbColonnes;                        /**< Cellules par ligne de la grille */
+    float mVitesseMax;                      /**< Vitesse de la classe maximale */
+    double mTemps;                          /**< Temps écoulé depuis la création (secondes) */
+    uint32_t mAlea;                         /**< État du générateur des arrondis (xorshift) */
+
+    std::vector<uint32_t> mDebuts;          /**< Début de chaque cellule après le tri (tampon d'Indexer) */
+    std::vector<uint32_t> mCurseurs;        /**< Position d'écriture par cellule (tampon d'Indexer) */
+    std::vector<uint16_t> mTampon16;        /**< Copie triée d'un attribut 16 bits (tampon d'Indexer) */
+    std::vector<uint8_t> mTampon8;          /**< Copie triée d'un attribut 8 bits (tampon d'Indexer) */
+
+    /**
+     * @brief Arrondit au hasard à l'entier inférieur ou supérieur, sans biais
+     * @param valeur Valeur à coder
+     * @param maximum Plus grande valeur codable
+     * @return Entier dans [0, maximum]
+     */
+    uint32_t Arrondir(float valeur, uint32_t maximum);
+
+    /**
+     * @brief Instant courant de l'horloge de reproduction
+     * @return Tops modulo 65536
+     */
+    uint16_t Horloge() const;
+
+    /**
+     * @brief Range un attribut par cellule (tri par comptage stable)
+     * @param tableau Attribut à ranger, mCellules étant encore dans le même ordre
+     * @param tampon Tampon de même type, échangé avec tableau une fois rempli
+     */
+    template<typename T>
+    void Ranger(std::vector<T>& tableau, std::vector<T>& tampon);
+
+public:
+    GrilleSpatiale grille;                  /**< Débuts des cellules au début du tick */
+
+    /**
+     * @brief Constructeur d'un lot vide
+     */
+    LotCompact();
+
+    /**
+     * @brief Dimensionne la grille et l'échelle des vitesses
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param tailleCellule Côté des cellules (et de la plage des positions codées)
+     * @param vitesseMax Plus grande vitesse atteinte par l'espèce
+     */
+    void Configurer(float largeur, float hauteur, float tailleCellule, float vitesseMax);
+
+    /**
+     * @brief Nombre d'individus (morts du tick compris)
+     * @return Taille des tableaux
+     */
+    size_t Taille() const { return mX.size(); }
+
+    /**
+     * @brief Position horizontale décodée
+     * @param i Indice de l'individu
+     * @return Position X
+     */
+    float X(size_t i) const
+    {
+        return (mCellules[i] % mNbColonnes) * mTailleCellule + mX[i] * (mTailleCellule / ECHELLE_POSITION);
+    }
+
+    /**
+     * @brief Position verticale décodée
+     * @param i Indice de l'individu
+     * @return Position Y
+     */
+    float Y(size_t i) const
+    {
+        return (mCellules[i] / mNbColonnes) * mTailleCellule + mY[i] * (mTailleCellule / ECHELLE_POSITION);
+    }
+
+    /**
+     * @brief Indique si l'individu est vivant
+     * @param i Indice de l'individu
+     * @return true si son énergie codée est non nulle
+     */
+    bool EstVivant(size_t i) const { return mEnergie[i] != 0; }
+
+    /**
+     * @brief Tue l'individu (énergie nulle)
+     * @param i Indice de l'individu
+     */
+    void Tuer(size_t i) { mEnergie[i] = 0; }
+
+    /**
+     * @brief Énergie décodée
+     * @param i Indice de l'individu
+     * @return Énergie (0-100)
+     */
+    float Energie(size_t i) const { return mEnergie[i] / ECHELLE_ENERGIE; }
+
+    /**
+     * @brief Vitesse décodée
+     * @param i Indice de l'individu
+     * @param vx Vitesse horizontale
+     * @param vy Vitesse verticale
+     */
+    void Vitesse(size_t i, float& vx, float& vy) const;
+
+    /**
+     * @brief Code le nouvel état d'un individu (mort si l'énergie tombe à 0)
+     * @param i Indice de l'individu
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param vx Vitesse horizontale
+     * @param vy Vitesse verticale
+     * @param energie Énergie
+     */
+    void Ecrire(size_t i, float x, float y, float vx, float vy, float energie);
+
+    /**
+     * @brief Fait avancer l'horloge de reproduction du lot
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    void AvancerTemps(float deltaTime);
+
+    /**
+     * @brief Vérifie énergie et délai de reproduction
+     * @param i Indice de l'individu
+     * @param seuil Énergie minimale
+     * @param delai Délai depuis la dernière reproduction (moins de 4096 s)
+     * @return true si l'individu peut se reproduire
+     *
+     * À appeler à chaque tick pour chaque vivant : le délai écoulé y est
+     * mémorisé avant que l'horloge 16 bits ne fasse un tour.
+     */
+    bool PeutSeReproduire(size_t i, float seuil, float delai);
+
+    /**
+     * @brief Paie le coût de la reproduction et relance le délai
+     * @param i Indice du parent
+     * @param seuil Énergie cédée
+     */
+    void Reproduire(size_t i, float seuil);
+
+    /**
+     * @brief Ajoute un individu d'énergie pleine en fin de lot
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param vx Vitesse horizontale
+     * @param vy Vitesse verticale
+     */
+    void Ajouter(float x, float y, float vx, float vy);
+
+    /**
+     * @brief Compactage stable des vivants
+     */
+    void RetirerMorts();
+
+    /**
+     * @brief Retire tous les individus ; horloge et arrondis repartent comme un lot neuf
+     */
+    void Vider();
+
+    /**
+     * @brief Trie le lot par cellule et reconstruit la grille
+     */
+    void Indexer();
+
+    /**
+     * @brief Mémoire occupée par individu
+     * @return Octets des attributs d'un individu
+     */
+    static constexpr size_t OctetsParIndividu()
+    {
+        return sizeof(uint32_t) + 3 * sizeof(uint16_t) + 2 * sizeof(uint8_t) + sizeof(uint16_t);
+    }
+};
+
+#endif /* LOT_COMPACT_H */
@@ -0,0 +1,264 @@
+/**
+ * @file ModeleChampMoyen.cpp
+ * @brief Taux du champ moyen et intégration de Dormand-Prince
+ */
+
+#include "ModeleChampMoyen.h"
+#include "PolitiqueEspece.h"
+#include <algorithm>
+#include <cmath>
+
+/* Coefficients de Dormand-Prince 5(4) : étapes (la dernière ligne donne l'ordre 5), écart entre ordres 5 et 4.
+   Le second membre ne dépend pas du temps : les abscisses des étapes ne servent pas. */
+static const double A[7][6] = {
+    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+    {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+    {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0},
+    {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0},
+    {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0},
+    {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0},
+    {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0}
+};
+static const double E[7] = {71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0,
+                            -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0};
+
+/* Les détections comparent la distance au carré à 9999 au plus : portée effective de 100 px */
+static constexpr double DISTANCE_CARREE_MAX = 9999.0;
+
+/**
+ * @brief Vitesse moyenne en errance : quatre directions sur huit sont diagonales
+ */
+static double VitesseErrance(double vitesseBase)
+{
+    return vitesseBase * (1.0 + std::sqrt(2.0)) / 2.0;
+}
+
+/**
+ * @brief Consommation par consommateur : a ρ / (1 + a h ρ) (Holling type II)
+ */
+static double Consommation(double balayage, double capture, double densite)
+{
+    return balayage * densite / (1.0 + balayage * capture * densite);
+}
+
+/**
+ * @brief Petits par seconde : SEUIL d'énergie par petit, au plus un par DELAI
+ */
+static double TauxNaissance(double bilan, double seuil, double delai)
+{
+    return bilan > 0.0 ? bilan / (seuil + delai * bilan) : 0.0;
+}
+
+/**
+ * @brief Portées effectives et vitesses des deux espèces
+ */
+ModeleChampMoyen::ModeleChampMoyen(float largeur, float hauteur, float capacitePlantes, float repoussePlantes)
+    : mSurface(std::max(1.0, static_cast<double>(largeur) * hauteur))
+    , mCapacitePlantes(capacitePlantes)
+    , mRepoussePlantes(repoussePlantes)
+{
+    using PolitiqueProie = PolitiqueEspece<Proie>;
+    using PolitiquePredateur = PolitiqueEspece<Predateur>;
+
+    double porteePlante = std::min<double>(PolitiqueProie::RAYON_DETECTION_PLANTE, std::sqrt(DISTANCE_CARREE_MAX));
+    double porteeProie = std::min<double>(PolitiquePredateur::RAYON_DETECTION_PROIE, std::sqrt(DISTANCE_CARREE_MAX));
+
+    /* La proie marche droit vers la plante ; le prédateur ne gagne sur la proie en fuite que l'écart des vitesses */
+    mBalayageProie = 2.0 * porteePlante * VitesseErrance(PolitiqueProie::VITESSE_BASE);
+    mCaptureProie = (2.0 / 3.0 * porteePlante - PolitiqueProie::RAYON_ATTAQUE) / PolitiqueProie::VITESSE_BASE;
+    mBalayagePredateur = 2.0 * porteeProie * VitesseErrance(PolitiquePredateur::VITESSE_BASE);
+    mCapturePredateur = (2.0 / 3.0 * porteeProie - PolitiquePredateur::RAYON_ATTAQUE)
+                        / (PolitiquePredateur::VITESSE_BASE - PolitiqueProie::VITESSE_BASE);
+
+    mDepenseProie = PolitiqueProie::METABOLISME_BASE
+                  + PolitiqueProie::COUT_DEPLACEMENT * VitesseErrance(PolitiqueProie::VITESSE_BASE);
+    mDepensePredateur = PolitiquePredateur::METABOLISME_BASE
+                      + PolitiquePredateur::COUT_DEPLACEMENT * VitesseErrance(PolitiquePredateur::VITESSE_BASE);
+
+    Initialiser(0.0, 0.0, 0.0);
+}
+
+/**
+ * @brief Bilans d'énergie, naissances, morts de faim, prédation et repousse
+ */
+void ModeleChampMoyen::Deriver(const EtatChampMoyen& etat, EtatChampMoyen& derivee) const
+{
+    using PolitiqueProie = PolitiqueEspece<Proie>;
+    using PolitiquePredateur = PolitiqueEspece<Predateur>;
+
+    double plantesParProie = Consommation(mBalayageProie, mCaptureProie, etat.plantes / mSurface);
+    double proiesParPredateur = Consommation(mBalayagePredateur, mCapturePredateur, etat.proies / mSurface);
+
+    double bilanProie = plantesParProie * PolitiqueProie::ENERGIE_GAGNE_PAR_PLANTE - mDepenseProie;
+    double bilanPredateur = proiesParPredateur * PolitiquePredateur::ENERGIE_GAGNE_PAR_PROIE - mDepensePredateur;
+
+    double croissanceProie = TauxNaissance(bilanProie, PolitiqueProie::SEUIL_ENERGIE_REPRODUCTION,
+                                           PolitiqueProie::DELAI_REPRODUCTION)
+                           + std::min(0.0, bilanProie) / RESERVE_MOYENNE;
+    double croissancePredateur = TauxNaissance(bilanPredateur, PolitiquePredateur::SEUIL_ENERGIE_REPRODUCTION,
+                                               PolitiquePredateur::DELAI_REPRODUCTION)
+                               + std::min(0.0, bilanPredateur) / RESERVE_MOYENNE;
+
+    /* Comme FaireRepousser : rien au-delà du plafond, mais les plantes en surnombre restent */
+    double repousse = mRepoussePlantes * std::max(0.0, 1.0 - etat.plantes / mCapacitePlantes);
+
+    derivee.proies = etat.proies * croissanceProie - etat.predateurs * proiesParPredateur;
+    derivee.predateurs = etat.predateurs * croissancePredateur;
+    derivee.plantes = repousse - etat.proies * plantesParProie;
+}
+
+/**
+ * @brief Temps, pas et écarts remis à zéro
+ */
+void ModeleChampMoyen::Initialiser(double proies, double predateurs, double plantes)
+{
+    mEtat.proies = proies;
+    mEtat.predateurs = predateurs;
+    mEtat.plantes = plantes;
+    Deriver(mEtat, mDerivee);
+    mTemps = 0.0;
+    mPas = PAS_INITIAL;
+    mNbPas = 0;
+    mNbRejets = 0;
+    mSommeEcarts = {0.0, 0.0, 0.0};
+    mNbComparaisons = 0;
+}
+
+/**
+ * @brief Pas de Dormand-Prince ; la dernière étape d'un pas accepté sert de première au suivant
+ *
+ * Un monde figé (espèces éteintes, plantes au plafond) franchit la durée
+ * d'un coup : les dérivées ne peuvent plus changer les effectifs.
+ */
+long ModeleChampMoyen::Avancer(double duree)
+{
+    double fin = mTemps + duree;
+    long acceptes = 0;
+
+    while (mTemps < fin)
+    {
+        /* Monde figé : ce qui reste de la durée ne déplacerait aucun effectif de la tolérance */
+        double reste = fin - mTemps;
+        if (std::max({std::fabs(mDerivee.proies), std::fabs(mDerivee.predateurs), std::fabs(mDerivee.plantes)})
+            * reste <= TOLERANCE_ABSOLUE)
+        {
+            mTemps = fin;
+            break;
+        }
+
+        double pas = std::min(mPas, reste);
+
+        /* Étapes : k[0] est la dérivée au début du pas */
+        EtatChampMoyen k[7];
+        k[0] = mDerivee;
+        EtatChampMoyen essai = mEtat;
+        for (int etape = 1; etape < 7; etape++)
+        {
+            essai = mEtat;
+            for (int j = 0; j < etape; j++)
+            {
+                essai.proies += pas * A[etape][j] * k[j].proies;
+                essai.predateurs += pas * A[etape][j] * k[j].predateurs;
+                essai.plantes += pas * A[etape][j] * k[j].plantes;
+            }
+            Deriver(essai, k[etape]);
+        }
+
+        /* essai contient la solution d'ordre 5 (dernière ligne de A) */
+        EtatChampMoyen ecart = {0.0, 0.0, 0.0};
+        for (int etape = 0; etape < 7; etape++)
+        {
+            ecart.proies += pas * E[etape] * k[etape].proies;
+            ecart.predateurs += pas * E[etape] * k[etape].predateurs;
+            ecart.plantes += pas * E[etape] * k[etape].plantes;
+        }
+
+        auto norme = [](double e, double avant, double apres)
+        {
+            return std::fabs(e) / (TOLERANCE_ABSOLUE
+                                   + TOLERANCE_RELATIVE * std::max(std::fabs(avant), std::fabs(apres)));
+        };
+        double erreur = std::max({norme(ecart.proies, mEtat.proies, essai.proies),
+                                  norme(ecart.predateurs, mEtat.predateurs, essai.predateurs),
+                                  norme(ecart.plantes, mEtat.plantes, essai.plantes)});
+
+        /* Facteur de sécurité 0,9, pas multiplié par 0,2 à 5 */
+        double facteur = erreur > 0.0 ? 0.9 * std::pow(erreur, -0.2) : 5.0;
+        facteur = std::min(5.0, std::max(0.2, facteur));
+
+        if (erreur <= 1.0)
+        {
+            /* Une espèce éteinte reste à zéro : sa lente décroissance limiterait le pas sans rien changer */
+            mTemps += pas;
+            mEtat.proies = essai.proies < SEUIL_EXTINCTION ? 0.0 : essai.proies;
+            mEtat.predateurs = essai.predateurs < SEUIL_EXTINCTION ? 0.0 : essai.predateurs;
+            mEtat.plantes = std::max(0.0, essai.plantes);
+            mDerivee = k[6];
+            if (mEtat.proies != essai.proies || mEtat.predateurs != essai.predateurs
+                || mEtat.plantes != essai.plantes)
+                Deriver(mEtat, mDerivee);
+            mNbPas++;
+            acceptes++;
+
+            /* Un pas raccourci pour tomber sur la fin ne réduit pas le suivant */
+            mPas = std::min(PAS_MAX, std::max(mPas, pas) * facteur);
+        }
+        else
+        {
+            mNbRejets++;
+            mPas = pas * facteur;
+        }
+    }
+    return acceptes;
+}
+
+/**
+ * @brief Écart logarithmique, un individu ajouté des deux côtés pour supporter les extinctions
+ */
+void ModeleChampMoyen::Comparer(int proies, int predateurs, int plantes)
+{
+    double ecartProies = std::log((proies + 1.0) / (mEtat.proies + 1.0));
+    double ecartPredateurs = std::log((predateurs + 1.0) / (mEtat.predateurs + 1.0));
+    double ecartPlantes = std::log((plantes + 1.0) / (mEtat.plantes + 1.0));
+    mSommeEcarts.proies += ecartProies * ecartProies;
+    mSommeEcarts.predateurs += ecartPredateurs * ecartPredateurs;
+    mSommeEcarts.plantes += ecartPlantes * ecartPlantes;
+    mNbComparaisons++;
+}
+
+/**
+ * @brief Effectifs prévus au temps courant
+ */
+const EtatChampMoyen& ModeleChampMoyen::GetEtat() const
+{
+    return mEtat;
+}
+
+/**
+ * @brief Temps simulé depuis Initialiser
+ */
+double ModeleChampMoyen::GetTemps() const
+{
+    return mTemps;
+}
+
+/**
+ * @brief Pas acceptés et refusés
+ */
+void ModeleChampMoyen::GetPas(long& acceptes, long& rejetes) const
+{
+    acceptes = mNbPas;
+    rejetes = mNbRejets;
+}
+
+/**
+ * @brief exp(moyenne quadratique des écarts logarithmiques) - 1
+ */
+EtatChampMoyen ModeleChampMoyen::GetEcart() const
+{
+    if (mNbComparaisons == 0)
+        return {0.0, 0.0, 0.0};
+    return {std::exp(std::sqrt(mSommeEcarts.proies / mNbComparaisons)) - 1.0,
+            std::exp(std::sqrt(mSommeEcarts.predateurs / mNbComparaisons)) - 1.0,
+            std::exp(std::sqrt(mSommeEcarts.plantes / mNbComparaisons)) - 1.0};
+}
@@ -0,0 +1,139 @@
+/**
+ * @file ModeleChampMoyen.h
+ * @brief Modèle en champ moyen : équations proies-prédateurs-plantes tirées des constantes des agents
+ */
+
+#ifndef MODELE_CHAMP_MOYEN_H
+#define MODELE_CHAMP_MOYEN_H
+
+/**
+ * @struct EtatChampMoyen
+ * @brief Effectifs (continus) des trois populations
+ */
+struct EtatChampMoyen
+{
+    double proies;      /**< Proies */
+    double predateurs;  /**< Prédateurs */
+    double plantes;     /**< Plantes */
+};
+
+/**
+ * @class ModeleChampMoyen
+ * @brief Équations différentielles des populations, intégrées par Runge-Kutta adaptatif
+ *
+ * Les animaux sont supposés répartis uniformément. Chaque taux vient des
+ * constantes des agents :
+ *  - rencontres : un animal balaie une bande de la largeur de son rayon de
+ *    détection à sa vitesse ; temps de capture d'une cible détectée en
+ *    moyenne aux deux tiers du rayon (réponse de Holling de type II) ;
+ *  - bilan d'énergie : gain par plante ou par proie, moins métabolisme et
+ *    coût du déplacement en errance ;
+ *  - naissances : un bilan positif paie SEUIL_ENERGIE_REPRODUCTION par
+ *    petit, pas plus d'un par DELAI_REPRODUCTION ;
+ *  - morts : un bilan négatif épuise la réserve moyenne d'un animal ;
+ *  - plantes : repousse du plafond et du délai des plantes, nulle au plafond.
+ *
+ * Le solveur est celui de Dormand-Prince (ordres 5 et 4 emboîtés) : le pas
+ * grandit tant que l'écart entre les deux ordres reste sous la tolérance.
+ * Près de l'équilibre proies-plantes, dont les oscillations amorties durent
+ * quelques minutes, c'est la stabilité du schéma qui le borne (de l'ordre de
+ * 200 s) : mille heures coûtent une vingtaine de milliers de pas, quelques
+ * millisecondes, contre une microseconde pour une frame.
+ */
+class ModeleChampMoyen
+{
+private:
+    double mSurface;                /**< Surface du monde (pixels²) */
+    double mCapacitePlantes;        /**< Plafond de plantes */
+    double mRepoussePlantes;        /**< Plantes apparues par seconde sous le plafond */
+    double mBalayageProie;          /**< Surface explorée par une proie (pixels²/s) */
+    double mCaptureProie;           /**< Temps pour atteindre une plante détectée (s) */
+    double mBalayagePredateur;      /**< Surface explorée par un prédateur (pixels²/s) */
+    double mCapturePredateur;       /**< Temps pour rattraper une proie détectée (s) */
+    double mDepenseProie;           /**< Énergie dépensée par une proie (par seconde) */
+    double mDepensePredateur;       /**< Énergie dépensée par un prédateur (par seconde) */
+
+    EtatChampMoyen mEtat;           /**< Effectifs au temps mTemps */
+    EtatChampMoyen mDerivee;        /**< Dérivée en mEtat (première étape du pas suivant) */
+    double mTemps;                  /**< Temps simulé depuis Initialiser (s) */
+    double mPas;                    /**< Pas proposé pour la prochaine étape (s) */
+    long mNbPas;                    /**< Pas acceptés depuis Initialiser */
+    long mNbRejets;                 /**< Pas refusés depuis Initialiser */
+
+    EtatChampMoyen mSommeEcarts;    /**< Somme des carrés des écarts logarithmiques aux agents */
+    int mNbComparaisons;            /**< Relevés comparés */
+
+    static constexpr double TOLERANCE_RELATIVE = 1e-6;  /**< Écart relatif toléré par pas */
+    static constexpr double TOLERANCE_ABSOLUE = 1e-3;   /**< Écart absolu toléré par pas (individus) */
+    static constexpr double PAS_INITIAL = 1.0 / 60.0;   /**< Premier pas essayé (s) */
+    static constexpr double PAS_MAX = 600.0;            /**< Pas le plus long (s) */
+    static constexpr double RESERVE_MOYENNE = 50.0;     /**< Énergie moyenne d'un animal (sur 100) */
+    static constexpr double SEUIL_EXTINCTION = 0.01;    /**< Effectif d'animaux sous lequel l'espèce est éteinte */
+
+    /**
+     * @brief Évalue le second membre des équations
+     * @param etat Effectifs
+     * @param derivee Variation par seconde de chaque effectif
+     */
+    void Deriver(const EtatChampMoyen& etat, EtatChampMoyen& derivee) const;
+
+public:
+    /**
+     * @brief Tire les taux des constantes des espèces et de la végétation du monde
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param capacitePlantes Plafond de plantes du monde
+     * @param repoussePlantes Plantes apparues par seconde sous le plafond
+     */
+    ModeleChampMoyen(float largeur, float hauteur, float capacitePlantes, float repoussePlantes);
+
+    /**
+     * @brief Repart des effectifs donnés, au temps zéro
+     * @param proies Proies
+     * @param predateurs Prédateurs
+     * @param plantes Plantes
+     */
+    void Initialiser(double proies, double predateurs, double plantes);
+
+    /**
+     * @brief Intègre les équations sur une durée
+     * @param duree Temps simulé (secondes)
+     * @return Nombre de pas acceptés
+     */
+    long Avancer(double duree);
+
+    /**
+     * @brief Ajoute un relevé des agents au calcul de l'écart
+     * @param proies Proies des agents
+     * @param predateurs Prédateurs des agents
+     * @param plantes Plantes des agents
+     */
+    void Comparer(int proies, int predateurs, int plantes);
+
+    /**
+     * @brief Effectifs prévus au temps courant
+     * @return Proies, prédateurs et plantes
+     */
+    const EtatChampMoyen& GetEtat() const;
+
+    /**
+     * @brief Temps simulé depuis Initialiser
+     * @return Secondes
+     */
+    double GetTemps() const;
+
+    /**
+     * @brief Pas acceptés et refusés depuis Initialiser
+     * @param acceptes Pas acceptés
+     * @param rejetes Pas refusés (écart au-dessus de la tolérance)
+     */
+    void GetPas(long& acceptes, long& rejetes) const;
+
+    /**
+     * @brief Écart des agents au modèle sur tous les relevés comparés
+     * @return Par population, facteur moyen (moyenne quadratique des logarithmes) moins un : 0,25 = 25 %
+     */
+    EtatChampMoyen GetEcart() const;
+};
+
+#endif /* MODELE_CHAMP_MOYEN_H */
@@ -0,0 +1,436 @@
+/**
+ * @file PlanificateurSommeil.cpp
+ * @brief Implémentation du planificateur de sommeil
+ */
+
+#include "PlanificateurSommeil.h"
+#include "Plante.h"
+#include "PolitiqueEspece.h"
+#include "Predateur.h"
+#include "Proie.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+static_assert(PlanificateurSommeil::TAILLE_CELLULE >= PolitiqueEspece<Proie>::RAYON_DETECTION_PREDATEUR
+              && PlanificateurSommeil::TAILLE_CELLULE >= PolitiqueEspece<Proie>::RAYON_DETECTION_PLANTE
+              && PlanificateurSommeil::TAILLE_CELLULE >= PolitiqueEspece<Predateur>::RAYON_DETECTION_PROIE,
+              "Les cellules de veille doivent couvrir tout rayon de détection");
+
+/**
+ * @brief Découpe le monde en cellules de veille vides
+ */
+PlanificateurSommeil::PlanificateurSommeil(const ContexteMonde& monde)
+    : mMonde(&monde)
+    , mNbColonnes(std::max(1, static_cast<int>(std::ceil(monde.largeur / TAILLE_CELLULE))))
+    , mNbLignes(std::max(1, static_cast<int>(std::ceil(monde.hauteur / TAILLE_CELLULE))))
+    , mCellules(static_cast<size_t>(mNbColonnes) * mNbLignes)
+    , mTemps(0.0)
+    , mProchainJeton(1)
+{
+    for (auto& cellule : mCellules)
+    {
+        cellule.nbProies = 0;
+        cellule.nbPredateurs = 0;
+        cellule.nbPlantes = 0;
+    }
+}
+
+/**
+ * @brief Entrée du rang de l'animal
+ */
+PlanificateurSommeil::EtatSommeil& PlanificateurSommeil::EtatDe(const Animal* animal)
+{
+    return mEtats[animal->GetRang()];
+}
+
+/**
+ * @brief Entrée du rang de l'animal
+ */
+const PlanificateurSommeil::EtatSommeil& PlanificateurSommeil::EtatDe(const Animal* animal) const
+{
+    return mEtats[animal->GetRang()];
+}
+
+/**
+ * @brief Un rang jamais vu agrandit la table ; un rang repris écrase l'état du mort
+ */
+void PlanificateurSommeil::Inscrire(const Animal* animal, int cellule)
+{
+    if (animal->GetRang() >= mEtats.size())
+        mEtats.resize(animal->GetRang() + 1);
+    EtatDe(animal).cellule = cellule;
+}
+
+/**
+ * @brief Cellule d'un point, bornée aux limites du monde
+ */
+int PlanificateurSommeil::CelluleDe(float x, float y) const
+{
+    int colonne = std::min(std::max(static_cast<int>(x / TAILLE_CELLULE), 0), mNbColonnes - 1);
+    int ligne = std::min(std::max(static_cast<int>(y / TAILLE_CELLULE), 0), mNbLignes - 1);
+    return ligne * mNbColonnes + colonne;
+}
+
+/**
+ * @brief Met à jour le compteur de proies d'une cellule
+ */
+void PlanificateurSommeil::Compter(int cellule, const Proie*, int delta)
+{
+    if (cellule >= 0)
+        mCellules[cellule].nbProies += delta;
+}
+
+/**
+ * @brief Met à jour le compteur de prédateurs d'une cellule
+ */
+void PlanificateurSommeil::Compter(int cellule, const Predateur*, int delta)
+{
+    if (cellule >= 0)
+        mCellules[cellule].nbPredateurs += delta;
+}
+
+/**
+ * @brief Une proie perçoit prédateurs et plantes
+ */
+bool PlanificateurSommeil::VoisinageCalme(int cellule, const Proie*) const
+{
+    int colonne = cellule % mNbColonnes;
+    int ligne = cellule / mNbColonnes;
+
+    for (int l = std::max(0, ligne - 1); l <= std::min(mNbLignes - 1, ligne + 1); l++)
+    {
+        for (int c = std::max(0, colonne - 1); c <= std::min(mNbColonnes - 1, colonne + 1); c++)
+        {
+            const CelluleVeille& voisine = mCellules[l * mNbColonnes + c];
+            if (voisine.nbPredateurs > 0 || voisine.nbPlantes > 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Un prédateur ne perçoit que les proies
+ */
+bool PlanificateurSommeil::VoisinageCalme(int cellule, const Predateur*) const
+{
+    int colonne = cellule % mNbColonnes;
+    int ligne = cellule / mNbColonnes;
+
+    for (int l = std::max(0, ligne - 1); l <= std::min(mNbLignes - 1, ligne + 1); l++)
+    {
+        for (int c = std::max(0, colonne - 1); c <= std::min(mNbColonnes - 1, colonne + 1); c++)
+        {
+            if (mCellules[l * mNbColonnes + c].nbProies > 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Réveille les dormeurs des 3 x 3 cellules autour d'une arrivée
+ */
+void PlanificateurSommeil::ReveillerAutour(int cellule, bool proies, bool predateurs)
+{
+    int colonne = cellule % mNbColonnes;
+    int ligne = cellule / mNbColonnes;
+
+    for (int l = std::max(0, ligne - 1); l <= std::min(mNbLignes - 1, ligne + 1); l++)
+    {
+        for (int c = std::max(0, colonne - 1); c <= std::min(mNbColonnes - 1, colonne + 1); c++)
+        {
+            CelluleVeille& voisine = mCellules[l * mNbColonnes + c];
+
+            /* Reveiller retire le dormeur de la liste : on la vide par la fin */
+            while (proies && !voisine.proiesEndormies.empty())
+                Reveiller(voisine.proiesEndormies.back(), false);
+            while (predateurs && !voisine.predateursEndormis.empty())
+                Reveiller(voisine.predateursEndormis.back(), false);
+        }
+    }
+}
+
+/**
+ * @brief Rattrape le dormeur et le rend à la mise à jour
+ */
+template<typename Espece>
+void PlanificateurSommeil::Reveiller(Espece* animal, bool changerDirection)
+{
+    const EtatSommeil& etat = EtatDe(animal);
+    CelluleVeille& cellule = mCellules[etat.cellule];
+
+    if constexpr (std::is_same<Espece, Proie>::value)
+    {
+        mProiesEndormies.erase(etat.jeton);
+        auto& dormeurs = cellule.proiesEndormies;
+        dormeurs.erase(std::find(dormeurs.begin(), dormeurs.end(), animal));
+        mProiesEveillees.push_back(animal);
+    }
+    else
+    {
+        mPredateursEndormis.erase(etat.jeton);
+        auto& dormeurs = cellule.predateursEndormis;
+        dormeurs.erase(std::find(dormeurs.begin(), dormeurs.end(), animal));
+        mPredateursEveilles.push_back(animal);
+    }
+
+    float duree = static_cast<float>(mTemps - etat.debut);
+    animal->template ReveillerSelon<PolitiqueEspece<Espece>>(duree, changerDirection, *mMonde);
+}
+
+/**
+ * @brief Fige l'animal et programme le premier de ses événements
+ */
+template<typename Espece>
+void PlanificateurSommeil::Endormir(Espece* animal)
+{
+    using Politique = PolitiqueEspece<Espece>;
+
+    int indice = EtatDe(animal).cellule;
+    float x0 = (indice % mNbColonnes) * TAILLE_CELLULE;
+    float y0 = (indice / mNbColonnes) * TAILLE_CELLULE;
+
+    Reveil reveil;
+    reveil.changerDirection = false;
+    double duree = animal->template DureeAvantEvenementSelon<Politique>(x0, y0, x0 + TAILLE_CELLULE,
+                                                                        y0 + TAILLE_CELLULE, *mMonde);
+
+    /* Chance par tick -> loi exponentielle de même taux moyen */
+    double taux = Politique::CHANCE_CHANGEMENT_DIRECTION / 100.0 * TICKS_PAR_SECONDE;
+    double tirage = 1.0 - mMonde->alea->Reel();    /* ]0, 1] : le logarithme reste fini */
+    double avantVirage = -std::log(tirage) / taux;
+    if (avantVirage < duree)
+    {
+        duree = avantVirage;
+        reveil.changerDirection = true;
+    }
+
+    reveil.jeton = mProchainJeton++;
+    reveil.instant = mTemps + duree;
+    mAgenda.push(reveil);
+
+    EtatDe(animal).debut = mTemps;
+    EtatDe(animal).jeton = reveil.jeton;
+    animal->Endormir();
+    if constexpr (std::is_same<Espece, Proie>::value)
+    {
+        mProiesEndormies[reveil.jeton] = animal;
+        mCellules[indice].proiesEndormies.push_back(animal);
+    }
+    else
+    {
+        mPredateursEndormis[reveil.jeton] = animal;
+        mCellules[indice].predateursEndormis.push_back(animal);
+    }
+}
+
+/**
+ * @brief Suit une proie éveillée ; les prédateurs voisins endormis la voient arriver
+ */
+void PlanificateurSommeil::Suivre(Proie* proie)
+{
+    int cellule = CelluleDe(proie->GetX(), proie->GetY());
+    Inscrire(proie, cellule);
+    Compter(cellule, proie, +1);
+    mProiesEveillees.push_back(proie);
+    ReveillerAutour(cellule, false, true);
+}
+
+/**
+ * @brief Suit un prédateur éveillé ; les proies voisines endormies le voient arriver
+ */
+void PlanificateurSommeil::Suivre(Predateur* predateur)
+{
+    int cellule = CelluleDe(predateur->GetX(), predateur->GetY());
+    Inscrire(predateur, cellule);
+    Compter(cellule, predateur, +1);
+    mPredateursEveilles.push_back(predateur);
+    ReveillerAutour(cellule, true, false);
+}
+
+/**
+ * @brief Une plante apparue réveille les proies voisines
+ */
+void PlanificateurSommeil::AjouterPlante(const Plante* plante)
+{
+    int cellule = CelluleDe(plante->GetX(), plante->GetY());
+    mCellules[cellule].nbPlantes++;
+    ReveillerAutour(cellule, true, false);
+}
+
+/**
+ * @brief Une plante consommée ne retient plus personne
+ */
+void PlanificateurSommeil::RetirerPlante(const Plante* plante)
+{
+    mCellules[CelluleDe(plante->GetX(), plante->GetY())].nbPlantes--;
+}
+
+/**
+ * @brief Dépile les réveils du tick (les jetons périmés sont ignorés)
+ */
+void PlanificateurSommeil::Avancer(float deltaTime)
+{
+    double fin = mTemps + deltaTime;
+
+    while (!mAgenda.empty() && mAgenda.top().instant <= fin)
+    {
+        Reveil reveil = mAgenda.top();
+        mAgenda.pop();
+
+        auto proie = mProiesEndormies.find(reveil.jeton);
+        if (proie != mProiesEndormies.end())
+        {
+            Reveiller(proie->second, reveil.changerDirection);
+            continue;
+        }
+
+        auto predateur = mPredateursEndormis.find(reveil.jeton);
+        if (predateur != mPredateursEndormis.end())
+            Reveiller(predateur->second, reveil.changerDirection);
+    }
+
+    mTemps = fin;
+}
+
+/**
+ * @brief Deux passes : d'abord tous les comptages, ensuite les endormissements
+ */
+template<typename Espece>
+void PlanificateurSommeil::ActualiserLot(std::vector<Espece*>& eveilles)
+{
+    const bool estProie = std::is_same<Espece, Proie>::value;
+
+    /* 1. Morts et changements de cellule (un arrivant réveille l'autre espèce) */
+    size_t garde = 0;
+    for (size_t i = 0; i < eveilles.size(); i++)
+    {
+        Espece* animal = eveilles[i];
+        int ancienne = EtatDe(animal).cellule;
+
+        if (!animal->EstVivant())
+        {
+            Compter(ancienne, animal, -1);
+            EtatDe(animal).cellule = -1;
+            continue;
+        }
+
+        int cellule = CelluleDe(animal->GetX(), animal->GetY());
+        if (cellule != ancienne)
+        {
+            Compter(ancienne, animal, -1);
+            Compter(cellule, animal, +1);
+            EtatDe(animal).cellule = cellule;
+            ReveillerAutour(cellule, !estProie, estProie);
+        }
+        eveilles[garde++] = animal;
+    }
+    eveilles.resize(garde);
+}
+
+/**
+ * @brief Bilan des deux espèces puis mise en sommeil des calmes
+ */
+void PlanificateurSommeil::Actualiser()
+{
+    ActualiserLot(mProiesEveillees);
+    ActualiserLot(mPredateursEveilles);
+
+    /* Les comptages sont à jour : chaque éveillé calme peut s'endormir */
+    size_t garde = 0;
+    for (Proie* proie : mProiesEveillees)
+    {
+        if (VoisinageCalme(EtatDe(proie).cellule, proie)
+            && !proie->PeutSeReproduireSelon<PolitiqueEspece<Proie>>(*mMonde))
+            Endormir(proie);
+        else
+            mProiesEveillees[garde++] = proie;
+    }
+    mProiesEveillees.resize(garde);
+
+    garde = 0;
+    for (Predateur* predateur : mPredateursEveilles)
+    {
+        if (VoisinageCalme(EtatDe(predateur).cellule, predateur)
+            && !predateur->PeutSeReproduireSelon<PolitiqueEspece<Predateur>>(*mMonde))
+            Endormir(predateur);
+        else
+            mPredateursEveilles[garde++] = predateur;
+    }
+    mPredateursEveilles.resize(garde);
+}
+
+/**
+ * @brief Rattrape tous les dormeurs ; l'agenda devient inutile
+ */
+void PlanificateurSommeil::ToutReveiller()
+{
+    for (auto& cellule : mCellules)
+    {
+        while (!cellule.proiesEndormies.empty())
+            Reveiller(cellule.proiesEndormies.back(), false);
+        while (!cellule.predateursEndormis.empty())
+            Reveiller(cellule.predateursEndormis.back(), false);
+    }
+    mAgenda = decltype(mAgenda)();
+}
+
+/**
+ * @brief Cellules, agenda et tables vidés sans rendre leur capacité
+ */
+void PlanificateurSommeil::Vider()
+{
+    for (auto& cellule : mCellules)
+    {
+        cellule.nbProies = 0;
+        cellule.nbPredateurs = 0;
+        cellule.nbPlantes = 0;
+        cellule.proiesEndormies.clear();
+        cellule.predateursEndormis.clear();
+    }
+
+    /* priority_queue n'a pas de clear : dépiler garde le tableau sous-jacent */
+    while (!mAgenda.empty())
+        mAgenda.pop();
+    mProiesEndormies.clear();
+    mPredateursEndormis.clear();
+    mProiesEveillees.clear();
+    mPredateursEveilles.clear();
+    mTemps = 0.0;
+    mProchainJeton = 1;
+}
+
+/**
+ * @brief Accès aux proies éveillées
+ */
+const std::vector<Proie*>& PlanificateurSommeil::GetProiesEveillees() const
+{
+    return mProiesEveillees;
+}
+
+/**
+ * @brief Accès aux prédateurs éveillés
+ */
+const std::vector<Predateur*>& PlanificateurSommeil::GetPredateursEveilles() const
+{
+    return mPredateursEveilles;
+}
+
+/**
+ * @brief Prolonge la trajectoire depuis l'instant d'endormissement
+ */
+void PlanificateurSommeil::PositionEndormie(const Animal* animal, float& x, float& y) const
+{
+    float duree = animal->EstEndormi() ? static_cast<float>(mTemps - EtatDe(animal).debut) : 0.0f;
+    animal->PositionApres(duree, x, y);
+}
+
+/**
+ * @brief Compte les animaux endormis
+ */
+int PlanificateurSommeil::GetNombreEndormis() const
+{
+    return static_cast<int>(mProiesEndormies.size() + mPredateursEndormis.size());
+}
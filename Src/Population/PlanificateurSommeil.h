@@ -0,0 +1,258 @@
+/**
+ * @file PlanificateurSommeil.h
+ * @brief Mise en sommeil des animaux isolés, réveillés sur événement
+ */
+
+#ifndef PLANIFICATEUR_SOMMEIL_H
+#define PLANIFICATEUR_SOMMEIL_H
+
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+class Animal;
+class Proie;
+class Predateur;
+class Plante;
+struct ContexteMonde;
+
+/**
+ * @class PlanificateurSommeil
+ * @brief Endort les animaux sans voisin utile et ne les réveille que sur événement
+ *
+ * Le monde est couvert de cellules de veille de côté TAILLE_CELLULE, au moins
+ * égal au plus grand rayon de détection : tout ce qu'un animal peut percevoir
+ * est dans les 3 x 3 cellules autour de la sienne. Un animal s'endort quand ce
+ * voisinage ne contient ni menace ni nourriture et qu'il ne peut pas se
+ * reproduire. Il file alors en ligne droite : position et énergie suivent une
+ * formule fermée, sans aucun calcul par tick.
+ *
+ * Il se réveille au premier événement prévu à l'endormissement (changement de
+ * direction, sortie de cellule ou rebond, épuisement, droit à la reproduction)
+ * ou quand une menace ou de la nourriture entre dans son voisinage. Un dormeur
+ * ne peut donc être perçu par personne : seuls les éveillés sont parcourus.
+ */
+class PlanificateurSommeil
+{
+private:
+    /**
+     * @struct CelluleVeille
+     * @brief Occupants d'une cellule (éveillés et endormis) et dormeurs à prévenir
+     */
+    struct CelluleVeille
+    {
+        int nbProies;                               /**< Proies présentes */
+        int nbPredateurs;                           /**< Prédateurs présents */
+        int nbPlantes;                              /**< Plantes disponibles */
+        std::vector<Proie*> proiesEndormies;        /**< Proies endormies ici */
+        std::vector<Predateur*> predateursEndormis; /**< Prédateurs endormis ici */
+    };
+
+    /**
+     * @struct EtatSommeil
+     * @brief Ce que le planificateur sait d'un animal suivi, rangé sous le rang de l'animal
+     */
+    struct EtatSommeil
+    {
+        double debut;                   /**< Instant d'endormissement (position et énergie y sont figées) */
+        unsigned long jeton;            /**< Identifiant du sommeil en cours */
+        int cellule;                    /**< Cellule de veille occupée (-1 : non suivi) */
+    };
+
+    /**
+     * @struct Reveil
+     * @brief Réveil programmé (périmé si le jeton n'est plus celui d'un dormeur)
+     */
+    struct Reveil
+    {
+        double instant;                 /**< Instant du réveil */
+        unsigned long jeton;            /**< Sommeil concerné */
+        bool changerDirection;          /**< Réveil dû à un changement de direction */
+
+        bool operator>(const Reveil& autre) const { return instant > autre.instant; }
+    };
+
+    const ContexteMonde* mMonde;        /**< Monde de l'écosystème propriétaire (bornes des trajectoires) */
+    int mNbColonnes;                    /**< Colonnes de cellules */
+    int mNbLignes;                      /**< Lignes de cellules */
+    std::vector<CelluleVeille> mCellules;   /**< Cellules, rangées ligne par ligne */
+    std::vector<EtatSommeil> mEtats;    /**< État des animaux suivis, indexé par leur rang (AnnexesAnimaux) */
+    double mTemps;                      /**< Horloge de la simulation (secondes) */
+    unsigned long mProchainJeton;       /**< Jeton du prochain sommeil */
+
+    std::priority_queue<Reveil, std::vector<Reveil>, std::greater<Reveil>> mAgenda;  /**< Réveils à venir */
+    std::unordered_map<unsigned long, Proie*> mProiesEndormies;         /**< Proies endormies par jeton */
+    std::unordered_map<unsigned long, Predateur*> mPredateursEndormis;  /**< Prédateurs endormis par jeton */
+    std::vector<Proie*> mProiesEveillees;           /**< Proies mises à jour ce tick */
+    std::vector<Predateur*> mPredateursEveilles;    /**< Prédateurs mis à jour ce tick */
+
+    static constexpr float TICKS_PAR_SECONDE = 60.0f;   /**< Cadence de référence des chances par tick */
+
+    /**
+     * @brief État d'un animal suivi
+     * @param animal Animal accueilli par l'écosystème (rang valide)
+     * @return Entrée du rang de l'animal
+     */
+    EtatSommeil& EtatDe(const Animal* animal);
+    const EtatSommeil& EtatDe(const Animal* animal) const;
+
+    /**
+     * @brief Agrandit la table des états jusqu'au rang d'un nouvel animal suivi
+     * @param animal Animal à suivre
+     * @param cellule Cellule de veille occupée
+     */
+    void Inscrire(const Animal* animal, int cellule);
+
+    /**
+     * @brief Trouve la cellule contenant un point
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @return Indice de la cellule
+     */
+    int CelluleDe(float x, float y) const;
+
+    /**
+     * @brief Ajoute ou retire un occupant d'une cellule
+     * @param cellule Indice de la cellule (-1 : ignoré)
+     * @param animal Animal compté (choisit le compteur)
+     * @param delta +1 ou -1
+     */
+    void Compter(int cellule, const Proie* animal, int delta);
+    void Compter(int cellule, const Predateur* animal, int delta);
+
+    /**
+     * @brief Vérifie qu'aucune menace ni nourriture n'est à portée de perception
+     * @param cellule Cellule de l'animal
+     * @param animal Animal testé (choisit ce qui compte)
+     * @return true si l'animal peut dormir
+     */
+    bool VoisinageCalme(int cellule, const Proie* animal) const;
+    bool VoisinageCalme(int cellule, const Predateur* animal) const;
+
+    /**
+     * @brief Réveille les dormeurs voisins concernés par un nouvel arrivant
+     * @param cellule Cellule d'arrivée
+     * @param proies true pour réveiller les proies
+     * @param predateurs true pour réveiller les prédateurs
+     */
+    void ReveillerAutour(int cellule, bool proies, bool predateurs);
+
+    /**
+     * @brief Réveille un dormeur et le remet dans la liste des éveillés
+     * @tparam Espece Proie ou Predateur
+     * @param animal Dormeur
+     * @param changerDirection true si le réveil est un changement de direction
+     */
+    template<typename Espece>
+    void Reveiller(Espece* animal, bool changerDirection);
+
+    /**
+     * @brief Endort un animal et programme son réveil
+     * @tparam Espece Proie ou Predateur
+     * @param animal Animal éveillé, calme
+     */
+    template<typename Espece>
+    void Endormir(Espece* animal);
+
+    /**
+     * @brief Retire les morts, suit les changements de cellule et endort les calmes
+     * @tparam Espece Proie ou Predateur
+     * @param eveilles Éveillés de l'espèce (compactés sur place)
+     */
+    template<typename Espece>
+    void ActualiserLot(std::vector<Espece*>& eveilles);
+
+public:
+    static constexpr float TAILLE_CELLULE = 150.0f;     /**< Côté d'une cellule (>= tout rayon de détection) */
+
+    /**
+     * @brief Constructeur
+     * @param monde Monde de l'écosystème propriétaire (doit survivre au planificateur)
+     */
+    explicit PlanificateurSommeil(const ContexteMonde& monde);
+
+    /**
+     * @brief Suit un animal éveillé (population initiale, naissance)
+     * @param proie Proie à suivre
+     */
+    void Suivre(Proie* proie);
+
+    /**
+     * @brief Suit un animal éveillé (population initiale, naissance)
+     * @param predateur Prédateur à suivre
+     */
+    void Suivre(Predateur* predateur);
+
+    /**
+     * @brief Signale une plante devenue disponible (réveille les proies voisines)
+     * @param plante Plante apparue
+     */
+    void AjouterPlante(const Plante* plante);
+
+    /**
+     * @brief Signale une plante consommée
+     * @param plante Plante consommée
+     */
+    void RetirerPlante(const Plante* plante);
+
+    /**
+     * @brief Réveille les dormeurs dont l'événement tombe dans le tick, puis avance l'horloge
+     * @param deltaTime Durée du tick (secondes)
+     *
+     * Les réveillés sont rattrapés au début du tick : la mise à jour qui suit
+     * les fait avancer de deltaTime comme les autres éveillés.
+     */
+    void Avancer(float deltaTime);
+
+    /**
+     * @brief Bilan de fin de tick : morts, changements de cellule, endormissements
+     *
+     * À appeler après les déplacements et les repas, avant la libération des morts.
+     */
+    void Actualiser();
+
+    /**
+     * @brief Réveille tout le monde (avant de quitter le mode sommeil)
+     */
+    void ToutReveiller();
+
+    /**
+     * @brief Oublie animaux, plantes et réveils (écosystème relancé), capacités gardées
+     *
+     * Les animaux suivis ne sont pas lus : ils peuvent déjà être libérés.
+     * L'horloge et les jetons repartent de zéro, comme un planificateur neuf.
+     */
+    void Vider();
+
+    /**
+     * @brief Accès aux proies éveillées
+     * @return Proies à mettre à jour et visibles des autres
+     */
+    const std::vector<Proie*>& GetProiesEveillees() const;
+
+    /**
+     * @brief Accès aux prédateurs éveillés
+     * @return Prédateurs à mettre à jour et visibles des autres
+     */
+    const std::vector<Predateur*>& GetPredateursEveilles() const;
+
+    /**
+     * @brief Position rattrapée sur la trajectoire du sommeil
+     * @param animal Animal suivi, éveillé ou endormi
+     * @param x Position horizontale (celle de l'animal s'il est éveillé)
+     * @param y Position verticale (celle de l'animal s'il est éveillé)
+     *
+     * Réservée à l'affichage et aux grilles : les boucles de mise à jour ne
+     * voient que des éveillés et lisent GetX/GetY, sans test de sommeil.
+     */
+    void PositionEndormie(const Animal* animal, float& x, float& y) const;
+
+    /**
+     * @brief Compte les animaux endormis
+     * @return Nombre de dormeurs
+     */
+    int GetNombreEndormis() const;
+};
+
+#endif /* PLANIFICATEUR_SOMMEIL_H */
@@ -1,57 +1,137 @@
-/**
- * @file Plante.h
- * @brief Classe représentant une ressource végétale
- */
-
-#ifndef PLANTE_H
-#define PLANTE_H
-
-/**
- * @class Plante
- * @brief Ressource immobile consommable par les proies
- */
-class Plante
-{
-private:
-    float mX;            /**< Position horizontale */
-    float mY;            /**< Position verticale */
-    bool mDisponible;    /**< État de disponibilité */
-    
-public:
-    /**
-     * @brief Constructeur
-     * @param x Position horizontale initiale
-     * @param y Position verticale initiale
-     */
-    Plante(float x, float y);
-    
-    /**
-     * @brief Destructeur
-     */
-    ~Plante();
-    
-    /**
-     * @brief Récupère position X
-     * @return Position horizontale
-     */
-    float GetX() const;
-    
-    /**
-     * @brief Récupère position Y
-     * @return Position verticale
-     */
-    float GetY() const;
-    
-    /**
-     * @brief Vérifie si plante peut être consommée
-     * @return true si disponible, false sinon
-     */
-    bool EstDisponible() const;
-    
-    /**
-     * @brief Marque la plante comme consommée
-     */
-    void Consommer();
-};
-
+/**
+ * @file Plante.h
+ * @brief Classe représentant une ressource végétale
+ */
+
+#ifndef PLANTE_H
+#define PLANTE_H
+
+#include <cstddef>
+
+/**
+ * @class Plante
+ * @brief Ressource immobile consommable par les proies
+ */
+class Plante
+{
+private:
+    float mX;            /**< Position horizontale */
+    float mY;            /**< Position verticale */
+    bool mDisponible;    /**< État de disponibilité */
+    bool mComptee;       /**< Consommation déjà relevée par l'écosystème */
+    
+public:
+    /**
+     * @brief Constructeur
+     * @param x Position horizontale initiale
+     * @param y Position verticale initiale
+     */
+    Plante(float x, float y);
+
+    /**
+     * @brief Allocation dans la réserve des plantes
+     * @param taille Taille demandée
+     * @return Emplacement non initialisé
+     */
+    static void* operator new(size_t taille);
+
+    /**
+     * @brief Construction dans un emplacement pris par ReserveObjets::Reserver
+     * @param taille Taille demandée
+     * @param place Emplacement réservé
+     * @return place
+     */
+    static void* operator new(size_t taille, void* place) { (void)taille; return place; }
+
+    /**
+     * @brief Rend l'emplacement à la réserve des plantes
+     * @param place Emplacement libéré
+     */
+    static void operator delete(void* place);
+
+    /**
+     * @brief Pendant du new placé (constructeur en échec) : rien à rendre
+     */
+    static void operator delete(void*, void*) {}
+    
+    /**
+     * @brief Destructeur
+     */
+    ~Plante();
+    
+    /**
+     * @brief Récupère position X
+     * @return Position horizontale
+     */
+    float GetX() const;
+    
+    /**
+     * @brief Récupère position Y
+     * @return Position verticale
+     */
+    float GetY() const;
+    
+    /**
+     * @brief Vérifie si plante peut être consommée
+     * @return true si disponible, false sinon
+     */
+    bool EstDisponible() const;
+    
+    /**
+     * @brief Marque la plante comme consommée
+     */
+    void Consommer();
+
+    /**
+     * @brief Vérifie si la consommation a déjà été relevée
+     * @return true si la plante est déjà comptée parmi les consommées
+     */
+    bool EstComptee() const;
+
+    /**
+     * @brief Relève la consommation : la plante ne sera plus comptée
+     */
+    void MarquerComptee();
+};
+
+/**
+ * @brief Vérifie si la plante est disponible
+ */
+inline bool Plante::EstDisponible() const
+{
+    return mDisponible;
+}
+
+/**
+ * @brief Vérifie si la consommation est déjà relevée
+ */
+inline bool Plante::EstComptee() const
+{
+    return mComptee;
+}
+
+/**
+ * @brief Relève la consommation
+ */
+inline void Plante::MarquerComptee()
+{
+    mComptee = true;
+}
+
+/**
+ * @brief Récupère la position horizontale
+ */
+inline float Plante::GetX() const
+{
+    return mX;
+}
+
+/**
+ * @brief Récupère la position verticale
+ */
+inline float Plante::GetY() const
+{
+    return mY;
+}
+
 #endif /* PLANTE_H */
\ No newline at end of file
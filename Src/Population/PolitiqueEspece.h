@@ -0,0 +1,104 @@
+/**
+ * @file PolitiqueEspece.h
+ * @brief Constantes de chaque espèce et boucle de mise à jour générée par espèce
+ */
+
+#ifndef POLITIQUE_ESPECE_H
+#define POLITIQUE_ESPECE_H
+
+#include "Animal.h"
+#include <vector>
+
+class Proie;
+class Predateur;
+class Plante;
+
+/**
+ * @struct PolitiqueEspece
+ * @brief Paramètres d'une espèce, connus à la compilation
+ *
+ * Spécialisée pour chaque espèce. Les méthodes gabarits d'Animal (DeplacerSelon,
+ * MetabolismeSelon...) lisent ces constantes : le compilateur les intègre
+ * directement dans la boucle de l'espèce.
+ */
+template<typename Espece>
+struct PolitiqueEspece;
+
+/**
+ * @brief Paramètres des proies
+ */
+template<>
+struct PolitiqueEspece<Proie>
+{
+    static constexpr float VITESSE_BASE = 80.0f;                   /**< Vitesse de déplacement (pixels/s) */
+    static constexpr float MARGE_BORD = 30.0f;                     /**< Distance de rebond aux bords du monde */
+    static constexpr float TAILLE_SPRITE = 35.0f;                  /**< Côté du sprite affiché (pixels) */
+    static constexpr float METABOLISME_BASE = 0.1f;                /**< Énergie perdue par seconde au repos */
+    static constexpr float COUT_DEPLACEMENT = 0.01f;               /**< Énergie perdue par pixel parcouru */
+    static constexpr int CHANCE_CHANGEMENT_DIRECTION = 5;          /**< Chances sur 100 de tourner en errant */
+    static constexpr float DELAI_REPRODUCTION = 40.0f;             /**< Délai entre reproductions (s) */
+    static constexpr float SEUIL_ENERGIE_REPRODUCTION = 70.0f;     /**< Énergie min pour reproduction */
+    static constexpr float RAYON_ATTAQUE = 20.0f;                  /**< Distance pour consommer plante */
+    static constexpr float RAYON_DETECTION_PREDATEUR = 150.0f;     /**< Rayon de détection prédateurs */
+    static constexpr float RAYON_DETECTION_PLANTE = 100.0f;        /**< Rayon de détection plantes */
+    static constexpr float ENERGIE_GAGNE_PAR_PLANTE = 5.0f;        /**< Énergie gagnée par plante */
+    static constexpr float TAUX_BROUTAGE = 0.5f;                   /**< Biomasse broutée par seconde (équivalents plantes) */
+    static constexpr float SEUIL_PATURAGE = 0.25f;                 /**< Part de la capacité sous laquelle la cellule est quittée */
+};
+
+/**
+ * @brief Paramètres des prédateurs
+ */
+template<>
+struct PolitiqueEspece<Predateur>
+{
+    static constexpr float VITESSE_BASE = 120.0f;                  /**< Vitesse de déplacement (pixels/s) */
+    static constexpr float MARGE_BORD = 45.0f;                     /**< Distance de rebond aux bords du monde */
+    static constexpr float TAILLE_SPRITE = 60.0f;                  /**< Côté du sprite affiché (pixels) */
+    static constexpr float METABOLISME_BASE = 0.35f;               /**< Énergie perdue par seconde au repos */
+    static constexpr float COUT_DEPLACEMENT = 0.05f;               /**< Énergie perdue par pixel parcouru */
+    static constexpr int CHANCE_CHANGEMENT_DIRECTION = 10;         /**< Chances sur 100 de tourner en errant */
+    static constexpr float DELAI_REPRODUCTION = 15.0f;             /**< Délai entre reproductions (s) */
+    static constexpr float SEUIL_ENERGIE_REPRODUCTION = 30.0f;     /**< Énergie min pour reproduction */
+    static constexpr float RAYON_ATTAQUE = 40.0f;                  /**< Distance d'attaque (pixels) */
+    static constexpr float RAYON_DETECTION_PROIE = 150.0f;         /**< Rayon de détection proies */
+    static constexpr float ENERGIE_GAGNE_PAR_PROIE = 30.0f;        /**< Énergie gagnée en mangeant */
+};
+
+/**
+ * @brief Met à jour un lot homogène d'animaux d'une même espèce
+ * @tparam Espece Classe finale de l'espèce (Proie, Predateur)
+ * @param lot Animaux à mettre à jour (les morts sont ignorés)
+ * @param proies Proies visibles
+ * @param predateurs Prédateurs visibles
+ * @param plantes Plantes visibles
+ * @param deltaTime Temps écoulé (secondes)
+ * @param monde Dimensions et végétation de l'écosystème propriétaire
+ *
+ * Appels qualifiés et gabarits : aucune indirection par la vtable d'Animal,
+ * et déplacement comme métabolisme sont intégrés dans la boucle.
+ */
+template<typename Espece>
+inline void MettreAJourLot(const std::vector<Espece*>& lot,
+                           const std::vector<Proie*>& proies,
+                           const std::vector<Predateur*>& predateurs,
+                           const std::vector<Plante*>& plantes,
+                           float deltaTime,
+                           const ContexteMonde& monde)
+{
+    using Politique = PolitiqueEspece<Espece>;
+
+    for (Espece* animal : lot)
+    {
+        /* Un animal mangé plus tôt dans le tick ne bouge plus */
+        if (!animal->EstVivant())
+            continue;
+
+        animal->Espece::Comportement(proies, predateurs, plantes, monde);
+        animal->template DeplacerSelon<Politique>(deltaTime, monde);
+        animal->template MetabolismeSelon<Politique>(deltaTime);
+        animal->DecompterSuivi(deltaTime, monde);
+    }
+}
+
+#endif /* POLITIQUE_ESPECE_H */
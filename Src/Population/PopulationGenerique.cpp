@@ -0,0 +1,541 @@
+/**
+ * @file PopulationGenerique.cpp
+ * @brief Noyaux de mise à jour pilotés par les tables d'espèces
+ */
+
+#include "PopulationGenerique.h"
+#include "BudgetPopulation.h"
+#include "Plante.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+/**
+ * @brief Tire une position uniforme dans [min, max[
+ */
+static float AleatoireEntre(float min, float max)
+{
+    return min + (max - min) * static_cast<float>(rand() / (RAND_MAX + 1.0));
+}
+
+static constexpr float VITESSE_INITIALE_MAX = 50.0f;   /**< Composante max de VitesseAleatoire */
+
+/**
+ * @brief Vitesse initiale aléatoire, comme Proie et Predateur
+ */
+static void VitesseAleatoire(float& vx, float& vy)
+{
+    vx = ((rand() % 200) - 100) * 0.5f;
+    vy = ((rand() % 200) - 100) * 0.5f;
+}
+
+/**
+ * @brief Remplace l'état d'un individu
+ */
+void LotEspece::Ecrire(size_t i, float nx, float ny, float nvx, float nvy, float nenergie)
+{
+    x[i] = nx;
+    y[i] = ny;
+    vx[i] = nvx;
+    vy[i] = nvy;
+    energie[i] = std::max(0.0f, nenergie);
+    if (nenergie <= 0.0f)
+        vivant[i] = 0;
+}
+
+/**
+ * @brief Un compteur par individu
+ */
+void LotEspece::AvancerTemps(float deltaTime)
+{
+    for (float& temps : tempsRepro)
+        temps += deltaTime;
+}
+
+/**
+ * @brief Vérifie énergie et temps depuis la dernière reproduction
+ */
+bool LotEspece::PeutSeReproduire(size_t i, float seuil, float delai) const
+{
+    return energie[i] > seuil && tempsRepro[i] > delai;
+}
+
+/**
+ * @brief Énergie cédée, compteur remis à zéro
+ */
+void LotEspece::Reproduire(size_t i, float seuil)
+{
+    energie[i] -= seuil;
+    tempsRepro[i] = 0.0f;
+}
+
+/**
+ * @brief Nouvel individu en fin de lot
+ */
+void LotEspece::Ajouter(float nx, float ny, float nvx, float nvy)
+{
+    x.push_back(nx);
+    y.push_back(ny);
+    vx.push_back(nvx);
+    vy.push_back(nvy);
+    energie.push_back(100.0f);
+    tempsRepro.push_back(0.0f);
+    vivant.push_back(1);
+}
+
+/**
+ * @brief Compactage stable des vivants
+ */
+void LotEspece::RetirerMorts()
+{
+    size_t garde = 0;
+    for (size_t i = 0; i < Taille(); i++)
+    {
+        if (!vivant[i])
+            continue;
+        x[garde] = x[i];
+        y[garde] = y[i];
+        vx[garde] = vx[i];
+        vy[garde] = vy[i];
+        energie[garde] = energie[i];
+        tempsRepro[garde] = tempsRepro[i];
+        vivant[garde] = 1;
+        garde++;
+    }
+    x.resize(garde);
+    y.resize(garde);
+    vx.resize(garde);
+    vy.resize(garde);
+    energie.resize(garde);
+    tempsRepro.resize(garde);
+    vivant.resize(garde);
+}
+
+/**
+ * @brief Tableaux vidés sans rendre leur capacité
+ */
+void LotEspece::Vider()
+{
+    x.clear();
+    y.clear();
+    vx.clear();
+    vy.clear();
+    energie.clear();
+    tempsRepro.clear();
+    vivant.clear();
+}
+
+/**
+ * @brief Reconstruit la grille depuis les positions
+ */
+void LotEspece::Indexer()
+{
+    grille.Construire(x, y);
+}
+
+/**
+ * @brief Crée les lots de la représentation choisie et leurs individus initiaux
+ */
+PopulationGenerique::PopulationGenerique(const RegistreEspeces& registre, float largeur,
+                                         float hauteur, float tailleCellule, bool compact)
+    : mRegistre(registre)
+    , mCompact(compact)
+    , mLargeur(largeur)
+    , mHauteur(hauteur)
+    , mBudget(nullptr)
+{
+    if (mCompact)
+    {
+        mLotsCompacts.resize(registre.GetNombreEspeces());
+        for (int e = 0; e < registre.GetNombreEspeces(); e++)
+        {
+            /* Errance en diagonale : la vitesse atteint vitesse * sqrt(2) */
+            const ParametresEspece& parametres = registre.GetEspece(e);
+            float vitesseMax = std::max(parametres.vitesse, VITESSE_INITIALE_MAX) * 1.4143f;
+            mLotsCompacts[e].Configurer(largeur, hauteur, tailleCellule, vitesseMax);
+        }
+        Peupler(mLotsCompacts);
+    }
+    else
+    {
+        mLots.resize(registre.GetNombreEspeces());
+        for (LotEspece& lot : mLots)
+            lot.grille.Configurer(largeur, hauteur, tailleCellule);
+        Peupler(mLots);
+    }
+}
+
+/**
+ * @brief Individus uniformes dans le monde, hors marges
+ */
+template<typename Lot>
+void PopulationGenerique::Peupler(std::vector<Lot>& lots)
+{
+    for (int e = 0; e < mRegistre.GetNombreEspeces(); e++)
+    {
+        const ParametresEspece& parametres = mRegistre.GetEspece(e);
+        for (int i = 0; i < parametres.populationInitiale; i++)
+        {
+            float x = AleatoireEntre(parametres.margeBord, mLargeur - parametres.margeBord);
+            float y = AleatoireEntre(parametres.margeBord, mHauteur - parametres.margeBord);
+            float vx, vy;
+            VitesseAleatoire(vx, vy);
+            lots[e].Ajouter(x, y, vx, vy);
+        }
+        lots[e].Indexer();
+    }
+}
+
+/**
+ * @brief Parcourt les cellules recouvrant le disque de recherche
+ */
+template<typename Lot>
+int PopulationGenerique::PlusProche(const Lot& lot, float x, float y, float rayon, float& distanceCarre)
+{
+    int meilleur = -1;
+
+    mIndicesRequete.clear();
+    lot.grille.RequeteRectangle(x - rayon, y - rayon, x + rayon, y + rayon, mIndicesRequete);
+
+    for (uint32_t j : mIndicesRequete)
+    {
+        if (!lot.EstVivant(j))
+            continue;
+
+        float dx = lot.X(j) - x;
+        float dy = lot.Y(j) - y;
+        float d2 = dx * dx + dy * dy;
+        if (d2 < rayon * rayon && d2 < distanceCarre)
+        {
+            distanceCarre = d2;
+            meilleur = static_cast<int>(j);
+        }
+    }
+    return meilleur;
+}
+
+/**
+ * @brief Fuite, sinon repas le plus proche (plante ou proie), sinon errance
+ */
+template<typename Lot>
+void PopulationGenerique::MettreAJourEspece(std::vector<Lot>& lots, int espece, float deltaTime,
+                                            const std::vector<Plante*>& plantes,
+                                            const GrilleSpatiale& grillePlantes)
+{
+    const ParametresEspece& p = mRegistre.GetEspece(espece);
+    Lot& lot = lots[espece];
+
+    /* Paramètres chargés une fois pour tout le lot */
+    const float vitesse = p.vitesse;
+    const float rayon = p.rayonDetection;
+    const float rayonAttaque = p.rayonAttaque;
+    const float marge = p.margeBord;
+    const float pertes = p.metabolisme;
+    const float coutDeplacement = p.coutDeplacement;
+
+    const size_t n = lot.Taille();
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!lot.EstVivant(i))
+            continue;
+
+        float x = lot.X(i);
+        float y = lot.Y(i);
+        float vx, vy;
+        lot.Vitesse(i, vx, vy);
+        float energie = lot.Energie(i);
+
+        /* 1. Menace la plus proche, toutes espèces fuies confondues */
+        float meilleureMenace = 1e30f;
+        const Lot* lotMenace = nullptr;
+        int menace = -1;
+        for (int m : p.menaces)
+        {
+            int j = PlusProche(lots[m], x, y, rayon, meilleureMenace);
+            if (j >= 0)
+            {
+                lotMenace = &lots[m];
+                menace = j;
+            }
+        }
+
+        if (menace >= 0)
+        {
+            float dx = lotMenace->X(menace) - x;
+            float dy = lotMenace->Y(menace) - y;
+            float distance = std::sqrt(dx * dx + dy * dy);
+            if (distance > 0.01f)
+            {
+                vx = -(dx / distance) * vitesse;
+                vy = -(dy / distance) * vitesse;
+            }
+        }
+        else
+        {
+            /* 2. Repas le plus proche : proies animales ou plantes */
+            float meilleurRepas = 1e30f;
+            Lot* lotProie = nullptr;
+            int proie = -1;
+            Plante* plante = nullptr;
+
+            for (int c : p.proies)
+            {
+                int j = PlusProche(lots[c], x, y, rayon, meilleurRepas);
+                if (j >= 0)
+                {
+                    lotProie = &lots[c];
+                    proie = j;
+                }
+            }
+
+            if (p.mangePlantes)
+            {
+                mIndicesRequete.clear();
+                grillePlantes.RequeteRectangle(x - rayon, y - rayon, x + rayon, y + rayon, mIndicesRequete);
+                for (uint32_t j : mIndicesRequete)
+                {
+                    if (!plantes[j]->EstDisponible())
+                        continue;
+                    float dx = plantes[j]->GetX() - x;
+                    float dy = plantes[j]->GetY() - y;
+                    float d2 = dx * dx + dy * dy;
+                    if (d2 < rayon * rayon && d2 < meilleurRepas)
+                    {
+                        meilleurRepas = d2;
+                        plante = plantes[j];
+                        proie = -1;
+                    }
+                }
+            }
+
+            if (plante || proie >= 0)
+            {
+                float cibleX = plante ? plante->GetX() : lotProie->X(proie);
+                float cibleY = plante ? plante->GetY() : lotProie->Y(proie);
+                float dx = cibleX - x;
+                float dy = cibleY - y;
+                float distance = std::sqrt(dx * dx + dy * dy);
+
+                if (distance > 0.01f)
+                {
+                    vx = (dx / distance) * vitesse;
+                    vy = (dy / distance) * vitesse;
+                }
+
+                if (distance <= rayonAttaque)
+                {
+                    if (plante)
+                        plante->Consommer();
+                    else
+                        lotProie->Tuer(proie);
+                    energie = std::min(100.0f, energie + p.energieRepas);
+                }
+            }
+            else if (rand() % 100 < p.changementDirection)
+            {
+                /* 3. Errance : une des 8 directions */
+                static const float DIRECTIONS[8][2] = {
+                    { 0,  1}, { 0, -1}, { 1,  0}, {-1,  0},
+                    { 1,  1}, {-1, -1}, {-1,  1}, { 1, -1}
+                };
+                int direction = rand() % 8;
+                vx = DIRECTIONS[direction][0] * vitesse;
+                vy = DIRECTIONS[direction][1] * vitesse;
+            }
+        }
+
+        /* Déplacement et rebonds */
+        x += vx * deltaTime;
+        y += vy * deltaTime;
+        if (x < marge || x > mLargeur - marge)
+        {
+            vx = -vx;
+            x = std::min(std::max(x, marge), mLargeur - marge);
+        }
+        if (y < marge || y > mHauteur - marge)
+        {
+            vy = -vy;
+            y = std::min(std::max(y, marge), mHauteur - marge);
+        }
+
+        /* Métabolisme */
+        float v = std::sqrt(vx * vx + vy * vy);
+        energie -= (pertes + v * coutDeplacement) * deltaTime;
+        lot.Ecrire(i, x, y, vx, vy, energie);
+    }
+}
+
+/**
+ * @brief Compactage stable des vivants, naissances en fin de lot, puis réindexation
+ */
+template<typename Lot>
+void PopulationGenerique::RenouvelerEspece(Lot& lot, int espece)
+{
+    const ParametresEspece& p = mRegistre.GetEspece(espece);
+
+    lot.RetirerMorts();
+
+    const size_t garde = lot.Taille();
+    for (size_t i = 0; i < garde; i++)
+    {
+        if (lot.PeutSeReproduire(i, p.seuilReproduction, p.delaiReproduction)
+            && rand() % 100 < p.chanceReproduction
+            && (!mBudget || mBudget->AutoriserNaissance(GetOctetsParIndividu())))
+        {
+            lot.Reproduire(i, p.seuilReproduction);
+            float vx, vy;
+            VitesseAleatoire(vx, vy);
+            lot.Ajouter(lot.X(i), lot.Y(i), vx, vy);
+        }
+    }
+
+    lot.Indexer();
+}
+
+/**
+ * @brief Toutes les espèces bougent, puis chacune se renouvelle et se réindexe
+ */
+template<typename Lot>
+void PopulationGenerique::MettreAJourLots(std::vector<Lot>& lots, float deltaTime,
+                                          const std::vector<Plante*>& plantes,
+                                          const GrilleSpatiale& grillePlantes)
+{
+    int nbEspeces = static_cast<int>(lots.size());
+
+    /* Les grilles restent celles du début du tick : les indices qu'elles
+       renvoient sont stables tant qu'aucun lot n'est compacté */
+    for (int e = 0; e < nbEspeces; e++)
+        MettreAJourEspece(lots, e, deltaTime, plantes, grillePlantes);
+
+    for (int e = 0; e < nbEspeces; e++)
+    {
+        lots[e].AvancerTemps(deltaTime);
+        RenouvelerEspece(lots[e], e);
+    }
+}
+
+/**
+ * @brief Le budget est consulté à chaque naissance
+ */
+void PopulationGenerique::DefinirBudget(BudgetPopulation* budget)
+{
+    mBudget = budget;
+}
+
+/**
+ * @brief Lots vidés de la représentation choisie, puis même peuplement qu'à la construction
+ */
+void PopulationGenerique::Reinitialiser()
+{
+    if (mCompact)
+    {
+        for (LotCompact& lot : mLotsCompacts)
+            lot.Vider();
+        Peupler(mLotsCompacts);
+    }
+    else
+    {
+        for (LotEspece& lot : mLots)
+            lot.Vider();
+        Peupler(mLots);
+    }
+}
+
+/**
+ * @brief Aiguille vers la représentation choisie
+ */
+void PopulationGenerique::MettreAJour(float deltaTime, const std::vector<Plante*>& plantes,
+                                      const GrilleSpatiale& grillePlantes)
+{
+    if (mCompact)
+        MettreAJourLots(mLotsCompacts, deltaTime, plantes, grillePlantes);
+    else
+        MettreAJourLots(mLots, deltaTime, plantes, grillePlantes);
+}
+
+/**
+ * @brief Somme des comptages de chaque grille
+ */
+int PopulationGenerique::CompterRectangle(float x0, float y0, float x1, float y1) const
+{
+    int total = 0;
+    for (int e = 0; e < mRegistre.GetNombreEspeces(); e++)
+        total += GetGrille(e).CompterRectangle(x0, y0, x1, y1);
+    return total;
+}
+
+/**
+ * @brief Sépare les espèces selon qu'elles mangent des plantes
+ */
+void PopulationGenerique::CompterParRegime(int& herbivores, int& carnivores) const
+{
+    herbivores = 0;
+    carnivores = 0;
+    for (int e = 0; e < mRegistre.GetNombreEspeces(); e++)
+    {
+        int nombre = static_cast<int>(mCompact ? mLotsCompacts[e].Taille() : mLots[e].Taille());
+        if (mRegistre.GetEspece(e).mangePlantes)
+            herbivores += nombre;
+        else
+            carnivores += nombre;
+    }
+}
+
+/**
+ * @brief Taille du lot de l'espèce
+ */
+size_t PopulationGenerique::GetNombre(int espece) const
+{
+    return mCompact ? mLotsCompacts[espece].Taille() : mLots[espece].Taille();
+}
+
+/**
+ * @brief Grille du lot de l'espèce, quelle que soit la représentation
+ */
+const GrilleSpatiale& PopulationGenerique::GetGrille(int espece) const
+{
+    return mCompact ? mLotsCompacts[espece].grille : mLots[espece].grille;
+}
+
+/**
+ * @brief Position décodée si besoin
+ */
+void PopulationGenerique::GetPosition(int espece, size_t i, float& x, float& y) const
+{
+    if (mCompact)
+    {
+        x = mLotsCompacts[espece].X(i);
+        y = mLotsCompacts[espece].Y(i);
+    }
+    else
+    {
+        x = mLots[espece].X(i);
+        y = mLots[espece].Y(i);
+    }
+}
+
+/**
+ * @brief Indique la représentation utilisée
+ */
+bool PopulationGenerique::EstCompacte() const
+{
+    return mCompact;
+}
+
+/**
+ * @brief Attributs d'un individu dans la représentation utilisée
+ */
+size_t PopulationGenerique::GetOctetsParIndividu() const
+{
+    if (mCompact)
+        return LotCompact::OctetsParIndividu();
+    return 6 * sizeof(float) + sizeof(uint8_t);
+}
+
+/**
+ * @brief Accès au registre utilisé
+ */
+const RegistreEspeces& PopulationGenerique::GetRegistre() const
+{
+    return mRegistre;
+}
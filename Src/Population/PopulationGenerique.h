@@ -0,0 +1,284 @@
+/**
+ * @file PopulationGenerique.h
+ * @brief Animaux des espèces du registre, stockés et mis à jour par espèce
+ */
+
+#ifndef POPULATION_GENERIQUE_H
+#define POPULATION_GENERIQUE_H
+
+#include "GrilleSpatiale.h"
+#include "LotCompact.h"
+#include "RegistreEspeces.h"
+#include <cstdint>
+#include <vector>
+
+class Plante;
+class BudgetPopulation;
+
+/**
+ * @struct LotEspece
+ * @brief Individus d'une espèce, un tableau par attribut
+ *
+ * Les accesseurs sont ceux de LotCompact : le noyau de mise à jour est écrit
+ * une fois pour les deux représentations.
+ */
+struct LotEspece
+{
+    std::vector<float> x;               /**< Positions horizontales */
+    std::vector<float> y;               /**< Positions verticales */
+    std::vector<float> vx;              /**< Vitesses horizontales */
+    std::vector<float> vy;              /**< Vitesses verticales */
+    std::vector<float> energie;         /**< Énergie (0-100) */
+    std::vector<float> tempsRepro;      /**< Temps depuis la dernière reproduction */
+    std::vector<uint8_t> vivant;        /**< 1 si vivant */
+    GrilleSpatiale grille;              /**< Index des positions du début du tick */
+
+    /**
+     * @brief Nombre d'individus (morts du tick compris)
+     * @return Taille des tableaux
+     */
+    size_t Taille() const { return x.size(); }
+
+    float X(size_t i) const { return x[i]; }                    /**< Position horizontale */
+    float Y(size_t i) const { return y[i]; }                    /**< Position verticale */
+    bool EstVivant(size_t i) const { return vivant[i] != 0; }   /**< Vrai si vivant */
+    void Tuer(size_t i) { vivant[i] = 0; }                      /**< Marque l'individu mort */
+    float Energie(size_t i) const { return energie[i]; }        /**< Énergie (0-100) */
+
+    /**
+     * @brief Vitesse de l'individu
+     * @param i Indice de l'individu
+     * @param vitesseX Vitesse horizontale
+     * @param vitesseY Vitesse verticale
+     */
+    void Vitesse(size_t i, float& vitesseX, float& vitesseY) const { vitesseX = vx[i]; vitesseY = vy[i]; }
+
+    /**
+     * @brief Remplace l'état d'un individu (mort si l'énergie tombe à 0)
+     * @param i Indice de l'individu
+     * @param nx Position horizontale
+     * @param ny Position verticale
+     * @param nvx Vitesse horizontale
+     * @param nvy Vitesse verticale
+     * @param nenergie Énergie
+     */
+    void Ecrire(size_t i, float nx, float ny, float nvx, float nvy, float nenergie);
+
+    /**
+     * @brief Vieillit tous les individus
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    void AvancerTemps(float deltaTime);
+
+    /**
+     * @brief Vérifie énergie et délai de reproduction
+     * @param i Indice de l'individu
+     * @param seuil Énergie minimale
+     * @param delai Délai depuis la dernière reproduction
+     * @return true si l'individu peut se reproduire
+     */
+    bool PeutSeReproduire(size_t i, float seuil, float delai) const;
+
+    /**
+     * @brief Paie le coût de la reproduction et relance le délai
+     * @param i Indice du parent
+     * @param seuil Énergie cédée
+     */
+    void Reproduire(size_t i, float seuil);
+
+    /**
+     * @brief Ajoute un individu d'énergie pleine en fin de lot
+     * @param nx Position horizontale
+     * @param ny Position verticale
+     * @param nvx Vitesse horizontale
+     * @param nvy Vitesse verticale
+     */
+    void Ajouter(float nx, float ny, float nvx, float nvy);
+
+    /**
+     * @brief Compactage stable des vivants
+     */
+    void RetirerMorts();
+
+    /**
+     * @brief Retire tous les individus, capacité des tableaux gardée
+     */
+    void Vider();
+
+    /**
+     * @brief Reconstruit la grille
+     */
+    void Indexer();
+};
+
+/**
+ * @class PopulationGenerique
+ * @brief Mise à jour par lots homogènes, pilotée par les tables du registre
+ *
+ * Chaque espèce est traitée par le même noyau : ses paramètres sont chargés une
+ * fois avant la boucle, ses proies et menaces sont cherchées dans les grilles
+ * des espèces ciblées par la matrice d'interactions. Ajouter une espèce ou un
+ * niveau trophique ne demande que de modifier le fichier de configuration.
+ */
+class PopulationGenerique
+{
+private:
+    const RegistreEspeces& mRegistre;   /**< Paramètres des espèces (non possédé) */
+    bool mCompact;                      /**< États quantifiés (mLotsCompacts) au lieu de floats (mLots) */
+    std::vector<LotEspece> mLots;       /**< Un lot par espèce du registre (mode float) */
+    std::vector<LotCompact> mLotsCompacts;  /**< Un lot par espèce du registre (mode compact) */
+    float mLargeur;                     /**< Largeur du monde */
+    float mHauteur;                     /**< Hauteur du monde */
+    std::vector<uint32_t> mIndicesRequete;  /**< Tampon des requêtes de grille */
+    BudgetPopulation* mBudget;          /**< Admission des naissances (non possédé, nullptr : libre) */
+
+    /**
+     * @brief Crée les individus initiaux de chaque espèce
+     * @tparam Lot LotEspece ou LotCompact
+     * @param lots Lots configurés, vides
+     */
+    template<typename Lot>
+    void Peupler(std::vector<Lot>& lots);
+
+    /**
+     * @brief Cherche l'individu vivant le plus proche d'un point dans un lot
+     * @tparam Lot LotEspece ou LotCompact
+     * @param lot Lot cherché
+     * @param x Position horizontale
+     * @param y Position verticale
+     * @param rayon Rayon de recherche
+     * @param distanceCarre Distance au carré du meilleur trouvé (mise à jour si meilleur)
+     * @return Indice trouvé, -1 sinon
+     */
+    template<typename Lot>
+    int PlusProche(const Lot& lot, float x, float y, float rayon, float& distanceCarre);
+
+    /**
+     * @brief Comportement, déplacement et métabolisme d'une espèce
+     * @tparam Lot LotEspece ou LotCompact
+     * @param lots Lots de toutes les espèces
+     * @param espece Indice de l'espèce
+     * @param deltaTime Temps écoulé (secondes)
+     * @param plantes Plantes indexées par grillePlantes
+     * @param grillePlantes Index des plantes disponibles
+     */
+    template<typename Lot>
+    void MettreAJourEspece(std::vector<Lot>& lots, int espece, float deltaTime,
+                           const std::vector<Plante*>& plantes, const GrilleSpatiale& grillePlantes);
+
+    /**
+     * @brief Retire les morts, fait naître les nouveaux individus et réindexe
+     * @tparam Lot LotEspece ou LotCompact
+     * @param lot Lot de l'espèce
+     * @param espece Indice de l'espèce
+     */
+    template<typename Lot>
+    void RenouvelerEspece(Lot& lot, int espece);
+
+    /**
+     * @brief Met à jour toutes les espèces d'une représentation
+     * @tparam Lot LotEspece ou LotCompact
+     * @param lots Lots de toutes les espèces
+     * @param deltaTime Temps écoulé (secondes)
+     * @param plantes Plantes indexées par grillePlantes
+     * @param grillePlantes Index des plantes disponibles
+     */
+    template<typename Lot>
+    void MettreAJourLots(std::vector<Lot>& lots, float deltaTime,
+                         const std::vector<Plante*>& plantes, const GrilleSpatiale& grillePlantes);
+
+public:
+    /**
+     * @brief Crée les populations initiales du registre
+     * @param registre Registre des espèces (doit survivre à la population)
+     * @param largeur Largeur du monde
+     * @param hauteur Hauteur du monde
+     * @param tailleCellule Côté des cellules des grilles
+     * @param compact true pour la représentation quantifiée (LotCompact)
+     */
+    PopulationGenerique(const RegistreEspeces& registre, float largeur, float hauteur, float tailleCellule,
+                        bool compact = false);
+
+    /**
+     * @brief Met à jour toutes les espèces pour un tick
+     * @param deltaTime Temps écoulé (secondes)
+     * @param plantes Plantes indexées par grillePlantes
+     * @param grillePlantes Index des plantes disponibles
+     */
+    void MettreAJour(float deltaTime, const std::vector<Plante*>& plantes, const GrilleSpatiale& grillePlantes);
+
+    /**
+     * @brief Remplace les individus par de nouvelles populations initiales (écosystème relancé)
+     *
+     * Les lots sont tronqués sur place puis repeuplés comme à la construction,
+     * avec les tirages de rand() qui suivent : sans allocation tant que les
+     * populations ne dépassent pas celles de la simulation précédente.
+     */
+    void Reinitialiser();
+
+    /**
+     * @brief Soumet les naissances à un budget
+     * @param budget Budget partagé avec l'écosystème (non possédé, nullptr : croissance libre)
+     */
+    void DefinirBudget(BudgetPopulation* budget);
+
+    /**
+     * @brief Compte les individus d'une zone sans les parcourir
+     * @param x0 Bord gauche de la zone
+     * @param y0 Bord haut de la zone
+     * @param x1 Bord droit de la zone
+     * @param y1 Bord bas de la zone
+     * @return Nombre approché d'individus, toutes espèces
+     */
+    int CompterRectangle(float x0, float y0, float x1, float y1) const;
+
+    /**
+     * @brief Compte les herbivores et les autres
+     * @param herbivores Individus d'espèces mangeant des plantes
+     * @param carnivores Individus des autres espèces
+     */
+    void CompterParRegime(int& herbivores, int& carnivores) const;
+
+    /**
+     * @brief Compte les individus d'une espèce
+     * @param espece Indice de l'espèce
+     * @return Nombre d'individus (indices valides pour GetPosition)
+     */
+    size_t GetNombre(int espece) const;
+
+    /**
+     * @brief Index spatial d'une espèce (positions du début du tick)
+     * @param espece Indice de l'espèce
+     * @return Grille de l'espèce
+     */
+    const GrilleSpatiale& GetGrille(int espece) const;
+
+    /**
+     * @brief Position d'un individu
+     * @param espece Indice de l'espèce
+     * @param i Indice renvoyé par la grille de l'espèce
+     * @param x Position horizontale
+     * @param y Position verticale
+     */
+    void GetPosition(int espece, size_t i, float& x, float& y) const;
+
+    /**
+     * @brief Indique la représentation utilisée
+     * @return true si les états sont quantifiés
+     */
+    bool EstCompacte() const;
+
+    /**
+     * @brief Mémoire des états des individus
+     * @return Octets occupés par individu (hors index spatial)
+     */
+    size_t GetOctetsParIndividu() const;
+
+    /**
+     * @brief Accès au registre utilisé
+     * @return Registre des espèces
+     */
+    const RegistreEspeces& GetRegistre() const;
+};
+
+#endif /* POPULATION_GENERIQUE_H */
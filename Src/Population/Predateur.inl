@@ -0,0 +1,90 @@
+/**
+ * @file Predateur.inl
+ * @brief Comportement du prédateur, défini en ligne pour les boucles par espèce
+ *
+ * Inclus à la fin de Predateur.h, comme Proie.inl pour la proie.
+ */
+
+#ifndef PREDATEUR_INL
+#define PREDATEUR_INL
+
+#include "Predateur.h"
+#include "Proie.h"
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Trouve et cible la proie vivante la plus proche (ou garde la cible suivie)
+ */
+inline void Predateur::Detecter(const std::vector<Proie*>& proies,
+                               const std::vector<Predateur*>& /*predateurs*/,
+                               const ContexteMonde& monde)
+{
+    mProieDetectee = SuivreOuDetecter(proies, mProieDetectee, Politique::RAYON_DETECTION_PROIE,
+                                      Politique::VITESSE_BASE, PolitiqueEspece<Proie>::VITESSE_BASE, monde);
+}
+
+/**
+ * @brief Ajuste vitesse pour se diriger vers la proie cible
+ */
+inline void Predateur::Chasser()
+{
+    float dx = mProieDetectee->GetX() - this->GetX();
+    float dy = mProieDetectee->GetY() - this->GetY();
+    float distance = sqrt(dx * dx + dy * dy);
+    
+    if (distance > 0.01f)
+    {
+        mVx = (dx / distance) * Politique::VITESSE_BASE;
+        mVy = (dy / distance) * Politique::VITESSE_BASE;
+    }
+}
+
+/**
+ * @brief Orchestre détection, chasse et alimentation
+ */
+inline void Predateur::Comportement(const std::vector<Proie*>& proies,
+                                   const std::vector<Predateur*>& predateurs,
+                                   const std::vector<Plante*>& /*plantes*/,
+                                   const ContexteMonde& monde)
+{
+    Detecter(proies, predateurs, monde);
+    
+    if (mProieDetectee)
+    {
+        Chasser();
+        SeNourrir(monde);
+    }
+    else
+    {
+        ErrerSelon<Politique>(*monde.alea);
+    }
+}
+
+/**
+ * @brief Consomme proie si à portée d'attaque
+ */
+inline void Predateur::SeNourrir(const ContexteMonde& monde)
+{
+    if (!mProieDetectee) return;
+    if (!mProieDetectee->EstVivant())
+    {
+        mProieDetectee = nullptr;
+        RelancerDetection(monde);
+        return;
+    }
+    
+    float dx = mProieDetectee->GetX() - this->GetX();
+    float dy = mProieDetectee->GetY() - this->GetY();
+    float distance = sqrt(dx * dx + dy * dy);
+    
+    if (distance <= Politique::RAYON_ATTAQUE)
+    {
+        mProieDetectee->PerdreEnergie(100.0f);
+        this->GagnerEnergie(Politique::ENERGIE_GAGNE_PAR_PROIE);
+        mProieDetectee = nullptr;
+        RelancerDetection(monde);
+    }
+}
+
+#endif /* PREDATEUR_INL */
@@ -1,118 +1,194 @@
-/**
- * @file Proie.h
- * @brief Classe représentant une proie herbivore de l'écosystème
- */
-
-#ifndef PROIE_H
-#define PROIE_H
-
-#include "Animal.h"
-
-class Predateur;
-class Plante;
-
-/**
- * @class Proie
- * @brief Herbivore fuyant les prédateurs et se nourrissant de plantes
- */
-class Proie : public Animal
-{
-protected:
-    Predateur* mMenaceDetectee;  /**< Prédateur actuellement détecté */
-    Plante* mPlanteDetectee;     /**< Plante actuellement ciblée */
-
-private:
-    static constexpr float ENERGIE_GAGNE_PAR_PLANTE = 5.0f;        /**< Énergie gagnée par plante */
-    static constexpr float DELAI_REPRODUCTION = 40.0f;          /**< Délai entre reproductions (s) */
-    static constexpr float SEUIL_ENERGIE_REPRODUCTION = 70.0f;     /**< Énergie min pour reproduction */
-    static constexpr float RAYON_ATTAQUE = 20.0f;                  /**< Distance pour consommer plante */
-    static constexpr float VITESSE_BASE = 80.0f;                   /**< Vitesse de déplacement (pixels/s) */
-    static constexpr float RAYON_DETECTION_PREDATEUR = 150.0f;     /**< Rayon de détection prédateurs */
-    static constexpr float RAYON_DETECTION_PLANTE = 100.0f;        /**< Rayon de détection plantes */
-    
-public:
-    /**
-     * @brief Constructeur de la proie
-     * @param x Position horizontale initiale
-     * @param y Position verticale initiale
-     * @param largeur Largeur du monde
-     * @param hauteur Hauteur du monde
-     */
-    Proie(float x, float y, float largeur, float hauteur);
-    
-    /**
-     * @brief Destructeur
-     */
-    ~Proie();
-    
-    /**
-     * @brief Définit le comportement de la proie (fuite, alimentation, errance)
-     * @param proies Liste des proies dans le monde (non utilisée)
-     * @param predateurs Liste des prédateurs dans le monde
-     * @param plantes Liste des plantes disponibles
-     */
-    void Comportement(const std::vector<Proie*>& proies,
-                     const std::vector<Predateur*>& predateurs,
-                     const std::vector<Plante*>& plantes) override;
-
-    /**
-     * @brief Déplace l'animal selon sa vitesse et gère les rebonds
-     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
-     */
-    void Deplacer(float deltaTime) override;
-    
-    /**
-     * @brief Vérifie si la proie peut se reproduire
-     * @return true si conditions remplies, false sinon
-     */
-    bool PeutSeReproduire() const override;
-
-    /**
-     * @brief Récupère l'énergie minimal pour se reproduire
-     * @return La quantité d'energie necessaire par espèce (0-100)
-     */
-    float GetSeuil() const override;
-
-    /**
-     * @brief Gère le métabolisme et perte d'énergie
-     * @param deltaTime Temps écoulé (secondes)
-     */
-    void Metabolisme(float deltaTime) override;
-    
-    /**
-     * @brief Détecte le prédateur le plus proche
-     * @param proies Liste des proies (non utilisée)
-     * @param predateurs Liste des prédateurs disponibles
-     */
-    void Detecter(const std::vector<Proie*>& proies,
-                 const std::vector<Predateur*>& predateurs) override;
-    
-private:
-    /**
-     * @brief Détecte la plante la plus proche
-     * @param plantes Liste des plantes disponibles
-     */
-    void DetecterPlante(const std::vector<Plante*>& plantes);
-    
-    /**
-     * @brief Se dirige vers la plante détectée
-     */
-    void ChercherPlante();
-    
-    /**
-     * @brief S'éloigne du prédateur détecté
-     */
-    void Fuir();
-    
-    /**
-     * @brief Mouvement aléatoire en l'absence de menace ou nourriture
-     */
-    void Errer();
-    
-    /**
-     * @brief Consomme une plante si à portée
-     */
-    void SeNourrir();
-};
-
+/**
+ * @file Proie.h
+ * @brief Classe représentant une proie herbivore de l'écosystème
+ */
+
+#ifndef PROIE_H
+#define PROIE_H
+
+#include "Animal.h"
+#include "PolitiqueEspece.h"
+
+class Predateur;
+class Plante;
+class ChampVegetation;
+class CarteNourriture;
+
+/**
+ * @class Proie
+ * @brief Herbivore fuyant les prédateurs et se nourrissant de plantes
+ *
+ * Classe finale : un appel via Proie* n'a pas besoin de la vtable.
+ */
+class Proie final : public Animal
+{
+protected:
+    Predateur* mMenaceDetectee;  /**< Prédateur actuellement détecté */
+    Plante* mPlanteDetectee;     /**< Plante actuellement ciblée */
+
+public:
+    using Politique = PolitiqueEspece<Proie>;  /**< Constantes de l'espèce */
+    
+    /**
+     * @brief Constructeur de la proie
+     * @param x Position horizontale initiale
+     * @param y Position verticale initiale
+     */
+    Proie(float x, float y);
+
+    /**
+     * @brief Constructeur à vitesse donnée (tirée par l'appelant)
+     * @param x Position horizontale initiale
+     * @param y Position verticale initiale
+     * @param vx Vitesse horizontale initiale
+     * @param vy Vitesse verticale initiale
+     */
+    Proie(float x, float y, float vx, float vy);
+
+    /**
+     * @brief Copie d'une proie relogée (menace et plante ciblées comprises)
+     * @param modele Proie copiée
+     */
+    Proie(const Proie& modele);
+
+    /**
+     * @brief Allocation dans la réserve des proies
+     * @param taille Taille demandée
+     * @return Emplacement non initialisé
+     */
+    static void* operator new(size_t taille);
+
+    /**
+     * @brief Construction dans un emplacement pris par ReserveObjets::Reserver
+     * @param taille Taille demandée
+     * @param place Emplacement réservé
+     * @return place
+     */
+    static void* operator new(size_t taille, void* place) { (void)taille; return place; }
+
+    /**
+     * @brief Rend l'emplacement à la réserve des proies
+     * @param place Emplacement libéré
+     */
+    static void operator delete(void* place);
+
+    /**
+     * @brief Pendant du new placé (constructeur en échec) : rien à rendre
+     */
+    static void operator delete(void*, void*) {}
+    
+    /**
+     * @brief Destructeur
+     */
+    ~Proie();
+    
+    /**
+     * @brief Définit le comportement de la proie (fuite, alimentation, errance)
+     * @param proies Liste des proies dans le monde (non utilisée)
+     * @param predateurs Liste des prédateurs dans le monde
+     * @param plantes Liste des plantes disponibles
+     * @param monde Dimensions, champ de végétation et carte de la nourriture
+     */
+    void Comportement(const std::vector<Proie*>& proies,
+                     const std::vector<Predateur*>& predateurs,
+                     const std::vector<Plante*>& plantes,
+                     const ContexteMonde& monde) override;
+
+    /**
+     * @brief Déplace l'animal selon sa vitesse et gère les rebonds
+     * @param deltaTime Temps écoulé depuis le dernier frame (secondes)
+     * @param monde Dimensions du monde
+     */
+    void Deplacer(float deltaTime, const ContexteMonde& monde) override;
+    
+    /**
+     * @brief Vérifie si la proie peut se reproduire
+     * @param monde Contexte de l'écosystème propriétaire (annexes)
+     * @return true si conditions remplies, false sinon
+     */
+    bool PeutSeReproduire(const ContexteMonde& monde) const override;
+
+    /**
+     * @brief Récupère l'énergie minimal pour se reproduire
+     * @return La quantité d'energie necessaire par espèce (0-100)
+     */
+    float GetSeuil() const override;
+
+    /**
+     * @brief Gère le métabolisme et perte d'énergie
+     * @param deltaTime Temps écoulé (secondes)
+     */
+    void Metabolisme(float deltaTime) override;
+    
+    /**
+     * @brief Détecte le prédateur le plus proche
+     * @param proies Liste des proies (non utilisée)
+     * @param predateurs Liste des prédateurs disponibles
+     * @param monde Contexte de l'écosystème propriétaire (délais de suivi)
+     */
+    void Detecter(const std::vector<Proie*>& proies,
+                 const std::vector<Predateur*>& predateurs,
+                 const ContexteMonde& monde) override;
+
+    /**
+     * @brief Oublie la menace suivie si elle est morte (avant sa libération)
+     * @param monde Contexte de l'écosystème propriétaire (délais de suivi)
+     */
+    void OublierCibleMorte(const ContexteMonde& monde);
+
+    /**
+     * @brief Menace suivie
+     * @return Prédateur détecté, nullptr si aucun
+     */
+    Predateur* GetMenaceDetectee() const;
+
+    /**
+     * @brief Remplace la menace suivie par sa copie relogée
+     * @param menace Nouvelle adresse du même prédateur
+     */
+    void RemplacerMenace(Predateur* menace);
+
+    /**
+     * @brief Broute la cellule du champ où se trouve la proie
+     * @param champ Champ de biomasse
+     * @param deltaTime Temps écoulé (secondes)
+     * @return Biomasse broutée
+     */
+    float Brouter(ChampVegetation& champ, float deltaTime);
+    
+private:
+    /**
+     * @brief Détecte la plante la plus proche
+     * @param plantes Liste des plantes disponibles
+     * @param carte Carte de la nourriture (nullptr : recherche parmi les plantes)
+     */
+    void DetecterPlante(const std::vector<Plante*>& plantes, const CarteNourriture* carte);
+    
+    /**
+     * @brief Se dirige vers la plante détectée
+     */
+    void ChercherPlante();
+
+    /**
+     * @brief Reste sur une cellule riche, sinon remonte le gradient de biomasse
+     * @param champ Champ de biomasse de l'écosystème
+     * @param alea Flux aléatoire de l'errance
+     */
+    void Paturer(const ChampVegetation& champ, GenerateurAleatoire& alea);
+    
+    /**
+     * @brief S'éloigne du prédateur détecté
+     */
+    void Fuir();
+    
+    /**
+     * @brief Consomme une plante si à portée
+     */
+    void SeNourrir();
+};
+
+/* Corps en ligne : le prédateur doit être complet pour la fuite */
+#include "Predateur.h"
+#include "Proie.inl"
+
 #endif /* PROIE_H */
\ No newline at end of file
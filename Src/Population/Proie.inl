@@ -0,0 +1,182 @@
+/**
+ * @file Proie.inl
+ * @brief Comportement de la proie, défini en ligne pour les boucles par espèce
+ *
+ * Inclus à la fin de Proie.h : MettreAJourLot et ListesVoisins intègrent
+ * détection, fuite et alimentation au lieu d'appeler Proie.cpp à chaque animal.
+ */
+
+#ifndef PROIE_INL
+#define PROIE_INL
+
+#include "Proie.h"
+#include "Predateur.h"
+#include "Plante.h"
+#include "ChampVegetation.h"
+#include "CarteNourriture.h"
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Trouve et cible le prédateur vivant le plus proche (ou garde la menace suivie)
+ */
+inline void Proie::Detecter(const std::vector<Proie*>& /*proies*/,
+                           const std::vector<Predateur*>& predateurs,
+                           const ContexteMonde& monde)
+{
+    mMenaceDetectee = SuivreOuDetecter(predateurs, mMenaceDetectee, Politique::RAYON_DETECTION_PREDATEUR,
+                                       Politique::VITESSE_BASE, PolitiqueEspece<Predateur>::VITESSE_BASE, monde);
+}
+
+/**
+ * @brief Ajuste vitesse pour s'éloigner du prédateur
+ */
+inline void Proie::Fuir()
+{
+    float dx = mMenaceDetectee->GetX() - this->GetX();
+    float dy = mMenaceDetectee->GetY() - this->GetY();
+    float distance = sqrt(dx * dx + dy * dy);
+    
+    if (distance > 0.01f)
+    {
+        /* Direction opposée au prédateur */
+        mVx = -(dx / distance) * Politique::VITESSE_BASE;
+        mVy = -(dy / distance) * Politique::VITESSE_BASE;
+    }
+}
+
+/**
+ * @brief Orchestre fuite, alimentation ou errance selon situation
+ */
+inline void Proie::Comportement(const std::vector<Proie*>& proies,
+                               const std::vector<Predateur*>& predateurs,
+                               const std::vector<Plante*>& plantes,
+                               const ContexteMonde& monde)
+{
+    Detecter(proies, predateurs, monde);
+    
+    if (mMenaceDetectee)
+    {
+        Fuir();
+    }
+    else if (monde.champ)
+    {
+        Paturer(*monde.champ, *monde.alea);
+    }
+    else if (mPlanteDetectee)
+    {
+        ChercherPlante();
+        SeNourrir();
+    }
+    else
+    {
+        ErrerSelon<Politique>(*monde.alea);
+        DetecterPlante(plantes, monde.carte);
+    }
+}
+
+/**
+ * @brief Ajuste vitesse pour se diriger vers la plante cible
+ */
+inline void Proie::ChercherPlante()
+{
+    float dx = mPlanteDetectee->GetX() - this->GetX();
+    float dy = mPlanteDetectee->GetY() - this->GetY();
+    float distance = sqrt(dx * dx + dy * dy);
+    
+    if (distance > 0.01f)
+    {
+        mVx = (dx / distance) * Politique::VITESSE_BASE;
+        mVy = (dy / distance) * Politique::VITESSE_BASE;
+    }
+}
+
+/**
+ * @brief Erre tant que la cellule nourrit, puis suit la pente vers plus de biomasse
+ */
+inline void Proie::Paturer(const ChampVegetation& champ, GenerateurAleatoire& alea)
+{
+    if (champ.Lire(GetX(), GetY()) >= Politique::SEUIL_PATURAGE * champ.GetCapacite())
+    {
+        ErrerSelon<Politique>(alea);
+        return;
+    }
+
+    float gx, gy;
+    champ.Gradient(GetX(), GetY(), gx, gy);
+    float norme = sqrt(gx * gx + gy * gy);
+    if (norme > 1e-9f)
+    {
+        mVx = (gx / norme) * Politique::VITESSE_BASE;
+        mVy = (gy / norme) * Politique::VITESSE_BASE;
+    }
+    else
+        ErrerSelon<Politique>(alea);
+}
+
+/**
+ * @brief Trouve et cible la plante disponible la plus proche
+ */
+inline void Proie::DetecterPlante(const std::vector<Plante*>& plantes, const CarteNourriture* carte)
+{
+    float distMin = 9999.0f;
+    mPlanteDetectee = nullptr;
+
+    /* Une lecture de cellule ; la portée reste celle de l'animal */
+    if (carte)
+    {
+        Plante* plante = carte->Lire(GetX(), GetY());
+        if (plante)
+        {
+            float dx = plante->GetX() - this->GetX();
+            float dy = plante->GetY() - this->GetY();
+            float distanceCarre = dx * dx + dy * dy;
+            if (distanceCarre < Politique::RAYON_DETECTION_PLANTE * Politique::RAYON_DETECTION_PLANTE
+                && distanceCarre < distMin)
+                mPlanteDetectee = plante;
+        }
+        return;
+    }
+    
+    for (auto* plant : plantes)
+    {
+        if (!plant->EstDisponible()) continue;
+        
+        float dx = plant->GetX() - this->GetX();
+        float dy = plant->GetY() - this->GetY();
+        float distanceCarre = dx * dx + dy * dy;
+        float rayonCarre = Politique::RAYON_DETECTION_PLANTE * Politique::RAYON_DETECTION_PLANTE;
+        
+        if (distanceCarre < rayonCarre && distanceCarre < distMin)
+        {
+            distMin = distanceCarre;
+            mPlanteDetectee = plant;
+        }
+    }
+}
+
+/**
+ * @brief Consomme plante si à portée
+ */
+inline void Proie::SeNourrir()
+{
+    if (!mPlanteDetectee) return;
+    if (!mPlanteDetectee->EstDisponible())
+    {
+        mPlanteDetectee = nullptr;
+        return;
+    }
+    
+    float dx = mPlanteDetectee->GetX() - this->GetX();
+    float dy = mPlanteDetectee->GetY() - this->GetY();
+    float distance = sqrt(dx * dx + dy * dy);
+    
+    if (distance <= Politique::RAYON_ATTAQUE)
+    {
+        mPlanteDetectee->Consommer();
+        this->GagnerEnergie(Politique::ENERGIE_GAGNE_PAR_PLANTE);
+        mPlanteDetectee = nullptr;
+    }
+}
+
+#endif /* PROIE_INL */
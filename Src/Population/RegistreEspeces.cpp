@@ -0,0 +1,206 @@
+/**
+ * @file RegistreEspeces.cpp
+ * @brief Lecture du fichier de configuration des espèces
+ */
+
+#include "RegistreEspeces.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @brief Retire espaces et fins de ligne aux deux bouts
+ */
+static std::string Nettoyer(const std::string& texte)
+{
+    const char* blancs = " \t\r\n";
+    size_t debut = texte.find_first_not_of(blancs);
+    if (debut == std::string::npos)
+        return "";
+    size_t fin = texte.find_last_not_of(blancs);
+    return texte.substr(debut, fin - debut + 1);
+}
+
+/**
+ * @brief Valeurs proches d'une proie de la forêt
+ */
+ParametresEspece RegistreEspeces::ParametresParDefaut(const std::string& nom)
+{
+    ParametresEspece espece;
+    espece.nom = nom;
+    espece.vitesse = 80.0f;
+    espece.rayonDetection = 100.0f;
+    espece.rayonAttaque = 20.0f;
+    espece.margeBord = 30.0f;
+    espece.metabolisme = 0.1f;
+    espece.coutDeplacement = 0.01f;
+    espece.changementDirection = 5;
+    espece.delaiReproduction = 40.0f;
+    espece.seuilReproduction = 70.0f;
+    espece.chanceReproduction = 24;
+    espece.energieRepas = 5.0f;
+    espece.populationInitiale = 0;
+    espece.taille = 16;
+    espece.couleur[0] = 255;
+    espece.couleur[1] = 255;
+    espece.couleur[2] = 255;
+    espece.mangePlantes = false;
+    return espece;
+}
+
+/**
+ * @brief Lit sections, paramètres et interactions ligne par ligne
+ */
+bool RegistreEspeces::Charger(const std::string& chemin)
+{
+    std::ifstream fichier(chemin);
+    if (!fichier)
+    {
+        std::cerr << "❌ Configuration des espèces introuvable : " << chemin << std::endl;
+        return false;
+    }
+
+    mEspeces.clear();
+
+    /* Les interactions peuvent citer une espèce définie plus bas : lues à la fin */
+    std::vector<std::pair<int, std::string>> interactions;
+    ParametresEspece* courante = nullptr;
+    bool sectionInteractions = false;
+    std::string ligne;
+    int numero = 0;
+
+    while (std::getline(fichier, ligne))
+    {
+        numero++;
+        ligne = Nettoyer(ligne.substr(0, ligne.find('#')));
+        if (ligne.empty())
+            continue;
+
+        if (ligne.front() == '[' && ligne.back() == ']')
+        {
+            std::string nom = Nettoyer(ligne.substr(1, ligne.size() - 2));
+            sectionInteractions = (nom == "Interactions");
+            courante = nullptr;
+            if (!sectionInteractions)
+            {
+                if (IndiceDe(nom) >= 0 || nom.empty())
+                {
+                    std::cerr << "❌ " << chemin << ":" << numero << " : espèce vide ou en double" << std::endl;
+                    return false;
+                }
+                mEspeces.push_back(ParametresParDefaut(nom));
+                courante = &mEspeces.back();
+            }
+            continue;
+        }
+
+        if (sectionInteractions)
+        {
+            interactions.push_back(std::make_pair(numero, ligne));
+            continue;
+        }
+
+        size_t egal = ligne.find('=');
+        if (!courante || egal == std::string::npos)
+        {
+            std::cerr << "❌ " << chemin << ":" << numero << " : ligne hors section ou sans '='" << std::endl;
+            return false;
+        }
+
+        std::string cle = Nettoyer(ligne.substr(0, egal));
+        std::istringstream valeur(ligne.substr(egal + 1));
+        bool ok = true;
+
+        if (cle == "vitesse")                   ok = static_cast<bool>(valeur >> courante->vitesse);
+        else if (cle == "rayon_detection")      ok = static_cast<bool>(valeur >> courante->rayonDetection);
+        else if (cle == "rayon_attaque")        ok = static_cast<bool>(valeur >> courante->rayonAttaque);
+        else if (cle == "marge_bord")           ok = static_cast<bool>(valeur >> courante->margeBord);
+        else if (cle == "metabolisme")          ok = static_cast<bool>(valeur >> courante->metabolisme);
+        else if (cle == "cout_deplacement")     ok = static_cast<bool>(valeur >> courante->coutDeplacement);
+        else if (cle == "changement_direction") ok = static_cast<bool>(valeur >> courante->changementDirection);
+        else if (cle == "delai_reproduction")   ok = static_cast<bool>(valeur >> courante->delaiReproduction);
+        else if (cle == "seuil_reproduction")   ok = static_cast<bool>(valeur >> courante->seuilReproduction);
+        else if (cle == "chance_reproduction")  ok = static_cast<bool>(valeur >> courante->chanceReproduction);
+        else if (cle == "energie_repas")        ok = static_cast<bool>(valeur >> courante->energieRepas);
+        else if (cle == "population")           ok = static_cast<bool>(valeur >> courante->populationInitiale);
+        else if (cle == "taille")               ok = static_cast<bool>(valeur >> courante->taille);
+        else if (cle == "couleur")
+        {
+            int r, v, b;
+            ok = static_cast<bool>(valeur >> r >> v >> b);
+            courante->couleur[0] = static_cast<uint8_t>(r);
+            courante->couleur[1] = static_cast<uint8_t>(v);
+            courante->couleur[2] = static_cast<uint8_t>(b);
+        }
+        else
+        {
+            std::cerr << "❌ " << chemin << ":" << numero << " : paramètre inconnu '" << cle << "'" << std::endl;
+            return false;
+        }
+
+        if (!ok)
+        {
+            std::cerr << "❌ " << chemin << ":" << numero << " : valeur invalide pour '" << cle << "'" << std::endl;
+            return false;
+        }
+    }
+
+    /* Matrice creuse : chaque espèce garde la liste de ses proies et de ses menaces */
+    for (const auto& interaction : interactions)
+    {
+        std::istringstream mots(interaction.second);
+        std::string sujet, verbe, cible;
+        mots >> sujet >> verbe >> cible;
+
+        int indiceSujet = IndiceDe(sujet);
+        int indiceCible = IndiceDe(cible);
+        bool plantes = (verbe == "mange" && cible == "plantes");
+
+        if (indiceSujet < 0 || (indiceCible < 0 && !plantes) || (verbe != "mange" && verbe != "fuit"))
+        {
+            std::cerr << "❌ " << chemin << ":" << interaction.first
+                      << " : interaction invalide '" << interaction.second << "'" << std::endl;
+            return false;
+        }
+
+        ParametresEspece& espece = mEspeces[indiceSujet];
+        if (plantes)
+            espece.mangePlantes = true;
+        else if (verbe == "mange")
+            espece.proies.push_back(indiceCible);
+        else
+            espece.menaces.push_back(indiceCible);
+    }
+
+    std::cout << "✅ " << mEspeces.size() << " espèces chargées depuis " << chemin << std::endl;
+    return true;
+}
+
+/**
+ * @brief Recherche linéaire (quelques espèces seulement)
+ */
+int RegistreEspeces::IndiceDe(const std::string& nom) const
+{
+    for (size_t i = 0; i < mEspeces.size(); i++)
+    {
+        if (mEspeces[i].nom == nom)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+/**
+ * @brief Récupère le nombre d'espèces
+ */
+int RegistreEspeces::GetNombreEspeces() const
+{
+    return static_cast<int>(mEspeces.size());
+}
+
+/**
+ * @brief Accès aux paramètres d'une espèce
+ */
+const ParametresEspece& RegistreEspeces::GetEspece(int indice) const
+{
+    return mEspeces[indice];
+}
@@ -0,0 +1,89 @@
+/**
+ * @file RegistreEspeces.h
+ * @brief Espèces et réseau trophique décrits dans un fichier de configuration
+ */
+
+#ifndef REGISTRE_ESPECES_H
+#define REGISTRE_ESPECES_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ParametresEspece
+ * @brief Paramètres d'une espèce chargée depuis la configuration
+ */
+struct ParametresEspece
+{
+    std::string nom;                /**< Nom de l'espèce (clé de la section) */
+    float vitesse;                  /**< Vitesse de déplacement (pixels/s) */
+    float rayonDetection;           /**< Rayon de détection des proies et menaces */
+    float rayonAttaque;             /**< Distance pour manger */
+    float margeBord;                /**< Distance de rebond aux bords du monde */
+    float metabolisme;              /**< Énergie perdue par seconde au repos */
+    float coutDeplacement;          /**< Énergie perdue par pixel parcouru */
+    int changementDirection;        /**< Chances sur 100 de tourner en errant, par tick */
+    float delaiReproduction;        /**< Délai entre reproductions (s) */
+    float seuilReproduction;        /**< Énergie min pour se reproduire (et coût de la naissance) */
+    int chanceReproduction;         /**< Chances sur 100 de se reproduire une fois éligible, par tick */
+    float energieRepas;             /**< Énergie gagnée par repas */
+    int populationInitiale;         /**< Individus créés au lancement */
+    int taille;                     /**< Côté du sprite (pixels écran à zoom 1) */
+    uint8_t couleur[3];             /**< Couleur d'affichage (R, V, B) */
+
+    bool mangePlantes;              /**< Se nourrit des plantes */
+    std::vector<int> proies;        /**< Espèces mangées (indices dans le registre) */
+    std::vector<int> menaces;       /**< Espèces fuies (indices dans le registre) */
+};
+
+/**
+ * @class RegistreEspeces
+ * @brief Table des espèces et matrice creuse « qui mange / fuit qui »
+ *
+ * Format du fichier : une section [Nom] par espèce avec des lignes
+ * « cle = valeur », puis une section [Interactions] avec des lignes
+ * « A mange B », « A mange plantes » ou « A fuit B ». # commence un commentaire.
+ */
+class RegistreEspeces
+{
+private:
+    std::vector<ParametresEspece> mEspeces;     /**< Espèces dans l'ordre du fichier */
+
+    /**
+     * @brief Paramètres par défaut d'une nouvelle espèce
+     * @param nom Nom de l'espèce
+     * @return Paramètres initialisés
+     */
+    static ParametresEspece ParametresParDefaut(const std::string& nom);
+
+public:
+    /**
+     * @brief Charge un fichier de configuration (remplace le contenu actuel)
+     * @param chemin Chemin du fichier
+     * @return true si succès, false sinon (erreur affichée avec son numéro de ligne)
+     */
+    bool Charger(const std::string& chemin);
+
+    /**
+     * @brief Trouve une espèce par son nom
+     * @param nom Nom de l'espèce
+     * @return Indice de l'espèce, -1 si inconnue
+     */
+    int IndiceDe(const std::string& nom) const;
+
+    /**
+     * @brief Récupère le nombre d'espèces
+     * @return Nombre d'espèces
+     */
+    int GetNombreEspeces() const;
+
+    /**
+     * @brief Accès aux paramètres d'une espèce
+     * @param indice Indice de l'espèce
+     * @return Paramètres
+     */
+    const ParametresEspece& GetEspece(int indice) const;
+};
+
+#endif /* REGISTRE_ESPECES_H */
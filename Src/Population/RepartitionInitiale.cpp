@@ -0,0 +1,231 @@
+/**
+ * @file RepartitionInitiale.cpp
+ * @brief Tirage des positions initiales selon la disposition choisie
+ */
+
+#include "RepartitionInitiale.h"
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/**
+ * @brief Constructeur : aucun rectangle préparé, masque vide
+ */
+RepartitionInitiale::RepartitionInitiale(TypeRepartition type, unsigned int graine)
+    : mType(type == REPARTITION_MASQUE ? REPARTITION_UNIFORME : type)
+    , mGraine(graine)
+    , mLargeurMasque(0)
+    , mHauteurMasque(0)
+    , mX0(0.0f)
+    , mY0(0.0f)
+    , mX1(1.0f)
+    , mY1(1.0f)
+    , mEchelleX(1.0f)
+    , mEchelleY(1.0f)
+    , mHauteurBande(HAUTEUR_BANDE)
+    , mEcartAgregat(1.0f)
+    , mRepliUniforme(true)
+{
+}
+
+/**
+ * @brief Poids d'un pixel : luminosité (BT.601) multipliée par l'opacité
+ */
+bool RepartitionInitiale::ChargerMasque(const std::string& chemin)
+{
+    SDL_Surface* image = IMG_Load(chemin.c_str());
+    if (!image)
+    {
+        std::cerr << "❌ Masque illisible (" << chemin << "): " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_Surface* rgba = image;
+    if (image->format != SDL_PIXELFORMAT_RGBA32)
+        rgba = SDL_ConvertSurface(image, SDL_PIXELFORMAT_RGBA32);
+    if (!rgba)
+    {
+        std::cerr << "❌ Conversion du masque impossible : " << SDL_GetError() << std::endl;
+        SDL_DestroySurface(image);
+        return false;
+    }
+
+    mLargeurMasque = rgba->w;
+    mHauteurMasque = rgba->h;
+    mMasque.resize(static_cast<size_t>(mLargeurMasque) * mHauteurMasque);
+    for (int y = 0; y < mHauteurMasque; y++)
+    {
+        const uint8_t* ligne = static_cast<const uint8_t*>(rgba->pixels) + static_cast<size_t>(y) * rgba->pitch;
+        for (int x = 0; x < mLargeurMasque; x++)
+        {
+            const uint8_t* p = ligne + x * 4;
+            float luminosite = (0.299f * p[0] + 0.587f * p[1] + 0.114f * p[2]) / 255.0f;
+            mMasque[static_cast<size_t>(y) * mLargeurMasque + x] = luminosite * (p[3] / 255.0f);
+        }
+    }
+
+    if (rgba != image)
+        SDL_DestroySurface(rgba);
+    SDL_DestroySurface(image);
+
+    mType = REPARTITION_MASQUE;
+    std::cout << "🗺️ Masque de répartition " << mLargeurMasque << "x" << mHauteurMasque
+              << " chargé : " << chemin << std::endl;
+    return true;
+}
+
+/**
+ * @brief Précalcule ce qui ne dépend que du rectangle : centres proches, poids cumulés du masque
+ */
+void RepartitionInitiale::Preparer(float largeurMonde, float hauteurMonde, float x0, float y0, float x1, float y1)
+{
+    mX0 = x0;
+    mY0 = y0;
+    mX1 = std::max(x0, x1);
+    mY1 = std::max(y0, y1);
+    mCentresX.clear();
+    mCentresY.clear();
+    mCumul.clear();
+    mPixels.clear();
+
+    switch (mType)
+    {
+    case REPARTITION_AGREGATS:
+    {
+        /* Tous les centres sont tirés, même loin du rectangle, pour rester
+           identiques d'une bande à l'autre ; seuls les proches sont gardés */
+        float surface = largeurMonde * hauteurMonde;
+        int nbCentres = std::max(1, static_cast<int>(surface / SURFACE_PAR_AGREGAT));
+        mEcartAgregat = std::sqrt(surface / nbCentres) / 8.0f;
+
+        GenerateurAleatoire alea(mGraine);
+        float portee = 3.0f * mEcartAgregat;
+        for (int i = 0; i < nbCentres; i++)
+        {
+            float cx = alea.Entre(0.0f, largeurMonde);
+            float cy = alea.Entre(0.0f, hauteurMonde);
+            if (cx + portee >= mX0 && cx - portee < mX1 && cy + portee >= mY0 && cy - portee < mY1)
+            {
+                mCentresX.push_back(cx);
+                mCentresY.push_back(cy);
+            }
+        }
+        mRepliUniforme = mCentresX.empty();
+        break;
+    }
+
+    case REPARTITION_BANDES:
+        /* Au moins deux bandes peuplées, même dans un petit monde */
+        mHauteurBande = std::min(HAUTEUR_BANDE, hauteurMonde / 4.0f);
+        mRepliUniforme = (mHauteurBande <= 0.0f);
+        break;
+
+    case REPARTITION_MASQUE:
+    {
+        /* Le masque couvre le monde ; un pixel à cheval sur le bord ne compte
+           que pour sa part intérieure au rectangle */
+        mEchelleX = largeurMonde / mLargeurMasque;
+        mEchelleY = hauteurMonde / mHauteurMasque;
+        int px0 = std::max(0, static_cast<int>(mX0 / mEchelleX));
+        int px1 = std::min(mLargeurMasque, static_cast<int>(std::ceil(mX1 / mEchelleX)));
+        int py0 = std::max(0, static_cast<int>(mY0 / mEchelleY));
+        int py1 = std::min(mHauteurMasque, static_cast<int>(std::ceil(mY1 / mEchelleY)));
+
+        double total = 0.0;
+        for (int py = py0; py < py1; py++)
+        {
+            float hauteur = std::min((py + 1) * mEchelleY, mY1) - std::max(py * mEchelleY, mY0);
+            for (int px = px0; px < px1; px++)
+            {
+                int pixel = py * mLargeurMasque + px;
+                float largeur = std::min((px + 1) * mEchelleX, mX1) - std::max(px * mEchelleX, mX0);
+                float poids = mMasque[pixel] * largeur * hauteur;
+                if (poids <= 0.0f)
+                    continue;
+                total += poids;
+                mCumul.push_back(total);
+                mPixels.push_back(pixel);
+            }
+        }
+        mRepliUniforme = mCumul.empty();
+        if (mRepliUniforme)
+            std::cerr << "⚠️ Masque noir sur [" << mX0 << ", " << mX1 << "[ : répartition uniforme" << std::endl;
+        break;
+    }
+
+    case REPARTITION_UNIFORME:
+    default:
+        mRepliUniforme = true;
+        break;
+    }
+}
+
+/**
+ * @brief Recherche dichotomique du pixel dans les poids cumulés
+ */
+void RepartitionInitiale::TirerMasque(GenerateurAleatoire& alea, float& x, float& y) const
+{
+    /* 64 bits de tirage : les petits poids d'une grande image restent atteignables */
+    double u = (alea.Suivant() * 4294967296.0 + alea.Suivant()) / 18446744073709551616.0;
+    size_t rang = std::upper_bound(mCumul.begin(), mCumul.end(), u * mCumul.back()) - mCumul.begin();
+    int pixel = mPixels[std::min(rang, mPixels.size() - 1)];
+
+    int px = pixel % mLargeurMasque;
+    int py = pixel / mLargeurMasque;
+    x = alea.Entre(std::max(px * mEchelleX, mX0), std::min((px + 1) * mEchelleX, mX1));
+    y = alea.Entre(std::max(py * mEchelleY, mY0), std::min((py + 1) * mEchelleY, mY1));
+}
+
+/**
+ * @brief Tirage selon la disposition, repli uniforme si elle ne donne rien
+ */
+void RepartitionInitiale::Tirer(GenerateurAleatoire& alea, float& x, float& y) const
+{
+    if (!mRepliUniforme)
+    {
+        switch (mType)
+        {
+        case REPARTITION_AGREGATS:
+            for (int essai = 0; essai < ESSAIS_AGREGAT; essai++)
+            {
+                int centre = alea.Entier(static_cast<int>(mCentresX.size()));
+                x = mCentresX[centre] + mEcartAgregat * alea.Normale();
+                y = mCentresY[centre] + mEcartAgregat * alea.Normale();
+                if (x >= mX0 && x < mX1 && y >= mY0 && y < mY1)
+                    return;
+            }
+            break;
+
+        case REPARTITION_BANDES:
+            /* Une bande sur deux est peuplée : rejet des bandes impaires */
+            x = alea.Entre(mX0, mX1);
+            for (int essai = 0; essai < ESSAIS_AGREGAT; essai++)
+            {
+                y = alea.Entre(mY0, mY1);
+                if (static_cast<int>(y / mHauteurBande) % 2 == 0)
+                    return;
+            }
+            return;
+
+        case REPARTITION_MASQUE:
+            TirerMasque(alea, x, y);
+            return;
+
+        default:
+            break;
+        }
+    }
+
+    x = alea.Entre(mX0, mX1);
+    y = alea.Entre(mY0, mY1);
+}
+
+/**
+ * @brief Récupère la disposition
+ */
+TypeRepartition RepartitionInitiale::GetType() const
+{
+    return mType;
+}
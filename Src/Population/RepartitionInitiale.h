@@ -0,0 +1,112 @@
+/**
+ * @file RepartitionInitiale.h
+ * @brief Disposition spatiale des populations initiales
+ */
+
+#ifndef REPARTITION_INITIALE_H
+#define REPARTITION_INITIALE_H
+
+#include "../Core/GenerateurAleatoire.h"
+#include <string>
+#include <vector>
+
+/**
+ * @enum TypeRepartition
+ * @brief Façon de disposer les entités créées par Ecosysteme::Peupler
+ */
+enum TypeRepartition
+{
+    REPARTITION_UNIFORME,   /**< Densité constante */
+    REPARTITION_AGREGATS,   /**< Groupes gaussiens autour de centres tirés au hasard */
+    REPARTITION_BANDES,     /**< Bandes horizontales peuplées, séparées par des bandes vides */
+    REPARTITION_MASQUE      /**< Densité proportionnelle à la luminosité d'une image */
+};
+
+/**
+ * @class RepartitionInitiale
+ * @brief Tire des positions selon une disposition, dans un rectangle du monde
+ *
+ * Preparer fixe le rectangle à peupler (monde entier, bande d'un processus,
+ * marge des plantes) ; Tirer est ensuite constante et peut être appelée par
+ * plusieurs threads, chacun avec son générateur. Les centres des agrégats ne
+ * dépendent que de la graine et du monde : des processus voisins voient les
+ * mêmes groupes de part et d'autre de leur frontière.
+ */
+class RepartitionInitiale
+{
+private:
+    static constexpr float SURFACE_PAR_AGREGAT = 1500.0f * 1500.0f;   /**< Surface du monde par centre d'agrégat */
+    static constexpr float HAUTEUR_BANDE = 400.0f;                     /**< Hauteur d'une bande peuplée (et d'une vide) */
+    static constexpr int ESSAIS_AGREGAT = 8;                           /**< Tirages hors rectangle tolérés avant repli uniforme */
+
+    TypeRepartition mType;          /**< Disposition choisie */
+    unsigned int mGraine;           /**< Graine des centres d'agrégats */
+
+    int mLargeurMasque;             /**< Largeur de l'image masque (pixels) */
+    int mHauteurMasque;             /**< Hauteur de l'image masque (pixels) */
+    std::vector<float> mMasque;     /**< Poids de chaque pixel (luminosité x opacité) */
+
+    float mX0;                      /**< Rectangle préparé : bord gauche */
+    float mY0;                      /**< Rectangle préparé : bord haut */
+    float mX1;                      /**< Rectangle préparé : bord droit (exclu) */
+    float mY1;                      /**< Rectangle préparé : bord bas (exclu) */
+    float mEchelleX;                /**< Pixels monde par pixel de masque, horizontalement */
+    float mEchelleY;                /**< Pixels monde par pixel de masque, verticalement */
+    float mHauteurBande;            /**< Hauteur d'une bande pour le monde préparé */
+    float mEcartAgregat;            /**< Écart type des agrégats pour le monde préparé */
+    std::vector<float> mCentresX;   /**< Abscisses des centres d'agrégats proches du rectangle */
+    std::vector<float> mCentresY;   /**< Ordonnées des mêmes centres */
+    std::vector<double> mCumul;     /**< Poids cumulés des pixels du masque touchant le rectangle */
+    std::vector<int> mPixels;       /**< Pixel de masque de chaque entrée de mCumul */
+    bool mRepliUniforme;            /**< Rien à tirer selon la disposition : densité constante */
+
+    /**
+     * @brief Tire un pixel du masque selon son poids, puis un point de ce pixel
+     * @param alea Générateur du thread appelant
+     * @param x Position horizontale tirée
+     * @param y Position verticale tirée
+     */
+    void TirerMasque(GenerateurAleatoire& alea, float& x, float& y) const;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param type Disposition (REPARTITION_MASQUE exige ChargerMasque)
+     * @param graine Graine des centres d'agrégats
+     */
+    explicit RepartitionInitiale(TypeRepartition type = REPARTITION_UNIFORME, unsigned int graine = 0);
+
+    /**
+     * @brief Charge une image masque et passe en REPARTITION_MASQUE
+     * @param chemin Image (formats de SDL_image), étirée sur tout le monde
+     * @return false si l'image est illisible (la disposition ne change pas)
+     */
+    bool ChargerMasque(const std::string& chemin);
+
+    /**
+     * @brief Fixe le rectangle des prochains tirages
+     * @param largeurMonde Largeur du monde
+     * @param hauteurMonde Hauteur du monde
+     * @param x0 Bord gauche du rectangle
+     * @param y0 Bord haut du rectangle
+     * @param x1 Bord droit du rectangle (exclu)
+     * @param y1 Bord bas du rectangle (exclu)
+     */
+    void Preparer(float largeurMonde, float hauteurMonde, float x0, float y0, float x1, float y1);
+
+    /**
+     * @brief Tire une position dans le rectangle préparé
+     * @param alea Générateur du thread appelant
+     * @param x Position horizontale tirée
+     * @param y Position verticale tirée
+     */
+    void Tirer(GenerateurAleatoire& alea, float& x, float& y) const;
+
+    /**
+     * @brief Récupère la disposition
+     * @return Type de répartition
+     */
+    TypeRepartition GetType() const;
+};
+
+#endif /* REPARTITION_INITIALE_H */
@@ -0,0 +1,137 @@
+/**
+ * @file ReserveObjets.h
+ * @brief Emplacements d'objets alloués par blocs et recyclés
+ */
+
+#ifndef RESERVE_OBJETS_H
+#define RESERVE_OBJETS_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @class ReserveObjets
+ * @brief Réserve d'emplacements pour les objets d'une classe, partagée par le processus
+ * @tparam T Classe dont l'opérateur new puise dans la réserve
+ *
+ * Les emplacements sont pris dans de grands blocs, jamais rendus au système
+ * avant la fin du programme : un objet libéré laisse son emplacement au
+ * prochain new. Reserver prend d'un coup les emplacements d'une population
+ * entière (un seul bloc, un seul verrou) pour les remplir en parallèle par
+ * new placé.
+ */
+template<typename T>
+class ReserveObjets
+{
+private:
+    static constexpr size_t TAILLE_BLOC = 4096;     /**< Emplacements ajoutés quand la réserve est vide */
+
+    /**
+     * @union Emplacement
+     * @brief Place d'un objet, ou maillon de la liste des places libres
+     */
+    union Emplacement
+    {
+        Emplacement* suivant;                               /**< Place libre suivante */
+        alignas(T) unsigned char octets[sizeof(T)];         /**< Stockage de l'objet */
+    };
+
+    std::mutex mMutex;                      /**< Protège blocs et places libres */
+    std::vector<Emplacement*> mBlocs;       /**< Blocs alloués (possédés) */
+    Emplacement* mLibres;                   /**< Tête de la liste des places libres */
+
+    ReserveObjets() : mLibres(nullptr) {}
+
+    ~ReserveObjets()
+    {
+        for (auto* bloc : mBlocs)
+            ::operator delete(bloc);
+    }
+
+    /**
+     * @brief Réserve unique de la classe
+     * @return Réserve créée au premier appel
+     */
+    static ReserveObjets& Instance()
+    {
+        static ReserveObjets reserve;
+        return reserve;
+    }
+
+    /**
+     * @brief Alloue un bloc et l'ajoute aux places libres (verrou tenu)
+     * @param nombre Emplacements du bloc
+     */
+    void Agrandir(size_t nombre)
+    {
+        Emplacement* bloc = static_cast<Emplacement*>(::operator new(nombre * sizeof(Emplacement)));
+        mBlocs.push_back(bloc);
+        for (size_t i = nombre; i-- > 0;)
+        {
+            bloc[i].suivant = mLibres;
+            mLibres = &bloc[i];
+        }
+    }
+
+public:
+    /**
+     * @brief Prend une place (opérateur new de T)
+     * @return Mémoire non initialisée pour un T
+     */
+    static void* Allouer()
+    {
+        ReserveObjets& reserve = Instance();
+        std::lock_guard<std::mutex> verrou(reserve.mMutex);
+        if (!reserve.mLibres)
+            reserve.Agrandir(TAILLE_BLOC);
+        Emplacement* place = reserve.mLibres;
+        reserve.mLibres = place->suivant;
+        return place;
+    }
+
+    /**
+     * @brief Rend une place (opérateur delete de T)
+     * @param place Mémoire d'un T détruit
+     */
+    static void Liberer(void* place)
+    {
+        if (!place)
+            return;
+        ReserveObjets& reserve = Instance();
+        std::lock_guard<std::mutex> verrou(reserve.mMutex);
+        Emplacement* libre = static_cast<Emplacement*>(place);
+        libre->suivant = reserve.mLibres;
+        reserve.mLibres = libre;
+    }
+
+    /**
+     * @brief Prend plusieurs places d'un coup
+     * @param nombre Places demandées
+     * @param places Places prises (ajoutées), à remplir par new placé
+     *
+     * Les places libres sont reprises d'abord ; le reste vient d'un seul bloc.
+     */
+    static void Reserver(size_t nombre, std::vector<void*>& places)
+    {
+        ReserveObjets& reserve = Instance();
+        std::lock_guard<std::mutex> verrou(reserve.mMutex);
+        places.reserve(places.size() + nombre);
+        while (nombre > 0 && reserve.mLibres)
+        {
+            places.push_back(reserve.mLibres);
+            reserve.mLibres = reserve.mLibres->suivant;
+            nombre--;
+        }
+        if (nombre == 0)
+            return;
+
+        Emplacement* bloc = static_cast<Emplacement*>(::operator new(nombre * sizeof(Emplacement)));
+        reserve.mBlocs.push_back(bloc);
+        for (size_t i = 0; i < nombre; i++)
+            places.push_back(&bloc[i]);
+    }
+};
+
+#endif /* RESERVE_OBJETS_H */
@@ -1,359 +1,569 @@
-/**
- * @file GUI.cpp
- * @brief Implémentation des méthodes de la classe GUI pour gérer l'interface graphique
- */
-
-#include "GUI.h"
-
-/**
- * @brief Constructeur par défaut de la classe GUI
- */
-GUI::GUI() : mWindow(nullptr), mRenderer(nullptr)
-{
-}
-
-/**
- * @brief Destructeur de la classe GUI
- */
-GUI::~GUI()
-{
-}
-
-/**
- * @brief Initialise le contexte ImGui avec SDL
- * @param window Pointeur vers la fenêtre SDL
- * @param renderer Pointeur vers le renderer SDL
- */
-void GUI::Initialize(SDL_Window *window, SDL_Renderer *renderer)
-{
-    mWindow = window;
-    mRenderer = renderer;
-    
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
-    
-    ImGuiIO &io = ImGui::GetIO();
-    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
-    
-    ImGui_ImplSDL3_InitForSDLRenderer(window, renderer);
-    ImGui_ImplSDLRenderer3_Init(renderer);
-    
-    AppliquerStyleConfiguration();
-}
-
-/**
- * @brief Détruit le contexte ImGui et libère les ressources
- */
-void GUI::Destroy()
-{
-    ImGui_ImplSDLRenderer3_Shutdown();
-    ImGui_ImplSDL3_Shutdown();
-    ImGui::DestroyContext();
-}
-
-/**
- * @brief Applique un style professionnel pour la configuration
- */
-void GUI::AppliquerStyleConfiguration()
-{
-    ImGuiStyle &style = ImGui::GetStyle();
-    
-    style.WindowRounding = 10.0f;
-    style.FrameRounding = 6.0f;
-    style.ScrollbarRounding = 6.0f;
-    style.GrabRounding = 4.0f;
-    style.WindowPadding = ImVec2(15, 15);
-    style.FramePadding = ImVec2(10, 6);
-    style.ItemSpacing = ImVec2(12, 8);
-    
-    ImVec4 *colors = style.Colors;
-    colors[ImGuiCol_WindowBg] = ImVec4(0.95f, 0.95f, 0.96f, 1.0f);
-    colors[ImGuiCol_TitleBg] = ImVec4(0.20f, 0.50f, 0.35f, 1.0f);
-    colors[ImGuiCol_TitleBgActive] = ImVec4(0.25f, 0.60f, 0.42f, 1.0f);
-    colors[ImGuiCol_Button] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
-    colors[ImGuiCol_ButtonHovered] = ImVec4(0.30f, 0.70f, 0.52f, 1.0f);
-    colors[ImGuiCol_ButtonActive] = ImVec4(0.22f, 0.50f, 0.38f, 1.0f);
-    colors[ImGuiCol_FrameBg] = ImVec4(0.88f, 0.88f, 0.90f, 1.0f);
-    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.82f, 0.82f, 0.85f, 1.0f);
-    colors[ImGuiCol_SliderGrab] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
-    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.22f, 0.50f, 0.38f, 1.0f);
-    colors[ImGuiCol_Header] = ImVec4(0.26f, 0.59f, 0.45f, 0.55f);
-    colors[ImGuiCol_HeaderHovered] = ImVec4(0.30f, 0.70f, 0.52f, 0.80f);
-    colors[ImGuiCol_HeaderActive] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
-    colors[ImGuiCol_Text] = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
-}
-
-/**
- * @brief Applique un style professionnel sombre pour la simulation
- */
-void GUI::AppliquerStyleSimulation()
-{
-    ImGuiStyle &style = ImGui::GetStyle();
-    
-    style.WindowRounding = 8.0f;
-    style.FrameRounding = 4.0f;
-    style.ScrollbarRounding = 4.0f;
-    style.GrabRounding = 3.0f;
-    style.WindowPadding = ImVec2(12, 12);
-    style.FramePadding = ImVec2(8, 5);
-    style.ItemSpacing = ImVec2(10, 6);
-    style.Alpha = 0.94f;
-    
-    ImVec4 *colors = style.Colors;
-    colors[ImGuiCol_WindowBg] = ImVec4(0.10f, 0.11f, 0.13f, 0.95f);
-    colors[ImGuiCol_TitleBg] = ImVec4(0.15f, 0.16f, 0.18f, 1.0f);
-    colors[ImGuiCol_TitleBgActive] = ImVec4(0.20f, 0.22f, 0.24f, 1.0f);
-    colors[ImGuiCol_Button] = ImVec4(0.20f, 0.50f, 0.40f, 0.85f);
-    colors[ImGuiCol_ButtonHovered] = ImVec4(0.25f, 0.60f, 0.48f, 1.0f);
-    colors[ImGuiCol_ButtonActive] = ImVec4(0.18f, 0.45f, 0.36f, 1.0f);
-    colors[ImGuiCol_FrameBg] = ImVec4(0.18f, 0.20f, 0.22f, 0.85f);
-    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.22f, 0.24f, 0.26f, 0.90f);
-    colors[ImGuiCol_SliderGrab] = ImVec4(0.25f, 0.60f, 0.48f, 1.0f);
-    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.30f, 0.70f, 0.56f, 1.0f);
-    colors[ImGuiCol_Header] = ImVec4(0.20f, 0.50f, 0.40f, 0.55f);
-    colors[ImGuiCol_HeaderHovered] = ImVec4(0.25f, 0.60f, 0.48f, 0.80f);
-    colors[ImGuiCol_HeaderActive] = ImVec4(0.20f, 0.50f, 0.40f, 1.0f);
-    colors[ImGuiCol_Text] = ImVec4(0.92f, 0.93f, 0.94f, 1.0f);
-    colors[ImGuiCol_PlotLines] = ImVec4(0.25f, 0.70f, 0.55f, 1.0f);
-    colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.30f, 0.80f, 0.65f, 1.0f);
-}
-
-/**
- * @brief Affiche le menu de configuration initial
- * @param windowWidth Largeur de la fenêtre
- * @param windowHeight Hauteur de la fenêtre
- * @return Configuration choisie par l'utilisateur
- */
-ConfigEcosysteme GUI::AfficherMenuConfiguration(int windowWidth, int windowHeight)
-{
-    ConfigEcosysteme config;
-    config.nbProies = 20;
-    config.nbPredateurs = 5;
-    config.nbPlantes = 30;
-    config.nbPlantesConso = 50;
-    config.delaiPlantes = 5.0f;
-    config.typeEcosysteme = 0;
-    config.pret = false;
-    
-    const char *typesEcosysteme[] = {"🌲 Forêt", "🌊 Océan"};
-    
-    bool enCours = true;
-    SDL_Event event;
-    
-    while (enCours)
-    {
-        while (SDL_PollEvent(&event))
-        {
-            ImGui_ImplSDL3_ProcessEvent(&event);
-            if (event.type == SDL_EVENT_QUIT)
-            {
-                config.pret = false;
-                return config;
-            }
-        }
-        
-        ImGui_ImplSDL3_NewFrame();
-        ImGui_ImplSDLRenderer3_NewFrame();
-        ImGui::NewFrame();
-        
-        /* Fenêtre de configuration centrée */
-        float windowW = 650.0f;
-        float windowH = 580.0f;
-        ImGui::SetNextWindowPos(ImVec2((windowWidth - windowW) / 2, (windowHeight - windowH) / 2));
-        ImGui::SetNextWindowSize(ImVec2(windowW, windowH));
-        
-        ImGui::Begin("🌍 Configuration de l'Écosystème", nullptr,
-                     ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse);
-        
-        ImGui::Dummy(ImVec2(0, 10));
-        ImGui::TextWrapped("Configurez les paramètres initiaux de votre simulation écologique.");
-        ImGui::Separator();
-        ImGui::Dummy(ImVec2(0, 10));
-        
-        /* Type d'écosystème */
-        ImGui::Text("📍 Type d'Écosystème");
-        ImGui::Combo("##type", &config.typeEcosysteme, typesEcosysteme, 2);
-        
-        ImGui::Dummy(ImVec2(0, 15));
-        ImGui::Separator();
-        ImGui::Dummy(ImVec2(0, 10));
-        
-        /* Population initiale */
-        ImGui::Text("🐾 Population Initiale");
-        ImGui::Dummy(ImVec2(0, 5));
-        ImGui::SliderInt("Proies (Herbivores)", &config.nbProies, 5, 50);
-        ImGui::SliderInt("Prédateurs (Carnivores)", &config.nbPredateurs, 1, 20);
-        
-        ImGui::Dummy(ImVec2(0, 15));
-        ImGui::Separator();
-        ImGui::Dummy(ImVec2(0, 10));
-        
-        /* Végétation */
-        ImGui::Text("🌱 Végétation");
-        ImGui::Dummy(ImVec2(0, 5));
-        ImGui::SliderInt("Nombre de Plantes", &config.nbPlantes, 10, 100);
-        ImGui::SliderInt("Plantes pour Satiété", &config.nbPlantesConso, 10, 100);
-        ImGui::SliderFloat("Vitesse de Repousse (s)", &config.delaiPlantes, 1.0f, 10.0f, "%.1f");
-        
-        ImGui::Dummy(ImVec2(0, 20));
-        ImGui::Separator();
-        ImGui::Dummy(ImVec2(0, 10));
-        
-        /* Résumé */
-        ImGui::Text("📊 Résumé de la Configuration");
-        ImGui::Dummy(ImVec2(0, 5));
-        ImGui::BulletText("Écosystème : %s", typesEcosysteme[config.typeEcosysteme]);
-        ImGui::BulletText("Population : %d proies, %d prédateurs", config.nbProies, config.nbPredateurs);
-        ImGui::BulletText("Végétation : %d plantes (repousse en %.1fs)", config.nbPlantes, config.delaiPlantes);
-        
-        ImGui::Dummy(ImVec2(0, 20));
-        
-        /* Bouton de lancement */
-        float buttonWidth = 250.0f;
-        ImGui::SetCursorPosX((windowW - buttonWidth) / 2);
-        if (ImGui::Button("🚀 Lancer la Simulation", ImVec2(buttonWidth, 50)))
-        {
-            config.pret = true;
-            enCours = false;
-        }
-        
-        ImGui::End();
-        
-        /* Rendu */
-        SDL_SetRenderDrawColor(mRenderer, 35, 40, 45, 255);
-        SDL_RenderClear(mRenderer);
-        
-        ImGui::Render();
-        ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), mRenderer);
-        SDL_RenderPresent(mRenderer);
-        
-        SDL_Delay(16);
-    }
-    
-    /* Changer le style pour la simulation */
-    AppliquerStyleSimulation();
-    
-    return config;
-}
-
-/**
- * @brief Prépare une nouvelle frame ImGui
- */
-void GUI::DebutFrame()
-{
-    ImGui_ImplSDL3_NewFrame();
-    ImGui_ImplSDLRenderer3_NewFrame();
-    ImGui::NewFrame();
-}
-
-/**
- * @brief Finalise et rend la frame ImGui
- * @param renderer Pointeur vers le renderer SDL
- */
-void GUI::FinFrame(SDL_Renderer *renderer)
-{
-    ImGui::Render();
-    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer);
-}
-
-/**
- * @brief Affiche le panneau de contrôle avec sliders et boutons
- */
-void GUI::AfficherPanneauControle(int &nbProies, int &nbPreds, int &nbPlantes,
-                                   int &nbPlantesConso, float &delaiPlantes,
-                                   bool &enPause, bool &enCours, bool &relancer,
-                                   int windowWidth)
-{
-    ImGui::SetNextWindowPos(ImVec2(windowWidth - 330, 10));
-    ImGui::SetNextWindowSize(ImVec2(320, 420));
-    
-    ImGui::Begin("⚙️ Contrôles");
-    
-    /* Boutons de contrôle */
-    if (ImGui::Button(enPause ? "▶️ Reprendre" : "⏸️ Pause", ImVec2(-1, 40)))
-    {
-        enPause = !enPause;
-    }
-    
-    if (ImGui::Button("🔄 Relancer", ImVec2(-1, 40)))
-    {
-        relancer = true;
-    }
-    
-    if (ImGui::Button("❌ Quitter", ImVec2(-1, 40)))
-    {
-        enCours = false;
-    }
-    
-    ImGui::Separator();
-    ImGui::Dummy(ImVec2(0, 5));
-    
-    /* Paramètres */
-    ImGui::Text("Paramètres de Relance");
-    ImGui::Dummy(ImVec2(0, 5));
-    ImGui::SliderInt("Proies", &nbProies, 5, 50);
-    ImGui::SliderInt("Prédateurs", &nbPreds, 1, 20);
-    ImGui::SliderInt("Plantes", &nbPlantes, 10, 100);
-    ImGui::SliderInt("Satiété", &nbPlantesConso, 10, 100);
-    ImGui::SliderFloat("Repousse", &delaiPlantes, 1.0f, 10.0f, "%.1fs");
-    
-    ImGui::End();
-}
-
-/**
- * @brief Affiche les statistiques et graphiques de population avec courbes
- */
-void GUI::AfficherStatistiques(int nbProies, int nbPreds, int nbPlantes,
-                                int nbConsommees)
-{
-    mHistoriqueProies.push_back(static_cast<float>(nbProies));
-    mHistoriquePredateurs.push_back(static_cast<float>(nbPreds));
-    mHistoriquePlantes.push_back(static_cast<float>(nbPlantes));
-
-    if (mHistoriqueProies.size() > 150)
-    {
-        mHistoriqueProies.erase(mHistoriqueProies.begin());
-        mHistoriquePredateurs.erase(mHistoriquePredateurs.begin());
-        mHistoriquePlantes.erase(mHistoriquePlantes.begin());
-    }
-
-    ImGui::SetNextWindowPos(ImVec2(10, 10));
-    ImGui::SetNextWindowSize(ImVec2(360, 550));
-    
-    ImGui::Begin("📊 Statistiques en Temps Réel");
-    
-    ImGui::Text("Évolution des Populations");
-    ImGui::Separator();
-    ImGui::Dummy(ImVec2(0, 5));
-    
-    /* Proies */
-    ImGui::Text("🐰 Proies : %d", nbProies);
-    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.40f, 0.80f, 0.45f, 1.0f));
-    ImGui::PlotLines("##Proies", mHistoriqueProies.data(), mHistoriqueProies.size(),
-                     0, nullptr, 0.0f, 60.0f, ImVec2(0, 100));
-    ImGui::PopStyleColor();
-    
-    ImGui::Dummy(ImVec2(0, 5));
-    
-    /* Prédateurs */
-    ImGui::Text("🐺 Prédateurs : %d", nbPreds);
-    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.90f, 0.35f, 0.35f, 1.0f));
-    ImGui::PlotLines("##Predateurs", mHistoriquePredateurs.data(), mHistoriquePredateurs.size(),
-                     0, nullptr, 0.0f, 25.0f, ImVec2(0, 100));
-    ImGui::PopStyleColor();
-    
-    ImGui::Dummy(ImVec2(0, 5));
-    
-    /* Plantes */
-    ImGui::Text("🌱 Plantes : %d", nbPlantes);
-    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.35f, 0.65f, 0.90f, 1.0f));
-    ImGui::PlotLines("##Plantes", mHistoriquePlantes.data(), mHistoriquePlantes.size(),
-                     0, nullptr, 0.0f, 120.0f, ImVec2(0, 100));
-    ImGui::PopStyleColor();
-    
-    ImGui::Dummy(ImVec2(0, 10));
-    ImGui::Separator();
-    ImGui::Text("🍃 Plantes Consommées : %d", nbConsommees);
-
-    ImGui::End();
+/**
+ * @file GUI.cpp
+ * @brief Implémentation des méthodes de la classe GUI pour gérer l'interface graphique
+ */
+
+#include "GUI.h"
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Constructeur par défaut de la classe GUI
+ */
+GUI::GUI() : mWindow(nullptr), mRenderer(nullptr)
+{
+}
+
+/**
+ * @brief Destructeur de la classe GUI
+ */
+GUI::~GUI()
+{
+}
+
+/**
+ * @brief Initialise le contexte ImGui avec SDL
+ * @param window Pointeur vers la fenêtre SDL
+ * @param renderer Pointeur vers le renderer SDL
+ */
+void GUI::Initialize(SDL_Window *window, SDL_Renderer *renderer)
+{
+    mWindow = window;
+    mRenderer = renderer;
+    
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    
+    ImGuiIO &io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    
+    ImGui_ImplSDL3_InitForSDLRenderer(window, renderer);
+    ImGui_ImplSDLRenderer3_Init(renderer);
+    
+    AppliquerStyleConfiguration();
+}
+
+/**
+ * @brief Détruit le contexte ImGui et libère les ressources
+ */
+void GUI::Destroy()
+{
+    ImGui_ImplSDLRenderer3_Shutdown();
+    ImGui_ImplSDL3_Shutdown();
+    ImGui::DestroyContext();
+}
+
+/**
+ * @brief Applique un style professionnel pour la configuration
+ */
+void GUI::AppliquerStyleConfiguration()
+{
+    ImGuiStyle &style = ImGui::GetStyle();
+    
+    style.WindowRounding = 10.0f;
+    style.FrameRounding = 6.0f;
+    style.ScrollbarRounding = 6.0f;
+    style.GrabRounding = 4.0f;
+    style.WindowPadding = ImVec2(15, 15);
+    style.FramePadding = ImVec2(10, 6);
+    style.ItemSpacing = ImVec2(12, 8);
+    
+    ImVec4 *colors = style.Colors;
+    colors[ImGuiCol_WindowBg] = ImVec4(0.95f, 0.95f, 0.96f, 1.0f);
+    colors[ImGuiCol_TitleBg] = ImVec4(0.20f, 0.50f, 0.35f, 1.0f);
+    colors[ImGuiCol_TitleBgActive] = ImVec4(0.25f, 0.60f, 0.42f, 1.0f);
+    colors[ImGuiCol_Button] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
+    colors[ImGuiCol_ButtonHovered] = ImVec4(0.30f, 0.70f, 0.52f, 1.0f);
+    colors[ImGuiCol_ButtonActive] = ImVec4(0.22f, 0.50f, 0.38f, 1.0f);
+    colors[ImGuiCol_FrameBg] = ImVec4(0.88f, 0.88f, 0.90f, 1.0f);
+    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.82f, 0.82f, 0.85f, 1.0f);
+    colors[ImGuiCol_SliderGrab] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
+    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.22f, 0.50f, 0.38f, 1.0f);
+    colors[ImGuiCol_Header] = ImVec4(0.26f, 0.59f, 0.45f, 0.55f);
+    colors[ImGuiCol_HeaderHovered] = ImVec4(0.30f, 0.70f, 0.52f, 0.80f);
+    colors[ImGuiCol_HeaderActive] = ImVec4(0.26f, 0.59f, 0.45f, 1.0f);
+    colors[ImGuiCol_Text] = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
+}
+
+/**
+ * @brief Applique un style professionnel sombre pour la simulation
+ */
+void GUI::AppliquerStyleSimulation()
+{
+    ImGuiStyle &style = ImGui::GetStyle();
+    
+    style.WindowRounding = 8.0f;
+    style.FrameRounding = 4.0f;
+    style.ScrollbarRounding = 4.0f;
+    style.GrabRounding = 3.0f;
+    style.WindowPadding = ImVec2(12, 12);
+    style.FramePadding = ImVec2(8, 5);
+    style.ItemSpacing = ImVec2(10, 6);
+    style.Alpha = 0.94f;
+    
+    ImVec4 *colors = style.Colors;
+    colors[ImGuiCol_WindowBg] = ImVec4(0.10f, 0.11f, 0.13f, 0.95f);
+    colors[ImGuiCol_TitleBg] = ImVec4(0.15f, 0.16f, 0.18f, 1.0f);
+    colors[ImGuiCol_TitleBgActive] = ImVec4(0.20f, 0.22f, 0.24f, 1.0f);
+    colors[ImGuiCol_Button] = ImVec4(0.20f, 0.50f, 0.40f, 0.85f);
+    colors[ImGuiCol_ButtonHovered] = ImVec4(0.25f, 0.60f, 0.48f, 1.0f);
+    colors[ImGuiCol_ButtonActive] = ImVec4(0.18f, 0.45f, 0.36f, 1.0f);
+    colors[ImGuiCol_FrameBg] = ImVec4(0.18f, 0.20f, 0.22f, 0.85f);
+    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.22f, 0.24f, 0.26f, 0.90f);
+    colors[ImGuiCol_SliderGrab] = ImVec4(0.25f, 0.60f, 0.48f, 1.0f);
+    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.30f, 0.70f, 0.56f, 1.0f);
+    colors[ImGuiCol_Header] = ImVec4(0.20f, 0.50f, 0.40f, 0.55f);
+    colors[ImGuiCol_HeaderHovered] = ImVec4(0.25f, 0.60f, 0.48f, 0.80f);
+    colors[ImGuiCol_HeaderActive] = ImVec4(0.20f, 0.50f, 0.40f, 1.0f);
+    colors[ImGuiCol_Text] = ImVec4(0.92f, 0.93f, 0.94f, 1.0f);
+    colors[ImGuiCol_PlotLines] = ImVec4(0.25f, 0.70f, 0.55f, 1.0f);
+    colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.30f, 0.80f, 0.65f, 1.0f);
+}
+
+/**
+ * @brief Affiche le menu de configuration initial
+ * @param windowWidth Largeur de la fenêtre
+ * @param windowHeight Hauteur de la fenêtre
+ * @return Configuration choisie par l'utilisateur
+ */
+ConfigEcosysteme GUI::AfficherMenuConfiguration(int windowWidth, int windowHeight)
+{
+    ConfigEcosysteme config;
+    config.nbProies = 20;
+    config.nbPredateurs = 5;
+    config.nbPlantes = 30;
+    config.nbPlantesConso = 50;
+    config.delaiPlantes = 5.0f;
+    config.largeurMonde = static_cast<float>(windowWidth);
+    config.hauteurMonde = static_cast<float>(windowHeight);
+    config.nbThreads = 1;
+    config.sommeil = false;
+    config.suivi = false;
+    config.collisions = false;
+    config.voisins = false;
+    config.flux = false;
+    config.triSpatial = false;
+    config.budgetAnimaux = 0;
+    config.budgetMemoire = 0;
+    config.politiqueBudget = 0;
+    config.compact = false;
+    config.champVegetation = false;
+    config.champMoyen = false;
+    config.repartition = 0;
+    config.tracer = false;
+    config.memoire = false;
+    config.enregistrer = false;
+    config.formatVideo = 0;
+    config.videoAvecInterface = false;
+    config.largeurVideo = windowWidth;
+    config.hauteurVideo = windowHeight;
+    config.typeEcosysteme = 0;
+    config.pret = false;
+
+    int threadsMax = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    
+    const char *typesEcosysteme[] = {"🌲 Forêt", "🌊 Océan", "✈️ Aérien"};
+    
+    bool enCours = true;
+    SDL_Event event;
+    
+    while (enCours)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            ImGui_ImplSDL3_ProcessEvent(&event);
+            if (event.type == SDL_EVENT_QUIT)
+            {
+                config.pret = false;
+                return config;
+            }
+        }
+        
+        ImGui_ImplSDL3_NewFrame();
+        ImGui_ImplSDLRenderer3_NewFrame();
+        ImGui::NewFrame();
+        
+        /* Fenêtre de configuration centrée */
+        float windowW = 650.0f;
+        float windowH = 580.0f;
+        ImGui::SetNextWindowPos(ImVec2((windowWidth - windowW) / 2, (windowHeight - windowH) / 2));
+        ImGui::SetNextWindowSize(ImVec2(windowW, windowH));
+        
+        ImGui::Begin("🌍 Configuration de l'Écosystème", nullptr,
+                     ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse);
+        
+        ImGui::Dummy(ImVec2(0, 10));
+        ImGui::TextWrapped("Configurez les paramètres initiaux de votre simulation écologique.");
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+        
+        /* Type d'écosystème */
+        ImGui::Text("📍 Type d'Écosystème");
+        ImGui::Combo("##type", &config.typeEcosysteme, typesEcosysteme, 3);
+        
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::SliderFloat("Largeur du Monde", &config.largeurMonde, static_cast<float>(windowWidth),
+                           100000.0f, "%.0f px", ImGuiSliderFlags_Logarithmic);
+        ImGui::SliderFloat("Hauteur du Monde", &config.hauteurMonde, static_cast<float>(windowHeight),
+                           100000.0f, "%.0f px", ImGuiSliderFlags_Logarithmic);
+        
+        ImGui::Dummy(ImVec2(0, 15));
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+        
+        /* Population initiale */
+        ImGui::Text("🐾 Population Initiale");
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::SliderInt("Proies (Herbivores)", &config.nbProies, 5, 50);
+        ImGui::SliderInt("Prédateurs (Carnivores)", &config.nbPredateurs, 1, 20);
+        
+        ImGui::Dummy(ImVec2(0, 15));
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+        
+        /* Végétation */
+        ImGui::Text("🌱 Végétation");
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::SliderInt("Nombre de Plantes", &config.nbPlantes, 10, 100);
+        ImGui::SliderInt("Plantes pour Satiété", &config.nbPlantesConso, 10, 100);
+        ImGui::SliderFloat("Vitesse de Repousse (s)", &config.delaiPlantes, 1.0f, 10.0f, "%.1f");
+        ImGui::Text("Répartition initiale :");
+        ImGui::RadioButton("Uniforme", &config.repartition, 0);
+        ImGui::SameLine();
+        ImGui::RadioButton("Agrégats", &config.repartition, 1);
+        ImGui::SameLine();
+        ImGui::RadioButton("Bandes", &config.repartition, 2);
+
+        ImGui::Dummy(ImVec2(0, 15));
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+
+        /* Performance */
+        ImGui::Text("⚡ Performance");
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::SliderInt("Threads de Simulation", &config.nbThreads, 1, threadsMax);
+        ImGui::Checkbox("Endormir les animaux isolés (1 thread)", &config.sommeil);
+        ImGui::Checkbox("Suivre les cibles entre deux détections", &config.suivi);
+        ImGui::Checkbox("Écarter les sprites qui se chevauchent", &config.collisions);
+        ImGui::Checkbox("Listes de voisins entre les ticks (1 thread)", &config.voisins);
+        ImGui::Checkbox("Carte de la plante la plus proche", &config.flux);
+        ImGui::Checkbox("Ranger le stockage dans l'ordre de Morton", &config.triSpatial);
+        ImGui::SliderInt("Budget d'animaux (0 = aucun)", &config.budgetAnimaux, 0, 2000);
+        ImGui::SliderInt("Budget mémoire en Mo (0 = aucun)", &config.budgetMemoire, 0, 64);
+        ImGui::Text("Freinage des naissances :");
+        ImGui::RadioButton("Probabilité", &config.politiqueBudget, 0);
+        ImGui::SameLine();
+        ImGui::RadioButton("Capacité", &config.politiqueBudget, 1);
+        ImGui::SameLine();
+        ImGui::RadioButton("Refus", &config.politiqueBudget, 2);
+        ImGui::Checkbox("Stockage compact des espèces du fichier (Aérien)", &config.compact);
+        ImGui::Checkbox("Végétation continue (hors Aérien)", &config.champVegetation);
+        ImGui::Checkbox("Superposer le champ moyen aux courbes", &config.champMoyen);
+        ImGui::Checkbox("Tracer les phases (trace_simulation.json)", &config.tracer);
+        ImGui::Checkbox("Compter les allocations par sous-système", &config.memoire);
+
+        ImGui::Dummy(ImVec2(0, 15));
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+
+        /* Enregistrement */
+        ImGui::Text("🎬 Enregistrement");
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::Checkbox("Enregistrer la simulation", &config.enregistrer);
+        if (config.enregistrer)
+        {
+            ImGui::RadioButton("PNG numérotés", &config.formatVideo, 0);
+            ImGui::SameLine();
+            ImGui::RadioButton("Flux Y4M", &config.formatVideo, 1);
+            ImGui::Checkbox("Inclure l'interface", &config.videoAvecInterface);
+            ImGui::SliderInt("Largeur vidéo", &config.largeurVideo, 320, 3840);
+            ImGui::SliderInt("Hauteur vidéo", &config.hauteurVideo, 180, 2160);
+        }
+        
+        ImGui::Dummy(ImVec2(0, 20));
+        ImGui::Separator();
+        ImGui::Dummy(ImVec2(0, 10));
+        
+        /* Résumé */
+        ImGui::Text("📊 Résumé de la Configuration");
+        ImGui::Dummy(ImVec2(0, 5));
+        ImGui::BulletText("Écosystème : %s", typesEcosysteme[config.typeEcosysteme]);
+        ImGui::BulletText("Monde : %.0f x %.0f px", config.largeurMonde, config.hauteurMonde);
+        ImGui::BulletText("Population : %d proies, %d prédateurs", config.nbProies, config.nbPredateurs);
+        ImGui::BulletText("Végétation : %d plantes (repousse en %.1fs)", config.nbPlantes, config.delaiPlantes);
+        
+        ImGui::Dummy(ImVec2(0, 20));
+        
+        /* Bouton de lancement */
+        float buttonWidth = 250.0f;
+        ImGui::SetCursorPosX((windowW - buttonWidth) / 2);
+        if (ImGui::Button("🚀 Lancer la Simulation", ImVec2(buttonWidth, 50)))
+        {
+            config.pret = true;
+            enCours = false;
+        }
+        
+        ImGui::End();
+        
+        /* Rendu */
+        SDL_SetRenderDrawColor(mRenderer, 35, 40, 45, 255);
+        SDL_RenderClear(mRenderer);
+        
+        ImGui::Render();
+        ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), mRenderer);
+        SDL_RenderPresent(mRenderer);
+        
+        SDL_Delay(16);
+    }
+    
+    /* Changer le style pour la simulation */
+    AppliquerStyleSimulation();
+    
+    return config;
+}
+
+/**
+ * @brief Prépare une nouvelle frame ImGui
+ */
+void GUI::DebutFrame()
+{
+    ImGui_ImplSDL3_NewFrame();
+    ImGui_ImplSDLRenderer3_NewFrame();
+    ImGui::NewFrame();
+}
+
+/**
+ * @brief Finalise et rend la frame ImGui
+ * @param renderer Pointeur vers le renderer SDL
+ */
+void GUI::FinFrame(SDL_Renderer *renderer)
+{
+    ImGui::Render();
+    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer);
+}
+
+/**
+ * @brief Affiche le panneau de contrôle avec sliders et boutons
+ */
+void GUI::AfficherPanneauControle(int &nbProies, int &nbPreds, int &nbPlantes,
+                                   int &nbPlantesConso, float &delaiPlantes,
+                                   int &seuilSprites,
+                                   bool &enPause, bool &enCours, bool &relancer,
+                                   int windowWidth)
+{
+    ImGui::SetNextWindowPos(ImVec2(windowWidth - 330, 10));
+    ImGui::SetNextWindowSize(ImVec2(320, 420));
+    
+    ImGui::Begin("⚙️ Contrôles");
+    
+    /* Boutons de contrôle */
+    if (ImGui::Button(enPause ? "▶️ Reprendre" : "⏸️ Pause", ImVec2(-1, 40)))
+    {
+        enPause = !enPause;
+    }
+    
+    if (ImGui::Button("🔄 Relancer", ImVec2(-1, 40)))
+    {
+        relancer = true;
+    }
+    
+    if (ImGui::Button("❌ Quitter", ImVec2(-1, 40)))
+    {
+        enCours = false;
+    }
+    
+    ImGui::Separator();
+    ImGui::Dummy(ImVec2(0, 5));
+    
+    /* Paramètres */
+    ImGui::Text("Paramètres de Relance");
+    ImGui::Dummy(ImVec2(0, 5));
+    ImGui::SliderInt("Proies", &nbProies, 5, 50);
+    ImGui::SliderInt("Prédateurs", &nbPreds, 1, 20);
+    ImGui::SliderInt("Plantes", &nbPlantes, 10, 100);
+    ImGui::SliderInt("Satiété", &nbPlantesConso, 10, 100);
+    ImGui::SliderFloat("Repousse", &delaiPlantes, 1.0f, 10.0f, "%.1fs");
+
+    ImGui::Separator();
+    ImGui::Text("Affichage");
+    ImGui::SliderInt("Sprites max", &seuilSprites, 500, 200000, "%d", ImGuiSliderFlags_Logarithmic);
+    ImGui::TextWrapped("Caméra : molette = zoom, clic droit = glisser, flèches = défiler, Origine = vue d'ensemble");
+    
+    ImGui::End();
+}
+
+/**
+ * @brief Affiche les statistiques et graphiques de population avec courbes
+ */
+void GUI::AfficherStatistiques(int nbProies, int nbPreds, int nbPlantes,
+                                int nbConsommees, const ModeleChampMoyen* champMoyen)
+{
+    mHistoriqueProies.push_back(static_cast<float>(nbProies));
+    mHistoriquePredateurs.push_back(static_cast<float>(nbPreds));
+    mHistoriquePlantes.push_back(static_cast<float>(nbPlantes));
+
+    if (mHistoriqueProies.size() > 150)
+    {
+        mHistoriqueProies.erase(mHistoriqueProies.begin());
+        mHistoriquePredateurs.erase(mHistoriquePredateurs.begin());
+        mHistoriquePlantes.erase(mHistoriquePlantes.begin());
+    }
+
+    if (champMoyen)
+    {
+        const EtatChampMoyen& prevu = champMoyen->GetEtat();
+        mPrevisionProies.push_back(static_cast<float>(prevu.proies));
+        mPrevisionPredateurs.push_back(static_cast<float>(prevu.predateurs));
+        mPrevisionPlantes.push_back(static_cast<float>(prevu.plantes));
+        if (mPrevisionProies.size() > mHistoriqueProies.size())
+        {
+            mPrevisionProies.erase(mPrevisionProies.begin());
+            mPrevisionPredateurs.erase(mPrevisionPredateurs.begin());
+            mPrevisionPlantes.erase(mPrevisionPlantes.begin());
+        }
+    }
+
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(360, 550));
+    
+    ImGui::Begin("📊 Statistiques en Temps Réel");
+    
+    ImGui::Text("Évolution des Populations");
+    ImGui::Separator();
+    ImGui::Dummy(ImVec2(0, 5));
+    
+    /* Proies */
+    ImGui::Text("🐰 Proies : %d", nbProies);
+    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.40f, 0.80f, 0.45f, 1.0f));
+    ImGui::PlotLines("##Proies", mHistoriqueProies.data(), mHistoriqueProies.size(),
+                     0, nullptr, 0.0f, 60.0f, ImVec2(0, 100));
+    ImGui::PopStyleColor();
+    if (champMoyen)
+        SuperposerPrevision(mPrevisionProies, mHistoriqueProies.size(), 0.0f, 60.0f);
+    
+    ImGui::Dummy(ImVec2(0, 5));
+    
+    /* Prédateurs */
+    ImGui::Text("🐺 Prédateurs : %d", nbPreds);
+    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.90f, 0.35f, 0.35f, 1.0f));
+    ImGui::PlotLines("##Predateurs", mHistoriquePredateurs.data(), mHistoriquePredateurs.size(),
+                     0, nullptr, 0.0f, 25.0f, ImVec2(0, 100));
+    ImGui::PopStyleColor();
+    if (champMoyen)
+        SuperposerPrevision(mPrevisionPredateurs, mHistoriquePredateurs.size(), 0.0f, 25.0f);
+    
+    ImGui::Dummy(ImVec2(0, 5));
+    
+    /* Plantes */
+    ImGui::Text("🌱 Plantes : %d", nbPlantes);
+    ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.35f, 0.65f, 0.90f, 1.0f));
+    ImGui::PlotLines("##Plantes", mHistoriquePlantes.data(), mHistoriquePlantes.size(),
+                     0, nullptr, 0.0f, 120.0f, ImVec2(0, 100));
+    ImGui::PopStyleColor();
+    if (champMoyen)
+        SuperposerPrevision(mPrevisionPlantes, mHistoriquePlantes.size(), 0.0f, 120.0f);
+    
+    ImGui::Dummy(ImVec2(0, 10));
+    ImGui::Separator();
+    ImGui::Text("🍃 Plantes Consommées : %d", nbConsommees);
+
+    if (champMoyen)
+    {
+        const EtatChampMoyen& prevu = champMoyen->GetEtat();
+        EtatChampMoyen ecart = champMoyen->GetEcart();
+        ImGui::Text("🔮 Champ moyen : %.0f proies, %.0f prédateurs, %.0f plantes",
+                    prevu.proies, prevu.predateurs, prevu.plantes);
+        ImGui::Text("   Écart moyen : %.0f %%, %.0f %%, %.0f %%",
+                    100.0 * ecart.proies, 100.0 * ecart.predateurs, 100.0 * ecart.plantes);
+    }
+    else
+    {
+        mPrevisionProies.clear();
+        mPrevisionPredateurs.clear();
+        mPrevisionPlantes.clear();
+    }
+
+    ImGui::End();
+}
+
+/**
+ * @brief Ligne blanche dans le cadre de la courbe, sur la même échelle
+ */
+void GUI::SuperposerPrevision(const std::vector<float>& prevision, size_t nbPoints,
+                              float minimum, float maximum)
+{
+    if (prevision.size() < 2 || nbPoints < 2)
+        return;
+
+    /* Cadre intérieur de PlotLines : rectangle de l'élément moins le remplissage du cadre */
+    ImVec2 padding = ImGui::GetStyle().FramePadding;
+    ImVec2 coinMin = ImGui::GetItemRectMin();
+    ImVec2 coinMax = ImGui::GetItemRectMax();
+    float x0 = coinMin.x + padding.x;
+    float y0 = coinMin.y + padding.y;
+    float largeur = coinMax.x - padding.x - x0;
+    float hauteur = coinMax.y - padding.y - y0;
+
+    /* La prévision a pu commencer après la courbe : elle couvre ses derniers points */
+    size_t decalage = nbPoints - std::min(nbPoints, prevision.size());
+    std::vector<ImVec2> points;
+    points.reserve(prevision.size());
+    for (size_t i = 0; i < prevision.size() && decalage + i < nbPoints; i++)
+    {
+        float t = std::min(1.0f, std::max(0.0f, (prevision[i] - minimum) / (maximum - minimum)));
+        points.push_back(ImVec2(x0 + largeur * (decalage + i) / (nbPoints - 1), y0 + hauteur * (1.0f - t)));
+    }
+    ImGui::GetWindowDrawList()->AddPolyline(points.data(), static_cast<int>(points.size()),
+                                            IM_COL32(240, 240, 240, 200), 0, 1.5f);
+}
+
+/**
+ * @brief Affiche une ligne par sous-système ayant alloué, puis le total
+ */
+void GUI::AfficherMemoire(const ReleveMemoire& releve, const ReleveMemoire& precedent)
+{
+    ImGui::SetNextWindowPos(ImVec2(10, 570));
+    ImGui::SetNextWindowSize(ImVec2(360, 200));
+
+    ImGui::Begin("🧮 Mémoire");
+    ImGui::Text("%-11s %9s %10s %10s", "", "new/frame", "vivants", "pic");
+    ImGui::Separator();
+
+    for (int i = 0; i < NB_SOUS_SYSTEMES; i++)
+    {
+        const CompteurMemoire& compteur = releve.compteurs[i];
+        if (compteur.allocations == 0)
+            continue;
+        ImGui::Text("%-11s %9llu %7lld Ko %7lld Ko", ComptableMemoire::GetNom(static_cast<SousSysteme>(i)),
+                    static_cast<unsigned long long>(compteur.allocations - precedent.compteurs[i].allocations),
+                    static_cast<long long>(compteur.vivants / 1024), static_cast<long long>(compteur.pic / 1024));
+    }
+
+    CompteurMemoire total = releve.Total();
+    CompteurMemoire totalPrecedent = precedent.Total();
+    ImGui::Separator();
+    ImGui::Text("%-11s %9llu %7lld Ko", "Total",
+                static_cast<unsigned long long>(total.allocations - totalPrecedent.allocations),
+                static_cast<long long>(total.vivants / 1024));
+
+    ImGui::End();
+}
+
+/**
+ * @brief Barre d'occupation, rouge quand les naissances sont freinées
+ */
+void GUI::AfficherBudget(float utilisation, uint64_t refusees, bool freinage)
+{
+    ImGui::SetNextWindowPos(ImVec2(380, 570));
+    ImGui::SetNextWindowSize(ImVec2(280, 110));
+
+    ImGui::Begin("🧺 Budget");
+    if (freinage)
+        ImGui::PushStyleColor(ImGuiCol_PlotHistogram, ImVec4(0.9f, 0.3f, 0.2f, 1.0f));
+    ImGui::ProgressBar(utilisation, ImVec2(-1.0f, 0.0f));
+    if (freinage)
+        ImGui::PopStyleColor();
+    ImGui::Text("Naissances %s", freinage ? "freinées" : "libres");
+    ImGui::Text("Refusées : %llu", static_cast<unsigned long long>(refusees));
+    ImGui::End();
 }
\ No newline at end of file
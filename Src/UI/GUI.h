@@ -1,120 +1,176 @@
-/**
- * @file GUI.h
- * @brief Déclaration de la classe GUI pour gérer l'interface graphique
- */
-
-#pragma once
-
-#include "imgui.h"
-#include "imgui_impl_sdl3.h"
-#include "imgui_impl_sdlrenderer3.h"
-#include <SDL3/SDL.h>
-#include <vector>
-
-/**
- * @struct ConfigEcosysteme
- * @brief Structure contenant la configuration initiale de l'écosystème
- */
-struct ConfigEcosysteme
-{
-    int nbProies;           /**< Nombre initial de proies */
-    int nbPredateurs;       /**< Nombre initial de prédateurs */
-    int nbPlantes;          /**< Nombre initial de plantes */
-    int nbPlantesConso;     /**< Nombre de plantes pour satiété */
-    float delaiPlantes;     /**< Délai d'apparition des plantes */
-    int typeEcosysteme;     /**< Type d'écosystème (0=Forêt, 1=Savane, 2=Désert) */
-    bool pret;              /**< True si prêt à lancer */
-};
-
-/**
- * @class GUI
- * @brief Gère l'interface graphique ImGui de la simulation
- */
-class GUI
-{
-public:
-    /**
-     * @brief Constructeur par défaut
-     */
-    GUI();
-    
-    /**
-     * @brief Destructeur
-     */
-    ~GUI();
-
-    /**
-     * @brief Initialise ImGui avec SDL
-     * @param window Pointeur vers la fenêtre SDL
-     * @param renderer Pointeur vers le renderer SDL
-     */
-    void Initialize(SDL_Window *window, SDL_Renderer *renderer);
-    
-    /**
-     * @brief Détruit le contexte ImGui
-     */
-    void Destroy();
-    
-    /**
-     * @brief Affiche le menu de configuration initial et bloque jusqu'au lancement
-     * @param windowWidth Largeur de la fenêtre
-     * @param windowHeight Hauteur de la fenêtre
-     * @return Configuration choisie par l'utilisateur
-     */
-    ConfigEcosysteme AfficherMenuConfiguration(int windowWidth, int windowHeight);
-    
-    /**
-     * @brief Démarre une nouvelle frame ImGui
-     */
-    void DebutFrame();
-    
-    /**
-     * @brief Finalise et affiche la frame ImGui
-     * @param renderer Pointeur vers le renderer SDL
-     */
-    void FinFrame(SDL_Renderer *renderer);
-    
-    /**
-     * @brief Affiche le panneau de contrôle de la simulation
-     * @param nbProies Nombre de proies (modifiable)
-     * @param nbPreds Nombre de prédateurs (modifiable)
-     * @param nbPlantes Nombre de plantes (modifiable)
-     * @param nbPlantesConso Nombre de plantes pour satiété (modifiable)
-     * @param delaiPlantes Délai d'apparition des plantes (modifiable)
-     * @param enPause État pause de la simulation (modifiable)
-     * @param enCours État de la boucle principale (modifiable)
-     * @param relancer Flag pour relancer la simulation (modifiable)
-     * @param windowWidth Largeur de la fenêtre
-     */
-    void AfficherPanneauControle(int &nbProies, int &nbPreds, int &nbPlantes,
-                                  int &nbPlantesConso, float &delaiPlantes,
-                                  bool &enPause, bool &enCours, bool &relancer,
-                                  int windowWidth);
-    
-    /**
-     * @brief Affiche les statistiques et graphiques de la simulation
-     * @param nbProies Nombre actuel de proies
-     * @param nbPreds Nombre actuel de prédateurs
-     * @param nbPlantes Nombre actuel de plantes
-     * @param nbConsommees Nombre total de plantes consommées
-     */
-    void AfficherStatistiques(int nbProies, int nbPreds, int nbPlantes,
-                              int nbConsommees);
-
-private:
-    SDL_Window *mWindow;                       /**< Pointeur vers la fenêtre SDL */
-    SDL_Renderer *mRenderer;                   /**< Pointeur vers le renderer SDL */
-    std::vector<float> mHistoriqueProies;      /**< Historique population proies */
-    std::vector<float> mHistoriquePredateurs;  /**< Historique population prédateurs */
-    std::vector<float> mHistoriquePlantes;     /**< Historique population plantes */
-    
-    /**
-     * @brief Applique un style professionnel sombre pour la simulation
-     */
-    void AppliquerStyleSimulation();
-    
-    /**
-     * @brief Applique un style clair et accueillant pour la configuration
-     */
-    void AppliquerStyleConfiguration();
+/**
+ * @file GUI.h
+ * @brief Déclaration de la classe GUI pour gérer l'interface graphique
+ */
+
+#pragma once
+
+#include "imgui.h"
+#include "imgui_impl_sdl3.h"
+#include "imgui_impl_sdlrenderer3.h"
+#include "../Core/ComptableMemoire.h"
+#include "../Population/ModeleChampMoyen.h"
+#include <SDL3/SDL.h>
+#include <vector>
+
+/**
+ * @struct ConfigEcosysteme
+ * @brief Structure contenant la configuration initiale de l'écosystème
+ */
+struct ConfigEcosysteme
+{
+    int nbProies;           /**< Nombre initial de proies */
+    int nbPredateurs;       /**< Nombre initial de prédateurs */
+    int nbPlantes;          /**< Nombre initial de plantes */
+    int nbPlantesConso;     /**< Nombre de plantes pour satiété */
+    float delaiPlantes;     /**< Délai d'apparition des plantes */
+    float largeurMonde;     /**< Largeur du monde simulé (pixels monde) */
+    float hauteurMonde;     /**< Hauteur du monde simulé (pixels monde) */
+    int nbThreads;          /**< Threads de simulation (1 = séquentiel) */
+    bool sommeil;           /**< Animaux isolés endormis (séquentiel uniquement) */
+    bool suivi;             /**< Cibles gardées entre deux détections complètes */
+    bool collisions;        /**< Sprites de même espèce écartés quand ils se chevauchent */
+    bool voisins;           /**< Listes de voisins gardées entre les ticks (1 thread) */
+    bool flux;              /**< Plante la plus proche lue dans la carte de la nourriture */
+    bool triSpatial;        /**< Stockage rangé périodiquement dans l'ordre de Morton */
+    int budgetAnimaux;      /**< Plafond d'animaux, toutes espèces (0 : aucun) */
+    int budgetMemoire;      /**< Plafond de mémoire des entités en Mo (0 : aucun) */
+    int politiqueBudget;    /**< Freinage des naissances (0 = probabilité, 1 = capacité, 2 = refus) */
+    bool compact;           /**< Espèces du fichier stockées sous forme quantifiée */
+    bool champVegetation;   /**< Végétation en champ de biomasse (hors Aérien) */
+    bool champMoyen;        /**< Prévision du champ moyen superposée aux courbes */
+    bool tracer;            /**< Phases de chaque frame écrites dans trace_simulation.json */
+    bool memoire;           /**< Allocations et mémoire comptées par sous-système */
+    int repartition;        /**< Disposition initiale (0 = uniforme, 1 = agrégats, 2 = bandes) */
+    bool enregistrer;       /**< Frames enregistrées dans Enregistrements/ */
+    int formatVideo;        /**< 0 = PNG numérotés, 1 = flux Y4M */
+    bool videoAvecInterface;    /**< L'interface figure dans les images */
+    int largeurVideo;       /**< Largeur des images enregistrées */
+    int hauteurVideo;       /**< Hauteur des images enregistrées */
+    int typeEcosysteme;     /**< Type d'écosystème (0=Forêt, 1=Savane, 2=Désert) */
+    bool pret;              /**< True si prêt à lancer */
+};
+
+/**
+ * @class GUI
+ * @brief Gère l'interface graphique ImGui de la simulation
+ */
+class GUI
+{
+public:
+    /**
+     * @brief Constructeur par défaut
+     */
+    GUI();
+    
+    /**
+     * @brief Destructeur
+     */
+    ~GUI();
+
+    /**
+     * @brief Initialise ImGui avec SDL
+     * @param window Pointeur vers la fenêtre SDL
+     * @param renderer Pointeur vers le renderer SDL
+     */
+    void Initialize(SDL_Window *window, SDL_Renderer *renderer);
+    
+    /**
+     * @brief Détruit le contexte ImGui
+     */
+    void Destroy();
+    
+    /**
+     * @brief Affiche le menu de configuration initial et bloque jusqu'au lancement
+     * @param windowWidth Largeur de la fenêtre
+     * @param windowHeight Hauteur de la fenêtre
+     * @return Configuration choisie par l'utilisateur
+     */
+    ConfigEcosysteme AfficherMenuConfiguration(int windowWidth, int windowHeight);
+    
+    /**
+     * @brief Démarre une nouvelle frame ImGui
+     */
+    void DebutFrame();
+    
+    /**
+     * @brief Finalise et affiche la frame ImGui
+     * @param renderer Pointeur vers le renderer SDL
+     */
+    void FinFrame(SDL_Renderer *renderer);
+    
+    /**
+     * @brief Affiche le panneau de contrôle de la simulation
+     * @param nbProies Nombre de proies (modifiable)
+     * @param nbPreds Nombre de prédateurs (modifiable)
+     * @param nbPlantes Nombre de plantes (modifiable)
+     * @param nbPlantesConso Nombre de plantes pour satiété (modifiable)
+     * @param delaiPlantes Délai d'apparition des plantes (modifiable)
+     * @param seuilSprites Animaux visibles au-delà desquels la carte de densité remplace les sprites (modifiable)
+     * @param enPause État pause de la simulation (modifiable)
+     * @param enCours État de la boucle principale (modifiable)
+     * @param relancer Flag pour relancer la simulation (modifiable)
+     * @param windowWidth Largeur de la fenêtre
+     */
+    void AfficherPanneauControle(int &nbProies, int &nbPreds, int &nbPlantes,
+                                  int &nbPlantesConso, float &delaiPlantes,
+                                  int &seuilSprites,
+                                  bool &enPause, bool &enCours, bool &relancer,
+                                  int windowWidth);
+    
+    /**
+     * @brief Affiche les statistiques et graphiques de la simulation
+     * @param nbProies Nombre actuel de proies
+     * @param nbPreds Nombre actuel de prédateurs
+     * @param nbPlantes Nombre actuel de plantes
+     * @param nbConsommees Nombre total de plantes consommées
+     * @param champMoyen Modèle dont la prévision est superposée aux courbes (nullptr : aucune)
+     */
+    void AfficherStatistiques(int nbProies, int nbPreds, int nbPlantes,
+                              int nbConsommees, const ModeleChampMoyen* champMoyen = nullptr);
+
+    /**
+     * @brief Affiche la mémoire vive, le pic et les allocations de la frame par sous-système
+     * @param releve Compteurs de la frame courante
+     * @param precedent Compteurs de la frame précédente
+     */
+    void AfficherMemoire(const ReleveMemoire& releve, const ReleveMemoire& precedent);
+
+    /**
+     * @brief Affiche l'occupation du budget de population et les naissances refusées
+     * @param utilisation Part du budget occupée (0 à 1)
+     * @param refusees Naissances refusées depuis le début
+     * @param freinage true si les naissances sont freinées
+     */
+    void AfficherBudget(float utilisation, uint64_t refusees, bool freinage);
+
+private:
+    SDL_Window *mWindow;                       /**< Pointeur vers la fenêtre SDL */
+    SDL_Renderer *mRenderer;                   /**< Pointeur vers le renderer SDL */
+    std::vector<float> mHistoriqueProies;      /**< Historique population proies */
+    std::vector<float> mHistoriquePredateurs;  /**< Historique population prédateurs */
+    std::vector<float> mHistoriquePlantes;     /**< Historique population plantes */
+    std::vector<float> mPrevisionProies;       /**< Proies prévues par le champ moyen */
+    std::vector<float> mPrevisionPredateurs;   /**< Prédateurs prévus par le champ moyen */
+    std::vector<float> mPrevisionPlantes;      /**< Plantes prévues par le champ moyen */
+
+    /**
+     * @brief Trace une prévision par-dessus la dernière courbe, alignée sur ses points les plus récents
+     * @param prevision Valeurs prévues (au plus autant que de points dans la courbe)
+     * @param nbPoints Points de la courbe
+     * @param minimum Bas de l'échelle de la courbe
+     * @param maximum Haut de l'échelle de la courbe
+     */
+    void SuperposerPrevision(const std::vector<float>& prevision, size_t nbPoints,
+                             float minimum, float maximum);
+    
+    /**
+     * @brief Applique un style professionnel sombre pour la simulation
+     */
+    void AppliquerStyleSimulation();
+    
+    /**
+     * @brief Applique un style clair et accueillant pour la configuration
+     */
+    void AppliquerStyleConfiguration();
 };
\ No newline at end of file
@@ -0,0 +1,174 @@
+/**
+ * @file TestCollisions.cpp
+ * @brief Détecteur de collisions face aux morts et naissances d'un même tick
+ *
+ * Lancé par test.py, compilé avec AddressSanitizer : un animal libéré encore
+ * suivi par le détecteur y apparaît comme une lecture après libération.
+ */
+
+#include "Population/DetecteurCollisions.h"
+#include "Population/Ecosysteme.h"
+#include "Population/Predateur.h"
+#include "Population/Proie.h"
+#include <cstdlib>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @brief Aucun événement ne doit opposer un animal à lui-même
+ * @param evenements Événements du dernier Resoudre
+ * @return true si toutes les paires sont distinctes
+ */
+static bool PairesDistinctes(const std::vector<Event>& evenements)
+{
+    for (const Event& evenement : evenements)
+    {
+        const Collision* collision = static_cast<const Collision*>(evenement.data);
+        if (collision->a == collision->b)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Adresses des animaux vivants de l'écosystème
+ * @param eco Écosystème observé
+ * @return Ensemble des proies et prédateurs
+ */
+static std::unordered_set<const Animal*> Recenser(const Ecosysteme& eco)
+{
+    std::unordered_set<const Animal*> animaux(eco.GetProies().begin(), eco.GetProies().end());
+    animaux.insert(eco.GetPredateurs().begin(), eco.GetPredateurs().end());
+    return animaux;
+}
+
+/**
+ * @brief Des morts libérées après Resoudre, leurs places reprises aussitôt par des nouveau-nés
+ */
+static void TesterMortsEtNaissances()
+{
+    const ContexteMonde monde = {1000.0f, 1000.0f, nullptr, nullptr, nullptr, nullptr};
+    const float taille = PolitiqueEspece<Proie>::TAILLE_SPRITE;
+
+    /* Des paires qui se chevauchent, pour que la phase fine travaille */
+    std::vector<Proie*> proies;
+    DetecteurCollisions detecteur;
+    for (int i = 0; i < 40; i++)
+    {
+        proies.push_back(new Proie(100.0f + 20.0f * i, 500.0f + (i % 2) * 10.0f, 0.0f, 0.0f));
+        detecteur.Suivre(proies.back(), taille, true);
+    }
+    detecteur.Resoudre(monde);
+
+    for (int tick = 0; tick < 5; tick++)
+    {
+        /* Un sur quatre meurt après la détection, comme dans la fin d'un tick d'Ecosysteme */
+        for (size_t i = tick % 4; i < proies.size(); i += 4)
+            proies[i]->PerdreEnergie(1000.0f);
+        detecteur.OublierMorts();
+
+        /* La réserve rend les emplacements libérés en premier : les nouveau-nés les reprennent */
+        for (size_t i = tick % 4; i < proies.size(); i += 4)
+        {
+            float x = proies[i]->GetX();
+            float y = proies[i]->GetY();
+            delete proies[i];
+            proies[i] = new Proie(x, y, 0.0f, 0.0f);
+            detecteur.Suivre(proies[i], taille, true);
+        }
+
+        detecteur.Resoudre(monde);
+        Verifier(detecteur.GetNombreSuivis() == proies.size(), "un nouveau-né est suivi deux fois");
+        Verifier(PairesDistinctes(detecteur.GetEvenements()), "un animal entre en collision avec lui-même");
+    }
+
+    for (auto* proie : proies)
+        delete proie;
+}
+
+/**
+ * @brief Écosystème dense, collisions actives : prédation et naissances à chaque tick
+ */
+static void TesterEcosysteme()
+{
+    srand(7);
+    Ecosysteme eco(400, 20, 300, 1500.0f, 1500.0f);
+    Verifier(eco.ActiverCollisions(true), "collisions refusées");
+
+    /* Un emplacement repris dans le même tick compte comme un survivant : le décompte est minoré */
+    int ticksMixtes = 0;
+    std::unordered_set<const Animal*> avant = Recenser(eco);
+    for (int tick = 0; tick < 1500; tick++)
+    {
+        eco.Update(1.0f / 60.0f);
+        std::unordered_set<const Animal*> apres = Recenser(eco);
+        size_t survivants = 0;
+        for (const Animal* animal : apres)
+            survivants += avant.count(animal);
+        if (survivants < avant.size() && survivants < apres.size())
+            ticksMixtes++;
+        avant.swap(apres);
+        Verifier(PairesDistinctes(eco.GetEvenementsCollision()), "un animal entre en collision avec lui-même");
+    }
+    Verifier(ticksMixtes > 0, "aucun tick ne mêle morts et naissances");
+}
+
+/**
+ * @brief Collisions et tri spatial ensemble : les événements désignent les copies
+ */
+static void TesterTriSpatial()
+{
+    srand(11);
+    Ecosysteme eco(400, 20, 300, 1500.0f, 1500.0f);
+    Verifier(eco.ActiverCollisions(true), "collisions refusées");
+    Verifier(eco.ActiverTriSpatial(true), "tri spatial refusé avec les collisions");
+
+    for (int tick = 0; tick < 1500; tick++)
+    {
+        eco.Update(1.0f / 60.0f);
+
+        /* Lues après le tick : une adresse d'avant le relogement serait déjà libérée */
+        std::unordered_set<const Animal*> vivants = Recenser(eco);
+        for (const Event& evenement : eco.GetEvenementsCollision())
+        {
+            const Collision* collision = static_cast<const Collision*>(evenement.data);
+            if (!vivants.count(collision->a) || !vivants.count(collision->b))
+            {
+                Verifier(false, "une collision désigne un animal relogé ou libéré");
+                break;
+            }
+        }
+    }
+    Verifier(eco.GetNombreTris() > 0, "scénario sans relogement");
+}
+
+int main()
+{
+    TesterMortsEtNaissances();
+    TesterEcosysteme();
+    TesterTriSpatial();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestCollisions : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestCollisions" << std::endl;
+    return 0;
+}
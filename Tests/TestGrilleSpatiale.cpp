@@ -0,0 +1,186 @@
+/**
+ * @file TestGrilleSpatiale.cpp
+ * @brief Requêtes de la grille spatiale face à un parcours exhaustif
+ *
+ * Une requête est grossière : elle doit rendre au moins toutes les entités
+ * du rectangle, chacune une fois, et rien quand le rectangle sort du monde.
+ */
+
+#include "Population/GrilleSpatiale.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @brief Positions tirées dans un monde de 1000 x 600
+ * @param nombre Nombre d'entités
+ * @param xs Positions horizontales (remplacées)
+ * @param ys Positions verticales (remplacées)
+ */
+static void Tirer(size_t nombre, std::vector<float>& xs, std::vector<float>& ys)
+{
+    xs.resize(nombre);
+    ys.resize(nombre);
+    for (size_t i = 0; i < nombre; i++)
+    {
+        xs[i] = static_cast<float>(rand() % 100000) / 100.0f;
+        ys[i] = static_cast<float>(rand() % 60000) / 100.0f;
+    }
+}
+
+/**
+ * @brief Compare une requête au parcours de toutes les entités
+ * @param grille Grille construite sur xs, ys
+ * @param xs Positions horizontales
+ * @param ys Positions verticales
+ * @param x0 Bord gauche
+ * @param y0 Bord haut
+ * @param x1 Bord droit
+ * @param y1 Bord bas
+ */
+static void Comparer(const GrilleSpatiale& grille, const std::vector<float>& xs, const std::vector<float>& ys,
+                     float x0, float y0, float x1, float y1)
+{
+    std::vector<uint32_t> trouves;
+    grille.RequeteRectangle(x0, y0, x1, y1, trouves);
+    Verifier(grille.CompterRectangle(x0, y0, x1, y1) == static_cast<int>(trouves.size()),
+             "CompterRectangle diffère de la taille de RequeteRectangle");
+
+    std::sort(trouves.begin(), trouves.end());
+    Verifier(std::adjacent_find(trouves.begin(), trouves.end()) == trouves.end(),
+             "une entité est rendue deux fois");
+
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        bool dedans = xs[i] >= x0 && xs[i] <= x1 && ys[i] >= y0 && ys[i] <= y1;
+        if (dedans && !std::binary_search(trouves.begin(), trouves.end(), static_cast<uint32_t>(i)))
+        {
+            Verifier(false, "une entité du rectangle manque à la requête");
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Rectangles tirés au hasard, dont certains débordent du monde
+ */
+static void TesterRequetes()
+{
+    srand(3);
+    std::vector<float> xs, ys;
+    Tirer(2000, xs, ys);
+
+    GrilleSpatiale grille;
+    grille.Configurer(1000.0f, 600.0f, 64.0f);
+    grille.Construire(xs, ys);
+
+    for (int essai = 0; essai < 500; essai++)
+    {
+        float x0 = static_cast<float>(rand() % 1400) - 200.0f;
+        float y0 = static_cast<float>(rand() % 1000) - 200.0f;
+        float x1 = x0 + static_cast<float>(rand() % 400);
+        float y1 = y0 + static_cast<float>(rand() % 400);
+        Comparer(grille, xs, ys, x0, y0, x1, y1);
+    }
+
+    /* Le monde entier, et au-delà, rend toutes les entités */
+    std::vector<uint32_t> tous;
+    grille.RequeteRectangle(-50.0f, -50.0f, 2000.0f, 2000.0f, tous);
+    Verifier(tous.size() == xs.size(), "le monde entier ne rend pas toutes les entités");
+}
+
+/**
+ * @brief Rectangles entièrement hors du monde, de chaque côté
+ */
+static void TesterHorsMonde()
+{
+    srand(5);
+    std::vector<float> xs, ys;
+    Tirer(500, xs, ys);
+
+    GrilleSpatiale grille;
+    grille.Configurer(1000.0f, 600.0f, 64.0f);
+    grille.Construire(xs, ys);
+
+    const float rectangles[][4] = {
+        {-300.0f, 100.0f, -10.0f, 400.0f},      /* à gauche */
+        {1100.0f, 100.0f, 1500.0f, 400.0f},     /* à droite */
+        {100.0f, -400.0f, 800.0f, -5.0f},       /* au-dessus */
+        {100.0f, 700.0f, 800.0f, 900.0f},       /* en dessous */
+        {-500.0f, -500.0f, -100.0f, -100.0f},   /* en diagonale */
+    };
+    for (const auto& r : rectangles)
+    {
+        std::vector<uint32_t> trouves;
+        grille.RequeteRectangle(r[0], r[1], r[2], r[3], trouves);
+        Verifier(trouves.empty(), "un rectangle hors du monde rend des entités");
+        Verifier(grille.CompterRectangle(r[0], r[1], r[2], r[3]) == 0, "un rectangle hors du monde compte des entités");
+    }
+}
+
+/**
+ * @brief Entités déjà rangées par cellule : mêmes résultats que la construction ordinaire
+ */
+static void TesterTriee()
+{
+    srand(9);
+    std::vector<float> xs, ys;
+    Tirer(1500, xs, ys);
+
+    GrilleSpatiale grille;
+    grille.Configurer(1000.0f, 600.0f, 64.0f);
+
+    /* Range les positions par cellule, comme le fait le relogement en ordre de Morton */
+    std::vector<std::pair<uint32_t, size_t>> cles(xs.size());
+    for (size_t i = 0; i < xs.size(); i++)
+        cles[i] = {grille.CelluleDe(xs[i], ys[i]), i};
+    std::sort(cles.begin(), cles.end());
+
+    std::vector<float> xsTries(xs.size()), ysTries(ys.size());
+    std::vector<uint32_t> cellules(xs.size());
+    for (size_t i = 0; i < cles.size(); i++)
+    {
+        xsTries[i] = xs[cles[i].second];
+        ysTries[i] = ys[cles[i].second];
+        cellules[i] = cles[i].first;
+    }
+    grille.ConstruireTriee(cellules);
+
+    for (int essai = 0; essai < 300; essai++)
+    {
+        float x0 = static_cast<float>(rand() % 1400) - 200.0f;
+        float y0 = static_cast<float>(rand() % 1000) - 200.0f;
+        Comparer(grille, xsTries, ysTries, x0, y0, x0 + 250.0f, y0 + 250.0f);
+    }
+}
+
+int main()
+{
+    TesterRequetes();
+    TesterHorsMonde();
+    TesterTriee();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestGrilleSpatiale : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestGrilleSpatiale" << std::endl;
+    return 0;
+}
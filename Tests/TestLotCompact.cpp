@@ -0,0 +1,305 @@
+/**
+ * @file TestLotCompact.cpp
+ * @brief Codage quantifié du lot compact face à ses bornes d'erreur documentées
+ *
+ * Chaque borne annoncée dans LotCompact.h est mesurée contre un calcul en
+ * float mené en parallèle : pas de codage, dérive après une minute à 60
+ * ticks/s, direction, vitesse et délai de reproduction.
+ */
+
+#include "Population/LotCompact.h"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+static constexpr float TAILLE_CELLULE = 256.0f;         /**< Cellule de 256 px : pas de position de 1/256 px */
+static constexpr float VITESSE_MAX = 120.0f;            /**< Vitesse de la classe maximale */
+static constexpr float PAS_POSITION = TAILLE_CELLULE / 65536.0f;
+static constexpr float PAS_ENERGIE = 100.0f / 65535.0f;
+static constexpr float DT = 1.0f / 60.0f;
+static constexpr float PI = 3.14159265358979f;
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @brief Tire un réel uniforme
+ * @param min Borne basse
+ * @param max Borne haute
+ * @return Valeur dans [min, max]
+ */
+static float Tirer(float min, float max)
+{
+    return min + (max - min) * (rand() / static_cast<float>(RAND_MAX));
+}
+
+/**
+ * @brief Lot configuré sur un monde de 2048 x 2048
+ * @param lot Lot à configurer
+ */
+static void Configurer(LotCompact& lot)
+{
+    lot.Configurer(2048.0f, 2048.0f, TAILLE_CELLULE, VITESSE_MAX);
+}
+
+/**
+ * @brief Un seul codage : position et énergie à moins d'un pas
+ */
+static void TesterPas()
+{
+    srand(21);
+    LotCompact lot;
+    Configurer(lot);
+
+    float ecartX = 0.0f, ecartE = 0.0f;
+    for (int i = 0; i < 5000; i++)
+    {
+        float x = Tirer(0.0f, 2047.0f);
+        float y = Tirer(0.0f, 2047.0f);
+        float energie = Tirer(0.01f, 100.0f);
+        lot.Ajouter(x, y, 0.0f, 0.0f);
+        lot.Ecrire(i, x, y, 0.0f, 0.0f, energie);
+
+        ecartX = std::max(ecartX, std::max(std::fabs(lot.X(i) - x), std::fabs(lot.Y(i) - y)));
+        ecartE = std::max(ecartE, std::fabs(lot.Energie(i) - energie));
+    }
+    Verifier(ecartX < PAS_POSITION * 1.01f, "une position codée s'écarte de plus d'un pas");
+    Verifier(ecartE < PAS_ENERGIE * 1.01f, "une énergie codée s'écarte de plus d'un pas");
+}
+
+/**
+ * @brief Une minute de déplacement et de dépense : écart type dans la borne, sans biais
+ */
+static void TesterDerive()
+{
+    srand(23);
+    const int nbIndividus = 400;
+    const int nbTicks = 60 * 60;
+    const float depense = 0.01f;
+
+    LotCompact lot;
+    Configurer(lot);
+
+    /* Référence en float, comme le stockage ordinaire : ses arrondis sont aussi ceux du calcul du lot */
+    std::vector<float> xs(nbIndividus), ys(nbIndividus), energies(nbIndividus);
+    std::vector<float> vxs(nbIndividus), vys(nbIndividus);
+    for (int i = 0; i < nbIndividus; i++)
+    {
+        /* Près de l'origine, où l'arrondi du float est négligeable, sans atteindre un bord en une minute */
+        float angle = Tirer(0.0f, 2.0f * PI);
+        float vitesse = Tirer(0.5f, 1.0f);
+        float vx = vitesse * std::cos(angle);
+        float vy = vitesse * std::sin(angle);
+        lot.Ajouter(Tirer(100.0f, 120.0f), Tirer(100.0f, 120.0f), vx, vy);
+        lot.Ecrire(i, lot.X(i), lot.Y(i), vx, vy, Tirer(80.0f, 100.0f));
+
+        /* La référence part de l'état décodé et suit la vitesse décodée : seule la dérive du codage compte */
+        xs[i] = lot.X(i);
+        ys[i] = lot.Y(i);
+        energies[i] = lot.Energie(i);
+        lot.Vitesse(i, vxs[i], vys[i]);
+    }
+
+    bool vitesseStable = true;
+    for (int tick = 0; tick < nbTicks; tick++)
+    {
+        for (int i = 0; i < nbIndividus; i++)
+        {
+            float vx, vy;
+            lot.Vitesse(i, vx, vy);
+            vitesseStable = vitesseStable && vx == vxs[i] && vy == vys[i];
+            lot.Ecrire(i, lot.X(i) + vx * DT, lot.Y(i) + vy * DT, vx, vy, lot.Energie(i) - depense);
+
+            xs[i] += vxs[i] * DT;
+            ys[i] += vys[i] * DT;
+            energies[i] -= depense;
+        }
+    }
+    Verifier(vitesseStable, "une vitesse décodée ne se recode pas à l'identique");
+
+    double sommeX = 0.0, carresX = 0.0, sommeE = 0.0, carresE = 0.0;
+    for (int i = 0; i < nbIndividus; i++)
+    {
+        double dx = lot.X(i) - xs[i];
+        double de = lot.Energie(i) - energies[i];
+        sommeX += dx;
+        carresX += dx * dx;
+        sommeE += de;
+        carresE += de * de;
+    }
+
+    /* Bornes documentées : 0,12 px et 0,05 d'énergie d'écart type après une minute */
+    double ecartTypeX = std::sqrt(carresX / nbIndividus);
+    double ecartTypeE = std::sqrt(carresE / nbIndividus);
+    Verifier(ecartTypeX <= 0.12, "la position dérive au-delà de 0,12 px en une minute");
+    Verifier(ecartTypeE <= 0.05, "l'énergie dérive au-delà de 0,05 en une minute");
+
+    /* Sans biais : la moyenne reste à quelques écarts types de la moyenne près */
+    Verifier(std::fabs(sommeX / nbIndividus) <= 4.0 * ecartTypeX / std::sqrt(nbIndividus),
+             "la position dérive dans une direction privilégiée");
+    Verifier(std::fabs(sommeE / nbIndividus) <= 4.0 * ecartTypeE / std::sqrt(nbIndividus),
+             "l'énergie dérive dans une direction privilégiée");
+}
+
+/**
+ * @brief Direction à 0,7° près, vitesse à 0,4 % de vitesseMax près, 8 directions exactes
+ */
+static void TesterVitesse()
+{
+    srand(29);
+    LotCompact lot;
+    Configurer(lot);
+    lot.Ajouter(500.0f, 500.0f, 0.0f, 0.0f);
+
+    float ecartAngle = 0.0f, ecartNorme = 0.0f;
+    for (int essai = 0; essai < 20000; essai++)
+    {
+        float angle = Tirer(-PI, PI);
+        float vitesse = Tirer(0.05f, 1.0f) * VITESSE_MAX;
+        lot.Ecrire(0, 500.0f, 500.0f, vitesse * std::cos(angle), vitesse * std::sin(angle), 50.0f);
+
+        float vx, vy;
+        lot.Vitesse(0, vx, vy);
+        float ecart = std::fabs(std::remainder(std::atan2(vy, vx) - angle, 2.0f * PI));
+        ecartAngle = std::max(ecartAngle, ecart * 180.0f / PI);
+        ecartNorme = std::max(ecartNorme, std::fabs(std::sqrt(vx * vx + vy * vy) - vitesse));
+    }
+    Verifier(ecartAngle <= 0.71f, "une direction codée s'écarte de plus de 0,7°");
+    Verifier(ecartNorme <= 0.004f * VITESSE_MAX * 1.01f, "une vitesse codée s'écarte de plus de 0,4 % de vitesseMax");
+
+    /* Errance : les huit directions à 45° reviennent exactement */
+    bool exactes = true;
+    for (int k = 0; k < 8; k++)
+    {
+        float angle = k * PI / 4.0f;
+        float vx0 = VITESSE_MAX * std::cos(angle);
+        float vy0 = VITESSE_MAX * std::sin(angle);
+        lot.Ecrire(0, 500.0f, 500.0f, vx0, vy0, 50.0f);
+
+        float vx, vy;
+        lot.Vitesse(0, vx, vy);
+        exactes = exactes && std::fabs(vx - vx0) < 1e-3f && std::fabs(vy - vy0) < 1e-3f;
+    }
+    Verifier(exactes, "une des huit directions d'errance n'est pas exacte");
+}
+
+/**
+ * @brief Le droit à la reproduction tombe à moins de 1/16 s de l'instant exact
+ */
+static void TesterDelaiReproduction()
+{
+    const float delais[] = {2.0f, 2.03f, 7.5f};
+    float avance = 0.0f, retard = 0.0f;
+
+    for (float delai : delais)
+    {
+        /* Naissances décalées d'un tick à chaque fois, pour couvrir toutes les phases des tops */
+        for (int decalage = 0; decalage < 60; decalage++)
+        {
+            LotCompact lot;
+            Configurer(lot);
+            double temps = 0.0;
+            for (int tick = 0; tick < decalage; tick++)
+            {
+                lot.AvancerTemps(DT);
+                temps += DT;
+            }
+            lot.Ajouter(500.0f, 500.0f, 0.0f, 0.0f);
+            double naissance = temps;
+
+            /* Appelé à chaque tick, comme le fait PopulationGenerique */
+            while (!lot.PeutSeReproduire(0, 10.0f, delai))
+            {
+                lot.AvancerTemps(DT);
+                temps += DT;
+            }
+            float ecart = static_cast<float>(temps - (naissance + delai));
+            avance = std::max(avance, -ecart);
+            retard = std::max(retard, ecart);
+        }
+    }
+
+    /* La granularité du tick s'ajoute à celle des tops */
+    Verifier(avance < 1.0f / 16.0f, "le droit à la reproduction arrive plus de 1/16 s en avance");
+    Verifier(retard < 1.0f / 16.0f + DT, "le droit à la reproduction arrive plus de 1/16 s en retard");
+
+    /* Reproduire relance le délai et cède l'énergie */
+    LotCompact lot;
+    Configurer(lot);
+    lot.Ajouter(500.0f, 500.0f, 0.0f, 0.0f);
+    lot.AvancerTemps(3.0f);
+    Verifier(lot.PeutSeReproduire(0, 10.0f, 2.0f), "délai écoulé non reconnu");
+    lot.Reproduire(0, 40.0f);
+    Verifier(std::fabs(lot.Energie(0) - 60.0f) < PAS_ENERGIE * 1.01f, "Reproduire ne cède pas l'énergie demandée");
+    Verifier(!lot.PeutSeReproduire(0, 10.0f, 2.0f), "Reproduire ne relance pas le délai");
+}
+
+/**
+ * @brief Indexer trie par cellule sans changer les états, RetirerMorts garde l'ordre
+ */
+static void TesterIndexer()
+{
+    srand(31);
+    LotCompact lot;
+    Configurer(lot);
+
+    double sommeAvant = 0.0;
+    for (int i = 0; i < 3000; i++)
+    {
+        lot.Ajouter(Tirer(0.0f, 2047.0f), Tirer(0.0f, 2047.0f), 0.0f, 0.0f);
+        lot.Ecrire(i, lot.X(i), lot.Y(i), 0.0f, 0.0f, 1.0f + (i % 90));
+        sommeAvant += lot.X(i) + lot.Y(i) + lot.Energie(i);
+    }
+    lot.Indexer();
+
+    double sommeApres = 0.0;
+    bool trie = true;
+    for (size_t i = 0; i < lot.Taille(); i++)
+    {
+        sommeApres += lot.X(i) + lot.Y(i) + lot.Energie(i);
+        if (i > 0)
+            trie = trie && lot.grille.CelluleDe(lot.X(i - 1), lot.Y(i - 1)) <= lot.grille.CelluleDe(lot.X(i), lot.Y(i));
+    }
+    Verifier(trie, "Indexer ne range pas le lot par cellule");
+    Verifier(std::fabs(sommeApres - sommeAvant) < 1e-2, "Indexer sépare les attributs d'un même individu");
+
+    std::vector<uint32_t> tous;
+    lot.grille.RequeteRectangle(0.0f, 0.0f, 2048.0f, 2048.0f, tous);
+    Verifier(tous.size() == lot.Taille(), "la grille du lot ne couvre pas tous les individus");
+
+    for (size_t i = 0; i < lot.Taille(); i += 3)
+        lot.Tuer(i);
+    size_t vivants = lot.Taille() - (lot.Taille() + 2) / 3;
+    lot.RetirerMorts();
+    Verifier(lot.Taille() == vivants, "RetirerMorts garde des morts ou perd des vivants");
+}
+
+int main()
+{
+    TesterPas();
+    TesterDerive();
+    TesterVitesse();
+    TesterDelaiReproduction();
+    TesterIndexer();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestLotCompact : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestLotCompact" << std::endl;
+    return 0;
+}
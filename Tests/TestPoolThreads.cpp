@@ -0,0 +1,197 @@
+/**
+ * @file TestPoolThreads.cpp
+ * @brief Boucles parallèles, vol de travail et dépendances du système de tâches
+ *
+ * Lancé par test.py avec AddressSanitizer : une tâche recyclée pendant
+ * qu'une poignée la désigne encore y apparaît comme une lecture invalide.
+ */
+
+#include "Core/PoolThreads.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @brief Chaque indice traité une fois et une seule, quel que soit le grain
+ */
+static void TesterCouverture()
+{
+    PoolThreads pool(4);
+    const int grains[] = {1, 3, 64, 5000};
+
+    for (int grain : grains)
+    {
+        std::vector<std::atomic<int>> passages(3000);
+        for (auto& passage : passages)
+            passage = 0;
+
+        pool.Pour(0, 3000, grain, [&](int debut, int fin) {
+            for (int i = debut; i < fin; i++)
+                passages[i]++;
+        });
+
+        bool unique = true;
+        for (auto& passage : passages)
+            unique = unique && passage == 1;
+        Verifier(unique, "un indice est traité zéro ou plusieurs fois");
+    }
+
+    /* Intervalle vide : le corps n'est pas appelé */
+    bool appele = false;
+    pool.Pour(5, 5, 1, [&](int, int) { appele = true; });
+    Verifier(!appele, "une boucle vide appelle son corps");
+}
+
+/**
+ * @brief Les morceaux posés par l'appelant sont volés par les travailleurs
+ */
+static void TesterVol()
+{
+    PoolThreads pool(4);
+    std::mutex mutex;
+    std::set<std::thread::id> executants;
+
+    pool.Pour(0, 64, 1, [&](int, int) {
+        {
+            std::lock_guard<std::mutex> verrou(mutex);
+            executants.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+
+    Verifier(executants.size() > 1, "aucun morceau n'a été volé par un travailleur");
+}
+
+/**
+ * @brief Boucle imbriquée dans un morceau : les travailleurs volent aussi entre eux
+ */
+static void TesterImbrication()
+{
+    PoolThreads pool(4);
+    std::atomic<int> total(0);
+
+    pool.Pour(0, 8, 1, [&](int, int) {
+        pool.Pour(0, 100, 4, [&](int debut, int fin) { total += fin - debut; });
+    });
+    Verifier(total == 800, "une boucle imbriquée perd ou répète des indices");
+}
+
+/**
+ * @brief Un travailleur retenu par une longue tâche ne bloque pas la fin d'une boucle
+ */
+static void TesterTacheLongue()
+{
+    PoolThreads pool(2);
+    std::atomic<bool> relache(false);
+    std::atomic<bool> faite(false);
+
+    PoolThreads::Tache* longue = pool.Lancer([&] {
+        while (!relache)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        faite = true;
+    });
+
+    std::atomic<int> total(0);
+    pool.Pour(0, 1000, 10, [&](int debut, int fin) { total += fin - debut; });
+    Verifier(total == 1000, "la boucle ne finit pas pendant la longue tâche");
+
+    relache = true;
+    pool.Attendre(longue);
+    Verifier(faite, "Attendre rend la main avant la fin de la tâche");
+}
+
+/**
+ * @brief Prérequis en losange : chaque tâche voit le travail de ses prérequis
+ */
+static void TesterDependances()
+{
+    PoolThreads pool(4);
+
+    for (int essai = 0; essai < 200; essai++)
+    {
+        std::atomic<int> a(0), b(0), c(0);
+        int d = -1;
+
+        PoolThreads::Tache* ta = pool.Lancer([&] { a = 1; });
+        PoolThreads::Tache* tb = pool.Lancer([&] { b = a + 1; }, {ta});
+        PoolThreads::Tache* tc = pool.Lancer([&] { c = a + 2; }, {ta, nullptr});
+        PoolThreads::Tache* td = pool.Lancer([&] { d = b + c; }, {tb, tc});
+        pool.Liberer(ta);
+        pool.Liberer(tb);
+        pool.Liberer(tc);
+        pool.Attendre(td);
+
+        if (d != 5)
+        {
+            Verifier(false, "une tâche s'exécute avant ses prérequis");
+            return;
+        }
+    }
+
+    /* Attendre depuis une tâche : le thread aide au lieu de se bloquer */
+    std::atomic<int> interieur(0);
+    PoolThreads::Tache* externe = pool.Lancer([&] {
+        PoolThreads::Tache* enfant = pool.Lancer([&] { interieur = 7; });
+        pool.Attendre(enfant);
+        interieur += 1;
+    });
+    pool.Attendre(externe);
+    Verifier(interieur == 8, "Attendre depuis une tâche ne voit pas la tâche enfant finie");
+}
+
+/**
+ * @brief Sans thread de travail, tout s'exécute sur l'appelant
+ */
+static void TesterSansTravailleur()
+{
+    PoolThreads pool(1);
+    Verifier(pool.GetNombreThreads() == 1, "nombre de threads faux");
+
+    int total = 0;
+    pool.Pour(0, 100, 7, [&](int debut, int fin) { total += fin - debut; });
+    Verifier(total == 100, "boucle incomplète sans travailleur");
+
+    int valeur = 0;
+    PoolThreads::Tache* tache = pool.Lancer([&] { valeur = 3; });
+    PoolThreads::Tache* suite = pool.Lancer([&] { valeur *= 2; }, {tache});
+    pool.Attendre(tache);
+    pool.Attendre(suite);
+    Verifier(valeur == 6, "tâches mal enchaînées sans travailleur");
+}
+
+int main()
+{
+    TesterCouverture();
+    TesterVol();
+    TesterImbrication();
+    TesterTacheLongue();
+    TesterDependances();
+    TesterSansTravailleur();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestPoolThreads : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestPoolThreads" << std::endl;
+    return 0;
+}
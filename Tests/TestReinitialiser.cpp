@@ -0,0 +1,187 @@
+/**
+ * @file TestReinitialiser.cpp
+ * @brief Écosystème relancé sur place face à un écosystème neuf de même graine
+ *
+ * Reinitialiser promet la suite exacte d'un écosystème neuf réglé de la même
+ * façon. Pour chaque combinaison de modes, un écosystème déjà usé est relancé,
+ * un autre est construit : après quelques centaines de ticks, chaque proie,
+ * prédateur et plante doit être au même endroit, avec la même énergie.
+ */
+
+#include "Core/PoolThreads.h"
+#include "Population/Ecosysteme.h"
+#include "Population/PopulationGenerique.h"
+#include "Population/Predateur.h"
+#include "Population/Proie.h"
+#include "Population/RegistreEspeces.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+static constexpr float LARGEUR = 2000.0f;      /**< Largeur du monde */
+static constexpr float HAUTEUR = 2000.0f;      /**< Hauteur du monde */
+static constexpr int TICKS = 300;              /**< Ticks simulés avant comparaison */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const std::string& message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @struct Reglage
+ * @brief Modes activés, dans l'ordre de SimulationSansAffichage
+ */
+struct Reglage
+{
+    const char* nom;            /**< Nom affiché en cas d'échec */
+    int tuiles;                 /**< Threads de la mise à jour par tuiles (0 : séquentielle) */
+    bool sommeil;               /**< Planificateur de sommeil */
+    bool suivi;                 /**< Suivi des cibles */
+    bool collisions;            /**< Détecteur de collisions */
+    bool voisins;               /**< Listes de voisins */
+    bool champ;                 /**< Végétation continue */
+    bool flux;                  /**< Carte de la nourriture */
+    bool tri;                   /**< Relogement en ordre de Morton */
+    bool especes;               /**< Espèces de Aerien.cfg, stockage compact */
+    size_t budget;              /**< Plafond d'animaux (0 : aucun) */
+};
+
+/**
+ * @brief Active les modes d'un réglage
+ * @param eco Écosystème tout juste construit
+ * @param reglage Modes voulus
+ * @param registre Espèces chargées (doit survivre à l'écosystème)
+ */
+static void Regler(Ecosysteme& eco, const Reglage& reglage, const RegistreEspeces& registre)
+{
+    eco.SetDelaiPlantes(5.0f);
+    if (reglage.tuiles)
+        Verifier(eco.ActiverParallelisme(reglage.tuiles), std::string(reglage.nom) + " : tuiles refusées");
+    eco.ActiverSommeil(reglage.sommeil);
+    eco.ActiverSuivi(reglage.suivi);
+    if (reglage.collisions)
+        Verifier(eco.ActiverCollisions(true), std::string(reglage.nom) + " : collisions refusées");
+    if (reglage.voisins)
+        Verifier(eco.ActiverListesVoisins(true), std::string(reglage.nom) + " : listes de voisins refusées");
+    if (reglage.champ)
+        Verifier(eco.ActiverChampVegetation(true), std::string(reglage.nom) + " : champ refusé");
+    if (reglage.flux)
+        Verifier(eco.ActiverCarteNourriture(true), std::string(reglage.nom) + " : carte refusée");
+    if (reglage.tri)
+        Verifier(eco.ActiverTriSpatial(true), std::string(reglage.nom) + " : tri spatial refusé");
+    if (reglage.especes)
+        eco.ChargerEspeces(registre, true);
+    eco.DefinirBudget(reglage.budget, 0, BUDGET_CAPACITE);
+}
+
+/**
+ * @brief État observable d'un écosystème, dans l'ordre de ses listes
+ * @param eco Écosystème observé
+ * @return Positions, énergies et délais des animaux, positions des plantes, effectifs
+ */
+static std::vector<float> Releve(const Ecosysteme& eco)
+{
+    std::vector<float> valeurs;
+    for (const Proie* proie : eco.GetProies())
+        valeurs.insert(valeurs.end(), {proie->GetX(), proie->GetY(), proie->GetEnergie(),
+                                       proie->GetTempsDepuisReproduction(eco.GetMonde())});
+    for (const Predateur* pred : eco.GetPredateurs())
+        valeurs.insert(valeurs.end(), {pred->GetX(), pred->GetY(), pred->GetEnergie(),
+                                       pred->GetTempsDepuisReproduction(eco.GetMonde())});
+    for (const Plante* plante : eco.GetPlantes())
+        valeurs.insert(valeurs.end(), {plante->GetX(), plante->GetY()});
+
+    valeurs.push_back(static_cast<float>(eco.GetNombreEndormis()));
+    valeurs.push_back(static_cast<float>(eco.GetTotalPlantesConsommees()));
+    if (const PopulationGenerique* especes = eco.GetEspeces())
+    {
+        for (int e = 0; e < especes->GetRegistre().GetNombreEspeces(); e++)
+        {
+            valeurs.push_back(static_cast<float>(especes->GetNombre(e)));
+            for (size_t i = 0; i < especes->GetNombre(e); i++)
+            {
+                float x, y;
+                especes->GetPosition(e, i, x, y);
+                valeurs.insert(valeurs.end(), {x, y});
+            }
+        }
+    }
+    return valeurs;
+}
+
+/**
+ * @brief Un écosystème usé puis relancé suit exactement un écosystème neuf
+ * @param reglage Modes activés dans les deux
+ * @param taches Système de tâches prêté aux deux
+ * @param registre Espèces du fichier
+ */
+static void Comparer(const Reglage& reglage, PoolThreads& taches, const RegistreEspeces& registre)
+{
+    const unsigned int graine = 5;
+    const int proies = 500, predateurs = 50, plantes = 300;
+
+    /* Usé : autre graine, autres effectifs, morts et naissances déjà passés par ses réserves */
+    srand(1);
+    Ecosysteme relance(800, 80, 400, LARGEUR, HAUTEUR, RepartitionInitiale(), &taches);
+    Regler(relance, reglage, registre);
+    for (int tick = 0; tick < TICKS; tick++)
+        relance.Update(1.0f / 60.0f);
+    Verifier(relance.Reinitialiser(proies, predateurs, plantes, graine),
+             std::string(reglage.nom) + " : Reinitialiser refusé");
+    std::vector<float> peuplementRelance = Releve(relance);
+
+    /* L'un après l'autre : les espèces du registre tirent dans rand(), commun aux deux */
+    for (int tick = 0; tick < TICKS; tick++)
+        relance.Update(1.0f / 60.0f);
+
+    srand(graine);
+    Ecosysteme neuf(proies, predateurs, plantes, LARGEUR, HAUTEUR, RepartitionInitiale(), &taches);
+    Regler(neuf, reglage, registre);
+    Verifier(peuplementRelance == Releve(neuf), std::string(reglage.nom) + " : peuplement différent après Reinitialiser");
+
+    for (int tick = 0; tick < TICKS; tick++)
+        neuf.Update(1.0f / 60.0f);
+    Verifier(Releve(relance) == Releve(neuf), std::string(reglage.nom) + " : la suite diffère d'un écosystème neuf");
+    Verifier(neuf.GetNombreProies() > 0 && neuf.GetNombrePredateurs() > 0,
+             std::string(reglage.nom) + " : scénario sans survivants");
+}
+
+int main()
+{
+    PoolThreads taches(4);
+    RegistreEspeces registre;
+    Verifier(registre.Charger("Assets/Config/Aerien.cfg"), "Aerien.cfg introuvable (lancer depuis la racine du dépôt)");
+
+    /*                 nom                      tuiles sommeil suivi  collis. voisins champ  flux   tri    especes budget */
+    const Reglage reglages[] = {
+        {"séquentiel",                          0,     false,  false, false,  false,  false, false, false, false,  0},
+        {"sommeil et suivi",                    0,     true,   true,  false,  false,  false, false, false, false,  0},
+        {"collisions, tri spatial et suivi",    0,     false,  true,  true,   false,  false, false, true,  false,  0},
+        {"listes de voisins",                   0,     false,  false, false,  true,   false, false, false, false,  0},
+        {"carte de la nourriture",              0,     false,  false, false,  false,  false, true,  false, false,  0},
+        {"champ de végétation",                 0,     false,  false, false,  false,  true,  false, false, false,  0},
+        {"tuiles et collisions",                4,     false,  false, true,   false,  false, false, false, false,  0},
+        {"espèces compactes et budget",         0,     false,  false, false,  false,  false, false, false, true,   700},
+    };
+    for (const Reglage& reglage : reglages)
+        Comparer(reglage, taches, registre);
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestReinitialiser : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestReinitialiser" << std::endl;
+    return 0;
+}
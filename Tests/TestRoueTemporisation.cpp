@@ -0,0 +1,206 @@
+/**
+ * @file TestRoueTemporisation.cpp
+ * @brief Échéances de la roue de temporisation à travers ses niveaux
+ *
+ * Avec une résolution d'une seconde, une minuterie armée pour d secondes
+ * doit échoir au d-ième tick exactement, qu'elle ait été rangée au niveau 0
+ * ou redescendue d'un niveau supérieur ; une minuterie désarmée jamais.
+ */
+
+#include "Core/RoueTemporisation.h"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @brief Fait avancer la roue tick par tick et note le tick d'échéance de chaque minuterie
+ * @param roue Roue d'une seconde par tick
+ * @param nbTicks Ticks à parcourir
+ * @param ticksEchus Tick d'échéance par indice (la cible porte l'indice), -1 si jamais échue
+ */
+static void Parcourir(RoueTemporisation& roue, int nbTicks, std::vector<long>& ticksEchus)
+{
+    std::vector<Minuterie*> echues;
+    for (long tick = 1; tick <= nbTicks; tick++)
+    {
+        roue.Avancer(1.0f, echues);
+        for (Minuterie* echue : echues)
+        {
+            size_t indice = reinterpret_cast<size_t>(echue->cible);
+            Verifier(ticksEchus[indice] < 0, "une minuterie échoit deux fois");
+            ticksEchus[indice] = tick;
+        }
+    }
+}
+
+/**
+ * @brief Délais répartis sur les quatre niveaux, bornes de chaque niveau comprises
+ */
+static void TesterCascade()
+{
+    const long delais[] = {
+        1, 2, 255, 256, 257,                /* niveau 0 et sa borne */
+        300, 4095, 16383, 16384, 16385,     /* niveau 1 et sa borne */
+        20000, 1048575, 1048576,            /* niveau 2 et sa borne */
+        1048577, 1500000,                   /* niveau 3 */
+    };
+    const size_t nombre = sizeof(delais) / sizeof(delais[0]);
+
+    RoueTemporisation roue(1.0f);
+    std::vector<Minuterie> minuteries(nombre);
+    for (size_t i = 0; i < nombre; i++)
+        roue.Armer(minuteries[i], static_cast<float>(delais[i]), 0, reinterpret_cast<void*>(i));
+    Verifier(roue.GetNombreArmees() == static_cast<int>(nombre), "minuteries armées mal comptées");
+
+    std::vector<long> ticksEchus(nombre, -1);
+    Parcourir(roue, 1500001, ticksEchus);
+
+    for (size_t i = 0; i < nombre; i++)
+    {
+        if (ticksEchus[i] != delais[i])
+        {
+            std::cerr << "   délai " << delais[i] << " : échue au tick " << ticksEchus[i] << std::endl;
+            Verifier(false, "une minuterie n'échoit pas au tick de son délai");
+        }
+    }
+    Verifier(roue.GetNombreArmees() == 0, "des minuteries restent armées après leur échéance");
+}
+
+/**
+ * @brief Armement en cours de route : l'échéance se compte depuis le temps de la roue
+ */
+static void TesterArmementTardif()
+{
+    RoueTemporisation roue(1.0f);
+    std::vector<Minuterie*> echues;
+    for (int tick = 0; tick < 1000; tick++)
+        roue.Avancer(1.0f, echues);
+
+    /* Juste avant un tour du niveau 0, pour que la cascade suive aussitôt */
+    const long delais[] = {23, 24, 25, 5000, 70000};
+    const size_t nombre = sizeof(delais) / sizeof(delais[0]);
+    std::vector<Minuterie> minuteries(nombre);
+    for (size_t i = 0; i < nombre; i++)
+        roue.Armer(minuteries[i], static_cast<float>(delais[i]), 0, reinterpret_cast<void*>(i));
+
+    std::vector<long> ticksEchus(nombre, -1);
+    Parcourir(roue, 70001, ticksEchus);
+    for (size_t i = 0; i < nombre; i++)
+        Verifier(ticksEchus[i] == delais[i], "une minuterie armée tard n'échoit pas à son délai");
+}
+
+/**
+ * @brief Désarmement, réarmement et destruction d'une minuterie armée, à tous les niveaux
+ */
+static void TesterAnnulation()
+{
+    srand(17);
+    const size_t nombre = 600;
+
+    RoueTemporisation roue(1.0f);
+    std::vector<Minuterie> minuteries(nombre);
+    std::vector<long> delais(nombre);
+    for (size_t i = 0; i < nombre; i++)
+    {
+        /* Un tiers par niveau 0, 1 et 2 */
+        const long portees[] = {256, 16384, 200000};
+        delais[i] = 1 + rand() % portees[i % 3];
+        roue.Armer(minuteries[i], static_cast<float>(delais[i]), 0, reinterpret_cast<void*>(i));
+    }
+
+    /* Une sur quatre désarmée tout de suite */
+    for (size_t i = 0; i < nombre; i += 4)
+    {
+        roue.Desarmer(minuteries[i]);
+        roue.Desarmer(minuteries[i]);   /* sans effet la seconde fois */
+        delais[i] = -1;
+    }
+    Verifier(roue.GetNombreArmees() == static_cast<int>(nombre - nombre / 4), "désarmement mal compté");
+
+    /* Une sur quatre réarmée : seule la nouvelle échéance compte */
+    for (size_t i = 1; i < nombre; i += 4)
+    {
+        delais[i] = 1 + rand() % 50000;
+        roue.Armer(minuteries[i], static_cast<float>(delais[i]), 0, reinterpret_cast<void*>(i));
+    }
+
+    /* Après 300 ticks (une cascade passée), une sur quatre est détruite encore armée */
+    std::vector<long> ticksEchus(nombre, -1);
+    Parcourir(roue, 300, ticksEchus);
+    for (size_t i = 2; i < nombre; i += 4)
+    {
+        if (delais[i] > 300)
+        {
+            minuteries[i].~Minuterie();
+            new (&minuteries[i]) Minuterie();
+            delais[i] = -1;
+        }
+    }
+
+    std::vector<long> suite(nombre, -1);
+    Parcourir(roue, 200001, suite);
+    for (size_t i = 0; i < nombre; i++)
+    {
+        long echeance = ticksEchus[i] >= 0 ? ticksEchus[i] : (suite[i] >= 0 ? suite[i] + 300 : -1);
+        if (echeance != delais[i])
+        {
+            std::cerr << "   minuterie " << i << " : attendue " << delais[i] << ", échue " << echeance << std::endl;
+            Verifier(false, "une minuterie annulée échoit, ou une autre rate son échéance");
+        }
+    }
+    Verifier(roue.GetNombreArmees() == 0, "des minuteries restent armées");
+}
+
+/**
+ * @brief Reinitialiser détache les minuteries et remet le temps à zéro
+ */
+static void TesterReinitialiser()
+{
+    RoueTemporisation roue(1.0f);
+    Minuterie avant, apres;
+    roue.Armer(avant, 10.0f, 0, nullptr);
+
+    std::vector<Minuterie*> echues;
+    roue.Avancer(5.0f, echues);
+    roue.Reinitialiser();
+    Verifier(!avant.EstArmee(), "une minuterie reste armée après Reinitialiser");
+    Verifier(roue.GetTemps() == 0.0, "le temps ne repart pas de zéro");
+
+    roue.Armer(apres, 3.0f, 0, nullptr);
+    roue.Avancer(2.0f, echues);
+    Verifier(echues.empty(), "une échéance tombe trop tôt après Reinitialiser");
+    roue.Avancer(1.0f, echues);
+    Verifier(echues.size() == 1 && echues[0] == &apres, "l'échéance manque après Reinitialiser");
+}
+
+int main()
+{
+    TesterCascade();
+    TesterArmementTardif();
+    TesterAnnulation();
+    TesterReinitialiser();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestRoueTemporisation : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestRoueTemporisation" << std::endl;
+    return 0;
+}
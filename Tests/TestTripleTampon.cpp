@@ -0,0 +1,141 @@
+/**
+ * @file TestTripleTampon.cpp
+ * @brief Passage de publications entre un producteur et un consommateur
+ *
+ * Le consommateur ne doit voir que des publications complètes, de plus en
+ * plus récentes, et jamais l'exemplaire que le producteur remplit.
+ */
+
+#include "Core/TripleTampon.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static int sEchecs = 0;     /**< Vérifications échouées */
+
+/**
+ * @brief Compte et signale une vérification échouée
+ * @param condition Résultat attendu vrai
+ * @param message Description affichée en cas d'échec
+ */
+static void Verifier(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "❌ " << message << std::endl;
+    sEchecs++;
+}
+
+/**
+ * @struct Publication
+ * @brief Valeur échangée : un numéro recopié dans tout un tableau
+ */
+struct Publication
+{
+    int numero = 0;                 /**< Numéro de la publication */
+    std::vector<int> copies;        /**< Le numéro, recopié : une lecture déchirée y mêle deux numéros */
+};
+
+/**
+ * @brief Remplit l'exemplaire du producteur
+ * @param publication Exemplaire à remplir
+ * @param numero Numéro de la publication
+ */
+static void Remplir(Publication& publication, int numero)
+{
+    publication.numero = numero;
+    publication.copies.assign(256, numero);
+}
+
+/**
+ * @brief Vérifie qu'une publication lue est entière
+ * @param publication Exemplaire lu
+ * @return true si toutes les copies portent le numéro
+ */
+static bool Entiere(const Publication& publication)
+{
+    for (int copie : publication.copies)
+        if (copie != publication.numero)
+            return false;
+    return true;
+}
+
+/**
+ * @brief Un seul thread : Lire ne rend que du nouveau, et la plus récente publication
+ */
+static void TesterSequence()
+{
+    TripleTampon<Publication> tampon;
+    Verifier(!tampon.Lire(), "Lire trouve une publication avant tout Publier");
+
+    Remplir(tampon.Ecriture(), 1);
+    tampon.Publier();
+    Verifier(&tampon.Ecriture() != &tampon.Lecture(), "producteur et consommateur partagent un exemplaire");
+    Verifier(tampon.Lire() && tampon.Lecture().numero == 1, "la première publication n'est pas lue");
+    Verifier(!tampon.Lire(), "Lire rend deux fois la même publication");
+    Verifier(tampon.Lecture().numero == 1, "Lire sans nouveauté change l'exemplaire lu");
+
+    /* Deux publications sans lecture : la plus ancienne est écrasée */
+    Remplir(tampon.Ecriture(), 2);
+    tampon.Publier();
+    Remplir(tampon.Ecriture(), 3);
+    tampon.Publier();
+    Verifier(&tampon.Ecriture() != &tampon.Lecture(), "producteur et consommateur partagent un exemplaire");
+    Verifier(tampon.Lecture().numero == 1, "publier change l'exemplaire du consommateur");
+    Verifier(tampon.Lire() && tampon.Lecture().numero == 3, "Lire ne rend pas la plus récente publication");
+    Verifier(!tampon.Lire(), "une publication écrasée reste lisible");
+}
+
+/**
+ * @brief Producteur et consommateur sur deux threads, sans attente de part et d'autre
+ */
+static void TesterDeuxThreads()
+{
+    const int nbPublications = 20000;
+    TripleTampon<Publication> tampon;
+
+    std::thread producteur([&] {
+        for (int numero = 1; numero <= nbPublications; numero++)
+        {
+            Remplir(tampon.Ecriture(), numero);
+            tampon.Publier();
+        }
+    });
+
+    int dernier = 0;
+    int lectures = 0;
+    bool croissant = true;
+    bool entieres = true;
+    while (dernier < nbPublications)
+    {
+        if (!tampon.Lire())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const Publication& lue = tampon.Lecture();
+        croissant = croissant && lue.numero > dernier;
+        entieres = entieres && Entiere(lue);
+        dernier = lue.numero;
+        lectures++;
+    }
+    producteur.join();
+
+    Verifier(croissant, "une publication lue est plus ancienne que la précédente");
+    Verifier(entieres, "une publication est lue pendant qu'elle est écrite");
+    Verifier(lectures > 0 && dernier == nbPublications, "la dernière publication n'est pas lue");
+}
+
+int main()
+{
+    TesterSequence();
+    TesterDeuxThreads();
+
+    if (sEchecs)
+    {
+        std::cerr << "❌ TestTripleTampon : " << sEchecs << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "✅ TestTripleTampon" << std::endl;
+    return 0;
+}
@@ -1,47 +1,82 @@
-import os
-import subprocess
-from pathlib import Path
-
-# Configuration
-SDL3_DIR = "Externals/SDL3"
-SRC_FILES = [
-    "Src/UI/GUI.cpp",
-    "Src/Graphics/Renderer.cpp",
-    "Src/Core/Main.cpp",
-    "Src/Population/Animal.cpp",
-    "Src/Population/Proie.cpp", 
-    "Src/Population/Plante.cpp",
-    "Src/Population/Predateur.cpp",
-    "Src/Population/Ecosysteme.cpp",
-    "Externals/imgui/imgui.cpp",
-    "Externals/imgui/imgui_draw.cpp",
-    "Externals/imgui/imgui_tables.cpp",
-    "Externals/imgui/imgui_widgets.cpp",
-    "Externals/imgui/backends/imgui_impl_sdl3.cpp",
-    "Externals/imgui/backends/imgui_impl_sdlrenderer3.cpp",
-]
-
-OUTPUT = "Build/simulation.exe"
-
-# Créer le dossier build
-Path("Build").mkdir(exist_ok=True)
-
-# Compiler
-cmd = [
-    "clang++",
-    "-std=c++17",
-    "-IExternals/SDL3/include",
-    "-ISrc",
-    "-IExternals/imgui",
-    "-IExternals/imgui/backends",
-    "-L" + SDL3_DIR + "/lib",
-    "-o", OUTPUT
-] + SRC_FILES + ["-lSDL3", "-lSDL3_image"]
-
-print("Compilation...")
-result = subprocess.run(cmd)
-
-if result.returncode == 0:
-    print("✅ Succès !")
-else:
+import os
+import subprocess
+from pathlib import Path
+
+# Configuration
+SDL3_DIR = "Externals/SDL3"
+SRC_FILES = [
+    "Src/UI/GUI.cpp",
+    "Src/Graphics/Renderer.cpp",
+    "Src/Graphics/Camera.cpp",
+    "Src/Graphics/CarteDensite.cpp",
+    "Src/Graphics/Enregistreur.cpp",
+    "Src/Core/ArenaFrame.cpp",
+    "Src/Core/ComptableMemoire.cpp",
+    "Src/Core/Main.cpp",
+    "Src/Core/PoolThreads.cpp",
+    "Src/Core/RoueTemporisation.cpp",
+    "Src/Core/OptionsLancement.cpp",
+    "Src/Core/SimulationSansAffichage.cpp",
+    "Src/Core/ThreadSimulation.cpp",
+    "Src/Core/Traceur.cpp",
+    "Src/Distribue/MemoirePartagee.cpp",
+    "Src/Distribue/BarriereProcessus.cpp",
+    "Src/Distribue/TransportMemoirePartagee.cpp",
+    "Src/Distribue/TransportSocket.cpp",
+    "Src/Distribue/SimulationDistribuee.cpp",
+    "Src/Population/Animal.cpp",
+    "Src/Population/AnnexesAnimaux.cpp",
+    "Src/Population/Proie.cpp", 
+    "Src/Population/Plante.cpp",
+    "Src/Population/Predateur.cpp",
+    "Src/Population/Ecosysteme.cpp",
+    "Src/Population/DecompositionSpatiale.cpp",
+    "Src/Population/DetecteurCollisions.cpp",
+    "Src/Population/GrilleSpatiale.cpp",
+    "Src/Population/ListesVoisins.cpp",
+    "Src/Population/CarteNourriture.cpp",
+    "Src/Population/BudgetPopulation.cpp",
+    "Src/Population/LotCompact.cpp",
+    "Src/Population/RepartitionInitiale.cpp",
+    "Src/Population/RegistreEspeces.cpp",
+    "Src/Population/PopulationGenerique.cpp",
+    "Src/Population/PlanificateurSommeil.cpp",
+    "Src/Population/ChampVegetation.cpp",
+    "Src/Population/ModeleChampMoyen.cpp",
+    "Src/Population/InstantaneRendu.cpp",
+    "Externals/imgui/imgui.cpp",
+    "Externals/imgui/imgui_draw.cpp",
+    "Externals/imgui/imgui_tables.cpp",
+    "Externals/imgui/imgui_widgets.cpp",
+    "Externals/imgui/backends/imgui_impl_sdl3.cpp",
+    "Externals/imgui/backends/imgui_impl_sdlrenderer3.cpp",
+]
+
+OUTPUT = "Build/simulation.exe"
+
+# Créer le dossier build
+Path("Build").mkdir(exist_ok=True)
+
+# Compiler
+cmd = [
+    "clang++",
+    "-std=c++17",
+    "-IExternals/SDL3/include",
+    "-ISrc",
+    "-IExternals/imgui",
+    "-IExternals/imgui/backends",
+    "-L" + SDL3_DIR + "/lib",
+    "-o", OUTPUT
+] + SRC_FILES + ["-lSDL3", "-lSDL3_image"]
+
+# std::thread a besoin de pthread hors Windows
+if os.name != "nt":
+    cmd.append("-pthread")
+
+print("Compilation...")
+result = subprocess.run(cmd)
+
+if result.returncode == 0:
+    print("✅ Succès !")
+else:
     print("❌ Erreur")
\ No newline at end of file
@@ -0,0 +1,81 @@
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+# Configuration
+SDL3_DIR = "Externals/SDL3"
+SRC_FILES = [
+    "Src/Core/ArenaFrame.cpp",
+    "Src/Core/ComptableMemoire.cpp",
+    "Src/Core/PoolThreads.cpp",
+    "Src/Core/RoueTemporisation.cpp",
+    "Src/Core/Traceur.cpp",
+    "Src/Population/Animal.cpp",
+    "Src/Population/AnnexesAnimaux.cpp",
+    "Src/Population/Proie.cpp",
+    "Src/Population/Plante.cpp",
+    "Src/Population/Predateur.cpp",
+    "Src/Population/Ecosysteme.cpp",
+    "Src/Population/DecompositionSpatiale.cpp",
+    "Src/Population/DetecteurCollisions.cpp",
+    "Src/Population/GrilleSpatiale.cpp",
+    "Src/Population/ListesVoisins.cpp",
+    "Src/Population/CarteNourriture.cpp",
+    "Src/Population/BudgetPopulation.cpp",
+    "Src/Population/LotCompact.cpp",
+    "Src/Population/RepartitionInitiale.cpp",
+    "Src/Population/RegistreEspeces.cpp",
+    "Src/Population/PopulationGenerique.cpp",
+    "Src/Population/PlanificateurSommeil.cpp",
+    "Src/Population/ChampVegetation.cpp",
+    "Src/Population/ModeleChampMoyen.cpp",
+    "Src/Population/InstantaneRendu.cpp",
+]
+
+# Un exécutable par fichier de Tests/, compilé avec AddressSanitizer
+TESTS = [
+    "Tests/TestCollisions.cpp",
+    "Tests/TestGrilleSpatiale.cpp",
+    "Tests/TestRoueTemporisation.cpp",
+    "Tests/TestPoolThreads.cpp",
+    "Tests/TestTripleTampon.cpp",
+    "Tests/TestLotCompact.cpp",
+    "Tests/TestReinitialiser.cpp",
+]
+
+Path("Build").mkdir(exist_ok=True)
+
+echecs = 0
+for test in TESTS:
+    output = "Build/" + Path(test).stem + ".exe"
+    cmd = [
+        "clang++",
+        "-std=c++17",
+        "-O1",
+        "-g",
+        "-fsanitize=address,undefined",
+        "-IExternals/SDL3/include",
+        "-ISrc",
+        "-L" + SDL3_DIR + "/lib",
+        "-o", output,
+        test
+    ] + SRC_FILES + ["-lSDL3"]
+
+    if os.name != "nt":
+        cmd.append("-pthread")
+
+    print(f"Compilation de {test}...")
+    if subprocess.run(cmd).returncode != 0:
+        print("❌ Erreur de compilation")
+        echecs += 1
+        continue
+
+    if subprocess.run([output]).returncode != 0:
+        echecs += 1
+
+if echecs == 0:
+    print("✅ Tous les tests passent")
+else:
+    print(f"❌ {echecs} test(s) en échec")
+sys.exit(1 if echecs else 0)